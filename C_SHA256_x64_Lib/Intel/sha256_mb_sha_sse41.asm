@@ -0,0 +1,243 @@
+; SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+; SPDX-FileCopyrightText: Copyright(c) 2011-2017 Intel Corporation All rights reserved.
+; SPDX-License-Identifier: BSD-3-Clause
+
+%include "sha256_mb_mgr_datastruct.asm"
+%include "reg_sizes.asm"
+
+[bits 64]
+default rel
+section .text
+
+;; Multi-buffer SHA256 using the SHA extensions, 2 or 4 independent messages
+;; per call, with the same args layout as sha256_mb_x4_sse and friends.
+;; Every sha256rnds2 depends on the one before, so a single message leaves the
+;; SHA unit waiting on its latency. Here two messages go through the rounds
+;; together, their sha256rnds2 alternating one by one, so that each one hides
+;; the latency of the other. The states and the message schedules of both stay
+;; in registers: 4 words of schedule each, as in sha256_sha_sse41, and a copy of
+;; W+K each for the shared xmm0.
+;; Two streams are already as many as the SHA unit can take: a third or fourth
+;; one only waits for the same unit, and would not fit in 16 xmm registers
+;; either. So the x4 function hashes lanes 0 and 1, then lanes 2 and 3.
+
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+%ifidn __OUTPUT_FORMAT__, elf64
+ ; Linux
+ %define arg0  rdi
+ %define arg1  rsi
+%else
+ ; Windows
+ %define arg0   rcx
+ %define arg1   rdx
+%endif
+
+%define APPEND(a,b) a %+ b
+
+%define ARGS	arg0
+%define NBLK	arg1
+%define TBL	rax
+%define NCNT	r10	; blocks left in the current pair of lanes
+
+;; data pointers of the two streams
+%define DPTR0	r8
+%define DPTR1	r9
+
+%define MSG	xmm0	; W[t]+K[t], implicit operand of sha256rnds2
+
+;; ABEF and CDGH of the streams
+%define ABEF0	xmm1
+%define CDGH0	xmm2
+%define ABEF1	xmm3
+%define CDGH1	xmm4
+
+;; message schedule of each stream, the words of 4 consecutive round groups
+%define W0_0	xmm5
+%define W0_1	xmm6
+%define W0_2	xmm7
+%define W0_3	xmm8
+%define W1_0	xmm9
+%define W1_1	xmm10
+%define W1_2	xmm11
+%define W1_3	xmm12
+
+;; W+K of the round group of each stream, then scratch for the schedule
+%define T0	xmm13
+%define T1	xmm14
+%define SHUF_MASK	xmm15
+
+;; stack frame, the chaining values of both streams
+_ABEF0_SAVE	equ	0
+_CDGH0_SAVE	equ	16
+_ABEF1_SAVE	equ	32
+_CDGH1_SAVE	equ	48
+_FRAME_SIZE	equ	64 + 8	; keeps rsp 16-byte aligned
+
+;; transposed digest of lane %2 of %3 -> ABEF, CDGH of stream %1
+%macro LOAD_DIGEST 3
+%define %%S	%1
+%define %%L	%2
+%define %%N	%3
+	pinsrd	APPEND(ABEF,%%S), [ARGS + _args_digest + 4*(0*%%N + %%L)], 3	; A
+	pinsrd	APPEND(ABEF,%%S), [ARGS + _args_digest + 4*(1*%%N + %%L)], 2	; B
+	pinsrd	APPEND(CDGH,%%S), [ARGS + _args_digest + 4*(2*%%N + %%L)], 3	; C
+	pinsrd	APPEND(CDGH,%%S), [ARGS + _args_digest + 4*(3*%%N + %%L)], 2	; D
+	pinsrd	APPEND(ABEF,%%S), [ARGS + _args_digest + 4*(4*%%N + %%L)], 1	; E
+	pinsrd	APPEND(ABEF,%%S), [ARGS + _args_digest + 4*(5*%%N + %%L)], 0	; F
+	pinsrd	APPEND(CDGH,%%S), [ARGS + _args_digest + 4*(6*%%N + %%L)], 1	; G
+	pinsrd	APPEND(CDGH,%%S), [ARGS + _args_digest + 4*(7*%%N + %%L)], 0	; H
+%endmacro
+
+;; ABEF, CDGH of stream %1 -> transposed digest of lane %2 of %3
+%macro STORE_DIGEST 3
+%define %%S	%1
+%define %%L	%2
+%define %%N	%3
+	pextrd	[ARGS + _args_digest + 4*(0*%%N + %%L)], APPEND(ABEF,%%S), 3	; A
+	pextrd	[ARGS + _args_digest + 4*(1*%%N + %%L)], APPEND(ABEF,%%S), 2	; B
+	pextrd	[ARGS + _args_digest + 4*(2*%%N + %%L)], APPEND(CDGH,%%S), 3	; C
+	pextrd	[ARGS + _args_digest + 4*(3*%%N + %%L)], APPEND(CDGH,%%S), 2	; D
+	pextrd	[ARGS + _args_digest + 4*(4*%%N + %%L)], APPEND(ABEF,%%S), 1	; E
+	pextrd	[ARGS + _args_digest + 4*(5*%%N + %%L)], APPEND(ABEF,%%S), 0	; F
+	pextrd	[ARGS + _args_digest + 4*(6*%%N + %%L)], APPEND(CDGH,%%S), 1	; G
+	pextrd	[ARGS + _args_digest + 4*(7*%%N + %%L)], APPEND(CDGH,%%S), 0	; H
+%endmacro
+
+;; W+K of round group %2 of stream %1 -> T%1, the words of rounds 0-15 loaded from the message first
+%macro LOAD_WK 2
+%assign %%c (%2 % 4)
+%if %2 < 4
+	movdqu	APPEND(W%1_,%%c), [APPEND(DPTR,%1) + %2*16]
+	pshufb	APPEND(W%1_,%%c), SHUF_MASK
+%endif
+	movdqa	T%1, APPEND(W%1_,%%c)
+	paddd	T%1, [TBL + %2*16]
+%endmacro
+
+;; the 4 rounds of one group of both streams, from T0 and T1
+%macro ROUNDS4 0
+	movdqa		MSG, T0
+	sha256rnds2	CDGH0, ABEF0, MSG
+	movdqa		MSG, T1
+	sha256rnds2	CDGH1, ABEF1, MSG
+	pshufd		MSG, T0, 0x0E
+	sha256rnds2	ABEF0, CDGH0, MSG
+	pshufd		MSG, T1, 0x0E
+	sha256rnds2	ABEF1, CDGH1, MSG
+%endmacro
+
+;; message schedule of stream %1 after round group %2, as in sha256_sha_sse41:
+;; the words of group %2+1 are completed, and those of group %2+3 started
+%macro SCHEDULE 2
+%assign %%c (%2 % 4)
+%assign %%p ((%2 + 3) % 4)
+%assign %%n ((%2 + 1) % 4)
+%if %2 >= 3 && %2 <= 14
+	movdqa		T%1, APPEND(W%1_,%%c)
+	palignr		T%1, APPEND(W%1_,%%p), 4
+	paddd		APPEND(W%1_,%%n), T%1
+	sha256msg2	APPEND(W%1_,%%n), APPEND(W%1_,%%c)
+%endif
+%if %2 >= 1 && %2 <= 12
+	sha256msg1	APPEND(W%1_,%%p), APPEND(W%1_,%%c)
+%endif
+%endmacro
+
+;; NBLK blocks of lanes %2 and %2+1 of %1
+%macro HASH_PAIR 2
+%define %%N	%1
+%define %%L	%2
+	LOAD_DIGEST	0, %%L, %%N
+	LOAD_DIGEST	1, %%L+1, %%N
+	mov	DPTR0, [ARGS + _data_ptr + 8*%%L]
+	mov	DPTR1, [ARGS + _data_ptr + 8*(%%L+1)]
+	mov	NCNT, NBLK
+
+%%block_loop:
+	movdqa	[rsp + _ABEF0_SAVE], ABEF0
+	movdqa	[rsp + _CDGH0_SAVE], CDGH0
+	movdqa	[rsp + _ABEF1_SAVE], ABEF1
+	movdqa	[rsp + _CDGH1_SAVE], CDGH1
+
+%assign G 0
+%rep 16
+	LOAD_WK	0, G
+	LOAD_WK	1, G
+	ROUNDS4
+	SCHEDULE	0, G
+	SCHEDULE	1, G
+%assign G (G+1)
+%endrep
+
+	paddd	ABEF0, [rsp + _ABEF0_SAVE]
+	paddd	CDGH0, [rsp + _CDGH0_SAVE]
+	paddd	ABEF1, [rsp + _ABEF1_SAVE]
+	paddd	CDGH1, [rsp + _CDGH1_SAVE]
+	add	DPTR0, 64
+	add	DPTR1, 64
+
+	sub	NCNT, 1
+	jnz	%%block_loop
+
+	STORE_DIGEST	0, %%L, %%N
+	STORE_DIGEST	1, %%L+1, %%N
+	mov	[ARGS + _data_ptr + 8*%%L], DPTR0
+	mov	[ARGS + _data_ptr + 8*(%%L+1)], DPTR1
+%endmacro
+
+; void sha256_mb_x%1_sha_sse41(SHA256_MB_ARGS_X%1 *args, uint64_t size_in_blocks);
+; arg 0 : ARGS : pointer to args, %1 lanes, digest transposed with a row of %1 words
+; arg 1 : NBLK : size (in blocks) ;; assumed to be >= 1
+;
+; Clobbers registers: rax, r8-r10, xmm0-xmm15
+;
+%macro SHA256_MB_SHA 1
+%define %%N		%1
+
+mk_global sha256_mb_x %+ %1 %+ _sha_sse41, function, internal
+align 32
+sha256_mb_x %+ %1 %+ _sha_sse41:
+	endbranch
+	test	NBLK, NBLK
+	jz	%%return
+	sub	rsp, _FRAME_SIZE
+
+	movdqa	SHUF_MASK, [PSHUFFLE_SHANI_MASK]
+	lea	TBL, [TABLE]
+
+%assign L 0
+%rep %%N / 2
+	HASH_PAIR	%%N, L
+%assign L (L+2)
+%endrep
+
+	add	rsp, _FRAME_SIZE
+%%return:
+	ret
+%endmacro
+
+SHA256_MB_SHA 2
+SHA256_MB_SHA 4
+
+
+section .data align=16
+PSHUFFLE_SHANI_MASK:    dq 0x0405060700010203, 0x0c0d0e0f08090a0b
+TABLE:	dd	0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5
+	dd      0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5
+	dd      0xd807aa98,0x12835b01,0x243185be,0x550c7dc3
+	dd      0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174
+	dd      0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc
+	dd      0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da
+	dd      0x983e5152,0xa831c66d,0xb00327c8,0xbf597fc7
+	dd      0xc6e00bf3,0xd5a79147,0x06ca6351,0x14292967
+	dd      0x27b70a85,0x2e1b2138,0x4d2c6dfc,0x53380d13
+	dd      0x650a7354,0x766a0abb,0x81c2c92e,0x92722c85
+	dd      0xa2bfe8a1,0xa81a664b,0xc24b8b70,0xc76c51a3
+	dd      0xd192e819,0xd6990624,0xf40e3585,0x106aa070
+	dd      0x19a4c116,0x1e376c08,0x2748774c,0x34b0bcb5
+	dd      0x391c0cb3,0x4ed8aa4a,0x5b9cca4f,0x682e6ff3
+	dd      0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208
+	dd      0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
@@ -2,6 +2,9 @@
    SPDX-FileCopyrightText: Copyright(c) 2011-2016 Intel Corporation All rights reserved.
    SPDX-License-Identifier: BSD-3-Clause */
 
+#ifndef _SHA256_MB_WRAPPER_H_
+#define _SHA256_MB_WRAPPER_H_
+
 #include <stdint.h>
 #include "sha256_mb.h"
 #include "endian_helper.h"
@@ -18,13 +21,25 @@ typedef struct {
 	uint8_t* data_ptr[SHA256_MAX_LANES];
 } SHA256_MB_ARGS_X4;
 
+typedef struct {
+	uint32_t digest[8][8][2];
+	uint8_t* data_ptr[SHA256_MAX_LANES];
+} SHA256_MB_ARGS_X2;
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 	extern void sha256_mb_x16_avx512_wrapper(SHA256_MB_ARGS_X16* args_struct, uint64_t size_in_blocks);
 	extern void sha256_mb_x8_avx2_wrapper(SHA256_MB_ARGS_X8* args_struct, uint64_t size_in_blocks);
+	extern void sha256_mb_x8_avx512vl_wrapper(SHA256_MB_ARGS_X8* args_struct, uint64_t size_in_blocks);	// AVX-512 on ymm registers
 	extern void sha256_mb_x4_avx_wrapper(SHA256_MB_ARGS_X4* args_struct, uint64_t size_in_blocks);
 	extern void sha256_mb_x4_sse_wrapper(SHA256_MB_ARGS_X4* args_struct, uint64_t size_in_blocks);
+	extern void sha256_mb_x4_sha_sse41_wrapper(SHA256_MB_ARGS_X4* args_struct, uint64_t size_in_blocks);	// SHA-NI, interleaved
+	extern void sha256_mb_x2_sha_sse41_wrapper(SHA256_MB_ARGS_X2* args_struct, uint64_t size_in_blocks);	// SHA-NI, interleaved
+	// SHA-NI, lane only of an args struct of num_lanes lanes (4, 8 or 16), the other lanes are left as they are
+	extern void sha256_ni_x1_wrapper(SHA256_MB_ARGS_X16* args_struct, uint64_t size_in_blocks, uint64_t lane, uint64_t num_lanes);
 #ifdef __cplusplus
 }
-#endif
\ No newline at end of file
+#endif
+
+#endif // _SHA256_MB_WRAPPER_H_
\ No newline at end of file
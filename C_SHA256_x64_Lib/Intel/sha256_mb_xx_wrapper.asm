@@ -5,8 +5,15 @@
 
 extern sha256_mb_x16_avx512
 extern sha256_mb_x8_avx2
+extern sha256_mb_x8_avx512vl
 extern sha256_mb_x4_avx
 extern sha256_mb_x4_sse
+extern sha256_mb_x4_sha_sse41
+extern sha256_mb_x2_sha_sse41
+extern sha256_mine_x16_avx512
+extern sha256_mine_x8_avx2
+extern sha256_mine_x8_avx512vl
+extern sha256_ni_x1
 
 [bits 64]
 default rel
@@ -14,7 +21,7 @@ section .text
 
 ;; Code to save registers and align stack before calling the inner functions.
 ;; rsp not saved to stack but calculated using add and sub.
-;; Inner functions are the SHA256 functions by Intel, for SSE4, AVX, AVX2 and AVX512.
+;; Inner functions are the SHA256 functions by Intel, for SSE4, AVX, AVX2 and AVX512 (on zmm, or ymm with AVX512VL), and the interleaved SHA-NI ones.
 
 ; CALLEE SAVED REGISTERS / NON-VOLATILE REGISTERS BY ABI (WINDOWS & LINUX)
 ; https://docs.microsoft.com/en-us/cpp/build/x64-calling-convention?view=msvc-160#callercallee-saved-registers
@@ -34,7 +41,22 @@ _XMM_SAVE       equ 0
 _GPR_SAVE       equ _XMM_SAVE + _XMM_SAVE_SIZE
 STACK_SPACE     equ _GPR_SAVE + _GPR_SAVE_SIZE + _ALIGN_SIZE
 
-%imacro WRAP_FUNC 2
+;; sha256_ni_x1 also takes the lane to hash and the lane count of the args struct, packed in r10 as (lanes*4 << 8) | lane,
+;; which its wrapper gets as the two arguments after size_in_blocks
+%imacro SET_NI_X1_LANE 0
+	%ifidn __OUTPUT_FORMAT__, win64
+		lea     r10, [r9*4]
+		shl     r10, 8
+		or      r10, r8
+	%else
+		lea     r10, [rcx*4]
+		shl     r10, 8
+		or      r10, rdx
+	%endif
+%endmacro
+
+; the optional third parameter sets up the registers an inner function takes besides its arguments
+%imacro WRAP_FUNC 2-3
 
 	mk_global %1_wrapper, function, internal
 	global %1_wrapper
@@ -62,6 +84,7 @@ STACK_SPACE     equ _GPR_SAVE + _GPR_SAVE_SIZE + _ALIGN_SIZE
 		vmovdqa  [rsp + _XMM_SAVE + 16*8], xmm14
 		vmovdqa  [rsp + _XMM_SAVE + 16*9], xmm15
 	%endif
+		%3
 
 	; Linux need position independent code but win64 won't accept plt
 	%ifdef __NASM_VER__
@@ -104,6 +127,13 @@ STACK_SPACE     equ _GPR_SAVE + _GPR_SAVE_SIZE + _ALIGN_SIZE
 
 WRAP_FUNC sha256_mb_x16_avx512, 64
 WRAP_FUNC sha256_mb_x8_avx2, 64
+WRAP_FUNC sha256_mb_x8_avx512vl, 64
 WRAP_FUNC sha256_mb_x4_avx, 64
 WRAP_FUNC sha256_mb_x4_sse, 64
+WRAP_FUNC sha256_mb_x4_sha_sse41, 64
+WRAP_FUNC sha256_mb_x2_sha_sse41, 64
+WRAP_FUNC sha256_mine_x16_avx512, 64
+WRAP_FUNC sha256_mine_x8_avx2, 64
+WRAP_FUNC sha256_mine_x8_avx512vl, 64
+WRAP_FUNC sha256_ni_x1, 64, SET_NI_X1_LANE
 
@@ -0,0 +1,70 @@
+/* SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+   SPDX-License-Identifier: BSD-3-Clause */
+
+#ifndef _SHA256_MINE_H_
+#define _SHA256_MINE_H_
+
+/**
+ *  @file sha256_mine.h
+ *  @brief SHA256 kernels specialised for nonce searching
+ *
+ * While mining, the tail block(s) of every candidate message only differ in the nonce
+ * bytes, so the rounds before the first nonce word and the message schedule of a second
+ * block without nonce bytes are the same for every nonce. They are computed once per job
+ * into a SHA256_MINE_PRECOMP, and the kernels below start from it.
+ *
+ * The x16 and x8 kernels do not read the messages from memory at all: the message words are
+ * in the precomp with the nonce bytes zeroed, and the kernels build the nonce words of every
+ * lane in registers. They loop over up to range->iterations batches of nonces by themselves
+ * and return on the first batch with a hit, or once the iterations are used up.
+ * The SHA-NI kernel hashes the one message it is given, the chaining value is in the precomp.
+ *
+ * With SHA256_MINE_DOUBLE the digest of the tail is hashed again in registers,
+ * as the one block of a 32-byte message with constant padding, from the initial state.
+ *
+ * Only H0 of the final block is finished. It is compared against h0_threshold in registers
+ * and the kernels return the mask of the lanes with H0 <= h0_threshold (bit j for lane j).
+ * Such a lane is only a candidate: the caller recomputes it in full to check the whole target.
+ */
+
+#include <stdint.h>
+#include "sha256_mb_wrapper.h"
+
+#define SHA256_MINE_CONST_TAIL	1	//!< the block after the nonce block has no nonce bytes, use tail_wk
+#define SHA256_MINE_DOUBLE	2	//!< sha256d, H0 is of the SHA256 of the 32-byte digest of the tail
+
+/** @brief Nonce-invariant part of the tail block(s), shared by all lanes and nonces */
+
+typedef struct {
+	DECLARE_ALIGNED(uint32_t tail_wk[64], 64);	//!< W[t] + K[t] of the block following the nonce block
+	DECLARE_ALIGNED(uint32_t msg[32], 64);		//!< message words of the tail block(s), nonce bytes zeroed
+	uint32_t state[SHA256_DIGEST_NWORDS];		//!< chaining value entering the nonce block
+	uint32_t round_state[SHA256_DIGEST_NWORDS];	//!< working variables a..h after start_round rounds
+	uint32_t start_round;	//!< rounds of the nonce block already applied, 0..15
+	uint32_t flags;		//!< SHA256_MINE_* flags
+	uint32_t h0_threshold;	//!< lanes with H0 <= this are hits, normally word 0 of the target
+	uint32_t nonce_word;	//!< first message word with a nonce byte
+	uint32_t nonce_shift;	//!< 8 * byte offset of the nonce in that word
+} SHA256_MINE_PRECOMP;
+
+/** @brief Nonces hashed by one call of a looping kernel, lane j of a batch hashes nonce + j */
+
+typedef struct {
+	uint64_t nonce;		//!< in: nonce of lane 0 of the first batch, out: of the next batch to hash
+	uint64_t iterations;	//!< in: batches to hash at most, out: batches left
+	uint64_t hit_nonce;	//!< out: nonce of lane 0 of the batch the returned mask is for
+	uint64_t nonce_step;	//!< nonce increment from one batch to the next
+} SHA256_MINE_RANGE;
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+	extern uint32_t sha256_mine_x16_avx512_wrapper(const SHA256_MINE_PRECOMP* precomp, SHA256_MINE_RANGE* range, uint64_t size_in_blocks);
+	extern uint32_t sha256_mine_x8_avx2_wrapper(const SHA256_MINE_PRECOMP* precomp, SHA256_MINE_RANGE* range, uint64_t size_in_blocks);
+	extern uint32_t sha256_mine_x8_avx512vl_wrapper(const SHA256_MINE_PRECOMP* precomp, SHA256_MINE_RANGE* range, uint64_t size_in_blocks);
+	extern uint32_t sha256_mine_sha_sse41(const uint8_t data[], const SHA256_MINE_PRECOMP* precomp, uint64_t size_in_blocks);
+#ifdef __cplusplus
+}
+#endif
+
+#endif // _SHA256_MINE_H_
@@ -0,0 +1,43 @@
+; SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+; SPDX-License-Identifier: BSD-3-Clause
+
+%include "datastruct.asm"
+
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;;; Define SHA256 mining precomputation and nonce range, see sha256_mine.h
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+%ifndef _SHA256_MINE_DATASTRUCT_ASM_
+%define _SHA256_MINE_DATASTRUCT_ASM_
+
+START_FIELDS    ; SHA256_MINE_PRECOMP
+;;;     name                    size    align
+FIELD   _pre_tail_wk,           4*64,   64      ; W[t] + K[t] of the block after the nonce block
+FIELD   _pre_msg,               4*32,   64      ; message words of the tail block(s), nonce bytes zeroed
+FIELD   _pre_state,             4*8,    4       ; chaining value entering the nonce block
+FIELD   _pre_round_state,       4*8,    4       ; a..h after _pre_start_round rounds
+FIELD   _pre_start_round,       4,      4       ; rounds of the nonce block already applied
+FIELD   _pre_flags,             4,      4       ; SHA256_MINE_* flags
+FIELD   _pre_h0_threshold,      4,      4       ; lanes with H0 <= this are hits
+FIELD   _pre_nonce_word,        4,      4       ; first message word with a nonce byte
+FIELD   _pre_nonce_shift,       4,      4       ; 8 * byte offset of the nonce in that word
+END_FIELDS
+
+%assign _SHA256_MINE_PRECOMP_size	_FIELD_OFFSET
+%assign _SHA256_MINE_PRECOMP_align	_STRUCT_ALIGN
+
+START_FIELDS    ; SHA256_MINE_RANGE
+;;;     name                    size    align
+FIELD   _range_nonce,           8,      8       ; nonce of lane 0 of the next batch
+FIELD   _range_iterations,      8,      8       ; batches left
+FIELD   _range_hit_nonce,       8,      8       ; nonce of lane 0 of the batch that hit
+FIELD   _range_nonce_step,      8,      8       ; nonce increment between batches
+END_FIELDS
+
+%assign _SHA256_MINE_RANGE_size		_FIELD_OFFSET
+%assign _SHA256_MINE_RANGE_align	_STRUCT_ALIGN
+
+%define SHA256_MINE_CONST_TAIL	1
+%define SHA256_MINE_DOUBLE	2
+
+%endif ; _SHA256_MINE_DATASTRUCT_ASM_
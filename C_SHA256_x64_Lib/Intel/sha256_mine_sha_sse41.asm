@@ -0,0 +1,433 @@
+; SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+; SPDX-FileCopyrightText: Copyright(c) 2011-2017 Intel Corporation All rights reserved.
+; SPDX-License-Identifier: BSD-3-Clause
+
+%include "sha256_mine_datastruct.asm"
+%include "reg_sizes.asm"
+
+[bits 64]
+default rel
+section .text
+
+;; Mining variant of sha256_sha_sse41, see sha256_mine.h
+;; The nonce block starts at precomp->start_round (a multiple of 4 for this
+;; kernel, one sha256rnds2 pair), with a..h taken from the precomp. A constant
+;; second block takes W[t]+K[t] straight from the precomp, no message schedule.
+;; For sha256d the digest is written to the stack as the block of a 32-byte
+;; message, and hashed again from the initial state.
+;; Only H0 is finished and compared against precomp->h0_threshold, the digest
+;; is not written out.
+
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;;
+
+%ifidn __OUTPUT_FORMAT__, elf64
+ ; Linux
+ %define arg0  rdi
+ %define arg1  rsi
+ %define arg2  rdx
+%else
+ ; Windows
+ %define arg0   rcx
+ %define arg1   rdx
+ %define arg2   r8
+%endif
+
+%define MSG     	xmm0
+%define STATE0  	xmm1
+%define STATE1  	xmm2
+%define MSGTMP0 	xmm3
+%define MSGTMP1 	xmm4
+%define MSGTMP2 	xmm5
+%define MSGTMP3 	xmm6
+%define MSGTMP4 	xmm7
+
+%define SHUF_MASK       xmm8
+
+%define ABEF_SAVE       xmm9
+%define CDGH_SAVE       xmm10
+
+%define DATA_ARG	arg0
+%define PRE		arg1
+%define NBLK		arg2
+
+%define DPTR    r11     ; local variable -- input buffer pointer
+%define TMP     xmm0      ; local variable -- assistant to address digest
+%define TBL     rax
+
+%define DOUBLE	r9d	; non-zero until the second hash of sha256d is started
+
+_XMM_SAVE_SIZE  equ 10*16
+_GPR_SAVE_SIZE  equ 0
+_MSG2_SIZE	equ 64
+_ALIGN_SIZE     equ 8
+
+_XMM_SAVE       equ 0
+_GPR_SAVE       equ _XMM_SAVE + _XMM_SAVE_SIZE
+_MSG2		equ _GPR_SAVE + _GPR_SAVE_SIZE	; block of the second hash of sha256d
+STACK_SPACE     equ _MSG2 + _MSG2_SIZE + _ALIGN_SIZE
+
+;; digest in memory (a..h) -> ABEF, CDGH
+%macro LOAD_ABEF_CDGH 3
+%define %%ABEF	%1
+%define %%CDGH	%2
+%define %%SRC	%3
+	movdqu	TMP, [%%SRC]		; ABCD
+	movdqu	%%CDGH, [%%SRC + 16]	; EFGH
+	pshufd	TMP, TMP, 0xB1		; CDAB
+	pshufd	%%CDGH, %%CDGH, 0x1B	; HGFE
+	movdqa	%%ABEF, TMP
+	palignr	%%ABEF, %%CDGH, 8	; ABEF
+	pblendw	%%CDGH, TMP, 0xF0	; CDGH
+%endmacro
+
+align 32
+
+; uint32_t sha256_mine_sha_sse41(const uint8_t data[], const SHA256_MINE_PRECOMP* precomp, uint64_t size_in_blocks)
+; arg 0 : DATA_ARG : pointer to data
+; arg 1 : PRE : pointer to the nonce-invariant precomputation
+; arg 2 : NBLK : size (in blocks) ;; 1 or 2
+;
+; Returns 1 in eax if H0 <= precomp->h0_threshold, otherwise 0
+; Clobbers registers: rax, r9, r10, r11, xmm0-xmm10
+;
+mk_global sha256_mine_sha_sse41, function, internal
+sha256_mine_sha_sse41:
+	endbranch
+	sub     rsp, STACK_SPACE
+%ifidn __OUTPUT_FORMAT__, win64
+	vmovdqa  [rsp + _XMM_SAVE + 16*0], xmm6
+	vmovdqa  [rsp + _XMM_SAVE + 16*1], xmm7
+	vmovdqa  [rsp + _XMM_SAVE + 16*2], xmm8
+	vmovdqa  [rsp + _XMM_SAVE + 16*3], xmm9
+	vmovdqa  [rsp + _XMM_SAVE + 16*4], xmm10
+	vmovdqa  [rsp + _XMM_SAVE + 16*5], xmm11
+	vmovdqa  [rsp + _XMM_SAVE + 16*6], xmm12
+	vmovdqa  [rsp + _XMM_SAVE + 16*7], xmm13
+	vmovdqa  [rsp + _XMM_SAVE + 16*8], xmm14
+	vmovdqa  [rsp + _XMM_SAVE + 16*9], xmm15
+%endif
+
+	;; chaining value for the addition after the nonce block, and the
+	;; working variables after the precomputed rounds
+	LOAD_ABEF_CDGH	ABEF_SAVE, CDGH_SAVE, PRE + _pre_state
+	LOAD_ABEF_CDGH	STATE0, STATE1, PRE + _pre_round_state
+
+	;; Load table constants masks
+	movdqa  SHUF_MASK, [PSHUFFLE_SHANI_MASK]
+	lea     TBL, [TABLE]
+
+	;; Load input pointers
+	mov     DPTR, DATA_ARG
+	mov	DOUBLE, [PRE + _pre_flags]
+	and	DOUBLE, SHA256_MINE_DOUBLE
+
+	;; Enter the rounds at precomp->start_round, the message words of the
+	;; skipped round groups are still needed for the schedule
+	mov	r10d, [PRE + _pre_start_round]
+	cmp	r10d, 4
+	jb	.rounds_0
+	movdqu  	MSGTMP0, [DPTR + 0*16]
+	pshufb  	MSGTMP0, SHUF_MASK
+	je	.rounds_4
+	movdqu  	MSGTMP1, [DPTR + 1*16]
+	pshufb  	MSGTMP1, SHUF_MASK
+	sha256msg1      MSGTMP0, MSGTMP1
+	cmp	r10d, 8
+	je	.rounds_8
+	movdqu  	MSGTMP2, [DPTR + 2*16]
+	pshufb  	MSGTMP2, SHUF_MASK
+	sha256msg1      MSGTMP1, MSGTMP2
+	jmp	.rounds_12
+
+.rounds_0:
+	; /* Rounds 0-3 */
+	movdqu  	MSG, [DPTR + 0*16]
+	pshufb  	MSG, SHUF_MASK
+	movdqa  	MSGTMP0, MSG
+		paddd   	MSG, [TBL + 0*16]
+		sha256rnds2     STATE1, STATE0, MSG
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+
+.rounds_4:
+	; /* Rounds 4-7 */
+	movdqu  	MSG, [DPTR + 1*16]
+	pshufb  	MSG, SHUF_MASK
+	movdqa  	MSGTMP1, MSG
+		paddd   	MSG, [TBL + 1*16]
+		sha256rnds2     STATE1, STATE0, MSG
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+	sha256msg1      MSGTMP0, MSGTMP1
+
+.rounds_8:
+	; /* Rounds 8-11 */
+	movdqu  	MSG, [DPTR + 2*16]
+	pshufb  	MSG, SHUF_MASK
+	movdqa  	MSGTMP2, MSG
+		paddd   	MSG, [TBL + 2*16]
+		sha256rnds2     STATE1, STATE0, MSG
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+	sha256msg1      MSGTMP1, MSGTMP2
+
+.rounds_12:
+	; /* Rounds 12-15 */
+	movdqu  	MSG, [DPTR + 3*16]
+	pshufb  	MSG, SHUF_MASK
+	movdqa  	MSGTMP3, MSG
+		paddd   	MSG, [TBL + 3*16]
+		sha256rnds2     STATE1, STATE0, MSG
+	movdqa  	MSGTMP4, MSGTMP3
+	palignr 	MSGTMP4, MSGTMP2, 4
+	paddd   	MSGTMP0, MSGTMP4
+	sha256msg2      MSGTMP0, MSGTMP3
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+	sha256msg1      MSGTMP2, MSGTMP3
+
+	; /* Rounds 16-19 */
+	movdqa  	MSG, MSGTMP0
+		paddd   	MSG, [TBL + 4*16]
+		sha256rnds2     STATE1, STATE0, MSG
+	movdqa  	MSGTMP4, MSGTMP0
+	palignr 	MSGTMP4, MSGTMP3, 4
+	paddd   	MSGTMP1, MSGTMP4
+	sha256msg2      MSGTMP1, MSGTMP0
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+	sha256msg1      MSGTMP3, MSGTMP0
+
+	; /* Rounds 20-23 */
+	movdqa  	MSG, MSGTMP1
+		paddd   	MSG, [TBL + 5*16]
+		sha256rnds2     STATE1, STATE0, MSG
+	movdqa  	MSGTMP4, MSGTMP1
+	palignr 	MSGTMP4, MSGTMP0, 4
+	paddd   	MSGTMP2, MSGTMP4
+	sha256msg2      MSGTMP2, MSGTMP1
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+	sha256msg1      MSGTMP0, MSGTMP1
+
+	; /* Rounds 24-27 */
+	movdqa  	MSG, MSGTMP2
+		paddd   	MSG, [TBL + 6*16]
+		sha256rnds2     STATE1, STATE0, MSG
+	movdqa  	MSGTMP4, MSGTMP2
+	palignr 	MSGTMP4, MSGTMP1, 4
+	paddd   	MSGTMP3, MSGTMP4
+	sha256msg2      MSGTMP3, MSGTMP2
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+	sha256msg1      MSGTMP1, MSGTMP2
+
+	; /* Rounds 28-31 */
+	movdqa  	MSG, MSGTMP3
+		paddd   	MSG, [TBL + 7*16]
+		sha256rnds2     STATE1, STATE0, MSG
+	movdqa  	MSGTMP4, MSGTMP3
+	palignr 	MSGTMP4, MSGTMP2, 4
+	paddd   	MSGTMP0, MSGTMP4
+	sha256msg2      MSGTMP0, MSGTMP3
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+	sha256msg1      MSGTMP2, MSGTMP3
+
+	; /* Rounds 32-35 */
+	movdqa  	MSG, MSGTMP0
+		paddd   	MSG, [TBL + 8*16]
+		sha256rnds2     STATE1, STATE0, MSG
+	movdqa  	MSGTMP4, MSGTMP0
+	palignr 	MSGTMP4, MSGTMP3, 4
+	paddd   	MSGTMP1, MSGTMP4
+	sha256msg2      MSGTMP1, MSGTMP0
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+	sha256msg1      MSGTMP3, MSGTMP0
+
+	; /* Rounds 36-39 */
+	movdqa  	MSG, MSGTMP1
+		paddd   	MSG, [TBL + 9*16]
+		sha256rnds2     STATE1, STATE0, MSG
+	movdqa  	MSGTMP4, MSGTMP1
+	palignr 	MSGTMP4, MSGTMP0, 4
+	paddd   	MSGTMP2, MSGTMP4
+	sha256msg2      MSGTMP2, MSGTMP1
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+	sha256msg1      MSGTMP0, MSGTMP1
+
+	; /* Rounds 40-43 */
+	movdqa  	MSG, MSGTMP2
+		paddd   	MSG, [TBL + 10*16]
+		sha256rnds2     STATE1, STATE0, MSG
+	movdqa  	MSGTMP4, MSGTMP2
+	palignr 	MSGTMP4, MSGTMP1, 4
+	paddd   	MSGTMP3, MSGTMP4
+	sha256msg2      MSGTMP3, MSGTMP2
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+	sha256msg1      MSGTMP1, MSGTMP2
+
+	; /* Rounds 44-47 */
+	movdqa  	MSG, MSGTMP3
+		paddd   	MSG, [TBL + 11*16]
+		sha256rnds2     STATE1, STATE0, MSG
+	movdqa  	MSGTMP4, MSGTMP3
+	palignr 	MSGTMP4, MSGTMP2, 4
+	paddd   	MSGTMP0, MSGTMP4
+	sha256msg2      MSGTMP0, MSGTMP3
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+	sha256msg1      MSGTMP2, MSGTMP3
+
+	; /* Rounds 48-51 */
+	movdqa  	MSG, MSGTMP0
+		paddd   	MSG, [TBL + 12*16]
+		sha256rnds2     STATE1, STATE0, MSG
+	movdqa  	MSGTMP4, MSGTMP0
+	palignr 	MSGTMP4, MSGTMP3, 4
+	paddd   	MSGTMP1, MSGTMP4
+	sha256msg2      MSGTMP1, MSGTMP0
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+	sha256msg1      MSGTMP3, MSGTMP0
+
+	; /* Rounds 52-55 */
+	movdqa  	MSG, MSGTMP1
+		paddd   	MSG, [TBL + 13*16]
+		sha256rnds2     STATE1, STATE0, MSG
+	movdqa  	MSGTMP4, MSGTMP1
+	palignr 	MSGTMP4, MSGTMP0, 4
+	paddd   	MSGTMP2, MSGTMP4
+	sha256msg2      MSGTMP2, MSGTMP1
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+
+	; /* Rounds 56-59 */
+	movdqa  	MSG, MSGTMP2
+		paddd   	MSG, [TBL + 14*16]
+		sha256rnds2     STATE1, STATE0, MSG
+	movdqa  	MSGTMP4, MSGTMP2
+	palignr 	MSGTMP4, MSGTMP1, 4
+	paddd   	MSGTMP3, MSGTMP4
+	sha256msg2      MSGTMP3, MSGTMP2
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+
+	; /* Rounds 60-63 */
+	movdqa  	MSG, MSGTMP3
+		paddd   	MSG, [TBL + 15*16]
+		sha256rnds2     STATE1, STATE0, MSG
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+
+	sub     	NBLK, 1
+	je      	.last_block
+
+	; /* Add current hash values with previously saved */
+	paddd   	STATE0, ABEF_SAVE
+	paddd   	STATE1, CDGH_SAVE
+
+	movdqa  	ABEF_SAVE, STATE0
+	movdqa  	CDGH_SAVE, STATE1
+	test    	dword [PRE + _pre_flags], SHA256_MINE_CONST_TAIL
+	jnz     	.const_block
+
+	; The nonce spills into the next block, process it in full
+	add     	DPTR, 64
+	jmp     	.rounds_0
+
+.const_block:
+	; No nonce in this block, W[t]+K[t] comes from the precomp
+%assign I 0
+%rep 16
+	movdqa  	MSG, [PRE + _pre_tail_wk + I*16]
+		sha256rnds2     STATE1, STATE0, MSG
+		pshufd  	MSG, MSG, 0x0E
+		sha256rnds2     STATE0, STATE1, MSG
+%assign I (I+1)
+%endrep
+
+.last_block:
+	test	DOUBLE, DOUBLE
+	jnz	.second_hash
+
+	;; only H0 is needed for the target check, A is the top dword of ABEF
+	paddd   	STATE0, ABEF_SAVE
+	pextrd  	r10d, STATE0, 3
+	xor     	eax, eax
+	cmp     	r10d, [PRE + _pre_h0_threshold]
+	setbe   	al
+
+	;;;;;;;;;;;;;;;;
+	;; Postamble
+%ifidn __OUTPUT_FORMAT__, win64
+	vmovdqa  xmm6, [rsp + _XMM_SAVE + 16*0]
+	vmovdqa  xmm7, [rsp + _XMM_SAVE + 16*1]
+	vmovdqa  xmm8, [rsp + _XMM_SAVE + 16*2]
+	vmovdqa  xmm9, [rsp + _XMM_SAVE + 16*3]
+	vmovdqa  xmm10, [rsp + _XMM_SAVE + 16*4]
+	vmovdqa  xmm11, [rsp + _XMM_SAVE + 16*5]
+	vmovdqa  xmm12, [rsp + _XMM_SAVE + 16*6]
+	vmovdqa  xmm13, [rsp + _XMM_SAVE + 16*7]
+	vmovdqa  xmm14, [rsp + _XMM_SAVE + 16*8]
+	vmovdqa  xmm15, [rsp + _XMM_SAVE + 16*9]
+%endif
+	add     rsp, STACK_SPACE
+
+	ret
+
+.second_hash:
+	;; sha256d: the digest becomes the message of a second hash, stored big
+	;; endian like the data the rounds load, then the constant padding
+	xor	DOUBLE, DOUBLE
+	paddd   	STATE0, ABEF_SAVE
+	paddd   	STATE1, CDGH_SAVE
+	movdqa		MSGTMP0, STATE0
+	punpckhdq	MSGTMP0, STATE1		; BDAC
+	pshufd		MSGTMP0, MSGTMP0, 0x72	; ABCD
+	punpckldq	STATE0, STATE1		; FHEG
+	pshufd		STATE0, STATE0, 0x72	; EFGH
+	pshufb		MSGTMP0, SHUF_MASK
+	pshufb		STATE0, SHUF_MASK
+	movdqu		[rsp + _MSG2 + 0*16], MSGTMP0
+	movdqu		[rsp + _MSG2 + 1*16], STATE0
+	movdqa		MSGTMP0, [SHA256D_PAD + 0*16]
+	movdqu		[rsp + _MSG2 + 2*16], MSGTMP0
+	movdqa		MSGTMP0, [SHA256D_PAD + 1*16]
+	movdqu		[rsp + _MSG2 + 3*16], MSGTMP0
+
+	LOAD_ABEF_CDGH	STATE0, STATE1, SHA256_IV
+	movdqa  	ABEF_SAVE, STATE0
+	movdqa  	CDGH_SAVE, STATE1
+	lea		DPTR, [rsp + _MSG2]
+	mov		NBLK, 1
+	jmp		.rounds_0
+
+
+section .data align=16
+PSHUFFLE_SHANI_MASK:    dq 0x0405060700010203, 0x0c0d0e0f08090a0b
+SHA256_IV:	dd	0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a
+		dd	0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+;; bytes 32-63 of the padded 32-byte message: 0x80, zeros, and the length of 256 bits
+SHA256D_PAD:	dq	0x80, 0, 0, 0x0001000000000000
+TABLE:	dd	0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5
+	dd      0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5
+	dd      0xd807aa98,0x12835b01,0x243185be,0x550c7dc3
+	dd      0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174
+	dd      0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc
+	dd      0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da
+	dd      0x983e5152,0xa831c66d,0xb00327c8,0xbf597fc7
+	dd      0xc6e00bf3,0xd5a79147,0x06ca6351,0x14292967
+	dd      0x27b70a85,0x2e1b2138,0x4d2c6dfc,0x53380d13
+	dd      0x650a7354,0x766a0abb,0x81c2c92e,0x92722c85
+	dd      0xa2bfe8a1,0xa81a664b,0xc24b8b70,0xc76c51a3
+	dd      0xd192e819,0xd6990624,0xf40e3585,0x106aa070
+	dd      0x19a4c116,0x1e376c08,0x2748774c,0x34b0bcb5
+	dd      0x391c0cb3,0x4ed8aa4a,0x5b9cca4f,0x682e6ff3
+	dd      0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208
+	dd      0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
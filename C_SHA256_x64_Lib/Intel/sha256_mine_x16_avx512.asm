@@ -0,0 +1,534 @@
+; SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+; SPDX-FileCopyrightText: Copyright(c) 2011-2016 Intel Corporation All rights reserved.
+; SPDX-License-Identifier: BSD-3-Clause
+
+%include "sha256_mb_mgr_datastruct.asm"
+%include "sha256_mine_datastruct.asm"
+%include "reg_sizes.asm"
+
+%ifdef HAVE_AS_KNOWS_AVX512
+
+[bits 64]
+default rel
+section .text
+
+;; Mining variant of sha256_mb_x16_avx512, see sha256_mine.h
+;; The 16 lanes hold the same tail block(s) except for the nonce, so the message
+;; words are broadcast from precomp->msg once, and for every batch only the 2 or
+;; 3 words holding the nonce are rebuilt, from the 64-bit lane nonces kept on
+;; the stack. The kernel loops over range->iterations batches by itself and only
+;; returns on a hit, or once the iterations are used up.
+;; The nonce block does not start at round 0 but at precomp->start_round, with
+;; the working variables of the precomp broadcast to all lanes. A constant
+;; second block (no nonce bytes) takes W[t]+K[t] straight from the precomp, no
+;; message schedule.
+;; For sha256d the digest of the tail becomes W0-W7 of a second hash from the
+;; initial state, W8-W15 are its constant padding.
+;; Only H0 is finished, and compared against precomp->h0_threshold in registers;
+;; the digest is not written out, the lanes that hit are returned as a bit mask.
+;; outer calling routine takes care of save and restore of XMM registers
+
+;; Returns in eax the mask of the lanes with H0 <= precomp->h0_threshold, in the
+;; batch starting at range->hit_nonce, or 0 if no batch hit
+;; Function clobbers: rax, rcx, rsi, r9-r15; zmm0-31
+;; Windows clobbers:  rax             rsi            r9 r10 r11 r12 r13 r14 r15
+;; Windows preserves:     rbx rcx rdx     rdi rbp r8
+;;
+;; Linux clobbers:    rax     rcx                    r9 r10 r11 r12 r13 r14 r15
+;; Linux preserves:       rbx     rdx rsi rdi rbp r8
+;;
+;; clobbers zmm0-31
+
+%define APPEND(a,b) a %+ b
+
+; Define Stack Layout
+START_FIELDS
+;;;     name            size    align
+FIELD	_DIGEST_SAVE,	8*64,	64
+FIELD	_MSG,		32*64,	64	; message words of the tail block(s)
+FIELD	_NONCE,		2*64,	64	; 64-bit nonces of lanes 0-7 and 8-15
+FIELD	_STEP,		64,	64	; nonce step, in all 8 qwords
+FIELD	_SHIFT_L,	16,	16	; 8 * byte offset of the nonce in its first word
+FIELD	_SHIFT_R,	16,	16	; 32 - _SHIFT_L
+FIELD	_DOUBLE,	8,	8	; non-zero until the second hash of sha256d is started
+FIELD	_rsp,		8,	8
+%assign STACK_SPACE	_FIELD_OFFSET
+
+%ifidn __OUTPUT_FORMAT__, win64
+   %define arg1 rcx	; arg0 preserved
+   %define arg2 rdx	; arg1 preserved
+   %define arg3 r8	; arg2
+   %define var1 rsi
+   %define local_func_decl(func_name) global func_name
+ %else
+   %define arg1 rdi	; arg0 preserved
+   %define arg2 rsi	; arg1 preserved
+   %define arg3 rdx	; arg2
+   %define var1 rcx
+   %define local_func_decl(func_name) mk_global func_name, function, internal
+%endif
+
+%define precomp  arg1
+%define range    arg2
+%define num_blks arg3
+
+%define PRE	precomp
+%define RANGE	range
+
+%define TBL  var1
+
+%define SIZE	r9	; blocks left in this batch
+%define ITER	r10	; batches left
+%define NPTR	r11	; _MSG slot of the first nonce word
+%define MPTR	r12	; precomp->msg word of the first nonce word
+%define CPTR	r13	; constant block W[t]+K[t]
+%define CEND	r14
+%define GTMP	r15
+
+%define A	zmm0
+%define B	zmm1
+%define C	zmm2
+%define D	zmm3
+%define E	zmm4
+%define F	zmm5
+%define G	zmm6
+%define H	zmm7
+%define T1	zmm8
+%define TMP0	zmm9
+%define TMP1	zmm10
+%define TMP2	zmm11
+%define TMP3	zmm12
+%define TMP4	zmm13
+%define TMP5	zmm14
+%define TMP6	zmm15
+
+%define W0	zmm16
+%define W1	zmm17
+%define W2	zmm18
+%define W3	zmm19
+%define W4	zmm20
+%define W5	zmm21
+%define W6	zmm22
+%define W7	zmm23
+%define W8	zmm24
+%define W9	zmm25
+%define W10	zmm26
+%define W11	zmm27
+%define W12	zmm28
+%define W13	zmm29
+%define W14	zmm30
+%define W15	zmm31
+
+%macro ROTATE_ARGS 0
+%xdefine TMP_ H
+%xdefine H G
+%xdefine G F
+%xdefine F E
+%xdefine E D
+%xdefine D C
+%xdefine C B
+%xdefine B A
+%xdefine A TMP_
+%endm
+
+;;  CH(A, B, C) = (A&B) ^ (~A&C)
+;; MAJ(E, F, G) = (E&F) ^ (E&G) ^ (F&G)
+;; SIGMA0 = ROR_2  ^ ROR_13 ^ ROR_22
+;; SIGMA1 = ROR_6  ^ ROR_11 ^ ROR_25
+;; sigma0 = ROR_7  ^ ROR_18 ^ SHR_3
+;; sigma1 = ROR_17 ^ ROR_19 ^ SHR_10
+
+; Main processing loop per round
+; Kt is broadcast from a dword in memory, so the same macro also runs the
+; constant block where the dword already is Wt + Kt (WT is then "none")
+%macro PROCESS_LOOP 2
+%define %%WT	%1
+%define %%KT	%2
+	;; T1 = H + SIGMA1(E) + CH(E, F, G) + Kt + Wt
+	;; T2 = SIGMA0(A) + MAJ(A, B, C)
+	;; H=G, G=F, F=E, E=D+T1, D=C, C=B, B=A, A=T1+T2
+
+	;; H becomes T2, then add T1 for A
+	;; D becomes D + T1 for E
+
+	vpaddd		T1, H, %%KT{1to16}	; T1 = H + Kt
+	vmovdqa32	TMP0, E
+	vprord		TMP1, E, 6 		; ROR_6(E)
+	vprord		TMP2, E, 11 		; ROR_11(E)
+	vprord		TMP3, E, 25 		; ROR_25(E)
+	vpternlogd	TMP0, F, G, 0xCA	; TMP0 = CH(E,F,G)
+%ifnidn %%WT, none
+	vpaddd		T1, T1, %%WT		; T1 = T1 + Wt
+%endif
+	vpternlogd	TMP1, TMP2, TMP3, 0x96	; TMP1 = SIGMA1(E)
+	vpaddd		T1, T1, TMP0		; T1 = T1 + CH(E,F,G)
+	vpaddd		T1, T1, TMP1		; T1 = T1 + SIGMA1(E)
+	vpaddd		D, D, T1		; D = D + T1
+
+	vprord		H, A, 2 		; ROR_2(A)
+	vprord		TMP2, A, 13 		; ROR_13(A)
+	vprord		TMP3, A, 22 		; ROR_22(A)
+	vmovdqa32	TMP0, A
+	vpternlogd	TMP0, B, C, 0xE8	; TMP0 = MAJ(A,B,C)
+	vpternlogd	H, TMP2, TMP3, 0x96	; H(T2) = SIGMA0(A)
+	vpaddd		H, H, TMP0		; H(T2) = SIGMA0(A) + MAJ(A,B,C)
+	vpaddd		H, H, T1		; H(A) = H(T2) + T1
+
+	;; Rotate the args A-H (rotation of names associated with regs)
+	ROTATE_ARGS
+%endmacro
+
+%macro MSG_SCHED_ROUND_16_63 4
+%define %%WT	%1
+%define %%WTp1	%2
+%define %%WTp9	%3
+%define %%WTp14	%4
+	vprord		TMP4, %%WTp14, 17 	; ROR_17(Wt-2)
+	vprord		TMP5, %%WTp14, 19 	; ROR_19(Wt-2)
+	vpsrld		TMP6, %%WTp14, 10 	; SHR_10(Wt-2)
+	vpternlogd	TMP4, TMP5, TMP6, 0x96	; TMP4 = sigma1(Wt-2)
+
+	vpaddd		%%WT, %%WT, TMP4	; Wt = Wt-16 + sigma1(Wt-2)
+	vpaddd		%%WT, %%WT, %%WTp9	; Wt = Wt-16 + sigma1(Wt-2) + Wt-7
+
+	vprord		TMP4, %%WTp1, 7 	; ROR_7(Wt-15)
+	vprord		TMP5, %%WTp1, 18 	; ROR_18(Wt-15)
+	vpsrld		TMP6, %%WTp1, 3 	; SHR_3(Wt-15)
+	vpternlogd	TMP4, TMP5, TMP6, 0x96	; TMP4 = sigma0(Wt-15)
+
+	vpaddd		%%WT, %%WT, TMP4	; Wt = Wt-16 + sigma1(Wt-2) +
+						;      Wt-7 + sigma0(Wt-15) +
+%endmacro
+
+; Load one block (0 or 1) of the message words into W0-W15
+%macro LOAD_MSG 1
+%define %%BLOCK %1
+%assign I 0
+%rep 16
+	vmovdqa32	APPEND(W,I), [rsp + _MSG + 64*(%%BLOCK*16 + I)]
+%assign I (I+1)
+%endrep
+%endmacro
+
+; Put the nonces of this batch into their message words, then step the
+; lane nonces. The nonce is little endian at byte s of its first word, so
+; with lo/hi its dwords the words get (lo << 8s), (lo >> (32-8s) | hi << 8s)
+; and (hi >> (32-8s)), byte swapped and ORed into the template words, which
+; have zeros in the nonce bytes. For s = 0 the right shifts by 32 give 0.
+%macro NONCE_WORDS 0
+	vmovdqa64	TMP0, [rsp + _NONCE + 64*0]
+	vmovdqa64	TMP1, [rsp + _NONCE + 64*1]
+	vmovdqa32	TMP2, [NONCE_LO_PERM]
+	vpermi2d	TMP2, TMP0, TMP1		; lo dwords of lanes 0-15
+	vmovdqa32	TMP3, [NONCE_HI_PERM]
+	vpermi2d	TMP3, TMP0, TMP1		; hi dwords of lanes 0-15
+	vpaddq		TMP0, TMP0, [rsp + _STEP]
+	vpaddq		TMP1, TMP1, [rsp + _STEP]
+	vmovdqa64	[rsp + _NONCE + 64*0], TMP0
+	vmovdqa64	[rsp + _NONCE + 64*1], TMP1
+
+	vmovdqa32	TMP6, [PSHUFFLE_BYTE_FLIP_MASK]
+	vpslld		TMP4, TMP2, [rsp + _SHIFT_L]
+	vpsrld		TMP2, TMP2, [rsp + _SHIFT_R]
+	vpslld		TMP5, TMP3, [rsp + _SHIFT_L]
+	vpsrld		TMP3, TMP3, [rsp + _SHIFT_R]
+	vpord		TMP2, TMP2, TMP5
+	vpshufb		TMP4, TMP4, TMP6
+	vpshufb		TMP2, TMP2, TMP6
+	vpshufb		TMP3, TMP3, TMP6
+	vpord		TMP4, TMP4, [MPTR + 4*0]{1to16}
+	vpord		TMP2, TMP2, [MPTR + 4*1]{1to16}
+	vpord		TMP3, TMP3, [MPTR + 4*2]{1to16}
+	vmovdqa32	[NPTR + 64*0], TMP4
+	vmovdqa32	[NPTR + 64*1], TMP2
+	vmovdqa32	[NPTR + 64*2], TMP3
+%endmacro
+
+; Save digests for later addition
+%macro SAVE_DIGEST 0
+        vmovdqa32	[rsp + _DIGEST_SAVE + 64*0], A
+        vmovdqa32	[rsp + _DIGEST_SAVE + 64*1], B
+        vmovdqa32	[rsp + _DIGEST_SAVE + 64*2], C
+        vmovdqa32	[rsp + _DIGEST_SAVE + 64*3], D
+        vmovdqa32	[rsp + _DIGEST_SAVE + 64*4], E
+        vmovdqa32	[rsp + _DIGEST_SAVE + 64*5], F
+        vmovdqa32	[rsp + _DIGEST_SAVE + 64*6], G
+        vmovdqa32	[rsp + _DIGEST_SAVE + 64*7], H
+%endmacro
+
+; Add old digest
+%macro ADD_DIGEST 0
+        vpaddd		A, A, [rsp + _DIGEST_SAVE + 64*0]
+        vpaddd		B, B, [rsp + _DIGEST_SAVE + 64*1]
+        vpaddd		C, C, [rsp + _DIGEST_SAVE + 64*2]
+        vpaddd		D, D, [rsp + _DIGEST_SAVE + 64*3]
+        vpaddd		E, E, [rsp + _DIGEST_SAVE + 64*4]
+        vpaddd		F, F, [rsp + _DIGEST_SAVE + 64*5]
+        vpaddd		G, G, [rsp + _DIGEST_SAVE + 64*6]
+        vpaddd		H, H, [rsp + _DIGEST_SAVE + 64*7]
+%endmacro
+
+align 64
+
+;; uint32_t sha256_mine_x16_avx512(const SHA256_MINE_PRECOMP *precomp, SHA256_MINE_RANGE *range, uint64_t size)
+; arg 1 : pointer to the nonce-invariant precomputation
+; arg 2 : pointer to the nonce range, lane j of a batch hashes nonce + j,
+;         nonce, iterations and hit_nonce are updated
+; arg 3 : size (in blocks) ;; 1 or 2
+local_func_decl(sha256_mine_x16_avx512)
+sha256_mine_x16_avx512:
+	endbranch
+	mov	rax, rsp
+        sub     rsp, STACK_SPACE
+	and	rsp, ~63	; align stack to multiple of 64
+	mov	[rsp + _rsp], rax
+	lea	TBL, [TABLE]
+
+	;; Lane nonces of the first batch, and the step to the next one
+	vpbroadcastq	TMP0, [RANGE + _range_nonce]
+	vpaddq		TMP1, TMP0, [NONCE_LANE_OFFSETS + 64*0]
+	vpaddq		TMP0, TMP0, [NONCE_LANE_OFFSETS + 64*1]
+	vmovdqa64	[rsp + _NONCE + 64*0], TMP1
+	vmovdqa64	[rsp + _NONCE + 64*1], TMP0
+	vpbroadcastq	TMP0, [RANGE + _range_nonce_step]
+	vmovdqa64	[rsp + _STEP], TMP0
+
+	mov	eax, [PRE + _pre_nonce_shift]
+	mov	[rsp + _SHIFT_L], rax	; the shifts only use the low qword
+	neg	eax
+	add	eax, 32
+	mov	[rsp + _SHIFT_R], rax
+
+	;; Message words, the same for all lanes but the nonce words
+%assign I 0
+%rep 32
+	vpbroadcastd	TMP0, [PRE + _pre_msg + 4*I]
+	vmovdqa32	[rsp + _MSG + 64*I], TMP0
+%assign I (I+1)
+%endrep
+	mov	eax, [PRE + _pre_nonce_word]
+	lea	MPTR, [PRE + _pre_msg + 4*rax]
+	shl	rax, 6
+	lea	NPTR, [rsp + _MSG + rax]
+
+	xor	eax, eax
+	mov	ITER, [RANGE + _range_iterations]
+	test	ITER, ITER
+	jz	.done
+
+.batch_loop:
+	NONCE_WORDS
+
+	;; Chaining value of the nonce block, same for all lanes
+%assign I 0
+%rep 8
+	vpbroadcastd	TMP0, [PRE + _pre_state + 4*I]
+	vmovdqa32	[rsp + _DIGEST_SAVE + 64*I], TMP0
+%assign I (I+1)
+%endrep
+
+	mov	SIZE, num_blks
+	mov	eax, [PRE + _pre_flags]
+	and	eax, SHA256_MINE_DOUBLE
+	mov	[rsp + _DOUBLE], rax
+	LOAD_MSG 0
+
+	;; The rounds before precomp->start_round are already in _pre_round_state.
+	;; Their message schedule steps still have to be done, Wt+16 needs Wt.
+	mov	eax, [PRE + _pre_start_round]
+%assign I 0
+%assign J 1
+%assign K 9
+%assign L 14
+%rep 15
+	cmp	eax, I
+	je	APPEND(.enter_,I)
+	MSG_SCHED_ROUND_16_63  APPEND(W,I), APPEND(W,J), APPEND(W,K), APPEND(W,L)
+%assign I (I+1)
+%assign J ((J+1)% 16)
+%assign K ((K+1)% 16)
+%assign L ((L+1)% 16)
+%endrep
+
+	;; Load the working variables, named as they are after I rounds,
+	;; then jump into the round sequence
+%assign I 15
+%rep 16
+APPEND(.enter_,I):
+%rep I
+	ROTATE_ARGS
+%endrep
+	vpbroadcastd	A, [PRE + _pre_round_state + 4*0]
+	vpbroadcastd	B, [PRE + _pre_round_state + 4*1]
+	vpbroadcastd	C, [PRE + _pre_round_state + 4*2]
+	vpbroadcastd	D, [PRE + _pre_round_state + 4*3]
+	vpbroadcastd	E, [PRE + _pre_round_state + 4*4]
+	vpbroadcastd	F, [PRE + _pre_round_state + 4*5]
+	vpbroadcastd	G, [PRE + _pre_round_state + 4*6]
+	vpbroadcastd	H, [PRE + _pre_round_state + 4*7]
+%rep ((8 - (I % 8)) % 8)
+	ROTATE_ARGS
+%endrep
+%if I > 0
+	jmp	APPEND(.round_,I)
+%endif
+%assign I (I-1)
+%endrep
+
+	; MSG Schedule for W0-W15 is now complete in registers
+	; Process first 48 rounds
+	; Calculate next Wt+16 after processing is complete and Wt is unneeded
+.round_0:
+%assign I 0
+%assign J 0
+%assign K 1
+%assign L 9
+%assign M 14
+%rep 48
+%if I > 0 && I < 16
+APPEND(.round_,I):
+%endif
+	PROCESS_LOOP  APPEND(W,J), [TBL + 4*I]
+	MSG_SCHED_ROUND_16_63  APPEND(W,J), APPEND(W,K), APPEND(W,L), APPEND(W,M)
+%assign I (I+1)
+%assign J ((J+1)% 16)
+%assign K ((K+1)% 16)
+%assign L ((L+1)% 16)
+%assign M ((M+1)% 16)
+%endrep
+
+	; Process last 16 rounds
+%assign I 48
+%assign J 0
+%rep 16
+	PROCESS_LOOP  APPEND(W,J), [TBL + 4*I]
+%assign I (I+1)
+%assign J (J+1)
+%endrep
+
+	; Check is this is the last block
+	sub 	SIZE, 1
+	je	.last_block
+
+	ADD_DIGEST
+	SAVE_DIGEST
+	test	dword [PRE + _pre_flags], SHA256_MINE_CONST_TAIL
+	jnz	.const_block
+
+	; The nonce spills into the next block, process it in full
+	LOAD_MSG 1
+	jmp	.round_0
+
+.const_block:
+	; No nonce in this block, W[t]+K[t] comes from the precomp
+	lea	CPTR, [PRE + _pre_tail_wk]
+	lea	CEND, [PRE + _pre_tail_wk + 4*64]
+.const_loop:
+%assign I 0
+%rep 16
+	PROCESS_LOOP  none, [CPTR + 4*I]
+%assign I (I+1)
+%endrep
+	add	CPTR, 4*16
+	cmp	CPTR, CEND
+	jb	.const_loop
+
+.last_block:
+	cmp	qword [rsp + _DOUBLE], 0
+	jne	.second_hash
+
+	; Only H0 is needed for the target check
+	vpaddd		A, A, [rsp + _DIGEST_SAVE + 64*0]
+	vpcmpud		k1, A, [PRE + _pre_h0_threshold]{1to16}, 2	; H0 <= threshold
+	kmovw		eax, k1
+
+	sub	ITER, 1
+	test	eax, eax
+	jnz	.done
+	test	ITER, ITER
+	jnz	.batch_loop
+	jmp	.done
+
+.second_hash:
+	; sha256d: the digest, already in message word order, is hashed again
+	mov	qword [rsp + _DOUBLE], 0
+	ADD_DIGEST
+	vmovdqa32	W0, A
+	vmovdqa32	W1, B
+	vmovdqa32	W2, C
+	vmovdqa32	W3, D
+	vmovdqa32	W4, E
+	vmovdqa32	W5, F
+	vmovdqa32	W6, G
+	vmovdqa32	W7, H
+%assign I 8
+%rep 8
+	vpbroadcastd	APPEND(W,I), [SHA256D_PAD + 4*(I-8)]
+%assign I (I+1)
+%endrep
+	vpbroadcastd	A, [SHA256_IV + 4*0]
+	vpbroadcastd	B, [SHA256_IV + 4*1]
+	vpbroadcastd	C, [SHA256_IV + 4*2]
+	vpbroadcastd	D, [SHA256_IV + 4*3]
+	vpbroadcastd	E, [SHA256_IV + 4*4]
+	vpbroadcastd	F, [SHA256_IV + 4*5]
+	vpbroadcastd	G, [SHA256_IV + 4*6]
+	vpbroadcastd	H, [SHA256_IV + 4*7]
+	SAVE_DIGEST
+	mov	SIZE, 1
+	jmp	.round_0
+
+.done:
+	; lane 0 of _NONCE is already the nonce of the next batch
+	mov	[RANGE + _range_iterations], ITER
+	mov	GTMP, [rsp + _NONCE]
+	mov	[RANGE + _range_nonce], GTMP
+	sub	GTMP, [RANGE + _range_nonce_step]
+	mov	[RANGE + _range_hit_nonce], GTMP
+
+        mov     rsp, [rsp + _rsp]
+        ret
+
+        section .data
+align 64
+TABLE:
+	dd	0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5
+	dd	0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5
+	dd	0xd807aa98,0x12835b01,0x243185be,0x550c7dc3
+	dd	0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174
+	dd	0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc
+	dd	0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da
+	dd	0x983e5152,0xa831c66d,0xb00327c8,0xbf597fc7
+	dd	0xc6e00bf3,0xd5a79147,0x06ca6351,0x14292967
+	dd	0x27b70a85,0x2e1b2138,0x4d2c6dfc,0x53380d13
+	dd	0x650a7354,0x766a0abb,0x81c2c92e,0x92722c85
+	dd	0xa2bfe8a1,0xa81a664b,0xc24b8b70,0xc76c51a3
+	dd	0xd192e819,0xd6990624,0xf40e3585,0x106aa070
+	dd	0x19a4c116,0x1e376c08,0x2748774c,0x34b0bcb5
+	dd	0x391c0cb3,0x4ed8aa4a,0x5b9cca4f,0x682e6ff3
+	dd	0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208
+	dd	0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
+
+align 64
+PSHUFFLE_BYTE_FLIP_MASK: dq 0x0405060700010203, 0x0c0d0e0f08090a0b
+			 dq 0x0405060700010203, 0x0c0d0e0f08090a0b
+			 dq 0x0405060700010203, 0x0c0d0e0f08090a0b
+			 dq 0x0405060700010203, 0x0c0d0e0f08090a0b
+
+NONCE_LANE_OFFSETS:	dq 0, 1, 2, 3, 4, 5, 6, 7
+			dq 8, 9, 10, 11, 12, 13, 14, 15
+
+SHA256_IV:	dd 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a
+		dd 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+; padding of a 32-byte message, W8-W15
+SHA256D_PAD:	dd 0x80000000, 0, 0, 0, 0, 0, 0, 256
+
+NONCE_LO_PERM:	dd 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30
+NONCE_HI_PERM:	dd 1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31
+
+%else
+%ifidn __OUTPUT_FORMAT__, win64
+global no_sha256_mine_x16_avx512
+no_sha256_mine_x16_avx512:
+%endif
+%endif ; HAVE_AS_KNOWS_AVX512
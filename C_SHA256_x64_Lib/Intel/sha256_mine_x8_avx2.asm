@@ -0,0 +1,698 @@
+; SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+; SPDX-FileCopyrightText: Copyright(c) 2011-2016 Intel Corporation All rights reserved.
+; SPDX-License-Identifier: BSD-3-Clause
+
+%include "sha256_mb_mgr_datastruct.asm"
+%include "sha256_mine_datastruct.asm"
+%include "reg_sizes.asm"
+
+[bits 64]
+default rel
+section .text
+
+;; Mining variant of sha256_mb_x8_avx2, see sha256_mine.h
+;; The 8 lanes hold the same tail block(s) except for the nonce, so the message
+;; words are broadcast from precomp->msg once, and for every batch only the 2 or
+;; 3 words holding the nonce are rebuilt, from the 64-bit lane nonces kept on
+;; the stack. The kernel loops over range->iterations batches by itself and only
+;; returns on a hit, or once the iterations are used up.
+;; The nonce block starts at precomp->start_round with the working variables of
+;; the precomp broadcast to all lanes. W[0..15] are all on the stack before the
+;; first round, so the skipped rounds need no message schedule work here.
+;; A constant second block takes W[t]+K[t] straight from the precomp.
+;; For sha256d the digest of the tail becomes W0-W7 of a second hash from the
+;; initial state, W8-W15 are its constant padding.
+;; Only H0 is finished, and compared against precomp->h0_threshold in registers;
+;; the digest is not written out, the lanes that hit are returned as a bit mask.
+;; outer calling routine takes care of save and restore of XMM registers
+
+;; Returns in eax the mask of the lanes with H0 <= precomp->h0_threshold, in the
+;; batch starting at range->hit_nonce, or 0 if no batch hit
+;; Function clobbers: rax, rbx, rcx, rsi, r9-r15; ymm0-15
+;; Windows clobbers:  rax rbx         rsi            r9 r10 r11 r12 r13 r14 r15
+;; Windows preserves:         rcx rdx     rdi rbp r8
+;;
+;; Linux clobbers:    rax rbx rcx                    r9 r10 r11 r12 r13 r14 r15
+;; Linux preserves:               rdx rsi rdi rbp r8
+;;
+;; clobbers ymm0-15
+
+%ifidn __OUTPUT_FORMAT__, elf64
+ ; Linux definitions
+     %define arg1 	rdi
+     %define arg2	rsi
+     %define arg3	rdx
+     %define reg3	rcx
+%else
+ ; Windows definitions
+     %define arg1 	rcx
+     %define arg2 	rdx
+     %define arg3	r8
+     %define reg3	rsi
+%endif
+
+%define APPEND(a,b) a %+ b
+
+; Common definitions
+%define PRE      arg1
+%define RANGE    arg2
+%define NUM_BLKS arg3
+
+%define ROUND	rbx
+%define TBL	reg3
+
+%define INP_SIZE r9	; blocks left in this batch
+%define ITER	r10	; batches left
+%define NPTR	r11	; _MSG slot of the first nonce word
+%define MPTR	r12	; precomp->msg word of the first nonce word
+%define CPTR	r13	; constant block W[t]+K[t]
+%define CEND	r14
+%define GTMP	r15
+
+; ymm0	a
+; ymm1	b
+; ymm2	c
+; ymm3	d
+; ymm4	e
+; ymm5	f
+; ymm6	g	TMP0
+; ymm7	h	TMP1
+; ymm8	T1	TT0
+; ymm9		TT1
+; ymm10		TT2
+; ymm11		TT3
+; ymm12	a0	TT4
+; ymm13	a1	TT5
+; ymm14	a2	TT6
+; ymm15	TMP	TT7
+
+%define a ymm0
+%define b ymm1
+%define c ymm2
+%define d ymm3
+%define e ymm4
+%define f ymm5
+%define g ymm6
+%define h ymm7
+
+%define T1  ymm8
+
+%define a0 ymm12
+%define a1 ymm13
+%define a2 ymm14
+%define TMP ymm15
+
+%define TMP0 ymm6
+%define TMP1 ymm7
+
+%define TT0 ymm8
+%define TT1 ymm9
+%define TT2 ymm10
+%define TT3 ymm11
+%define TT4 ymm12
+%define TT5 ymm13
+%define TT6 ymm14
+%define TT7 ymm15
+
+%define SZ8	8*SHA256_DIGEST_WORD_SIZE	; Size of one vector register
+%define ROUNDS	64*SZ8
+%define PTR_SZ                  8
+%define SHA256_DIGEST_WORD_SIZE	4
+%define MAX_SHA256_LANES	8
+%define NUM_SHA256_DIGEST_WORDS	8
+%define SHA256_DIGEST_ROW_SIZE	(MAX_SHA256_LANES * SHA256_DIGEST_WORD_SIZE)
+
+; Define stack usage
+
+;; Assume stack aligned to 32 bytes before call
+;; Therefore FRAMESZ mod 32 must be 32-8 = 24
+struc stack_frame
+  .data		resb	16*SZ8
+  .digest	resb	8*SZ8
+  .msg		resb	32*SZ8	; message words of the tail block(s)
+  .nonce	resb	2*SZ8	; 64-bit nonces of lanes 0-3 and 4-7
+  .step		resb	SZ8	; nonce step, in all 4 qwords
+  .shift_l	resb	16	; 8 * byte offset of the nonce in its first word
+  .shift_r	resb	16	; 32 - .shift_l
+  .double	resb	8	; non-zero until the second hash of sha256d is started
+  .rsp		resb	8
+endstruc
+%define FRAMESZ	stack_frame_size
+%define _DIGEST	stack_frame.digest
+%define _MSG	stack_frame.msg
+%define _NONCE	stack_frame.nonce
+%define _STEP	stack_frame.step
+%define _SHIFT_L	stack_frame.shift_l
+%define _SHIFT_R	stack_frame.shift_r
+%define _DOUBLE	stack_frame.double
+%define _RSP_SAVE	stack_frame.rsp
+
+%define VMOVPS	vmovups
+
+
+%macro ROTATE_ARGS 0
+%xdefine TMP_ h
+%xdefine h g
+%xdefine g f
+%xdefine f e
+%xdefine e d
+%xdefine d c
+%xdefine c b
+%xdefine b a
+%xdefine a TMP_
+%endm
+
+; PRORD reg, imm, tmp
+%macro PRORD 3
+%define %%reg %1
+%define %%imm %2
+%define %%tmp %3
+	vpslld	%%tmp, %%reg, (32-(%%imm))
+	vpsrld	%%reg, %%reg, %%imm
+	vpor	%%reg, %%reg, %%tmp
+%endmacro
+
+; non-destructive
+; PRORD_nd reg, imm, tmp, src
+%macro PRORD_nd 4
+%define %%reg %1
+%define %%imm %2
+%define %%tmp %3
+%define %%src %4
+	vpslld	%%tmp, %%src, (32-(%%imm))
+	vpsrld	%%reg, %%src, %%imm
+	vpor	%%reg, %%reg, %%tmp
+%endmacro
+
+; PRORD dst/src, amt
+%macro PRORD 2
+	PRORD	%1, %2, TMP
+%endmacro
+
+; PRORD_nd dst, src, amt
+%macro PRORD_nd 3
+	PRORD_nd	%1, %3, TMP, %2
+%endmacro
+
+;; arguments passed implicitly in preprocessor symbols a...h
+;; T1 holds Wt, and KT is Kt in memory, or none if T1 already holds Wt + Kt
+%macro ROUND_00_15 2
+%define %%T1 %1
+%define %%KT %2
+	PRORD_nd	a0, e, (11-6)	; sig1: a0 = (e >> 5)
+
+	vpxor	a2, f, g	; ch: a2 = f^g
+	vpand	a2, a2, e		; ch: a2 = (f^g)&e
+	vpxor	a2, a2, g		; a2 = ch
+
+	PRORD_nd	a1, e, 25		; sig1: a1 = (e >> 25)
+%ifnidn %%KT, none
+	vpaddd	%%T1, %%T1, %%KT	; T1 = W + K
+%endif
+	vpxor	a0, a0, e	; sig1: a0 = e ^ (e >> 5)
+	PRORD	a0, 6		; sig1: a0 = (e >> 6) ^ (e >> 11)
+	vpaddd	h, h, a2	; h = h + ch
+	PRORD_nd	a2, a, (13-2)	; sig0: a2 = (a >> 11)
+	vpaddd	h, h, %%T1	; h = h + ch + W + K
+	vpxor	a0, a0, a1	; a0 = sigma1
+	PRORD_nd	a1, a, 22	; sig0: a1 = (a >> 22)
+	vpxor	%%T1, a, c	; maj: T1 = a^c
+	add	ROUND, SZ8	; ROUND++
+	vpand	%%T1, %%T1, b	; maj: T1 = (a^c)&b
+	vpaddd	h, h, a0
+
+	vpaddd	d, d, h
+
+	vpxor	a2, a2, a	; sig0: a2 = a ^ (a >> 11)
+	PRORD	a2, 2		; sig0: a2 = (a >> 2) ^ (a >> 13)
+	vpxor	a2, a2, a1	; a2 = sig0
+	vpand	a1, a, c	; maj: a1 = a&c
+	vpor	a1, a1, %%T1	; a1 = maj
+	vpaddd	h, h, a1	; h = h + ch + W + K + maj
+	vpaddd	h, h, a2	; h = h + ch + W + K + maj + sigma0
+
+	ROTATE_ARGS
+%endm
+
+
+;; arguments passed implicitly in preprocessor symbols i, a...h
+%macro ROUND_16_XX 2
+%define %%T1 %1
+%define %%i  %2
+	vmovdqa	%%T1, [SZ8*((%%i-15)&0xf) + rsp]
+	vmovdqa	a1, [SZ8*((%%i-2)&0xf) + rsp]
+	vmovdqa	a0, %%T1
+	PRORD	%%T1, 18-7
+	vmovdqa	a2, a1
+	PRORD	a1, 19-17
+	vpxor	%%T1, %%T1, a0
+	PRORD	%%T1, 7
+	vpxor	a1, a1, a2
+	PRORD	a1, 17
+	vpsrld	a0, a0, 3
+	vpxor	%%T1, %%T1, a0
+	vpsrld	a2, a2, 10
+	vpxor	a1, a1, a2
+	vpaddd	%%T1, %%T1, [SZ8*((%%i-16)&0xf) + rsp]
+	vpaddd	a1, a1, [SZ8*((%%i-7)&0xf) + rsp]
+	vpaddd	%%T1, %%T1, a1
+
+	vmovdqa	[SZ8*(%%i&0xf) + rsp], %%T1
+	ROUND_00_15 %%T1, [TBL + ROUND]
+
+%endm
+
+;; Copy one block (0 or 1) of the message words onto the stack as W0-W15
+%macro LOAD_MSG 1
+%define %%BLOCK %1
+%assign i 0
+%rep 16
+	vmovdqa	TMP, [rsp + _MSG + SZ8*(%%BLOCK*16 + i)]
+	vmovdqa	[SZ8*i + rsp], TMP
+%assign i (i+1)
+%endrep
+%endmacro
+
+;; Put the nonces of this batch into their message words, then step the
+;; lane nonces. The nonce is little endian at byte s of its first word, so
+;; with lo/hi its dwords the words get (lo << 8s), (lo >> (32-8s) | hi << 8s)
+;; and (hi >> (32-8s)), byte swapped and ORed into the template words, which
+;; have zeros in the nonce bytes. For s = 0 the right shifts by 32 give 0.
+;; Clobbers TT0-TT7.
+%macro NONCE_WORDS 0
+	vmovdqa	TT0, [rsp + _NONCE + 0*SZ8]
+	vmovdqa	TT1, [rsp + _NONCE + 1*SZ8]
+	vshufps	TT2, TT0, TT1, 0x88
+	vpermq	TT2, TT2, 0xD8		; lo dwords of lanes 0-7
+	vshufps	TT3, TT0, TT1, 0xDD
+	vpermq	TT3, TT3, 0xD8		; hi dwords of lanes 0-7
+	vpaddq	TT0, TT0, [rsp + _STEP]
+	vpaddq	TT1, TT1, [rsp + _STEP]
+	vmovdqa	[rsp + _NONCE + 0*SZ8], TT0
+	vmovdqa	[rsp + _NONCE + 1*SZ8], TT1
+
+	vmovdqa	TT7, [PSHUFFLE_BYTE_FLIP_MASK]
+	vpslld	TT4, TT2, [rsp + _SHIFT_L]
+	vpsrld	TT2, TT2, [rsp + _SHIFT_R]
+	vpslld	TT5, TT3, [rsp + _SHIFT_L]
+	vpsrld	TT3, TT3, [rsp + _SHIFT_R]
+	vpor	TT2, TT2, TT5
+	vpshufb	TT4, TT4, TT7
+	vpshufb	TT2, TT2, TT7
+	vpshufb	TT3, TT3, TT7
+	vpbroadcastd	TT0, [MPTR + 4*0]
+	vpbroadcastd	TT1, [MPTR + 4*1]
+	vpbroadcastd	TT5, [MPTR + 4*2]
+	vpor	TT4, TT4, TT0
+	vpor	TT2, TT2, TT1
+	vpor	TT3, TT3, TT5
+	vmovdqa	[NPTR + 0*SZ8], TT4
+	vmovdqa	[NPTR + 1*SZ8], TT2
+	vmovdqa	[NPTR + 2*SZ8], TT3
+%endmacro
+
+;; Broadcast the precomputed working variables, named as they are after
+;; the given number of rounds
+%macro LOAD_ROUND_STATE 1
+%define %%ROUNDS_DONE %1
+%rep %%ROUNDS_DONE
+	ROTATE_ARGS
+%endrep
+	vpbroadcastd	a, [PRE + _pre_round_state + 0*4]
+	vpbroadcastd	b, [PRE + _pre_round_state + 1*4]
+	vpbroadcastd	c, [PRE + _pre_round_state + 2*4]
+	vpbroadcastd	d, [PRE + _pre_round_state + 3*4]
+	vpbroadcastd	e, [PRE + _pre_round_state + 4*4]
+	vpbroadcastd	f, [PRE + _pre_round_state + 5*4]
+	vpbroadcastd	g, [PRE + _pre_round_state + 6*4]
+	vpbroadcastd	h, [PRE + _pre_round_state + 7*4]
+%rep ((8 - (%%ROUNDS_DONE % 8)) % 8)
+	ROTATE_ARGS
+%endrep
+	mov	ROUND, %%ROUNDS_DONE*SZ8
+%endmacro
+
+;; uint32_t sha256_mine_x8_avx2(const SHA256_MINE_PRECOMP *precomp, SHA256_MINE_RANGE *range, uint64_t blocks);
+;; arg 1 : PRE : pointer to the nonce-invariant precomputation
+;; arg 2 : RANGE : pointer to the nonce range, lane j of a batch hashes nonce + j,
+;;         nonce, iterations and hit_nonce are updated
+;; arg 3 : NUM_BLKS  : size of input in blocks, 1 or 2
+mk_global sha256_mine_x8_avx2, function, internal
+align 16
+sha256_mine_x8_avx2:
+	endbranch
+	; general registers preserved in outer calling routine
+	; outer calling routine saves all the XMM registers
+
+	; save rsp, allocate 32-byte aligned for local variables
+	mov	rax, rsp
+	sub	rsp, FRAMESZ
+	and	rsp, ~31
+	mov	[rsp + _RSP_SAVE], rax
+
+	lea	TBL,[K256_8_MB]
+
+	;; lane nonces of the first batch, and the step to the next one
+	vpbroadcastq	TT0, [RANGE + _range_nonce]
+	vpaddq	TT1, TT0, [NONCE_LANE_OFFSETS + 0*SZ8]
+	vpaddq	TT0, TT0, [NONCE_LANE_OFFSETS + 1*SZ8]
+	vmovdqa	[rsp + _NONCE + 0*SZ8], TT1
+	vmovdqa	[rsp + _NONCE + 1*SZ8], TT0
+	vpbroadcastq	TT0, [RANGE + _range_nonce_step]
+	vmovdqa	[rsp + _STEP], TT0
+
+	mov	eax, [PRE + _pre_nonce_shift]
+	mov	[rsp + _SHIFT_L], rax	; the shifts only use the low qword
+	neg	eax
+	add	eax, 32
+	mov	[rsp + _SHIFT_R], rax
+
+	;; message words, the same for all lanes but the nonce words
+%assign i 0
+%rep 32
+	vpbroadcastd	TT0, [PRE + _pre_msg + i*4]
+	vmovdqa	[rsp + _MSG + i*SZ8], TT0
+%assign i (i+1)
+%endrep
+	mov	eax, [PRE + _pre_nonce_word]
+	lea	MPTR, [PRE + _pre_msg + 4*rax]
+	shl	rax, 5
+	lea	NPTR, [rsp + _MSG + rax]
+
+	xor	eax, eax
+	mov	ITER, [RANGE + _range_iterations]
+	test	ITER, ITER
+	jz	.done
+
+.batch_loop:
+	NONCE_WORDS
+
+	;; chaining value of the nonce block, same for all lanes
+%assign i 0
+%rep 8
+	vpbroadcastd	a0, [PRE + _pre_state + i*4]
+	vmovdqa	[rsp + _DIGEST + i*SZ8], a0
+%assign i (i+1)
+%endrep
+
+	mov	INP_SIZE, NUM_BLKS
+	mov	eax, [PRE + _pre_flags]
+	and	eax, SHA256_MINE_DOUBLE
+	mov	[rsp + _DOUBLE], rax
+	LOAD_MSG 0
+
+	;; enter the rounds at precomp->start_round
+	mov	eax, [PRE + _pre_start_round]
+%assign i 1
+%rep 15
+	cmp	eax, i
+	je	APPEND(.enter_,i)
+%assign i (i+1)
+%endrep
+	LOAD_ROUND_STATE 0
+
+.round_0:
+%assign i 0
+%rep 16
+%if i > 0
+APPEND(.round_,i):
+%endif
+	vmovdqa	T1, [SZ8*i + rsp]
+	ROUND_00_15	T1, [TBL + ROUND]
+%assign i (i+1)
+%endrep
+
+	jmp	.rounds_16_xx
+align 16
+.rounds_16_xx:
+%rep 16
+	ROUND_16_XX	T1, i
+%assign i (i+1)
+%endrep
+
+	cmp	ROUND,ROUNDS
+	jb	.rounds_16_xx
+
+	sub	INP_SIZE, 1  ;; unit is blocks
+	je	.last_block
+
+	;; add old digest
+	vpaddd	a, a, [rsp + _DIGEST + 0*SZ8]
+	vpaddd	b, b, [rsp + _DIGEST + 1*SZ8]
+	vpaddd	c, c, [rsp + _DIGEST + 2*SZ8]
+	vpaddd	d, d, [rsp + _DIGEST + 3*SZ8]
+	vpaddd	e, e, [rsp + _DIGEST + 4*SZ8]
+	vpaddd	f, f, [rsp + _DIGEST + 5*SZ8]
+	vpaddd	g, g, [rsp + _DIGEST + 6*SZ8]
+	vpaddd	h, h, [rsp + _DIGEST + 7*SZ8]
+
+	;; save old digest
+	vmovdqa	[rsp + _DIGEST + 0*SZ8], a
+	vmovdqa	[rsp + _DIGEST + 1*SZ8], b
+	vmovdqa	[rsp + _DIGEST + 2*SZ8], c
+	vmovdqa	[rsp + _DIGEST + 3*SZ8], d
+	vmovdqa	[rsp + _DIGEST + 4*SZ8], e
+	vmovdqa	[rsp + _DIGEST + 5*SZ8], f
+	vmovdqa	[rsp + _DIGEST + 6*SZ8], g
+	vmovdqa	[rsp + _DIGEST + 7*SZ8], h
+
+	test	dword [PRE + _pre_flags], SHA256_MINE_CONST_TAIL
+	jnz	.const_block
+
+	;; the nonce spills into the next block, process it in full
+	LOAD_MSG 1
+	xor	ROUND, ROUND
+	jmp	.round_0
+
+.const_block:
+	;; no nonce in this block, W[t]+K[t] comes from the precomp
+	lea	CPTR, [PRE + _pre_tail_wk]
+	lea	CEND, [PRE + _pre_tail_wk + 4*64]
+.const_loop:
+%assign i 0
+%rep 16
+	vpbroadcastd	T1, [CPTR + 4*i]
+	ROUND_00_15	T1, none
+%assign i (i+1)
+%endrep
+	add	CPTR, 4*16
+	cmp	CPTR, CEND
+	jb	.const_loop
+
+.last_block:
+	cmp	qword [rsp + _DOUBLE], 0
+	jne	.second_hash
+
+	;; only H0 is needed for the target check, unsigned H0 <= threshold
+	vpaddd	a, a, [rsp + _DIGEST + 0*SZ8]
+	vpbroadcastd	TMP, [PRE + _pre_h0_threshold]
+	vpminud	TMP, TMP, a
+	vpcmpeqd	TMP, TMP, a
+	vmovmskps	eax, TMP
+
+	sub	ITER, 1
+	test	eax, eax
+	jnz	.done
+	test	ITER, ITER
+	jnz	.batch_loop
+	jmp	.done
+
+.second_hash:
+	;; sha256d: the digest, already in message word order, is hashed again
+	mov	qword [rsp + _DOUBLE], 0
+	vpaddd	a, a, [rsp + _DIGEST + 0*SZ8]
+	vpaddd	b, b, [rsp + _DIGEST + 1*SZ8]
+	vpaddd	c, c, [rsp + _DIGEST + 2*SZ8]
+	vpaddd	d, d, [rsp + _DIGEST + 3*SZ8]
+	vpaddd	e, e, [rsp + _DIGEST + 4*SZ8]
+	vpaddd	f, f, [rsp + _DIGEST + 5*SZ8]
+	vpaddd	g, g, [rsp + _DIGEST + 6*SZ8]
+	vpaddd	h, h, [rsp + _DIGEST + 7*SZ8]
+	vmovdqa	[SZ8*0 + rsp], a
+	vmovdqa	[SZ8*1 + rsp], b
+	vmovdqa	[SZ8*2 + rsp], c
+	vmovdqa	[SZ8*3 + rsp], d
+	vmovdqa	[SZ8*4 + rsp], e
+	vmovdqa	[SZ8*5 + rsp], f
+	vmovdqa	[SZ8*6 + rsp], g
+	vmovdqa	[SZ8*7 + rsp], h
+%assign i 0
+%rep 8
+	vpbroadcastd	TMP, [SHA256D_PAD + i*4]
+	vmovdqa	[SZ8*(8+i) + rsp], TMP
+	vpbroadcastd	TMP, [SHA256_IV + i*4]
+	vmovdqa	[rsp + _DIGEST + i*SZ8], TMP
+%assign i (i+1)
+%endrep
+	vpbroadcastd	a, [SHA256_IV + 0*4]
+	vpbroadcastd	b, [SHA256_IV + 1*4]
+	vpbroadcastd	c, [SHA256_IV + 2*4]
+	vpbroadcastd	d, [SHA256_IV + 3*4]
+	vpbroadcastd	e, [SHA256_IV + 4*4]
+	vpbroadcastd	f, [SHA256_IV + 5*4]
+	vpbroadcastd	g, [SHA256_IV + 6*4]
+	vpbroadcastd	h, [SHA256_IV + 7*4]
+	mov	INP_SIZE, 1
+	xor	ROUND, ROUND
+	jmp	.round_0
+
+.done:
+	;; lane 0 of _NONCE is already the nonce of the next batch
+	mov	[RANGE + _range_iterations], ITER
+	mov	GTMP, [rsp + _NONCE]
+	mov	[RANGE + _range_nonce], GTMP
+	sub	GTMP, [RANGE + _range_nonce_step]
+	mov	[RANGE + _range_hit_nonce], GTMP
+
+	;;;;;;;;;;;;;;;;
+	;; Postamble
+	mov	rsp, [rsp + _RSP_SAVE]
+	ret
+
+	;; entry points for a non-zero start round
+%assign i 1
+%rep 15
+APPEND(.enter_,i):
+	LOAD_ROUND_STATE i
+	jmp	APPEND(.round_,i)
+%assign i (i+1)
+%endrep
+
+section .data
+align 64
+K256_8_MB:
+	dq	0x428a2f98428a2f98, 0x428a2f98428a2f98
+	dq	0x428a2f98428a2f98, 0x428a2f98428a2f98
+	dq	0x7137449171374491, 0x7137449171374491
+	dq	0x7137449171374491, 0x7137449171374491
+	dq	0xb5c0fbcfb5c0fbcf, 0xb5c0fbcfb5c0fbcf
+	dq	0xb5c0fbcfb5c0fbcf, 0xb5c0fbcfb5c0fbcf
+	dq	0xe9b5dba5e9b5dba5, 0xe9b5dba5e9b5dba5
+	dq	0xe9b5dba5e9b5dba5, 0xe9b5dba5e9b5dba5
+	dq	0x3956c25b3956c25b, 0x3956c25b3956c25b
+	dq	0x3956c25b3956c25b, 0x3956c25b3956c25b
+	dq	0x59f111f159f111f1, 0x59f111f159f111f1
+	dq	0x59f111f159f111f1, 0x59f111f159f111f1
+	dq	0x923f82a4923f82a4, 0x923f82a4923f82a4
+	dq	0x923f82a4923f82a4, 0x923f82a4923f82a4
+	dq	0xab1c5ed5ab1c5ed5, 0xab1c5ed5ab1c5ed5
+	dq	0xab1c5ed5ab1c5ed5, 0xab1c5ed5ab1c5ed5
+	dq	0xd807aa98d807aa98, 0xd807aa98d807aa98
+	dq	0xd807aa98d807aa98, 0xd807aa98d807aa98
+	dq	0x12835b0112835b01, 0x12835b0112835b01
+	dq	0x12835b0112835b01, 0x12835b0112835b01
+	dq	0x243185be243185be, 0x243185be243185be
+	dq	0x243185be243185be, 0x243185be243185be
+	dq	0x550c7dc3550c7dc3, 0x550c7dc3550c7dc3
+	dq	0x550c7dc3550c7dc3, 0x550c7dc3550c7dc3
+	dq	0x72be5d7472be5d74, 0x72be5d7472be5d74
+	dq	0x72be5d7472be5d74, 0x72be5d7472be5d74
+	dq	0x80deb1fe80deb1fe, 0x80deb1fe80deb1fe
+	dq	0x80deb1fe80deb1fe, 0x80deb1fe80deb1fe
+	dq	0x9bdc06a79bdc06a7, 0x9bdc06a79bdc06a7
+	dq	0x9bdc06a79bdc06a7, 0x9bdc06a79bdc06a7
+	dq	0xc19bf174c19bf174, 0xc19bf174c19bf174
+	dq	0xc19bf174c19bf174, 0xc19bf174c19bf174
+	dq	0xe49b69c1e49b69c1, 0xe49b69c1e49b69c1
+	dq	0xe49b69c1e49b69c1, 0xe49b69c1e49b69c1
+	dq	0xefbe4786efbe4786, 0xefbe4786efbe4786
+	dq	0xefbe4786efbe4786, 0xefbe4786efbe4786
+	dq	0x0fc19dc60fc19dc6, 0x0fc19dc60fc19dc6
+	dq	0x0fc19dc60fc19dc6, 0x0fc19dc60fc19dc6
+	dq	0x240ca1cc240ca1cc, 0x240ca1cc240ca1cc
+	dq	0x240ca1cc240ca1cc, 0x240ca1cc240ca1cc
+	dq	0x2de92c6f2de92c6f, 0x2de92c6f2de92c6f
+	dq	0x2de92c6f2de92c6f, 0x2de92c6f2de92c6f
+	dq	0x4a7484aa4a7484aa, 0x4a7484aa4a7484aa
+	dq	0x4a7484aa4a7484aa, 0x4a7484aa4a7484aa
+	dq	0x5cb0a9dc5cb0a9dc, 0x5cb0a9dc5cb0a9dc
+	dq	0x5cb0a9dc5cb0a9dc, 0x5cb0a9dc5cb0a9dc
+	dq	0x76f988da76f988da, 0x76f988da76f988da
+	dq	0x76f988da76f988da, 0x76f988da76f988da
+	dq	0x983e5152983e5152, 0x983e5152983e5152
+	dq	0x983e5152983e5152, 0x983e5152983e5152
+	dq	0xa831c66da831c66d, 0xa831c66da831c66d
+	dq	0xa831c66da831c66d, 0xa831c66da831c66d
+	dq	0xb00327c8b00327c8, 0xb00327c8b00327c8
+	dq	0xb00327c8b00327c8, 0xb00327c8b00327c8
+	dq	0xbf597fc7bf597fc7, 0xbf597fc7bf597fc7
+	dq	0xbf597fc7bf597fc7, 0xbf597fc7bf597fc7
+	dq	0xc6e00bf3c6e00bf3, 0xc6e00bf3c6e00bf3
+	dq	0xc6e00bf3c6e00bf3, 0xc6e00bf3c6e00bf3
+	dq	0xd5a79147d5a79147, 0xd5a79147d5a79147
+	dq	0xd5a79147d5a79147, 0xd5a79147d5a79147
+	dq	0x06ca635106ca6351, 0x06ca635106ca6351
+	dq	0x06ca635106ca6351, 0x06ca635106ca6351
+	dq	0x1429296714292967, 0x1429296714292967
+	dq	0x1429296714292967, 0x1429296714292967
+	dq	0x27b70a8527b70a85, 0x27b70a8527b70a85
+	dq	0x27b70a8527b70a85, 0x27b70a8527b70a85
+	dq	0x2e1b21382e1b2138, 0x2e1b21382e1b2138
+	dq	0x2e1b21382e1b2138, 0x2e1b21382e1b2138
+	dq	0x4d2c6dfc4d2c6dfc, 0x4d2c6dfc4d2c6dfc
+	dq	0x4d2c6dfc4d2c6dfc, 0x4d2c6dfc4d2c6dfc
+	dq	0x53380d1353380d13, 0x53380d1353380d13
+	dq	0x53380d1353380d13, 0x53380d1353380d13
+	dq	0x650a7354650a7354, 0x650a7354650a7354
+	dq	0x650a7354650a7354, 0x650a7354650a7354
+	dq	0x766a0abb766a0abb, 0x766a0abb766a0abb
+	dq	0x766a0abb766a0abb, 0x766a0abb766a0abb
+	dq	0x81c2c92e81c2c92e, 0x81c2c92e81c2c92e
+	dq	0x81c2c92e81c2c92e, 0x81c2c92e81c2c92e
+	dq	0x92722c8592722c85, 0x92722c8592722c85
+	dq	0x92722c8592722c85, 0x92722c8592722c85
+	dq	0xa2bfe8a1a2bfe8a1, 0xa2bfe8a1a2bfe8a1
+	dq	0xa2bfe8a1a2bfe8a1, 0xa2bfe8a1a2bfe8a1
+	dq	0xa81a664ba81a664b, 0xa81a664ba81a664b
+	dq	0xa81a664ba81a664b, 0xa81a664ba81a664b
+	dq	0xc24b8b70c24b8b70, 0xc24b8b70c24b8b70
+	dq	0xc24b8b70c24b8b70, 0xc24b8b70c24b8b70
+	dq	0xc76c51a3c76c51a3, 0xc76c51a3c76c51a3
+	dq	0xc76c51a3c76c51a3, 0xc76c51a3c76c51a3
+	dq	0xd192e819d192e819, 0xd192e819d192e819
+	dq	0xd192e819d192e819, 0xd192e819d192e819
+	dq	0xd6990624d6990624, 0xd6990624d6990624
+	dq	0xd6990624d6990624, 0xd6990624d6990624
+	dq	0xf40e3585f40e3585, 0xf40e3585f40e3585
+	dq	0xf40e3585f40e3585, 0xf40e3585f40e3585
+	dq	0x106aa070106aa070, 0x106aa070106aa070
+	dq	0x106aa070106aa070, 0x106aa070106aa070
+	dq	0x19a4c11619a4c116, 0x19a4c11619a4c116
+	dq	0x19a4c11619a4c116, 0x19a4c11619a4c116
+	dq	0x1e376c081e376c08, 0x1e376c081e376c08
+	dq	0x1e376c081e376c08, 0x1e376c081e376c08
+	dq	0x2748774c2748774c, 0x2748774c2748774c
+	dq	0x2748774c2748774c, 0x2748774c2748774c
+	dq	0x34b0bcb534b0bcb5, 0x34b0bcb534b0bcb5
+	dq	0x34b0bcb534b0bcb5, 0x34b0bcb534b0bcb5
+	dq	0x391c0cb3391c0cb3, 0x391c0cb3391c0cb3
+	dq	0x391c0cb3391c0cb3, 0x391c0cb3391c0cb3
+	dq	0x4ed8aa4a4ed8aa4a, 0x4ed8aa4a4ed8aa4a
+	dq	0x4ed8aa4a4ed8aa4a, 0x4ed8aa4a4ed8aa4a
+	dq	0x5b9cca4f5b9cca4f, 0x5b9cca4f5b9cca4f
+	dq	0x5b9cca4f5b9cca4f, 0x5b9cca4f5b9cca4f
+	dq	0x682e6ff3682e6ff3, 0x682e6ff3682e6ff3
+	dq	0x682e6ff3682e6ff3, 0x682e6ff3682e6ff3
+	dq	0x748f82ee748f82ee, 0x748f82ee748f82ee
+	dq	0x748f82ee748f82ee, 0x748f82ee748f82ee
+	dq	0x78a5636f78a5636f, 0x78a5636f78a5636f
+	dq	0x78a5636f78a5636f, 0x78a5636f78a5636f
+	dq	0x84c8781484c87814, 0x84c8781484c87814
+	dq	0x84c8781484c87814, 0x84c8781484c87814
+	dq	0x8cc702088cc70208, 0x8cc702088cc70208
+	dq	0x8cc702088cc70208, 0x8cc702088cc70208
+	dq	0x90befffa90befffa, 0x90befffa90befffa
+	dq	0x90befffa90befffa, 0x90befffa90befffa
+	dq	0xa4506ceba4506ceb, 0xa4506ceba4506ceb
+	dq	0xa4506ceba4506ceb, 0xa4506ceba4506ceb
+	dq	0xbef9a3f7bef9a3f7, 0xbef9a3f7bef9a3f7
+	dq	0xbef9a3f7bef9a3f7, 0xbef9a3f7bef9a3f7
+	dq	0xc67178f2c67178f2, 0xc67178f2c67178f2
+	dq	0xc67178f2c67178f2, 0xc67178f2c67178f2
+PSHUFFLE_BYTE_FLIP_MASK: dq 0x0405060700010203, 0x0c0d0e0f08090a0b
+			 dq 0x0405060700010203, 0x0c0d0e0f08090a0b
+NONCE_LANE_OFFSETS:	dq 0, 1, 2, 3, 4, 5, 6, 7
+SHA256_IV:	dd 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a
+		dd 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+;; padding of a 32-byte message, W8-W15
+SHA256D_PAD:	dd 0x80000000, 0, 0, 0, 0, 0, 0, 256
@@ -149,6 +149,7 @@ public:
     static bool AVX512ER(void) { return CPU_Rep.f_7_EBX_[27]; }
     static bool AVX512CD(void) { return CPU_Rep.f_7_EBX_[28]; }
     static bool SHA(void) { return CPU_Rep.f_7_EBX_[29]; }
+    static bool AVX512VL(void) { return CPU_Rep.f_7_EBX_[31]; }
 
     static bool PREFETCHWT1(void) { return CPU_Rep.f_7_ECX_[0]; }
 
@@ -303,6 +304,7 @@ void print_cpu_extensions()
     support_message("AVX512ER", InstructionSet::AVX512ER());
     support_message("AVX512F", InstructionSet::AVX512F());
     support_message("AVX512PF", InstructionSet::AVX512PF());
+    support_message("AVX512VL", InstructionSet::AVX512VL());
     support_message("BMI1", InstructionSet::BMI1());
     support_message("BMI2", InstructionSet::BMI2());
     support_message("CLFSH", InstructionSet::CLFSH());
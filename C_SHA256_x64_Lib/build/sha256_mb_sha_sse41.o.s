@@ -0,0 +1,1183 @@
+.intel_syntax noprefix
+.section .note.GNU-stack
+.section .text
+.section .text
+.globl sha256_mb_x2_sha_sse41
+.balign 32
+sha256_mb_x2_sha_sse41:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+test rsi, rsi
+jz M_15_return
+sub rsp, 72
+movdqa xmm15, [rip + PSHUFFLE_SHANI_MASK]
+lea rax, [rip + TABLE]
+pinsrd xmm1, [rdi + 0 + 4*(0*2 + 0)], 3
+pinsrd xmm1, [rdi + 0 + 4*(1*2 + 0)], 2
+pinsrd xmm2, [rdi + 0 + 4*(2*2 + 0)], 3
+pinsrd xmm2, [rdi + 0 + 4*(3*2 + 0)], 2
+pinsrd xmm1, [rdi + 0 + 4*(4*2 + 0)], 1
+pinsrd xmm1, [rdi + 0 + 4*(5*2 + 0)], 0
+pinsrd xmm2, [rdi + 0 + 4*(6*2 + 0)], 1
+pinsrd xmm2, [rdi + 0 + 4*(7*2 + 0)], 0
+pinsrd xmm3, [rdi + 0 + 4*(0*2 + 0+1)], 3
+pinsrd xmm3, [rdi + 0 + 4*(1*2 + 0+1)], 2
+pinsrd xmm4, [rdi + 0 + 4*(2*2 + 0+1)], 3
+pinsrd xmm4, [rdi + 0 + 4*(3*2 + 0+1)], 2
+pinsrd xmm3, [rdi + 0 + 4*(4*2 + 0+1)], 1
+pinsrd xmm3, [rdi + 0 + 4*(5*2 + 0+1)], 0
+pinsrd xmm4, [rdi + 0 + 4*(6*2 + 0+1)], 1
+pinsrd xmm4, [rdi + 0 + 4*(7*2 + 0+1)], 0
+mov r8, [rdi + 512 + 8*0]
+mov r9, [rdi + 512 + 8*(0+1)]
+mov r10, rsi
+M_17_block_loop:
+movdqa [rsp + 0], xmm1
+movdqa [rsp + 16], xmm2
+movdqa [rsp + 32], xmm3
+movdqa [rsp + 48], xmm4
+movdqu xmm5, [r8 + 0*16]
+pshufb xmm5, xmm15
+movdqa xmm13, xmm5
+paddd xmm13, [rax + 0*16]
+movdqu xmm9, [r9 + 0*16]
+pshufb xmm9, xmm15
+movdqa xmm14, xmm9
+paddd xmm14, [rax + 0*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqu xmm6, [r8 + 1*16]
+pshufb xmm6, xmm15
+movdqa xmm13, xmm6
+paddd xmm13, [rax + 1*16]
+movdqu xmm10, [r9 + 1*16]
+pshufb xmm10, xmm15
+movdqa xmm14, xmm10
+paddd xmm14, [rax + 1*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+sha256msg1 xmm5, xmm6
+sha256msg1 xmm9, xmm10
+movdqu xmm7, [r8 + 2*16]
+pshufb xmm7, xmm15
+movdqa xmm13, xmm7
+paddd xmm13, [rax + 2*16]
+movdqu xmm11, [r9 + 2*16]
+pshufb xmm11, xmm15
+movdqa xmm14, xmm11
+paddd xmm14, [rax + 2*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+sha256msg1 xmm6, xmm7
+sha256msg1 xmm10, xmm11
+movdqu xmm8, [r8 + 3*16]
+pshufb xmm8, xmm15
+movdqa xmm13, xmm8
+paddd xmm13, [rax + 3*16]
+movdqu xmm12, [r9 + 3*16]
+pshufb xmm12, xmm15
+movdqa xmm14, xmm12
+paddd xmm14, [rax + 3*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm8
+palignr xmm13, xmm7, 4
+paddd xmm5, xmm13
+sha256msg2 xmm5, xmm8
+sha256msg1 xmm7, xmm8
+movdqa xmm14, xmm12
+palignr xmm14, xmm11, 4
+paddd xmm9, xmm14
+sha256msg2 xmm9, xmm12
+sha256msg1 xmm11, xmm12
+movdqa xmm13, xmm5
+paddd xmm13, [rax + 4*16]
+movdqa xmm14, xmm9
+paddd xmm14, [rax + 4*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm5
+palignr xmm13, xmm8, 4
+paddd xmm6, xmm13
+sha256msg2 xmm6, xmm5
+sha256msg1 xmm8, xmm5
+movdqa xmm14, xmm9
+palignr xmm14, xmm12, 4
+paddd xmm10, xmm14
+sha256msg2 xmm10, xmm9
+sha256msg1 xmm12, xmm9
+movdqa xmm13, xmm6
+paddd xmm13, [rax + 5*16]
+movdqa xmm14, xmm10
+paddd xmm14, [rax + 5*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm6
+palignr xmm13, xmm5, 4
+paddd xmm7, xmm13
+sha256msg2 xmm7, xmm6
+sha256msg1 xmm5, xmm6
+movdqa xmm14, xmm10
+palignr xmm14, xmm9, 4
+paddd xmm11, xmm14
+sha256msg2 xmm11, xmm10
+sha256msg1 xmm9, xmm10
+movdqa xmm13, xmm7
+paddd xmm13, [rax + 6*16]
+movdqa xmm14, xmm11
+paddd xmm14, [rax + 6*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm7
+palignr xmm13, xmm6, 4
+paddd xmm8, xmm13
+sha256msg2 xmm8, xmm7
+sha256msg1 xmm6, xmm7
+movdqa xmm14, xmm11
+palignr xmm14, xmm10, 4
+paddd xmm12, xmm14
+sha256msg2 xmm12, xmm11
+sha256msg1 xmm10, xmm11
+movdqa xmm13, xmm8
+paddd xmm13, [rax + 7*16]
+movdqa xmm14, xmm12
+paddd xmm14, [rax + 7*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm8
+palignr xmm13, xmm7, 4
+paddd xmm5, xmm13
+sha256msg2 xmm5, xmm8
+sha256msg1 xmm7, xmm8
+movdqa xmm14, xmm12
+palignr xmm14, xmm11, 4
+paddd xmm9, xmm14
+sha256msg2 xmm9, xmm12
+sha256msg1 xmm11, xmm12
+movdqa xmm13, xmm5
+paddd xmm13, [rax + 8*16]
+movdqa xmm14, xmm9
+paddd xmm14, [rax + 8*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm5
+palignr xmm13, xmm8, 4
+paddd xmm6, xmm13
+sha256msg2 xmm6, xmm5
+sha256msg1 xmm8, xmm5
+movdqa xmm14, xmm9
+palignr xmm14, xmm12, 4
+paddd xmm10, xmm14
+sha256msg2 xmm10, xmm9
+sha256msg1 xmm12, xmm9
+movdqa xmm13, xmm6
+paddd xmm13, [rax + 9*16]
+movdqa xmm14, xmm10
+paddd xmm14, [rax + 9*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm6
+palignr xmm13, xmm5, 4
+paddd xmm7, xmm13
+sha256msg2 xmm7, xmm6
+sha256msg1 xmm5, xmm6
+movdqa xmm14, xmm10
+palignr xmm14, xmm9, 4
+paddd xmm11, xmm14
+sha256msg2 xmm11, xmm10
+sha256msg1 xmm9, xmm10
+movdqa xmm13, xmm7
+paddd xmm13, [rax + 10*16]
+movdqa xmm14, xmm11
+paddd xmm14, [rax + 10*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm7
+palignr xmm13, xmm6, 4
+paddd xmm8, xmm13
+sha256msg2 xmm8, xmm7
+sha256msg1 xmm6, xmm7
+movdqa xmm14, xmm11
+palignr xmm14, xmm10, 4
+paddd xmm12, xmm14
+sha256msg2 xmm12, xmm11
+sha256msg1 xmm10, xmm11
+movdqa xmm13, xmm8
+paddd xmm13, [rax + 11*16]
+movdqa xmm14, xmm12
+paddd xmm14, [rax + 11*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm8
+palignr xmm13, xmm7, 4
+paddd xmm5, xmm13
+sha256msg2 xmm5, xmm8
+sha256msg1 xmm7, xmm8
+movdqa xmm14, xmm12
+palignr xmm14, xmm11, 4
+paddd xmm9, xmm14
+sha256msg2 xmm9, xmm12
+sha256msg1 xmm11, xmm12
+movdqa xmm13, xmm5
+paddd xmm13, [rax + 12*16]
+movdqa xmm14, xmm9
+paddd xmm14, [rax + 12*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm5
+palignr xmm13, xmm8, 4
+paddd xmm6, xmm13
+sha256msg2 xmm6, xmm5
+sha256msg1 xmm8, xmm5
+movdqa xmm14, xmm9
+palignr xmm14, xmm12, 4
+paddd xmm10, xmm14
+sha256msg2 xmm10, xmm9
+sha256msg1 xmm12, xmm9
+movdqa xmm13, xmm6
+paddd xmm13, [rax + 13*16]
+movdqa xmm14, xmm10
+paddd xmm14, [rax + 13*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm6
+palignr xmm13, xmm5, 4
+paddd xmm7, xmm13
+sha256msg2 xmm7, xmm6
+movdqa xmm14, xmm10
+palignr xmm14, xmm9, 4
+paddd xmm11, xmm14
+sha256msg2 xmm11, xmm10
+movdqa xmm13, xmm7
+paddd xmm13, [rax + 14*16]
+movdqa xmm14, xmm11
+paddd xmm14, [rax + 14*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm7
+palignr xmm13, xmm6, 4
+paddd xmm8, xmm13
+sha256msg2 xmm8, xmm7
+movdqa xmm14, xmm11
+palignr xmm14, xmm10, 4
+paddd xmm12, xmm14
+sha256msg2 xmm12, xmm11
+movdqa xmm13, xmm8
+paddd xmm13, [rax + 15*16]
+movdqa xmm14, xmm12
+paddd xmm14, [rax + 15*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+paddd xmm1, [rsp + 0]
+paddd xmm2, [rsp + 16]
+paddd xmm3, [rsp + 32]
+paddd xmm4, [rsp + 48]
+add r8, 64
+add r9, 64
+sub r10, 1
+jnz M_17_block_loop
+pextrd [rdi + 0 + 4*(0*2 + 0)], xmm1, 3
+pextrd [rdi + 0 + 4*(1*2 + 0)], xmm1, 2
+pextrd [rdi + 0 + 4*(2*2 + 0)], xmm2, 3
+pextrd [rdi + 0 + 4*(3*2 + 0)], xmm2, 2
+pextrd [rdi + 0 + 4*(4*2 + 0)], xmm1, 1
+pextrd [rdi + 0 + 4*(5*2 + 0)], xmm1, 0
+pextrd [rdi + 0 + 4*(6*2 + 0)], xmm2, 1
+pextrd [rdi + 0 + 4*(7*2 + 0)], xmm2, 0
+pextrd [rdi + 0 + 4*(0*2 + 0+1)], xmm3, 3
+pextrd [rdi + 0 + 4*(1*2 + 0+1)], xmm3, 2
+pextrd [rdi + 0 + 4*(2*2 + 0+1)], xmm4, 3
+pextrd [rdi + 0 + 4*(3*2 + 0+1)], xmm4, 2
+pextrd [rdi + 0 + 4*(4*2 + 0+1)], xmm3, 1
+pextrd [rdi + 0 + 4*(5*2 + 0+1)], xmm3, 0
+pextrd [rdi + 0 + 4*(6*2 + 0+1)], xmm4, 1
+pextrd [rdi + 0 + 4*(7*2 + 0+1)], xmm4, 0
+mov [rdi + 512 + 8*0], r8
+mov [rdi + 512 + 8*(0+1)], r9
+add rsp, 72
+M_15_return:
+ret
+.globl sha256_mb_x4_sha_sse41
+.balign 32
+sha256_mb_x4_sha_sse41:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+test rsi, rsi
+jz M_102_return
+sub rsp, 72
+movdqa xmm15, [rip + PSHUFFLE_SHANI_MASK]
+lea rax, [rip + TABLE]
+pinsrd xmm1, [rdi + 0 + 4*(0*4 + 0)], 3
+pinsrd xmm1, [rdi + 0 + 4*(1*4 + 0)], 2
+pinsrd xmm2, [rdi + 0 + 4*(2*4 + 0)], 3
+pinsrd xmm2, [rdi + 0 + 4*(3*4 + 0)], 2
+pinsrd xmm1, [rdi + 0 + 4*(4*4 + 0)], 1
+pinsrd xmm1, [rdi + 0 + 4*(5*4 + 0)], 0
+pinsrd xmm2, [rdi + 0 + 4*(6*4 + 0)], 1
+pinsrd xmm2, [rdi + 0 + 4*(7*4 + 0)], 0
+pinsrd xmm3, [rdi + 0 + 4*(0*4 + 0+1)], 3
+pinsrd xmm3, [rdi + 0 + 4*(1*4 + 0+1)], 2
+pinsrd xmm4, [rdi + 0 + 4*(2*4 + 0+1)], 3
+pinsrd xmm4, [rdi + 0 + 4*(3*4 + 0+1)], 2
+pinsrd xmm3, [rdi + 0 + 4*(4*4 + 0+1)], 1
+pinsrd xmm3, [rdi + 0 + 4*(5*4 + 0+1)], 0
+pinsrd xmm4, [rdi + 0 + 4*(6*4 + 0+1)], 1
+pinsrd xmm4, [rdi + 0 + 4*(7*4 + 0+1)], 0
+mov r8, [rdi + 512 + 8*0]
+mov r9, [rdi + 512 + 8*(0+1)]
+mov r10, rsi
+M_104_block_loop:
+movdqa [rsp + 0], xmm1
+movdqa [rsp + 16], xmm2
+movdqa [rsp + 32], xmm3
+movdqa [rsp + 48], xmm4
+movdqu xmm5, [r8 + 0*16]
+pshufb xmm5, xmm15
+movdqa xmm13, xmm5
+paddd xmm13, [rax + 0*16]
+movdqu xmm9, [r9 + 0*16]
+pshufb xmm9, xmm15
+movdqa xmm14, xmm9
+paddd xmm14, [rax + 0*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqu xmm6, [r8 + 1*16]
+pshufb xmm6, xmm15
+movdqa xmm13, xmm6
+paddd xmm13, [rax + 1*16]
+movdqu xmm10, [r9 + 1*16]
+pshufb xmm10, xmm15
+movdqa xmm14, xmm10
+paddd xmm14, [rax + 1*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+sha256msg1 xmm5, xmm6
+sha256msg1 xmm9, xmm10
+movdqu xmm7, [r8 + 2*16]
+pshufb xmm7, xmm15
+movdqa xmm13, xmm7
+paddd xmm13, [rax + 2*16]
+movdqu xmm11, [r9 + 2*16]
+pshufb xmm11, xmm15
+movdqa xmm14, xmm11
+paddd xmm14, [rax + 2*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+sha256msg1 xmm6, xmm7
+sha256msg1 xmm10, xmm11
+movdqu xmm8, [r8 + 3*16]
+pshufb xmm8, xmm15
+movdqa xmm13, xmm8
+paddd xmm13, [rax + 3*16]
+movdqu xmm12, [r9 + 3*16]
+pshufb xmm12, xmm15
+movdqa xmm14, xmm12
+paddd xmm14, [rax + 3*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm8
+palignr xmm13, xmm7, 4
+paddd xmm5, xmm13
+sha256msg2 xmm5, xmm8
+sha256msg1 xmm7, xmm8
+movdqa xmm14, xmm12
+palignr xmm14, xmm11, 4
+paddd xmm9, xmm14
+sha256msg2 xmm9, xmm12
+sha256msg1 xmm11, xmm12
+movdqa xmm13, xmm5
+paddd xmm13, [rax + 4*16]
+movdqa xmm14, xmm9
+paddd xmm14, [rax + 4*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm5
+palignr xmm13, xmm8, 4
+paddd xmm6, xmm13
+sha256msg2 xmm6, xmm5
+sha256msg1 xmm8, xmm5
+movdqa xmm14, xmm9
+palignr xmm14, xmm12, 4
+paddd xmm10, xmm14
+sha256msg2 xmm10, xmm9
+sha256msg1 xmm12, xmm9
+movdqa xmm13, xmm6
+paddd xmm13, [rax + 5*16]
+movdqa xmm14, xmm10
+paddd xmm14, [rax + 5*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm6
+palignr xmm13, xmm5, 4
+paddd xmm7, xmm13
+sha256msg2 xmm7, xmm6
+sha256msg1 xmm5, xmm6
+movdqa xmm14, xmm10
+palignr xmm14, xmm9, 4
+paddd xmm11, xmm14
+sha256msg2 xmm11, xmm10
+sha256msg1 xmm9, xmm10
+movdqa xmm13, xmm7
+paddd xmm13, [rax + 6*16]
+movdqa xmm14, xmm11
+paddd xmm14, [rax + 6*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm7
+palignr xmm13, xmm6, 4
+paddd xmm8, xmm13
+sha256msg2 xmm8, xmm7
+sha256msg1 xmm6, xmm7
+movdqa xmm14, xmm11
+palignr xmm14, xmm10, 4
+paddd xmm12, xmm14
+sha256msg2 xmm12, xmm11
+sha256msg1 xmm10, xmm11
+movdqa xmm13, xmm8
+paddd xmm13, [rax + 7*16]
+movdqa xmm14, xmm12
+paddd xmm14, [rax + 7*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm8
+palignr xmm13, xmm7, 4
+paddd xmm5, xmm13
+sha256msg2 xmm5, xmm8
+sha256msg1 xmm7, xmm8
+movdqa xmm14, xmm12
+palignr xmm14, xmm11, 4
+paddd xmm9, xmm14
+sha256msg2 xmm9, xmm12
+sha256msg1 xmm11, xmm12
+movdqa xmm13, xmm5
+paddd xmm13, [rax + 8*16]
+movdqa xmm14, xmm9
+paddd xmm14, [rax + 8*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm5
+palignr xmm13, xmm8, 4
+paddd xmm6, xmm13
+sha256msg2 xmm6, xmm5
+sha256msg1 xmm8, xmm5
+movdqa xmm14, xmm9
+palignr xmm14, xmm12, 4
+paddd xmm10, xmm14
+sha256msg2 xmm10, xmm9
+sha256msg1 xmm12, xmm9
+movdqa xmm13, xmm6
+paddd xmm13, [rax + 9*16]
+movdqa xmm14, xmm10
+paddd xmm14, [rax + 9*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm6
+palignr xmm13, xmm5, 4
+paddd xmm7, xmm13
+sha256msg2 xmm7, xmm6
+sha256msg1 xmm5, xmm6
+movdqa xmm14, xmm10
+palignr xmm14, xmm9, 4
+paddd xmm11, xmm14
+sha256msg2 xmm11, xmm10
+sha256msg1 xmm9, xmm10
+movdqa xmm13, xmm7
+paddd xmm13, [rax + 10*16]
+movdqa xmm14, xmm11
+paddd xmm14, [rax + 10*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm7
+palignr xmm13, xmm6, 4
+paddd xmm8, xmm13
+sha256msg2 xmm8, xmm7
+sha256msg1 xmm6, xmm7
+movdqa xmm14, xmm11
+palignr xmm14, xmm10, 4
+paddd xmm12, xmm14
+sha256msg2 xmm12, xmm11
+sha256msg1 xmm10, xmm11
+movdqa xmm13, xmm8
+paddd xmm13, [rax + 11*16]
+movdqa xmm14, xmm12
+paddd xmm14, [rax + 11*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm8
+palignr xmm13, xmm7, 4
+paddd xmm5, xmm13
+sha256msg2 xmm5, xmm8
+sha256msg1 xmm7, xmm8
+movdqa xmm14, xmm12
+palignr xmm14, xmm11, 4
+paddd xmm9, xmm14
+sha256msg2 xmm9, xmm12
+sha256msg1 xmm11, xmm12
+movdqa xmm13, xmm5
+paddd xmm13, [rax + 12*16]
+movdqa xmm14, xmm9
+paddd xmm14, [rax + 12*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm5
+palignr xmm13, xmm8, 4
+paddd xmm6, xmm13
+sha256msg2 xmm6, xmm5
+sha256msg1 xmm8, xmm5
+movdqa xmm14, xmm9
+palignr xmm14, xmm12, 4
+paddd xmm10, xmm14
+sha256msg2 xmm10, xmm9
+sha256msg1 xmm12, xmm9
+movdqa xmm13, xmm6
+paddd xmm13, [rax + 13*16]
+movdqa xmm14, xmm10
+paddd xmm14, [rax + 13*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm6
+palignr xmm13, xmm5, 4
+paddd xmm7, xmm13
+sha256msg2 xmm7, xmm6
+movdqa xmm14, xmm10
+palignr xmm14, xmm9, 4
+paddd xmm11, xmm14
+sha256msg2 xmm11, xmm10
+movdqa xmm13, xmm7
+paddd xmm13, [rax + 14*16]
+movdqa xmm14, xmm11
+paddd xmm14, [rax + 14*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm7
+palignr xmm13, xmm6, 4
+paddd xmm8, xmm13
+sha256msg2 xmm8, xmm7
+movdqa xmm14, xmm11
+palignr xmm14, xmm10, 4
+paddd xmm12, xmm14
+sha256msg2 xmm12, xmm11
+movdqa xmm13, xmm8
+paddd xmm13, [rax + 15*16]
+movdqa xmm14, xmm12
+paddd xmm14, [rax + 15*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+paddd xmm1, [rsp + 0]
+paddd xmm2, [rsp + 16]
+paddd xmm3, [rsp + 32]
+paddd xmm4, [rsp + 48]
+add r8, 64
+add r9, 64
+sub r10, 1
+jnz M_104_block_loop
+pextrd [rdi + 0 + 4*(0*4 + 0)], xmm1, 3
+pextrd [rdi + 0 + 4*(1*4 + 0)], xmm1, 2
+pextrd [rdi + 0 + 4*(2*4 + 0)], xmm2, 3
+pextrd [rdi + 0 + 4*(3*4 + 0)], xmm2, 2
+pextrd [rdi + 0 + 4*(4*4 + 0)], xmm1, 1
+pextrd [rdi + 0 + 4*(5*4 + 0)], xmm1, 0
+pextrd [rdi + 0 + 4*(6*4 + 0)], xmm2, 1
+pextrd [rdi + 0 + 4*(7*4 + 0)], xmm2, 0
+pextrd [rdi + 0 + 4*(0*4 + 0+1)], xmm3, 3
+pextrd [rdi + 0 + 4*(1*4 + 0+1)], xmm3, 2
+pextrd [rdi + 0 + 4*(2*4 + 0+1)], xmm4, 3
+pextrd [rdi + 0 + 4*(3*4 + 0+1)], xmm4, 2
+pextrd [rdi + 0 + 4*(4*4 + 0+1)], xmm3, 1
+pextrd [rdi + 0 + 4*(5*4 + 0+1)], xmm3, 0
+pextrd [rdi + 0 + 4*(6*4 + 0+1)], xmm4, 1
+pextrd [rdi + 0 + 4*(7*4 + 0+1)], xmm4, 0
+mov [rdi + 512 + 8*0], r8
+mov [rdi + 512 + 8*(0+1)], r9
+pinsrd xmm1, [rdi + 0 + 4*(0*4 + 2)], 3
+pinsrd xmm1, [rdi + 0 + 4*(1*4 + 2)], 2
+pinsrd xmm2, [rdi + 0 + 4*(2*4 + 2)], 3
+pinsrd xmm2, [rdi + 0 + 4*(3*4 + 2)], 2
+pinsrd xmm1, [rdi + 0 + 4*(4*4 + 2)], 1
+pinsrd xmm1, [rdi + 0 + 4*(5*4 + 2)], 0
+pinsrd xmm2, [rdi + 0 + 4*(6*4 + 2)], 1
+pinsrd xmm2, [rdi + 0 + 4*(7*4 + 2)], 0
+pinsrd xmm3, [rdi + 0 + 4*(0*4 + 2+1)], 3
+pinsrd xmm3, [rdi + 0 + 4*(1*4 + 2+1)], 2
+pinsrd xmm4, [rdi + 0 + 4*(2*4 + 2+1)], 3
+pinsrd xmm4, [rdi + 0 + 4*(3*4 + 2+1)], 2
+pinsrd xmm3, [rdi + 0 + 4*(4*4 + 2+1)], 1
+pinsrd xmm3, [rdi + 0 + 4*(5*4 + 2+1)], 0
+pinsrd xmm4, [rdi + 0 + 4*(6*4 + 2+1)], 1
+pinsrd xmm4, [rdi + 0 + 4*(7*4 + 2+1)], 0
+mov r8, [rdi + 512 + 8*2]
+mov r9, [rdi + 512 + 8*(2+1)]
+mov r10, rsi
+M_189_block_loop:
+movdqa [rsp + 0], xmm1
+movdqa [rsp + 16], xmm2
+movdqa [rsp + 32], xmm3
+movdqa [rsp + 48], xmm4
+movdqu xmm5, [r8 + 0*16]
+pshufb xmm5, xmm15
+movdqa xmm13, xmm5
+paddd xmm13, [rax + 0*16]
+movdqu xmm9, [r9 + 0*16]
+pshufb xmm9, xmm15
+movdqa xmm14, xmm9
+paddd xmm14, [rax + 0*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqu xmm6, [r8 + 1*16]
+pshufb xmm6, xmm15
+movdqa xmm13, xmm6
+paddd xmm13, [rax + 1*16]
+movdqu xmm10, [r9 + 1*16]
+pshufb xmm10, xmm15
+movdqa xmm14, xmm10
+paddd xmm14, [rax + 1*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+sha256msg1 xmm5, xmm6
+sha256msg1 xmm9, xmm10
+movdqu xmm7, [r8 + 2*16]
+pshufb xmm7, xmm15
+movdqa xmm13, xmm7
+paddd xmm13, [rax + 2*16]
+movdqu xmm11, [r9 + 2*16]
+pshufb xmm11, xmm15
+movdqa xmm14, xmm11
+paddd xmm14, [rax + 2*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+sha256msg1 xmm6, xmm7
+sha256msg1 xmm10, xmm11
+movdqu xmm8, [r8 + 3*16]
+pshufb xmm8, xmm15
+movdqa xmm13, xmm8
+paddd xmm13, [rax + 3*16]
+movdqu xmm12, [r9 + 3*16]
+pshufb xmm12, xmm15
+movdqa xmm14, xmm12
+paddd xmm14, [rax + 3*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm8
+palignr xmm13, xmm7, 4
+paddd xmm5, xmm13
+sha256msg2 xmm5, xmm8
+sha256msg1 xmm7, xmm8
+movdqa xmm14, xmm12
+palignr xmm14, xmm11, 4
+paddd xmm9, xmm14
+sha256msg2 xmm9, xmm12
+sha256msg1 xmm11, xmm12
+movdqa xmm13, xmm5
+paddd xmm13, [rax + 4*16]
+movdqa xmm14, xmm9
+paddd xmm14, [rax + 4*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm5
+palignr xmm13, xmm8, 4
+paddd xmm6, xmm13
+sha256msg2 xmm6, xmm5
+sha256msg1 xmm8, xmm5
+movdqa xmm14, xmm9
+palignr xmm14, xmm12, 4
+paddd xmm10, xmm14
+sha256msg2 xmm10, xmm9
+sha256msg1 xmm12, xmm9
+movdqa xmm13, xmm6
+paddd xmm13, [rax + 5*16]
+movdqa xmm14, xmm10
+paddd xmm14, [rax + 5*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm6
+palignr xmm13, xmm5, 4
+paddd xmm7, xmm13
+sha256msg2 xmm7, xmm6
+sha256msg1 xmm5, xmm6
+movdqa xmm14, xmm10
+palignr xmm14, xmm9, 4
+paddd xmm11, xmm14
+sha256msg2 xmm11, xmm10
+sha256msg1 xmm9, xmm10
+movdqa xmm13, xmm7
+paddd xmm13, [rax + 6*16]
+movdqa xmm14, xmm11
+paddd xmm14, [rax + 6*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm7
+palignr xmm13, xmm6, 4
+paddd xmm8, xmm13
+sha256msg2 xmm8, xmm7
+sha256msg1 xmm6, xmm7
+movdqa xmm14, xmm11
+palignr xmm14, xmm10, 4
+paddd xmm12, xmm14
+sha256msg2 xmm12, xmm11
+sha256msg1 xmm10, xmm11
+movdqa xmm13, xmm8
+paddd xmm13, [rax + 7*16]
+movdqa xmm14, xmm12
+paddd xmm14, [rax + 7*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm8
+palignr xmm13, xmm7, 4
+paddd xmm5, xmm13
+sha256msg2 xmm5, xmm8
+sha256msg1 xmm7, xmm8
+movdqa xmm14, xmm12
+palignr xmm14, xmm11, 4
+paddd xmm9, xmm14
+sha256msg2 xmm9, xmm12
+sha256msg1 xmm11, xmm12
+movdqa xmm13, xmm5
+paddd xmm13, [rax + 8*16]
+movdqa xmm14, xmm9
+paddd xmm14, [rax + 8*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm5
+palignr xmm13, xmm8, 4
+paddd xmm6, xmm13
+sha256msg2 xmm6, xmm5
+sha256msg1 xmm8, xmm5
+movdqa xmm14, xmm9
+palignr xmm14, xmm12, 4
+paddd xmm10, xmm14
+sha256msg2 xmm10, xmm9
+sha256msg1 xmm12, xmm9
+movdqa xmm13, xmm6
+paddd xmm13, [rax + 9*16]
+movdqa xmm14, xmm10
+paddd xmm14, [rax + 9*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm6
+palignr xmm13, xmm5, 4
+paddd xmm7, xmm13
+sha256msg2 xmm7, xmm6
+sha256msg1 xmm5, xmm6
+movdqa xmm14, xmm10
+palignr xmm14, xmm9, 4
+paddd xmm11, xmm14
+sha256msg2 xmm11, xmm10
+sha256msg1 xmm9, xmm10
+movdqa xmm13, xmm7
+paddd xmm13, [rax + 10*16]
+movdqa xmm14, xmm11
+paddd xmm14, [rax + 10*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm7
+palignr xmm13, xmm6, 4
+paddd xmm8, xmm13
+sha256msg2 xmm8, xmm7
+sha256msg1 xmm6, xmm7
+movdqa xmm14, xmm11
+palignr xmm14, xmm10, 4
+paddd xmm12, xmm14
+sha256msg2 xmm12, xmm11
+sha256msg1 xmm10, xmm11
+movdqa xmm13, xmm8
+paddd xmm13, [rax + 11*16]
+movdqa xmm14, xmm12
+paddd xmm14, [rax + 11*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm8
+palignr xmm13, xmm7, 4
+paddd xmm5, xmm13
+sha256msg2 xmm5, xmm8
+sha256msg1 xmm7, xmm8
+movdqa xmm14, xmm12
+palignr xmm14, xmm11, 4
+paddd xmm9, xmm14
+sha256msg2 xmm9, xmm12
+sha256msg1 xmm11, xmm12
+movdqa xmm13, xmm5
+paddd xmm13, [rax + 12*16]
+movdqa xmm14, xmm9
+paddd xmm14, [rax + 12*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm5
+palignr xmm13, xmm8, 4
+paddd xmm6, xmm13
+sha256msg2 xmm6, xmm5
+sha256msg1 xmm8, xmm5
+movdqa xmm14, xmm9
+palignr xmm14, xmm12, 4
+paddd xmm10, xmm14
+sha256msg2 xmm10, xmm9
+sha256msg1 xmm12, xmm9
+movdqa xmm13, xmm6
+paddd xmm13, [rax + 13*16]
+movdqa xmm14, xmm10
+paddd xmm14, [rax + 13*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm6
+palignr xmm13, xmm5, 4
+paddd xmm7, xmm13
+sha256msg2 xmm7, xmm6
+movdqa xmm14, xmm10
+palignr xmm14, xmm9, 4
+paddd xmm11, xmm14
+sha256msg2 xmm11, xmm10
+movdqa xmm13, xmm7
+paddd xmm13, [rax + 14*16]
+movdqa xmm14, xmm11
+paddd xmm14, [rax + 14*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+movdqa xmm13, xmm7
+palignr xmm13, xmm6, 4
+paddd xmm8, xmm13
+sha256msg2 xmm8, xmm7
+movdqa xmm14, xmm11
+palignr xmm14, xmm10, 4
+paddd xmm12, xmm14
+sha256msg2 xmm12, xmm11
+movdqa xmm13, xmm8
+paddd xmm13, [rax + 15*16]
+movdqa xmm14, xmm12
+paddd xmm14, [rax + 15*16]
+movdqa xmm0, xmm13
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm0, xmm14
+sha256rnds2 xmm4, xmm3, xmm0
+pshufd xmm0, xmm13, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+pshufd xmm0, xmm14, 0x0E
+sha256rnds2 xmm3, xmm4, xmm0
+paddd xmm1, [rsp + 0]
+paddd xmm2, [rsp + 16]
+paddd xmm3, [rsp + 32]
+paddd xmm4, [rsp + 48]
+add r8, 64
+add r9, 64
+sub r10, 1
+jnz M_189_block_loop
+pextrd [rdi + 0 + 4*(0*4 + 2)], xmm1, 3
+pextrd [rdi + 0 + 4*(1*4 + 2)], xmm1, 2
+pextrd [rdi + 0 + 4*(2*4 + 2)], xmm2, 3
+pextrd [rdi + 0 + 4*(3*4 + 2)], xmm2, 2
+pextrd [rdi + 0 + 4*(4*4 + 2)], xmm1, 1
+pextrd [rdi + 0 + 4*(5*4 + 2)], xmm1, 0
+pextrd [rdi + 0 + 4*(6*4 + 2)], xmm2, 1
+pextrd [rdi + 0 + 4*(7*4 + 2)], xmm2, 0
+pextrd [rdi + 0 + 4*(0*4 + 2+1)], xmm3, 3
+pextrd [rdi + 0 + 4*(1*4 + 2+1)], xmm3, 2
+pextrd [rdi + 0 + 4*(2*4 + 2+1)], xmm4, 3
+pextrd [rdi + 0 + 4*(3*4 + 2+1)], xmm4, 2
+pextrd [rdi + 0 + 4*(4*4 + 2+1)], xmm3, 1
+pextrd [rdi + 0 + 4*(5*4 + 2+1)], xmm3, 0
+pextrd [rdi + 0 + 4*(6*4 + 2+1)], xmm4, 1
+pextrd [rdi + 0 + 4*(7*4 + 2+1)], xmm4, 0
+mov [rdi + 512 + 8*2], r8
+mov [rdi + 512 + 8*(2+1)], r9
+add rsp, 72
+M_102_return:
+ret
+.section .data
+.balign 16
+PSHUFFLE_SHANI_MASK:
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
+TABLE:
+.long 0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5
+.long 0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5
+.long 0xd807aa98,0x12835b01,0x243185be,0x550c7dc3
+.long 0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174
+.long 0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc
+.long 0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da
+.long 0x983e5152,0xa831c66d,0xb00327c8,0xbf597fc7
+.long 0xc6e00bf3,0xd5a79147,0x06ca6351,0x14292967
+.long 0x27b70a85,0x2e1b2138,0x4d2c6dfc,0x53380d13
+.long 0x650a7354,0x766a0abb,0x81c2c92e,0x92722c85
+.long 0xa2bfe8a1,0xa81a664b,0xc24b8b70,0xc76c51a3
+.long 0xd192e819,0xd6990624,0xf40e3585,0x106aa070
+.long 0x19a4c116,0x1e376c08,0x2748774c,0x34b0bcb5
+.long 0x391c0cb3,0x4ed8aa4a,0x5b9cca4f,0x682e6ff3
+.long 0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208
+.long 0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
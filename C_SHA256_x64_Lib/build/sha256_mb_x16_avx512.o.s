@@ -0,0 +1,2684 @@
+.intel_syntax noprefix
+.section .note.GNU-stack
+.section .text
+.section .text
+.balign 64
+.globl sha256_mb_x16_avx512
+sha256_mb_x16_avx512:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+mov rax, rsp
+sub rsp, 520
+and rsp, ~63
+mov [rsp + 512], rax
+lea rcx, [rip + TABLE]
+vmovups zmm0, [rdi + 0*64]
+vmovups zmm1, [rdi + 1*64]
+vmovups zmm2, [rdi + 2*64]
+vmovups zmm3, [rdi + 3*64]
+vmovups zmm4, [rdi + 4*64]
+vmovups zmm5, [rdi + 5*64]
+vmovups zmm6, [rdi + 6*64]
+vmovups zmm7, [rdi + 7*64]
+xor rdx, rdx
+mov r9, [(rdi + 512) + 0*8]
+mov r10, [(rdi + 512) + 1*8]
+mov r11, [(rdi + 512) + 2*8]
+mov r12, [(rdi + 512) + 3*8]
+mov r13, [(rdi + 512) + 4*8]
+mov r14, [(rdi + 512) + 5*8]
+mov r15, [(rdi + 512) + 6*8]
+mov rax, [(rdi + 512) + 7*8]
+vmovups zmm16,[r9+rdx]
+vmovups zmm17,[r10+rdx]
+vmovups zmm18,[r11+rdx]
+vmovups zmm19,[r12+rdx]
+vmovups zmm20,[r13+rdx]
+vmovups zmm21,[r14+rdx]
+vmovups zmm22,[r15+rdx]
+vmovups zmm23,[rax+rdx]
+mov r9, [(rdi + 512) + 8*8]
+mov r10, [(rdi + 512) + 9*8]
+mov r11, [(rdi + 512) +10*8]
+mov r12, [(rdi + 512) +11*8]
+mov r13, [(rdi + 512) +12*8]
+mov r14, [(rdi + 512) +13*8]
+mov r15, [(rdi + 512) +14*8]
+mov rax, [(rdi + 512) +15*8]
+vmovups zmm24, [r9+rdx]
+vmovups zmm25, [r10+rdx]
+vmovups zmm26,[r11+rdx]
+vmovups zmm27,[r12+rdx]
+vmovups zmm28,[r13+rdx]
+vmovups zmm29,[r14+rdx]
+vmovups zmm30,[r15+rdx]
+vmovups zmm31,[rax+rdx]
+lloop:
+vmovdqa32 zmm11, [rip + PSHUFFLE_BYTE_FLIP_MASK]
+vmovdqa32 zmm12, [rcx]
+vmovdqa32 [rsp + 0 + 64*0], zmm0
+vmovdqa32 [rsp + 0 + 64*1], zmm1
+vmovdqa32 [rsp + 0 + 64*2], zmm2
+vmovdqa32 [rsp + 0 + 64*3], zmm3
+vmovdqa32 [rsp + 0 + 64*4], zmm4
+vmovdqa32 [rsp + 0 + 64*5], zmm5
+vmovdqa32 [rsp + 0 + 64*6], zmm6
+vmovdqa32 [rsp + 0 + 64*7], zmm7
+add rdx, 64
+vshufps zmm9, zmm16, zmm17, 0x44
+vshufps zmm16, zmm16, zmm17, 0xEE
+vshufps zmm10, zmm18, zmm19, 0x44
+vshufps zmm18, zmm18, zmm19, 0xEE
+vshufps zmm19, zmm9, zmm10, 0xDD
+vshufps zmm17, zmm16, zmm18, 0x88
+vshufps zmm16, zmm16, zmm18, 0xDD
+vshufps zmm9, zmm9, zmm10, 0x88
+vshufps zmm18, zmm20, zmm21, 0x44
+vshufps zmm20, zmm20, zmm21, 0xEE
+vshufps zmm10, zmm22, zmm23, 0x44
+vshufps zmm22, zmm22, zmm23, 0xEE
+vshufps zmm23, zmm18, zmm10, 0xDD
+vshufps zmm21, zmm20, zmm22, 0x88
+vshufps zmm20, zmm20, zmm22, 0xDD
+vshufps zmm18, zmm18, zmm10, 0x88
+vshufps zmm22, zmm24, zmm25,    0x44
+vshufps zmm24, zmm24, zmm25,    0xEE
+vshufps zmm10, zmm26, zmm27,  0x44
+vshufps zmm26, zmm26, zmm27, 0xEE
+vshufps zmm27, zmm22, zmm10, 0xDD
+vshufps zmm25, zmm24, zmm26, 0x88
+vshufps zmm24, zmm24, zmm26, 0xDD
+vshufps zmm22, zmm22, zmm10,  0x88
+vshufps zmm26, zmm28, zmm29, 0x44
+vshufps zmm28, zmm28, zmm29, 0xEE
+vshufps zmm10, zmm30, zmm31,  0x44
+vshufps zmm30, zmm30, zmm31, 0xEE
+vshufps zmm31, zmm26, zmm10,  0xDD
+vshufps zmm29, zmm28, zmm30, 0x88
+vshufps zmm28, zmm28, zmm30, 0xDD
+vshufps zmm26, zmm26, zmm10,  0x88
+vmovdqa32 zmm30, [rip + PSHUFFLE_TRANSPOSE16_MASK1]
+vpermi2q zmm30, zmm9, zmm18
+vmovdqa32 zmm10,  [rip + PSHUFFLE_TRANSPOSE16_MASK2]
+vpermi2q zmm10,  zmm9, zmm18
+vmovdqa32 zmm18, [rip + PSHUFFLE_TRANSPOSE16_MASK1]
+vpermi2q zmm18, zmm19, zmm23
+vmovdqa32 zmm9, [rip + PSHUFFLE_TRANSPOSE16_MASK2]
+vpermi2q zmm9, zmm19, zmm23
+vmovdqa32 zmm19, [rip + PSHUFFLE_TRANSPOSE16_MASK1]
+vpermi2q zmm19, zmm17, zmm21
+vmovdqa32 zmm23, [rip + PSHUFFLE_TRANSPOSE16_MASK2]
+vpermi2q zmm23, zmm17, zmm21
+vmovdqa32 zmm17, [rip + PSHUFFLE_TRANSPOSE16_MASK1]
+vpermi2q zmm17, zmm16, zmm20
+vmovdqa32 zmm21, [rip + PSHUFFLE_TRANSPOSE16_MASK2]
+vpermi2q zmm21, zmm16, zmm20
+vmovdqa32 zmm16, [rip + PSHUFFLE_TRANSPOSE16_MASK1]
+vpermi2q zmm16, zmm22, zmm26
+vmovdqa32 zmm20,  [rip + PSHUFFLE_TRANSPOSE16_MASK2]
+vpermi2q zmm20, zmm22, zmm26
+vmovdqa32 zmm22, [rip + PSHUFFLE_TRANSPOSE16_MASK1]
+vpermi2q zmm22, zmm27, zmm31
+vmovdqa32 zmm26, [rip + PSHUFFLE_TRANSPOSE16_MASK2]
+vpermi2q zmm26, zmm27, zmm31
+vmovdqa32 zmm27, [rip + PSHUFFLE_TRANSPOSE16_MASK1]
+vpermi2q zmm27, zmm25, zmm29
+vmovdqa32 zmm31, [rip + PSHUFFLE_TRANSPOSE16_MASK2]
+vpermi2q zmm31, zmm25, zmm29
+vmovdqa32 zmm25, [rip + PSHUFFLE_TRANSPOSE16_MASK1]
+vpermi2q zmm25, zmm24, zmm28
+vmovdqa32 zmm29, [rip + PSHUFFLE_TRANSPOSE16_MASK2]
+vpermi2q zmm29, zmm24, zmm28
+vshuff64x2 zmm24, zmm30, zmm16, 0xEE
+vshuff64x2 zmm16, zmm30, zmm16, 0x44
+vshuff64x2 zmm28, zmm10, zmm20, 0xEE
+vshuff64x2 zmm20, zmm10, zmm20, 0x44
+vshuff64x2 zmm30, zmm23, zmm31, 0xEE
+vshuff64x2 zmm10, zmm23, zmm31, 0x44
+vshuff64x2 zmm31, zmm21, zmm29, 0xEE
+vshuff64x2 zmm23, zmm21, zmm29, 0x44
+vshuff64x2 zmm29, zmm9, zmm26, 0xEE
+vshuff64x2 zmm21, zmm9, zmm26, 0x44
+vshuff64x2 zmm26, zmm19, zmm27, 0xEE
+vshuff64x2 zmm9, zmm19, zmm27, 0x44
+vshuff64x2 zmm27, zmm17, zmm25, 0xEE
+vshuff64x2 zmm19, zmm17, zmm25, 0x44
+vshuff64x2 zmm25, zmm18, zmm22, 0xEE
+vshuff64x2 zmm17, zmm18, zmm22, 0x44
+vmovdqa32 zmm18, zmm9
+vmovdqa32 zmm22, zmm10
+vpshufb zmm16, zmm16, zmm11
+vpshufb zmm17, zmm17, zmm11
+vpshufb zmm18, zmm18, zmm11
+vpshufb zmm19, zmm19, zmm11
+vpshufb zmm20, zmm20, zmm11
+vpshufb zmm21, zmm21, zmm11
+vpshufb zmm22, zmm22, zmm11
+vpshufb zmm23, zmm23, zmm11
+vpshufb zmm24, zmm24, zmm11
+vpshufb zmm25, zmm25, zmm11
+vpshufb zmm26, zmm26, zmm11
+vpshufb zmm27, zmm27, zmm11
+vpshufb zmm28, zmm28, zmm11
+vpshufb zmm29, zmm29, zmm11
+vpshufb zmm30, zmm30, zmm11
+vpshufb zmm31, zmm31, zmm11
+vpaddd zmm8, zmm7, zmm12
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm16
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vmovdqa32 zmm12, [rcx + ((0+1)*64)]
+vprord zmm13, zmm30, 17
+vprord zmm14, zmm30, 19
+vpsrld zmm15, zmm30, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm16, zmm16, zmm13
+vpaddd zmm16, zmm16, zmm25
+vprord zmm13, zmm17, 7
+vprord zmm14, zmm17, 18
+vpsrld zmm15, zmm17, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm16, zmm16, zmm13
+vpaddd zmm8, zmm6, zmm12
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm17
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vmovdqa32 zmm12, [rcx + ((1+1)*64)]
+vprord zmm13, zmm31, 17
+vprord zmm14, zmm31, 19
+vpsrld zmm15, zmm31, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm17, zmm17, zmm13
+vpaddd zmm17, zmm17, zmm26
+vprord zmm13, zmm18, 7
+vprord zmm14, zmm18, 18
+vpsrld zmm15, zmm18, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm17, zmm17, zmm13
+vpaddd zmm8, zmm5, zmm12
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm18
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vmovdqa32 zmm12, [rcx + ((2+1)*64)]
+vprord zmm13, zmm16, 17
+vprord zmm14, zmm16, 19
+vpsrld zmm15, zmm16, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm18, zmm18, zmm13
+vpaddd zmm18, zmm18, zmm27
+vprord zmm13, zmm19, 7
+vprord zmm14, zmm19, 18
+vpsrld zmm15, zmm19, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm18, zmm18, zmm13
+vpaddd zmm8, zmm4, zmm12
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm19
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vmovdqa32 zmm12, [rcx + ((3+1)*64)]
+vprord zmm13, zmm17, 17
+vprord zmm14, zmm17, 19
+vpsrld zmm15, zmm17, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm19, zmm19, zmm13
+vpaddd zmm19, zmm19, zmm28
+vprord zmm13, zmm20, 7
+vprord zmm14, zmm20, 18
+vpsrld zmm15, zmm20, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm19, zmm19, zmm13
+vpaddd zmm8, zmm3, zmm12
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm20
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vmovdqa32 zmm12, [rcx + ((4+1)*64)]
+vprord zmm13, zmm18, 17
+vprord zmm14, zmm18, 19
+vpsrld zmm15, zmm18, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm20, zmm20, zmm13
+vpaddd zmm20, zmm20, zmm29
+vprord zmm13, zmm21, 7
+vprord zmm14, zmm21, 18
+vpsrld zmm15, zmm21, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm20, zmm20, zmm13
+vpaddd zmm8, zmm2, zmm12
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm21
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vmovdqa32 zmm12, [rcx + ((5+1)*64)]
+vprord zmm13, zmm19, 17
+vprord zmm14, zmm19, 19
+vpsrld zmm15, zmm19, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm21, zmm21, zmm13
+vpaddd zmm21, zmm21, zmm30
+vprord zmm13, zmm22, 7
+vprord zmm14, zmm22, 18
+vpsrld zmm15, zmm22, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm21, zmm21, zmm13
+vpaddd zmm8, zmm1, zmm12
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm22
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vmovdqa32 zmm12, [rcx + ((6+1)*64)]
+vprord zmm13, zmm20, 17
+vprord zmm14, zmm20, 19
+vpsrld zmm15, zmm20, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm22, zmm22, zmm13
+vpaddd zmm22, zmm22, zmm31
+vprord zmm13, zmm23, 7
+vprord zmm14, zmm23, 18
+vpsrld zmm15, zmm23, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm22, zmm22, zmm13
+vpaddd zmm8, zmm0, zmm12
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm23
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vmovdqa32 zmm12, [rcx + ((7+1)*64)]
+vprord zmm13, zmm21, 17
+vprord zmm14, zmm21, 19
+vpsrld zmm15, zmm21, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm23, zmm23, zmm13
+vpaddd zmm23, zmm23, zmm16
+vprord zmm13, zmm24, 7
+vprord zmm14, zmm24, 18
+vpsrld zmm15, zmm24, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm23, zmm23, zmm13
+vpaddd zmm8, zmm7, zmm12
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm24
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vmovdqa32 zmm12, [rcx + ((8+1)*64)]
+vprord zmm13, zmm22, 17
+vprord zmm14, zmm22, 19
+vpsrld zmm15, zmm22, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm24, zmm24, zmm13
+vpaddd zmm24, zmm24, zmm17
+vprord zmm13, zmm25, 7
+vprord zmm14, zmm25, 18
+vpsrld zmm15, zmm25, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm24, zmm24, zmm13
+vpaddd zmm8, zmm6, zmm12
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm25
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vmovdqa32 zmm12, [rcx + ((9+1)*64)]
+vprord zmm13, zmm23, 17
+vprord zmm14, zmm23, 19
+vpsrld zmm15, zmm23, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm25, zmm25, zmm13
+vpaddd zmm25, zmm25, zmm18
+vprord zmm13, zmm26, 7
+vprord zmm14, zmm26, 18
+vpsrld zmm15, zmm26, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm25, zmm25, zmm13
+vpaddd zmm8, zmm5, zmm12
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm26
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vmovdqa32 zmm12, [rcx + ((10+1)*64)]
+vprord zmm13, zmm24, 17
+vprord zmm14, zmm24, 19
+vpsrld zmm15, zmm24, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm26, zmm26, zmm13
+vpaddd zmm26, zmm26, zmm19
+vprord zmm13, zmm27, 7
+vprord zmm14, zmm27, 18
+vpsrld zmm15, zmm27, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm26, zmm26, zmm13
+vpaddd zmm8, zmm4, zmm12
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm27
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vmovdqa32 zmm12, [rcx + ((11+1)*64)]
+vprord zmm13, zmm25, 17
+vprord zmm14, zmm25, 19
+vpsrld zmm15, zmm25, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm27, zmm27, zmm13
+vpaddd zmm27, zmm27, zmm20
+vprord zmm13, zmm28, 7
+vprord zmm14, zmm28, 18
+vpsrld zmm15, zmm28, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm27, zmm27, zmm13
+vpaddd zmm8, zmm3, zmm12
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm28
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vmovdqa32 zmm12, [rcx + ((12+1)*64)]
+vprord zmm13, zmm26, 17
+vprord zmm14, zmm26, 19
+vpsrld zmm15, zmm26, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm28, zmm28, zmm13
+vpaddd zmm28, zmm28, zmm21
+vprord zmm13, zmm29, 7
+vprord zmm14, zmm29, 18
+vpsrld zmm15, zmm29, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm28, zmm28, zmm13
+vpaddd zmm8, zmm2, zmm12
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm29
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vmovdqa32 zmm12, [rcx + ((13+1)*64)]
+vprord zmm13, zmm27, 17
+vprord zmm14, zmm27, 19
+vpsrld zmm15, zmm27, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm29, zmm29, zmm13
+vpaddd zmm29, zmm29, zmm22
+vprord zmm13, zmm30, 7
+vprord zmm14, zmm30, 18
+vpsrld zmm15, zmm30, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm29, zmm29, zmm13
+vpaddd zmm8, zmm1, zmm12
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm30
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vmovdqa32 zmm12, [rcx + ((14+1)*64)]
+vprord zmm13, zmm28, 17
+vprord zmm14, zmm28, 19
+vpsrld zmm15, zmm28, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm30, zmm30, zmm13
+vpaddd zmm30, zmm30, zmm23
+vprord zmm13, zmm31, 7
+vprord zmm14, zmm31, 18
+vpsrld zmm15, zmm31, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm30, zmm30, zmm13
+vpaddd zmm8, zmm0, zmm12
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm31
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vmovdqa32 zmm12, [rcx + ((15+1)*64)]
+vprord zmm13, zmm29, 17
+vprord zmm14, zmm29, 19
+vpsrld zmm15, zmm29, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm31, zmm31, zmm13
+vpaddd zmm31, zmm31, zmm24
+vprord zmm13, zmm16, 7
+vprord zmm14, zmm16, 18
+vpsrld zmm15, zmm16, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm31, zmm31, zmm13
+vpaddd zmm8, zmm7, zmm12
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm16
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vmovdqa32 zmm12, [rcx + ((16+1)*64)]
+vprord zmm13, zmm30, 17
+vprord zmm14, zmm30, 19
+vpsrld zmm15, zmm30, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm16, zmm16, zmm13
+vpaddd zmm16, zmm16, zmm25
+vprord zmm13, zmm17, 7
+vprord zmm14, zmm17, 18
+vpsrld zmm15, zmm17, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm16, zmm16, zmm13
+vpaddd zmm8, zmm6, zmm12
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm17
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vmovdqa32 zmm12, [rcx + ((17+1)*64)]
+vprord zmm13, zmm31, 17
+vprord zmm14, zmm31, 19
+vpsrld zmm15, zmm31, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm17, zmm17, zmm13
+vpaddd zmm17, zmm17, zmm26
+vprord zmm13, zmm18, 7
+vprord zmm14, zmm18, 18
+vpsrld zmm15, zmm18, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm17, zmm17, zmm13
+vpaddd zmm8, zmm5, zmm12
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm18
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vmovdqa32 zmm12, [rcx + ((18+1)*64)]
+vprord zmm13, zmm16, 17
+vprord zmm14, zmm16, 19
+vpsrld zmm15, zmm16, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm18, zmm18, zmm13
+vpaddd zmm18, zmm18, zmm27
+vprord zmm13, zmm19, 7
+vprord zmm14, zmm19, 18
+vpsrld zmm15, zmm19, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm18, zmm18, zmm13
+vpaddd zmm8, zmm4, zmm12
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm19
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vmovdqa32 zmm12, [rcx + ((19+1)*64)]
+vprord zmm13, zmm17, 17
+vprord zmm14, zmm17, 19
+vpsrld zmm15, zmm17, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm19, zmm19, zmm13
+vpaddd zmm19, zmm19, zmm28
+vprord zmm13, zmm20, 7
+vprord zmm14, zmm20, 18
+vpsrld zmm15, zmm20, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm19, zmm19, zmm13
+vpaddd zmm8, zmm3, zmm12
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm20
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vmovdqa32 zmm12, [rcx + ((20+1)*64)]
+vprord zmm13, zmm18, 17
+vprord zmm14, zmm18, 19
+vpsrld zmm15, zmm18, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm20, zmm20, zmm13
+vpaddd zmm20, zmm20, zmm29
+vprord zmm13, zmm21, 7
+vprord zmm14, zmm21, 18
+vpsrld zmm15, zmm21, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm20, zmm20, zmm13
+vpaddd zmm8, zmm2, zmm12
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm21
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vmovdqa32 zmm12, [rcx + ((21+1)*64)]
+vprord zmm13, zmm19, 17
+vprord zmm14, zmm19, 19
+vpsrld zmm15, zmm19, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm21, zmm21, zmm13
+vpaddd zmm21, zmm21, zmm30
+vprord zmm13, zmm22, 7
+vprord zmm14, zmm22, 18
+vpsrld zmm15, zmm22, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm21, zmm21, zmm13
+vpaddd zmm8, zmm1, zmm12
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm22
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vmovdqa32 zmm12, [rcx + ((22+1)*64)]
+vprord zmm13, zmm20, 17
+vprord zmm14, zmm20, 19
+vpsrld zmm15, zmm20, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm22, zmm22, zmm13
+vpaddd zmm22, zmm22, zmm31
+vprord zmm13, zmm23, 7
+vprord zmm14, zmm23, 18
+vpsrld zmm15, zmm23, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm22, zmm22, zmm13
+vpaddd zmm8, zmm0, zmm12
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm23
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vmovdqa32 zmm12, [rcx + ((23+1)*64)]
+vprord zmm13, zmm21, 17
+vprord zmm14, zmm21, 19
+vpsrld zmm15, zmm21, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm23, zmm23, zmm13
+vpaddd zmm23, zmm23, zmm16
+vprord zmm13, zmm24, 7
+vprord zmm14, zmm24, 18
+vpsrld zmm15, zmm24, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm23, zmm23, zmm13
+vpaddd zmm8, zmm7, zmm12
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm24
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vmovdqa32 zmm12, [rcx + ((24+1)*64)]
+vprord zmm13, zmm22, 17
+vprord zmm14, zmm22, 19
+vpsrld zmm15, zmm22, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm24, zmm24, zmm13
+vpaddd zmm24, zmm24, zmm17
+vprord zmm13, zmm25, 7
+vprord zmm14, zmm25, 18
+vpsrld zmm15, zmm25, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm24, zmm24, zmm13
+vpaddd zmm8, zmm6, zmm12
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm25
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vmovdqa32 zmm12, [rcx + ((25+1)*64)]
+vprord zmm13, zmm23, 17
+vprord zmm14, zmm23, 19
+vpsrld zmm15, zmm23, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm25, zmm25, zmm13
+vpaddd zmm25, zmm25, zmm18
+vprord zmm13, zmm26, 7
+vprord zmm14, zmm26, 18
+vpsrld zmm15, zmm26, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm25, zmm25, zmm13
+vpaddd zmm8, zmm5, zmm12
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm26
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vmovdqa32 zmm12, [rcx + ((26+1)*64)]
+vprord zmm13, zmm24, 17
+vprord zmm14, zmm24, 19
+vpsrld zmm15, zmm24, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm26, zmm26, zmm13
+vpaddd zmm26, zmm26, zmm19
+vprord zmm13, zmm27, 7
+vprord zmm14, zmm27, 18
+vpsrld zmm15, zmm27, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm26, zmm26, zmm13
+vpaddd zmm8, zmm4, zmm12
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm27
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vmovdqa32 zmm12, [rcx + ((27+1)*64)]
+vprord zmm13, zmm25, 17
+vprord zmm14, zmm25, 19
+vpsrld zmm15, zmm25, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm27, zmm27, zmm13
+vpaddd zmm27, zmm27, zmm20
+vprord zmm13, zmm28, 7
+vprord zmm14, zmm28, 18
+vpsrld zmm15, zmm28, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm27, zmm27, zmm13
+vpaddd zmm8, zmm3, zmm12
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm28
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vmovdqa32 zmm12, [rcx + ((28+1)*64)]
+vprord zmm13, zmm26, 17
+vprord zmm14, zmm26, 19
+vpsrld zmm15, zmm26, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm28, zmm28, zmm13
+vpaddd zmm28, zmm28, zmm21
+vprord zmm13, zmm29, 7
+vprord zmm14, zmm29, 18
+vpsrld zmm15, zmm29, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm28, zmm28, zmm13
+vpaddd zmm8, zmm2, zmm12
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm29
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vmovdqa32 zmm12, [rcx + ((29+1)*64)]
+vprord zmm13, zmm27, 17
+vprord zmm14, zmm27, 19
+vpsrld zmm15, zmm27, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm29, zmm29, zmm13
+vpaddd zmm29, zmm29, zmm22
+vprord zmm13, zmm30, 7
+vprord zmm14, zmm30, 18
+vpsrld zmm15, zmm30, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm29, zmm29, zmm13
+vpaddd zmm8, zmm1, zmm12
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm30
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vmovdqa32 zmm12, [rcx + ((30+1)*64)]
+vprord zmm13, zmm28, 17
+vprord zmm14, zmm28, 19
+vpsrld zmm15, zmm28, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm30, zmm30, zmm13
+vpaddd zmm30, zmm30, zmm23
+vprord zmm13, zmm31, 7
+vprord zmm14, zmm31, 18
+vpsrld zmm15, zmm31, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm30, zmm30, zmm13
+vpaddd zmm8, zmm0, zmm12
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm31
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vmovdqa32 zmm12, [rcx + ((31+1)*64)]
+vprord zmm13, zmm29, 17
+vprord zmm14, zmm29, 19
+vpsrld zmm15, zmm29, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm31, zmm31, zmm13
+vpaddd zmm31, zmm31, zmm24
+vprord zmm13, zmm16, 7
+vprord zmm14, zmm16, 18
+vpsrld zmm15, zmm16, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm31, zmm31, zmm13
+vpaddd zmm8, zmm7, zmm12
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm16
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vmovdqa32 zmm12, [rcx + ((32+1)*64)]
+vprord zmm13, zmm30, 17
+vprord zmm14, zmm30, 19
+vpsrld zmm15, zmm30, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm16, zmm16, zmm13
+vpaddd zmm16, zmm16, zmm25
+vprord zmm13, zmm17, 7
+vprord zmm14, zmm17, 18
+vpsrld zmm15, zmm17, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm16, zmm16, zmm13
+vpaddd zmm8, zmm6, zmm12
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm17
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vmovdqa32 zmm12, [rcx + ((33+1)*64)]
+vprord zmm13, zmm31, 17
+vprord zmm14, zmm31, 19
+vpsrld zmm15, zmm31, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm17, zmm17, zmm13
+vpaddd zmm17, zmm17, zmm26
+vprord zmm13, zmm18, 7
+vprord zmm14, zmm18, 18
+vpsrld zmm15, zmm18, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm17, zmm17, zmm13
+vpaddd zmm8, zmm5, zmm12
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm18
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vmovdqa32 zmm12, [rcx + ((34+1)*64)]
+vprord zmm13, zmm16, 17
+vprord zmm14, zmm16, 19
+vpsrld zmm15, zmm16, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm18, zmm18, zmm13
+vpaddd zmm18, zmm18, zmm27
+vprord zmm13, zmm19, 7
+vprord zmm14, zmm19, 18
+vpsrld zmm15, zmm19, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm18, zmm18, zmm13
+vpaddd zmm8, zmm4, zmm12
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm19
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vmovdqa32 zmm12, [rcx + ((35+1)*64)]
+vprord zmm13, zmm17, 17
+vprord zmm14, zmm17, 19
+vpsrld zmm15, zmm17, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm19, zmm19, zmm13
+vpaddd zmm19, zmm19, zmm28
+vprord zmm13, zmm20, 7
+vprord zmm14, zmm20, 18
+vpsrld zmm15, zmm20, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm19, zmm19, zmm13
+vpaddd zmm8, zmm3, zmm12
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm20
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vmovdqa32 zmm12, [rcx + ((36+1)*64)]
+vprord zmm13, zmm18, 17
+vprord zmm14, zmm18, 19
+vpsrld zmm15, zmm18, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm20, zmm20, zmm13
+vpaddd zmm20, zmm20, zmm29
+vprord zmm13, zmm21, 7
+vprord zmm14, zmm21, 18
+vpsrld zmm15, zmm21, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm20, zmm20, zmm13
+vpaddd zmm8, zmm2, zmm12
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm21
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vmovdqa32 zmm12, [rcx + ((37+1)*64)]
+vprord zmm13, zmm19, 17
+vprord zmm14, zmm19, 19
+vpsrld zmm15, zmm19, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm21, zmm21, zmm13
+vpaddd zmm21, zmm21, zmm30
+vprord zmm13, zmm22, 7
+vprord zmm14, zmm22, 18
+vpsrld zmm15, zmm22, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm21, zmm21, zmm13
+vpaddd zmm8, zmm1, zmm12
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm22
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vmovdqa32 zmm12, [rcx + ((38+1)*64)]
+vprord zmm13, zmm20, 17
+vprord zmm14, zmm20, 19
+vpsrld zmm15, zmm20, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm22, zmm22, zmm13
+vpaddd zmm22, zmm22, zmm31
+vprord zmm13, zmm23, 7
+vprord zmm14, zmm23, 18
+vpsrld zmm15, zmm23, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm22, zmm22, zmm13
+vpaddd zmm8, zmm0, zmm12
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm23
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vmovdqa32 zmm12, [rcx + ((39+1)*64)]
+vprord zmm13, zmm21, 17
+vprord zmm14, zmm21, 19
+vpsrld zmm15, zmm21, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm23, zmm23, zmm13
+vpaddd zmm23, zmm23, zmm16
+vprord zmm13, zmm24, 7
+vprord zmm14, zmm24, 18
+vpsrld zmm15, zmm24, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm23, zmm23, zmm13
+vpaddd zmm8, zmm7, zmm12
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm24
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vmovdqa32 zmm12, [rcx + ((40+1)*64)]
+vprord zmm13, zmm22, 17
+vprord zmm14, zmm22, 19
+vpsrld zmm15, zmm22, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm24, zmm24, zmm13
+vpaddd zmm24, zmm24, zmm17
+vprord zmm13, zmm25, 7
+vprord zmm14, zmm25, 18
+vpsrld zmm15, zmm25, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm24, zmm24, zmm13
+vpaddd zmm8, zmm6, zmm12
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm25
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vmovdqa32 zmm12, [rcx + ((41+1)*64)]
+vprord zmm13, zmm23, 17
+vprord zmm14, zmm23, 19
+vpsrld zmm15, zmm23, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm25, zmm25, zmm13
+vpaddd zmm25, zmm25, zmm18
+vprord zmm13, zmm26, 7
+vprord zmm14, zmm26, 18
+vpsrld zmm15, zmm26, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm25, zmm25, zmm13
+vpaddd zmm8, zmm5, zmm12
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm26
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vmovdqa32 zmm12, [rcx + ((42+1)*64)]
+vprord zmm13, zmm24, 17
+vprord zmm14, zmm24, 19
+vpsrld zmm15, zmm24, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm26, zmm26, zmm13
+vpaddd zmm26, zmm26, zmm19
+vprord zmm13, zmm27, 7
+vprord zmm14, zmm27, 18
+vpsrld zmm15, zmm27, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm26, zmm26, zmm13
+vpaddd zmm8, zmm4, zmm12
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm27
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vmovdqa32 zmm12, [rcx + ((43+1)*64)]
+vprord zmm13, zmm25, 17
+vprord zmm14, zmm25, 19
+vpsrld zmm15, zmm25, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm27, zmm27, zmm13
+vpaddd zmm27, zmm27, zmm20
+vprord zmm13, zmm28, 7
+vprord zmm14, zmm28, 18
+vpsrld zmm15, zmm28, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm27, zmm27, zmm13
+vpaddd zmm8, zmm3, zmm12
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm28
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vmovdqa32 zmm12, [rcx + ((44+1)*64)]
+vprord zmm13, zmm26, 17
+vprord zmm14, zmm26, 19
+vpsrld zmm15, zmm26, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm28, zmm28, zmm13
+vpaddd zmm28, zmm28, zmm21
+vprord zmm13, zmm29, 7
+vprord zmm14, zmm29, 18
+vpsrld zmm15, zmm29, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm28, zmm28, zmm13
+vpaddd zmm8, zmm2, zmm12
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm29
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vmovdqa32 zmm12, [rcx + ((45+1)*64)]
+vprord zmm13, zmm27, 17
+vprord zmm14, zmm27, 19
+vpsrld zmm15, zmm27, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm29, zmm29, zmm13
+vpaddd zmm29, zmm29, zmm22
+vprord zmm13, zmm30, 7
+vprord zmm14, zmm30, 18
+vpsrld zmm15, zmm30, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm29, zmm29, zmm13
+vpaddd zmm8, zmm1, zmm12
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm30
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vmovdqa32 zmm12, [rcx + ((46+1)*64)]
+vprord zmm13, zmm28, 17
+vprord zmm14, zmm28, 19
+vpsrld zmm15, zmm28, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm30, zmm30, zmm13
+vpaddd zmm30, zmm30, zmm23
+vprord zmm13, zmm31, 7
+vprord zmm14, zmm31, 18
+vpsrld zmm15, zmm31, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm30, zmm30, zmm13
+vpaddd zmm8, zmm0, zmm12
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm31
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vmovdqa32 zmm12, [rcx + ((47+1)*64)]
+vprord zmm13, zmm29, 17
+vprord zmm14, zmm29, 19
+vpsrld zmm15, zmm29, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm31, zmm31, zmm13
+vpaddd zmm31, zmm31, zmm24
+vprord zmm13, zmm16, 7
+vprord zmm14, zmm16, 18
+vpsrld zmm15, zmm16, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm31, zmm31, zmm13
+sub rsi, 1
+je lastLoop
+vpaddd zmm8, zmm7, zmm12
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm16
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vmovdqa32 zmm12, [rcx + ((48+1)*64)]
+mov r9, [(rdi + 512) + (0*8)]
+vmovups zmm16, [r9+rdx]
+vpaddd zmm8, zmm6, zmm12
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm17
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vmovdqa32 zmm12, [rcx + ((49+1)*64)]
+mov r9, [(rdi + 512) + (1*8)]
+vmovups zmm17, [r9+rdx]
+vpaddd zmm8, zmm5, zmm12
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm18
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vmovdqa32 zmm12, [rcx + ((50+1)*64)]
+mov r9, [(rdi + 512) + (2*8)]
+vmovups zmm18, [r9+rdx]
+vpaddd zmm8, zmm4, zmm12
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm19
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vmovdqa32 zmm12, [rcx + ((51+1)*64)]
+mov r9, [(rdi + 512) + (3*8)]
+vmovups zmm19, [r9+rdx]
+vpaddd zmm8, zmm3, zmm12
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm20
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vmovdqa32 zmm12, [rcx + ((52+1)*64)]
+mov r9, [(rdi + 512) + (4*8)]
+vmovups zmm20, [r9+rdx]
+vpaddd zmm8, zmm2, zmm12
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm21
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vmovdqa32 zmm12, [rcx + ((53+1)*64)]
+mov r9, [(rdi + 512) + (5*8)]
+vmovups zmm21, [r9+rdx]
+vpaddd zmm8, zmm1, zmm12
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm22
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vmovdqa32 zmm12, [rcx + ((54+1)*64)]
+mov r9, [(rdi + 512) + (6*8)]
+vmovups zmm22, [r9+rdx]
+vpaddd zmm8, zmm0, zmm12
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm23
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vmovdqa32 zmm12, [rcx + ((55+1)*64)]
+mov r9, [(rdi + 512) + (7*8)]
+vmovups zmm23, [r9+rdx]
+vpaddd zmm8, zmm7, zmm12
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm24
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vmovdqa32 zmm12, [rcx + ((56+1)*64)]
+mov r9, [(rdi + 512) + (8*8)]
+vmovups zmm24, [r9+rdx]
+vpaddd zmm8, zmm6, zmm12
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm25
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vmovdqa32 zmm12, [rcx + ((57+1)*64)]
+mov r9, [(rdi + 512) + (9*8)]
+vmovups zmm25, [r9+rdx]
+vpaddd zmm8, zmm5, zmm12
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm26
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vmovdqa32 zmm12, [rcx + ((58+1)*64)]
+mov r9, [(rdi + 512) + (10*8)]
+vmovups zmm26, [r9+rdx]
+vpaddd zmm8, zmm4, zmm12
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm27
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vmovdqa32 zmm12, [rcx + ((59+1)*64)]
+mov r9, [(rdi + 512) + (11*8)]
+vmovups zmm27, [r9+rdx]
+vpaddd zmm8, zmm3, zmm12
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm28
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vmovdqa32 zmm12, [rcx + ((60+1)*64)]
+mov r9, [(rdi + 512) + (12*8)]
+vmovups zmm28, [r9+rdx]
+vpaddd zmm8, zmm2, zmm12
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm29
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vmovdqa32 zmm12, [rcx + ((61+1)*64)]
+mov r9, [(rdi + 512) + (13*8)]
+vmovups zmm29, [r9+rdx]
+vpaddd zmm8, zmm1, zmm12
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm30
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vmovdqa32 zmm12, [rcx + ((62+1)*64)]
+mov r9, [(rdi + 512) + (14*8)]
+vmovups zmm30, [r9+rdx]
+vpaddd zmm8, zmm0, zmm12
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm31
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vmovdqa32 zmm12, [rcx + ((63+1)*64)]
+mov r9, [(rdi + 512) + (15*8)]
+vmovups zmm31, [r9+rdx]
+vpaddd zmm0, zmm0, [rsp + 0 + 64*0]
+vpaddd zmm1, zmm1, [rsp + 0 + 64*1]
+vpaddd zmm2, zmm2, [rsp + 0 + 64*2]
+vpaddd zmm3, zmm3, [rsp + 0 + 64*3]
+vpaddd zmm4, zmm4, [rsp + 0 + 64*4]
+vpaddd zmm5, zmm5, [rsp + 0 + 64*5]
+vpaddd zmm6, zmm6, [rsp + 0 + 64*6]
+vpaddd zmm7, zmm7, [rsp + 0 + 64*7]
+jmp lloop
+lastLoop:
+vpaddd zmm8, zmm7, zmm12
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm16
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vmovdqa32 zmm12, [rcx + ((48+1)*64)]
+vpaddd zmm8, zmm6, zmm12
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm17
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vmovdqa32 zmm12, [rcx + ((49+1)*64)]
+vpaddd zmm8, zmm5, zmm12
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm18
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vmovdqa32 zmm12, [rcx + ((50+1)*64)]
+vpaddd zmm8, zmm4, zmm12
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm19
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vmovdqa32 zmm12, [rcx + ((51+1)*64)]
+vpaddd zmm8, zmm3, zmm12
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm20
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vmovdqa32 zmm12, [rcx + ((52+1)*64)]
+vpaddd zmm8, zmm2, zmm12
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm21
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vmovdqa32 zmm12, [rcx + ((53+1)*64)]
+vpaddd zmm8, zmm1, zmm12
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm22
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vmovdqa32 zmm12, [rcx + ((54+1)*64)]
+vpaddd zmm8, zmm0, zmm12
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm23
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vmovdqa32 zmm12, [rcx + ((55+1)*64)]
+vpaddd zmm8, zmm7, zmm12
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm24
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vmovdqa32 zmm12, [rcx + ((56+1)*64)]
+vpaddd zmm8, zmm6, zmm12
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm25
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vmovdqa32 zmm12, [rcx + ((57+1)*64)]
+vpaddd zmm8, zmm5, zmm12
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm26
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vmovdqa32 zmm12, [rcx + ((58+1)*64)]
+vpaddd zmm8, zmm4, zmm12
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm27
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vmovdqa32 zmm12, [rcx + ((59+1)*64)]
+vpaddd zmm8, zmm3, zmm12
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm28
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vmovdqa32 zmm12, [rcx + ((60+1)*64)]
+vpaddd zmm8, zmm2, zmm12
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm29
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vmovdqa32 zmm12, [rcx + ((61+1)*64)]
+vpaddd zmm8, zmm1, zmm12
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm30
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vmovdqa32 zmm12, [rcx + ((62+1)*64)]
+vpaddd zmm8, zmm0, zmm12
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm31
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vmovdqa32 zmm12, [rcx + ((63+1)*64)]
+vpaddd zmm0, zmm0, [rsp + 0 + 64*0]
+vpaddd zmm1, zmm1, [rsp + 0 + 64*1]
+vpaddd zmm2, zmm2, [rsp + 0 + 64*2]
+vpaddd zmm3, zmm3, [rsp + 0 + 64*3]
+vpaddd zmm4, zmm4, [rsp + 0 + 64*4]
+vpaddd zmm5, zmm5, [rsp + 0 + 64*5]
+vpaddd zmm6, zmm6, [rsp + 0 + 64*6]
+vpaddd zmm7, zmm7, [rsp + 0 + 64*7]
+mov r9, [(rdi + 512) + (2*0)*8]
+mov r10, [(rdi + 512) + (2*0 +1)*8]
+add r9, rdx
+add r10, rdx
+mov [(rdi + 512) + (2*0)*8], r9
+mov [(rdi + 512) + (2*0+1)*8], r10
+mov r9, [(rdi + 512) + (2*1)*8]
+mov r10, [(rdi + 512) + (2*1 +1)*8]
+add r9, rdx
+add r10, rdx
+mov [(rdi + 512) + (2*1)*8], r9
+mov [(rdi + 512) + (2*1+1)*8], r10
+mov r9, [(rdi + 512) + (2*2)*8]
+mov r10, [(rdi + 512) + (2*2 +1)*8]
+add r9, rdx
+add r10, rdx
+mov [(rdi + 512) + (2*2)*8], r9
+mov [(rdi + 512) + (2*2+1)*8], r10
+mov r9, [(rdi + 512) + (2*3)*8]
+mov r10, [(rdi + 512) + (2*3 +1)*8]
+add r9, rdx
+add r10, rdx
+mov [(rdi + 512) + (2*3)*8], r9
+mov [(rdi + 512) + (2*3+1)*8], r10
+mov r9, [(rdi + 512) + (2*4)*8]
+mov r10, [(rdi + 512) + (2*4 +1)*8]
+add r9, rdx
+add r10, rdx
+mov [(rdi + 512) + (2*4)*8], r9
+mov [(rdi + 512) + (2*4+1)*8], r10
+mov r9, [(rdi + 512) + (2*5)*8]
+mov r10, [(rdi + 512) + (2*5 +1)*8]
+add r9, rdx
+add r10, rdx
+mov [(rdi + 512) + (2*5)*8], r9
+mov [(rdi + 512) + (2*5+1)*8], r10
+mov r9, [(rdi + 512) + (2*6)*8]
+mov r10, [(rdi + 512) + (2*6 +1)*8]
+add r9, rdx
+add r10, rdx
+mov [(rdi + 512) + (2*6)*8], r9
+mov [(rdi + 512) + (2*6+1)*8], r10
+mov r9, [(rdi + 512) + (2*7)*8]
+mov r10, [(rdi + 512) + (2*7 +1)*8]
+add r9, rdx
+add r10, rdx
+mov [(rdi + 512) + (2*7)*8], r9
+mov [(rdi + 512) + (2*7+1)*8], r10
+vmovups [rdi + 0*64], zmm0
+vmovups [rdi + 1*64], zmm1
+vmovups [rdi + 2*64], zmm2
+vmovups [rdi + 3*64], zmm3
+vmovups [rdi + 4*64], zmm4
+vmovups [rdi + 5*64], zmm5
+vmovups [rdi + 6*64], zmm6
+vmovups [rdi + 7*64], zmm7
+mov rsp, [rsp + 512]
+ret
+.section .data
+.balign 64
+TABLE:
+.quad 0x428a2f98428a2f98, 0x428a2f98428a2f98
+.quad 0x428a2f98428a2f98, 0x428a2f98428a2f98
+.quad 0x428a2f98428a2f98, 0x428a2f98428a2f98
+.quad 0x428a2f98428a2f98, 0x428a2f98428a2f98
+.quad 0x7137449171374491, 0x7137449171374491
+.quad 0x7137449171374491, 0x7137449171374491
+.quad 0x7137449171374491, 0x7137449171374491
+.quad 0x7137449171374491, 0x7137449171374491
+.quad 0xb5c0fbcfb5c0fbcf, 0xb5c0fbcfb5c0fbcf
+.quad 0xb5c0fbcfb5c0fbcf, 0xb5c0fbcfb5c0fbcf
+.quad 0xb5c0fbcfb5c0fbcf, 0xb5c0fbcfb5c0fbcf
+.quad 0xb5c0fbcfb5c0fbcf, 0xb5c0fbcfb5c0fbcf
+.quad 0xe9b5dba5e9b5dba5, 0xe9b5dba5e9b5dba5
+.quad 0xe9b5dba5e9b5dba5, 0xe9b5dba5e9b5dba5
+.quad 0xe9b5dba5e9b5dba5, 0xe9b5dba5e9b5dba5
+.quad 0xe9b5dba5e9b5dba5, 0xe9b5dba5e9b5dba5
+.quad 0x3956c25b3956c25b, 0x3956c25b3956c25b
+.quad 0x3956c25b3956c25b, 0x3956c25b3956c25b
+.quad 0x3956c25b3956c25b, 0x3956c25b3956c25b
+.quad 0x3956c25b3956c25b, 0x3956c25b3956c25b
+.quad 0x59f111f159f111f1, 0x59f111f159f111f1
+.quad 0x59f111f159f111f1, 0x59f111f159f111f1
+.quad 0x59f111f159f111f1, 0x59f111f159f111f1
+.quad 0x59f111f159f111f1, 0x59f111f159f111f1
+.quad 0x923f82a4923f82a4, 0x923f82a4923f82a4
+.quad 0x923f82a4923f82a4, 0x923f82a4923f82a4
+.quad 0x923f82a4923f82a4, 0x923f82a4923f82a4
+.quad 0x923f82a4923f82a4, 0x923f82a4923f82a4
+.quad 0xab1c5ed5ab1c5ed5, 0xab1c5ed5ab1c5ed5
+.quad 0xab1c5ed5ab1c5ed5, 0xab1c5ed5ab1c5ed5
+.quad 0xab1c5ed5ab1c5ed5, 0xab1c5ed5ab1c5ed5
+.quad 0xab1c5ed5ab1c5ed5, 0xab1c5ed5ab1c5ed5
+.quad 0xd807aa98d807aa98, 0xd807aa98d807aa98
+.quad 0xd807aa98d807aa98, 0xd807aa98d807aa98
+.quad 0xd807aa98d807aa98, 0xd807aa98d807aa98
+.quad 0xd807aa98d807aa98, 0xd807aa98d807aa98
+.quad 0x12835b0112835b01, 0x12835b0112835b01
+.quad 0x12835b0112835b01, 0x12835b0112835b01
+.quad 0x12835b0112835b01, 0x12835b0112835b01
+.quad 0x12835b0112835b01, 0x12835b0112835b01
+.quad 0x243185be243185be, 0x243185be243185be
+.quad 0x243185be243185be, 0x243185be243185be
+.quad 0x243185be243185be, 0x243185be243185be
+.quad 0x243185be243185be, 0x243185be243185be
+.quad 0x550c7dc3550c7dc3, 0x550c7dc3550c7dc3
+.quad 0x550c7dc3550c7dc3, 0x550c7dc3550c7dc3
+.quad 0x550c7dc3550c7dc3, 0x550c7dc3550c7dc3
+.quad 0x550c7dc3550c7dc3, 0x550c7dc3550c7dc3
+.quad 0x72be5d7472be5d74, 0x72be5d7472be5d74
+.quad 0x72be5d7472be5d74, 0x72be5d7472be5d74
+.quad 0x72be5d7472be5d74, 0x72be5d7472be5d74
+.quad 0x72be5d7472be5d74, 0x72be5d7472be5d74
+.quad 0x80deb1fe80deb1fe, 0x80deb1fe80deb1fe
+.quad 0x80deb1fe80deb1fe, 0x80deb1fe80deb1fe
+.quad 0x80deb1fe80deb1fe, 0x80deb1fe80deb1fe
+.quad 0x80deb1fe80deb1fe, 0x80deb1fe80deb1fe
+.quad 0x9bdc06a79bdc06a7, 0x9bdc06a79bdc06a7
+.quad 0x9bdc06a79bdc06a7, 0x9bdc06a79bdc06a7
+.quad 0x9bdc06a79bdc06a7, 0x9bdc06a79bdc06a7
+.quad 0x9bdc06a79bdc06a7, 0x9bdc06a79bdc06a7
+.quad 0xc19bf174c19bf174, 0xc19bf174c19bf174
+.quad 0xc19bf174c19bf174, 0xc19bf174c19bf174
+.quad 0xc19bf174c19bf174, 0xc19bf174c19bf174
+.quad 0xc19bf174c19bf174, 0xc19bf174c19bf174
+.quad 0xe49b69c1e49b69c1, 0xe49b69c1e49b69c1
+.quad 0xe49b69c1e49b69c1, 0xe49b69c1e49b69c1
+.quad 0xe49b69c1e49b69c1, 0xe49b69c1e49b69c1
+.quad 0xe49b69c1e49b69c1, 0xe49b69c1e49b69c1
+.quad 0xefbe4786efbe4786, 0xefbe4786efbe4786
+.quad 0xefbe4786efbe4786, 0xefbe4786efbe4786
+.quad 0xefbe4786efbe4786, 0xefbe4786efbe4786
+.quad 0xefbe4786efbe4786, 0xefbe4786efbe4786
+.quad 0x0fc19dc60fc19dc6, 0x0fc19dc60fc19dc6
+.quad 0x0fc19dc60fc19dc6, 0x0fc19dc60fc19dc6
+.quad 0x0fc19dc60fc19dc6, 0x0fc19dc60fc19dc6
+.quad 0x0fc19dc60fc19dc6, 0x0fc19dc60fc19dc6
+.quad 0x240ca1cc240ca1cc, 0x240ca1cc240ca1cc
+.quad 0x240ca1cc240ca1cc, 0x240ca1cc240ca1cc
+.quad 0x240ca1cc240ca1cc, 0x240ca1cc240ca1cc
+.quad 0x240ca1cc240ca1cc, 0x240ca1cc240ca1cc
+.quad 0x2de92c6f2de92c6f, 0x2de92c6f2de92c6f
+.quad 0x2de92c6f2de92c6f, 0x2de92c6f2de92c6f
+.quad 0x2de92c6f2de92c6f, 0x2de92c6f2de92c6f
+.quad 0x2de92c6f2de92c6f, 0x2de92c6f2de92c6f
+.quad 0x4a7484aa4a7484aa, 0x4a7484aa4a7484aa
+.quad 0x4a7484aa4a7484aa, 0x4a7484aa4a7484aa
+.quad 0x4a7484aa4a7484aa, 0x4a7484aa4a7484aa
+.quad 0x4a7484aa4a7484aa, 0x4a7484aa4a7484aa
+.quad 0x5cb0a9dc5cb0a9dc, 0x5cb0a9dc5cb0a9dc
+.quad 0x5cb0a9dc5cb0a9dc, 0x5cb0a9dc5cb0a9dc
+.quad 0x5cb0a9dc5cb0a9dc, 0x5cb0a9dc5cb0a9dc
+.quad 0x5cb0a9dc5cb0a9dc, 0x5cb0a9dc5cb0a9dc
+.quad 0x76f988da76f988da, 0x76f988da76f988da
+.quad 0x76f988da76f988da, 0x76f988da76f988da
+.quad 0x76f988da76f988da, 0x76f988da76f988da
+.quad 0x76f988da76f988da, 0x76f988da76f988da
+.quad 0x983e5152983e5152, 0x983e5152983e5152
+.quad 0x983e5152983e5152, 0x983e5152983e5152
+.quad 0x983e5152983e5152, 0x983e5152983e5152
+.quad 0x983e5152983e5152, 0x983e5152983e5152
+.quad 0xa831c66da831c66d, 0xa831c66da831c66d
+.quad 0xa831c66da831c66d, 0xa831c66da831c66d
+.quad 0xa831c66da831c66d, 0xa831c66da831c66d
+.quad 0xa831c66da831c66d, 0xa831c66da831c66d
+.quad 0xb00327c8b00327c8, 0xb00327c8b00327c8
+.quad 0xb00327c8b00327c8, 0xb00327c8b00327c8
+.quad 0xb00327c8b00327c8, 0xb00327c8b00327c8
+.quad 0xb00327c8b00327c8, 0xb00327c8b00327c8
+.quad 0xbf597fc7bf597fc7, 0xbf597fc7bf597fc7
+.quad 0xbf597fc7bf597fc7, 0xbf597fc7bf597fc7
+.quad 0xbf597fc7bf597fc7, 0xbf597fc7bf597fc7
+.quad 0xbf597fc7bf597fc7, 0xbf597fc7bf597fc7
+.quad 0xc6e00bf3c6e00bf3, 0xc6e00bf3c6e00bf3
+.quad 0xc6e00bf3c6e00bf3, 0xc6e00bf3c6e00bf3
+.quad 0xc6e00bf3c6e00bf3, 0xc6e00bf3c6e00bf3
+.quad 0xc6e00bf3c6e00bf3, 0xc6e00bf3c6e00bf3
+.quad 0xd5a79147d5a79147, 0xd5a79147d5a79147
+.quad 0xd5a79147d5a79147, 0xd5a79147d5a79147
+.quad 0xd5a79147d5a79147, 0xd5a79147d5a79147
+.quad 0xd5a79147d5a79147, 0xd5a79147d5a79147
+.quad 0x06ca635106ca6351, 0x06ca635106ca6351
+.quad 0x06ca635106ca6351, 0x06ca635106ca6351
+.quad 0x06ca635106ca6351, 0x06ca635106ca6351
+.quad 0x06ca635106ca6351, 0x06ca635106ca6351
+.quad 0x1429296714292967, 0x1429296714292967
+.quad 0x1429296714292967, 0x1429296714292967
+.quad 0x1429296714292967, 0x1429296714292967
+.quad 0x1429296714292967, 0x1429296714292967
+.quad 0x27b70a8527b70a85, 0x27b70a8527b70a85
+.quad 0x27b70a8527b70a85, 0x27b70a8527b70a85
+.quad 0x27b70a8527b70a85, 0x27b70a8527b70a85
+.quad 0x27b70a8527b70a85, 0x27b70a8527b70a85
+.quad 0x2e1b21382e1b2138, 0x2e1b21382e1b2138
+.quad 0x2e1b21382e1b2138, 0x2e1b21382e1b2138
+.quad 0x2e1b21382e1b2138, 0x2e1b21382e1b2138
+.quad 0x2e1b21382e1b2138, 0x2e1b21382e1b2138
+.quad 0x4d2c6dfc4d2c6dfc, 0x4d2c6dfc4d2c6dfc
+.quad 0x4d2c6dfc4d2c6dfc, 0x4d2c6dfc4d2c6dfc
+.quad 0x4d2c6dfc4d2c6dfc, 0x4d2c6dfc4d2c6dfc
+.quad 0x4d2c6dfc4d2c6dfc, 0x4d2c6dfc4d2c6dfc
+.quad 0x53380d1353380d13, 0x53380d1353380d13
+.quad 0x53380d1353380d13, 0x53380d1353380d13
+.quad 0x53380d1353380d13, 0x53380d1353380d13
+.quad 0x53380d1353380d13, 0x53380d1353380d13
+.quad 0x650a7354650a7354, 0x650a7354650a7354
+.quad 0x650a7354650a7354, 0x650a7354650a7354
+.quad 0x650a7354650a7354, 0x650a7354650a7354
+.quad 0x650a7354650a7354, 0x650a7354650a7354
+.quad 0x766a0abb766a0abb, 0x766a0abb766a0abb
+.quad 0x766a0abb766a0abb, 0x766a0abb766a0abb
+.quad 0x766a0abb766a0abb, 0x766a0abb766a0abb
+.quad 0x766a0abb766a0abb, 0x766a0abb766a0abb
+.quad 0x81c2c92e81c2c92e, 0x81c2c92e81c2c92e
+.quad 0x81c2c92e81c2c92e, 0x81c2c92e81c2c92e
+.quad 0x81c2c92e81c2c92e, 0x81c2c92e81c2c92e
+.quad 0x81c2c92e81c2c92e, 0x81c2c92e81c2c92e
+.quad 0x92722c8592722c85, 0x92722c8592722c85
+.quad 0x92722c8592722c85, 0x92722c8592722c85
+.quad 0x92722c8592722c85, 0x92722c8592722c85
+.quad 0x92722c8592722c85, 0x92722c8592722c85
+.quad 0xa2bfe8a1a2bfe8a1, 0xa2bfe8a1a2bfe8a1
+.quad 0xa2bfe8a1a2bfe8a1, 0xa2bfe8a1a2bfe8a1
+.quad 0xa2bfe8a1a2bfe8a1, 0xa2bfe8a1a2bfe8a1
+.quad 0xa2bfe8a1a2bfe8a1, 0xa2bfe8a1a2bfe8a1
+.quad 0xa81a664ba81a664b, 0xa81a664ba81a664b
+.quad 0xa81a664ba81a664b, 0xa81a664ba81a664b
+.quad 0xa81a664ba81a664b, 0xa81a664ba81a664b
+.quad 0xa81a664ba81a664b, 0xa81a664ba81a664b
+.quad 0xc24b8b70c24b8b70, 0xc24b8b70c24b8b70
+.quad 0xc24b8b70c24b8b70, 0xc24b8b70c24b8b70
+.quad 0xc24b8b70c24b8b70, 0xc24b8b70c24b8b70
+.quad 0xc24b8b70c24b8b70, 0xc24b8b70c24b8b70
+.quad 0xc76c51a3c76c51a3, 0xc76c51a3c76c51a3
+.quad 0xc76c51a3c76c51a3, 0xc76c51a3c76c51a3
+.quad 0xc76c51a3c76c51a3, 0xc76c51a3c76c51a3
+.quad 0xc76c51a3c76c51a3, 0xc76c51a3c76c51a3
+.quad 0xd192e819d192e819, 0xd192e819d192e819
+.quad 0xd192e819d192e819, 0xd192e819d192e819
+.quad 0xd192e819d192e819, 0xd192e819d192e819
+.quad 0xd192e819d192e819, 0xd192e819d192e819
+.quad 0xd6990624d6990624, 0xd6990624d6990624
+.quad 0xd6990624d6990624, 0xd6990624d6990624
+.quad 0xd6990624d6990624, 0xd6990624d6990624
+.quad 0xd6990624d6990624, 0xd6990624d6990624
+.quad 0xf40e3585f40e3585, 0xf40e3585f40e3585
+.quad 0xf40e3585f40e3585, 0xf40e3585f40e3585
+.quad 0xf40e3585f40e3585, 0xf40e3585f40e3585
+.quad 0xf40e3585f40e3585, 0xf40e3585f40e3585
+.quad 0x106aa070106aa070, 0x106aa070106aa070
+.quad 0x106aa070106aa070, 0x106aa070106aa070
+.quad 0x106aa070106aa070, 0x106aa070106aa070
+.quad 0x106aa070106aa070, 0x106aa070106aa070
+.quad 0x19a4c11619a4c116, 0x19a4c11619a4c116
+.quad 0x19a4c11619a4c116, 0x19a4c11619a4c116
+.quad 0x19a4c11619a4c116, 0x19a4c11619a4c116
+.quad 0x19a4c11619a4c116, 0x19a4c11619a4c116
+.quad 0x1e376c081e376c08, 0x1e376c081e376c08
+.quad 0x1e376c081e376c08, 0x1e376c081e376c08
+.quad 0x1e376c081e376c08, 0x1e376c081e376c08
+.quad 0x1e376c081e376c08, 0x1e376c081e376c08
+.quad 0x2748774c2748774c, 0x2748774c2748774c
+.quad 0x2748774c2748774c, 0x2748774c2748774c
+.quad 0x2748774c2748774c, 0x2748774c2748774c
+.quad 0x2748774c2748774c, 0x2748774c2748774c
+.quad 0x34b0bcb534b0bcb5, 0x34b0bcb534b0bcb5
+.quad 0x34b0bcb534b0bcb5, 0x34b0bcb534b0bcb5
+.quad 0x34b0bcb534b0bcb5, 0x34b0bcb534b0bcb5
+.quad 0x34b0bcb534b0bcb5, 0x34b0bcb534b0bcb5
+.quad 0x391c0cb3391c0cb3, 0x391c0cb3391c0cb3
+.quad 0x391c0cb3391c0cb3, 0x391c0cb3391c0cb3
+.quad 0x391c0cb3391c0cb3, 0x391c0cb3391c0cb3
+.quad 0x391c0cb3391c0cb3, 0x391c0cb3391c0cb3
+.quad 0x4ed8aa4a4ed8aa4a, 0x4ed8aa4a4ed8aa4a
+.quad 0x4ed8aa4a4ed8aa4a, 0x4ed8aa4a4ed8aa4a
+.quad 0x4ed8aa4a4ed8aa4a, 0x4ed8aa4a4ed8aa4a
+.quad 0x4ed8aa4a4ed8aa4a, 0x4ed8aa4a4ed8aa4a
+.quad 0x5b9cca4f5b9cca4f, 0x5b9cca4f5b9cca4f
+.quad 0x5b9cca4f5b9cca4f, 0x5b9cca4f5b9cca4f
+.quad 0x5b9cca4f5b9cca4f, 0x5b9cca4f5b9cca4f
+.quad 0x5b9cca4f5b9cca4f, 0x5b9cca4f5b9cca4f
+.quad 0x682e6ff3682e6ff3, 0x682e6ff3682e6ff3
+.quad 0x682e6ff3682e6ff3, 0x682e6ff3682e6ff3
+.quad 0x682e6ff3682e6ff3, 0x682e6ff3682e6ff3
+.quad 0x682e6ff3682e6ff3, 0x682e6ff3682e6ff3
+.quad 0x748f82ee748f82ee, 0x748f82ee748f82ee
+.quad 0x748f82ee748f82ee, 0x748f82ee748f82ee
+.quad 0x748f82ee748f82ee, 0x748f82ee748f82ee
+.quad 0x748f82ee748f82ee, 0x748f82ee748f82ee
+.quad 0x78a5636f78a5636f, 0x78a5636f78a5636f
+.quad 0x78a5636f78a5636f, 0x78a5636f78a5636f
+.quad 0x78a5636f78a5636f, 0x78a5636f78a5636f
+.quad 0x78a5636f78a5636f, 0x78a5636f78a5636f
+.quad 0x84c8781484c87814, 0x84c8781484c87814
+.quad 0x84c8781484c87814, 0x84c8781484c87814
+.quad 0x84c8781484c87814, 0x84c8781484c87814
+.quad 0x84c8781484c87814, 0x84c8781484c87814
+.quad 0x8cc702088cc70208, 0x8cc702088cc70208
+.quad 0x8cc702088cc70208, 0x8cc702088cc70208
+.quad 0x8cc702088cc70208, 0x8cc702088cc70208
+.quad 0x8cc702088cc70208, 0x8cc702088cc70208
+.quad 0x90befffa90befffa, 0x90befffa90befffa
+.quad 0x90befffa90befffa, 0x90befffa90befffa
+.quad 0x90befffa90befffa, 0x90befffa90befffa
+.quad 0x90befffa90befffa, 0x90befffa90befffa
+.quad 0xa4506ceba4506ceb, 0xa4506ceba4506ceb
+.quad 0xa4506ceba4506ceb, 0xa4506ceba4506ceb
+.quad 0xa4506ceba4506ceb, 0xa4506ceba4506ceb
+.quad 0xa4506ceba4506ceb, 0xa4506ceba4506ceb
+.quad 0xbef9a3f7bef9a3f7, 0xbef9a3f7bef9a3f7
+.quad 0xbef9a3f7bef9a3f7, 0xbef9a3f7bef9a3f7
+.quad 0xbef9a3f7bef9a3f7, 0xbef9a3f7bef9a3f7
+.quad 0xbef9a3f7bef9a3f7, 0xbef9a3f7bef9a3f7
+.quad 0xc67178f2c67178f2, 0xc67178f2c67178f2
+.quad 0xc67178f2c67178f2, 0xc67178f2c67178f2
+.quad 0xc67178f2c67178f2, 0xc67178f2c67178f2
+.quad 0xc67178f2c67178f2, 0xc67178f2c67178f2
+PSHUFFLE_BYTE_FLIP_MASK:
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
+PSHUFFLE_TRANSPOSE16_MASK1:
+.quad 0x0000000000000000
+.quad 0x0000000000000001
+.quad 0x0000000000000008
+.quad 0x0000000000000009
+.quad 0x0000000000000004
+.quad 0x0000000000000005
+.quad 0x000000000000000C
+.quad 0x000000000000000D
+PSHUFFLE_TRANSPOSE16_MASK2:
+.quad 0x0000000000000002
+.quad 0x0000000000000003
+.quad 0x000000000000000A
+.quad 0x000000000000000B
+.quad 0x0000000000000006
+.quad 0x0000000000000007
+.quad 0x000000000000000E
+.quad 0x000000000000000F
@@ -0,0 +1,2317 @@
+.intel_syntax noprefix
+.section .note.GNU-stack
+.section .text
+.section .text
+.globl sha256_mb_x4_sse
+.balign 32
+sha256_mb_x4_sse:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+sub rsp, (16*4*4 + 8*4*4 + 1*8)
+movdqa xmm0,[rdi+0*4*4]
+movdqa xmm1,[rdi+1*4*4]
+movdqa xmm2,[rdi+2*4*4]
+movdqa xmm3,[rdi+3*4*4]
+movdqa xmm4,[rdi+4*4*4]
+movdqa xmm5,[rdi+5*4*4]
+movdqa xmm6,[rdi+6*4*4]
+movdqa xmm7,[rdi+7*4*4]
+lea r12,[rip + K256_4_MB]
+mov r8,[rdi + 512 + 0*8]
+mov r9,[rdi + 512 + 1*8]
+mov r10,[rdi + 512 + 2*8]
+mov r11,[rdi + 512 + 3*8]
+xor rax, rax
+lloop:
+xor rbx, rbx
+movdqa [rsp + (16*4*4) + 0*4*4], xmm0
+movdqa [rsp + (16*4*4) + 1*4*4], xmm1
+movdqa [rsp + (16*4*4) + 2*4*4], xmm2
+movdqa [rsp + (16*4*4) + 3*4*4], xmm3
+movdqa [rsp + (16*4*4) + 4*4*4], xmm4
+movdqa [rsp + (16*4*4) + 5*4*4], xmm5
+movdqa [rsp + (16*4*4) + 6*4*4], xmm6
+movdqa [rsp + (16*4*4) + 7*4*4], xmm7
+movdqa xmm15, [rip + PSHUFFLE_BYTE_FLIP_MASK]
+movups xmm12,[r8+rax+0*16]
+movups xmm13,[r9+rax+0*16]
+movups xmm10,[r10+rax+0*16]
+movups xmm11,[r11+rax+0*16]
+movaps xmm14, xmm12
+shufps xmm14, xmm13, 0x44
+shufps xmm12, xmm13, 0xEE
+movaps xmm9, xmm10
+shufps xmm9, xmm11, 0x44
+shufps xmm10, xmm11, 0xEE
+movaps xmm13, xmm14
+shufps xmm13, xmm9, 0xDD
+movaps xmm11, xmm12
+shufps xmm11, xmm10, 0xDD
+shufps xmm12, xmm10, 0x88
+shufps xmm14, xmm9, 0x88
+pshufb xmm14, xmm15
+pshufb xmm13, xmm15
+pshufb xmm12, xmm15
+pshufb xmm11, xmm15
+movdqa xmm8, xmm4
+movdqa xmm9, xmm4
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm5
+pxor xmm10, xmm6
+pand xmm10, xmm4
+pxor xmm10, xmm6
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((0*4+0)&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm4
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm7, xmm10
+movdqa xmm10, xmm0
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm7, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm0
+movdqa xmm14, xmm0
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm2
+add rbx, 4*4
+pand xmm14, xmm1
+paddd xmm7, xmm8
+paddd xmm3, xmm7
+pxor xmm10, xmm0
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm0
+pand xmm9, xmm2
+por xmm9, xmm14
+paddd xmm7, xmm9
+paddd xmm7, xmm10
+movdqa xmm8, xmm3
+movdqa xmm9, xmm3
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm4
+pxor xmm10, xmm5
+pand xmm10, xmm3
+pxor xmm10, xmm5
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((0*4+1)&0xf) + rsp],xmm13
+paddd xmm13,[r12 + rbx]
+pxor xmm8, xmm3
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm6, xmm10
+movdqa xmm10, xmm7
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm6, xmm13
+pxor xmm8, xmm9
+movdqa xmm9, xmm7
+movdqa xmm13, xmm7
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm13, xmm1
+add rbx, 4*4
+pand xmm13, xmm0
+paddd xmm6, xmm8
+paddd xmm2, xmm6
+pxor xmm10, xmm7
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm7
+pand xmm9, xmm1
+por xmm9, xmm13
+paddd xmm6, xmm9
+paddd xmm6, xmm10
+movdqa xmm8, xmm2
+movdqa xmm9, xmm2
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm3
+pxor xmm10, xmm4
+pand xmm10, xmm2
+pxor xmm10, xmm4
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((0*4+2)&0xf) + rsp],xmm12
+paddd xmm12,[r12 + rbx]
+pxor xmm8, xmm2
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm5, xmm10
+movdqa xmm10, xmm6
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm5, xmm12
+pxor xmm8, xmm9
+movdqa xmm9, xmm6
+movdqa xmm12, xmm6
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm12, xmm0
+add rbx, 4*4
+pand xmm12, xmm7
+paddd xmm5, xmm8
+paddd xmm1, xmm5
+pxor xmm10, xmm6
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm6
+pand xmm9, xmm0
+por xmm9, xmm12
+paddd xmm5, xmm9
+paddd xmm5, xmm10
+movdqa xmm8, xmm1
+movdqa xmm9, xmm1
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm2
+pxor xmm10, xmm3
+pand xmm10, xmm1
+pxor xmm10, xmm3
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((0*4+3)&0xf) + rsp],xmm11
+paddd xmm11,[r12 + rbx]
+pxor xmm8, xmm1
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm4, xmm10
+movdqa xmm10, xmm5
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm4, xmm11
+pxor xmm8, xmm9
+movdqa xmm9, xmm5
+movdqa xmm11, xmm5
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm11, xmm7
+add rbx, 4*4
+pand xmm11, xmm6
+paddd xmm4, xmm8
+paddd xmm0, xmm4
+pxor xmm10, xmm5
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm5
+pand xmm9, xmm7
+por xmm9, xmm11
+paddd xmm4, xmm9
+paddd xmm4, xmm10
+movdqa xmm15, [rip + PSHUFFLE_BYTE_FLIP_MASK]
+movups xmm12,[r8+rax+1*16]
+movups xmm13,[r9+rax+1*16]
+movups xmm10,[r10+rax+1*16]
+movups xmm11,[r11+rax+1*16]
+movaps xmm14, xmm12
+shufps xmm14, xmm13, 0x44
+shufps xmm12, xmm13, 0xEE
+movaps xmm9, xmm10
+shufps xmm9, xmm11, 0x44
+shufps xmm10, xmm11, 0xEE
+movaps xmm13, xmm14
+shufps xmm13, xmm9, 0xDD
+movaps xmm11, xmm12
+shufps xmm11, xmm10, 0xDD
+shufps xmm12, xmm10, 0x88
+shufps xmm14, xmm9, 0x88
+pshufb xmm14, xmm15
+pshufb xmm13, xmm15
+pshufb xmm12, xmm15
+pshufb xmm11, xmm15
+movdqa xmm8, xmm0
+movdqa xmm9, xmm0
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm1
+pxor xmm10, xmm2
+pand xmm10, xmm0
+pxor xmm10, xmm2
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((1*4+0)&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm0
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm3, xmm10
+movdqa xmm10, xmm4
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm3, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm4
+movdqa xmm14, xmm4
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm6
+add rbx, 4*4
+pand xmm14, xmm5
+paddd xmm3, xmm8
+paddd xmm7, xmm3
+pxor xmm10, xmm4
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm4
+pand xmm9, xmm6
+por xmm9, xmm14
+paddd xmm3, xmm9
+paddd xmm3, xmm10
+movdqa xmm8, xmm7
+movdqa xmm9, xmm7
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm0
+pxor xmm10, xmm1
+pand xmm10, xmm7
+pxor xmm10, xmm1
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((1*4+1)&0xf) + rsp],xmm13
+paddd xmm13,[r12 + rbx]
+pxor xmm8, xmm7
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm2, xmm10
+movdqa xmm10, xmm3
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm2, xmm13
+pxor xmm8, xmm9
+movdqa xmm9, xmm3
+movdqa xmm13, xmm3
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm13, xmm5
+add rbx, 4*4
+pand xmm13, xmm4
+paddd xmm2, xmm8
+paddd xmm6, xmm2
+pxor xmm10, xmm3
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm3
+pand xmm9, xmm5
+por xmm9, xmm13
+paddd xmm2, xmm9
+paddd xmm2, xmm10
+movdqa xmm8, xmm6
+movdqa xmm9, xmm6
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm7
+pxor xmm10, xmm0
+pand xmm10, xmm6
+pxor xmm10, xmm0
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((1*4+2)&0xf) + rsp],xmm12
+paddd xmm12,[r12 + rbx]
+pxor xmm8, xmm6
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm1, xmm10
+movdqa xmm10, xmm2
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm1, xmm12
+pxor xmm8, xmm9
+movdqa xmm9, xmm2
+movdqa xmm12, xmm2
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm12, xmm4
+add rbx, 4*4
+pand xmm12, xmm3
+paddd xmm1, xmm8
+paddd xmm5, xmm1
+pxor xmm10, xmm2
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm2
+pand xmm9, xmm4
+por xmm9, xmm12
+paddd xmm1, xmm9
+paddd xmm1, xmm10
+movdqa xmm8, xmm5
+movdqa xmm9, xmm5
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm6
+pxor xmm10, xmm7
+pand xmm10, xmm5
+pxor xmm10, xmm7
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((1*4+3)&0xf) + rsp],xmm11
+paddd xmm11,[r12 + rbx]
+pxor xmm8, xmm5
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm0, xmm10
+movdqa xmm10, xmm1
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm0, xmm11
+pxor xmm8, xmm9
+movdqa xmm9, xmm1
+movdqa xmm11, xmm1
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm11, xmm3
+add rbx, 4*4
+pand xmm11, xmm2
+paddd xmm0, xmm8
+paddd xmm4, xmm0
+pxor xmm10, xmm1
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm1
+pand xmm9, xmm3
+por xmm9, xmm11
+paddd xmm0, xmm9
+paddd xmm0, xmm10
+movdqa xmm15, [rip + PSHUFFLE_BYTE_FLIP_MASK]
+movups xmm12,[r8+rax+2*16]
+movups xmm13,[r9+rax+2*16]
+movups xmm10,[r10+rax+2*16]
+movups xmm11,[r11+rax+2*16]
+movaps xmm14, xmm12
+shufps xmm14, xmm13, 0x44
+shufps xmm12, xmm13, 0xEE
+movaps xmm9, xmm10
+shufps xmm9, xmm11, 0x44
+shufps xmm10, xmm11, 0xEE
+movaps xmm13, xmm14
+shufps xmm13, xmm9, 0xDD
+movaps xmm11, xmm12
+shufps xmm11, xmm10, 0xDD
+shufps xmm12, xmm10, 0x88
+shufps xmm14, xmm9, 0x88
+pshufb xmm14, xmm15
+pshufb xmm13, xmm15
+pshufb xmm12, xmm15
+pshufb xmm11, xmm15
+movdqa xmm8, xmm4
+movdqa xmm9, xmm4
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm5
+pxor xmm10, xmm6
+pand xmm10, xmm4
+pxor xmm10, xmm6
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((2*4+0)&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm4
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm7, xmm10
+movdqa xmm10, xmm0
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm7, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm0
+movdqa xmm14, xmm0
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm2
+add rbx, 4*4
+pand xmm14, xmm1
+paddd xmm7, xmm8
+paddd xmm3, xmm7
+pxor xmm10, xmm0
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm0
+pand xmm9, xmm2
+por xmm9, xmm14
+paddd xmm7, xmm9
+paddd xmm7, xmm10
+movdqa xmm8, xmm3
+movdqa xmm9, xmm3
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm4
+pxor xmm10, xmm5
+pand xmm10, xmm3
+pxor xmm10, xmm5
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((2*4+1)&0xf) + rsp],xmm13
+paddd xmm13,[r12 + rbx]
+pxor xmm8, xmm3
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm6, xmm10
+movdqa xmm10, xmm7
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm6, xmm13
+pxor xmm8, xmm9
+movdqa xmm9, xmm7
+movdqa xmm13, xmm7
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm13, xmm1
+add rbx, 4*4
+pand xmm13, xmm0
+paddd xmm6, xmm8
+paddd xmm2, xmm6
+pxor xmm10, xmm7
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm7
+pand xmm9, xmm1
+por xmm9, xmm13
+paddd xmm6, xmm9
+paddd xmm6, xmm10
+movdqa xmm8, xmm2
+movdqa xmm9, xmm2
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm3
+pxor xmm10, xmm4
+pand xmm10, xmm2
+pxor xmm10, xmm4
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((2*4+2)&0xf) + rsp],xmm12
+paddd xmm12,[r12 + rbx]
+pxor xmm8, xmm2
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm5, xmm10
+movdqa xmm10, xmm6
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm5, xmm12
+pxor xmm8, xmm9
+movdqa xmm9, xmm6
+movdqa xmm12, xmm6
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm12, xmm0
+add rbx, 4*4
+pand xmm12, xmm7
+paddd xmm5, xmm8
+paddd xmm1, xmm5
+pxor xmm10, xmm6
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm6
+pand xmm9, xmm0
+por xmm9, xmm12
+paddd xmm5, xmm9
+paddd xmm5, xmm10
+movdqa xmm8, xmm1
+movdqa xmm9, xmm1
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm2
+pxor xmm10, xmm3
+pand xmm10, xmm1
+pxor xmm10, xmm3
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((2*4+3)&0xf) + rsp],xmm11
+paddd xmm11,[r12 + rbx]
+pxor xmm8, xmm1
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm4, xmm10
+movdqa xmm10, xmm5
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm4, xmm11
+pxor xmm8, xmm9
+movdqa xmm9, xmm5
+movdqa xmm11, xmm5
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm11, xmm7
+add rbx, 4*4
+pand xmm11, xmm6
+paddd xmm4, xmm8
+paddd xmm0, xmm4
+pxor xmm10, xmm5
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm5
+pand xmm9, xmm7
+por xmm9, xmm11
+paddd xmm4, xmm9
+paddd xmm4, xmm10
+movdqa xmm15, [rip + PSHUFFLE_BYTE_FLIP_MASK]
+movups xmm12,[r8+rax+3*16]
+movups xmm13,[r9+rax+3*16]
+movups xmm10,[r10+rax+3*16]
+movups xmm11,[r11+rax+3*16]
+movaps xmm14, xmm12
+shufps xmm14, xmm13, 0x44
+shufps xmm12, xmm13, 0xEE
+movaps xmm9, xmm10
+shufps xmm9, xmm11, 0x44
+shufps xmm10, xmm11, 0xEE
+movaps xmm13, xmm14
+shufps xmm13, xmm9, 0xDD
+movaps xmm11, xmm12
+shufps xmm11, xmm10, 0xDD
+shufps xmm12, xmm10, 0x88
+shufps xmm14, xmm9, 0x88
+pshufb xmm14, xmm15
+pshufb xmm13, xmm15
+pshufb xmm12, xmm15
+pshufb xmm11, xmm15
+movdqa xmm8, xmm0
+movdqa xmm9, xmm0
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm1
+pxor xmm10, xmm2
+pand xmm10, xmm0
+pxor xmm10, xmm2
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((3*4+0)&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm0
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm3, xmm10
+movdqa xmm10, xmm4
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm3, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm4
+movdqa xmm14, xmm4
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm6
+add rbx, 4*4
+pand xmm14, xmm5
+paddd xmm3, xmm8
+paddd xmm7, xmm3
+pxor xmm10, xmm4
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm4
+pand xmm9, xmm6
+por xmm9, xmm14
+paddd xmm3, xmm9
+paddd xmm3, xmm10
+movdqa xmm8, xmm7
+movdqa xmm9, xmm7
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm0
+pxor xmm10, xmm1
+pand xmm10, xmm7
+pxor xmm10, xmm1
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((3*4+1)&0xf) + rsp],xmm13
+paddd xmm13,[r12 + rbx]
+pxor xmm8, xmm7
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm2, xmm10
+movdqa xmm10, xmm3
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm2, xmm13
+pxor xmm8, xmm9
+movdqa xmm9, xmm3
+movdqa xmm13, xmm3
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm13, xmm5
+add rbx, 4*4
+pand xmm13, xmm4
+paddd xmm2, xmm8
+paddd xmm6, xmm2
+pxor xmm10, xmm3
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm3
+pand xmm9, xmm5
+por xmm9, xmm13
+paddd xmm2, xmm9
+paddd xmm2, xmm10
+movdqa xmm8, xmm6
+movdqa xmm9, xmm6
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm7
+pxor xmm10, xmm0
+pand xmm10, xmm6
+pxor xmm10, xmm0
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((3*4+2)&0xf) + rsp],xmm12
+paddd xmm12,[r12 + rbx]
+pxor xmm8, xmm6
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm1, xmm10
+movdqa xmm10, xmm2
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm1, xmm12
+pxor xmm8, xmm9
+movdqa xmm9, xmm2
+movdqa xmm12, xmm2
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm12, xmm4
+add rbx, 4*4
+pand xmm12, xmm3
+paddd xmm1, xmm8
+paddd xmm5, xmm1
+pxor xmm10, xmm2
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm2
+pand xmm9, xmm4
+por xmm9, xmm12
+paddd xmm1, xmm9
+paddd xmm1, xmm10
+movdqa xmm8, xmm5
+movdqa xmm9, xmm5
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm6
+pxor xmm10, xmm7
+pand xmm10, xmm5
+pxor xmm10, xmm7
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*((3*4+3)&0xf) + rsp],xmm11
+paddd xmm11,[r12 + rbx]
+pxor xmm8, xmm5
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm0, xmm10
+movdqa xmm10, xmm1
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm0, xmm11
+pxor xmm8, xmm9
+movdqa xmm9, xmm1
+movdqa xmm11, xmm1
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm11, xmm3
+add rbx, 4*4
+pand xmm11, xmm2
+paddd xmm0, xmm8
+paddd xmm4, xmm0
+pxor xmm10, xmm1
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm1
+pand xmm9, xmm3
+por xmm9, xmm11
+paddd xmm0, xmm9
+paddd xmm0, xmm10
+add rax, 4*4*4
+jmp Lrounds_16_xx
+.balign 16
+Lrounds_16_xx:
+movdqa xmm14, [4*4*((16-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((16-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((16-16)&0xf) + rsp]
+paddd xmm9, [4*4*((16-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm4
+movdqa xmm9, xmm4
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm5
+pxor xmm10, xmm6
+pand xmm10, xmm4
+pxor xmm10, xmm6
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(16&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm4
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm7, xmm10
+movdqa xmm10, xmm0
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm7, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm0
+movdqa xmm14, xmm0
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm2
+add rbx, 4*4
+pand xmm14, xmm1
+paddd xmm7, xmm8
+paddd xmm3, xmm7
+pxor xmm10, xmm0
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm0
+pand xmm9, xmm2
+por xmm9, xmm14
+paddd xmm7, xmm9
+paddd xmm7, xmm10
+movdqa xmm14, [4*4*((17-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((17-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((17-16)&0xf) + rsp]
+paddd xmm9, [4*4*((17-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm3
+movdqa xmm9, xmm3
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm4
+pxor xmm10, xmm5
+pand xmm10, xmm3
+pxor xmm10, xmm5
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(17&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm3
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm6, xmm10
+movdqa xmm10, xmm7
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm6, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm7
+movdqa xmm14, xmm7
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm1
+add rbx, 4*4
+pand xmm14, xmm0
+paddd xmm6, xmm8
+paddd xmm2, xmm6
+pxor xmm10, xmm7
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm7
+pand xmm9, xmm1
+por xmm9, xmm14
+paddd xmm6, xmm9
+paddd xmm6, xmm10
+movdqa xmm14, [4*4*((18-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((18-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((18-16)&0xf) + rsp]
+paddd xmm9, [4*4*((18-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm2
+movdqa xmm9, xmm2
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm3
+pxor xmm10, xmm4
+pand xmm10, xmm2
+pxor xmm10, xmm4
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(18&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm2
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm5, xmm10
+movdqa xmm10, xmm6
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm5, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm6
+movdqa xmm14, xmm6
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm0
+add rbx, 4*4
+pand xmm14, xmm7
+paddd xmm5, xmm8
+paddd xmm1, xmm5
+pxor xmm10, xmm6
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm6
+pand xmm9, xmm0
+por xmm9, xmm14
+paddd xmm5, xmm9
+paddd xmm5, xmm10
+movdqa xmm14, [4*4*((19-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((19-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((19-16)&0xf) + rsp]
+paddd xmm9, [4*4*((19-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm1
+movdqa xmm9, xmm1
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm2
+pxor xmm10, xmm3
+pand xmm10, xmm1
+pxor xmm10, xmm3
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(19&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm1
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm4, xmm10
+movdqa xmm10, xmm5
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm4, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm5
+movdqa xmm14, xmm5
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm7
+add rbx, 4*4
+pand xmm14, xmm6
+paddd xmm4, xmm8
+paddd xmm0, xmm4
+pxor xmm10, xmm5
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm5
+pand xmm9, xmm7
+por xmm9, xmm14
+paddd xmm4, xmm9
+paddd xmm4, xmm10
+movdqa xmm14, [4*4*((20-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((20-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((20-16)&0xf) + rsp]
+paddd xmm9, [4*4*((20-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm0
+movdqa xmm9, xmm0
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm1
+pxor xmm10, xmm2
+pand xmm10, xmm0
+pxor xmm10, xmm2
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(20&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm0
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm3, xmm10
+movdqa xmm10, xmm4
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm3, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm4
+movdqa xmm14, xmm4
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm6
+add rbx, 4*4
+pand xmm14, xmm5
+paddd xmm3, xmm8
+paddd xmm7, xmm3
+pxor xmm10, xmm4
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm4
+pand xmm9, xmm6
+por xmm9, xmm14
+paddd xmm3, xmm9
+paddd xmm3, xmm10
+movdqa xmm14, [4*4*((21-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((21-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((21-16)&0xf) + rsp]
+paddd xmm9, [4*4*((21-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm7
+movdqa xmm9, xmm7
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm0
+pxor xmm10, xmm1
+pand xmm10, xmm7
+pxor xmm10, xmm1
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(21&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm7
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm2, xmm10
+movdqa xmm10, xmm3
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm2, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm3
+movdqa xmm14, xmm3
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm5
+add rbx, 4*4
+pand xmm14, xmm4
+paddd xmm2, xmm8
+paddd xmm6, xmm2
+pxor xmm10, xmm3
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm3
+pand xmm9, xmm5
+por xmm9, xmm14
+paddd xmm2, xmm9
+paddd xmm2, xmm10
+movdqa xmm14, [4*4*((22-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((22-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((22-16)&0xf) + rsp]
+paddd xmm9, [4*4*((22-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm6
+movdqa xmm9, xmm6
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm7
+pxor xmm10, xmm0
+pand xmm10, xmm6
+pxor xmm10, xmm0
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(22&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm6
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm1, xmm10
+movdqa xmm10, xmm2
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm1, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm2
+movdqa xmm14, xmm2
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm4
+add rbx, 4*4
+pand xmm14, xmm3
+paddd xmm1, xmm8
+paddd xmm5, xmm1
+pxor xmm10, xmm2
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm2
+pand xmm9, xmm4
+por xmm9, xmm14
+paddd xmm1, xmm9
+paddd xmm1, xmm10
+movdqa xmm14, [4*4*((23-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((23-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((23-16)&0xf) + rsp]
+paddd xmm9, [4*4*((23-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm5
+movdqa xmm9, xmm5
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm6
+pxor xmm10, xmm7
+pand xmm10, xmm5
+pxor xmm10, xmm7
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(23&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm5
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm0, xmm10
+movdqa xmm10, xmm1
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm0, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm1
+movdqa xmm14, xmm1
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm3
+add rbx, 4*4
+pand xmm14, xmm2
+paddd xmm0, xmm8
+paddd xmm4, xmm0
+pxor xmm10, xmm1
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm1
+pand xmm9, xmm3
+por xmm9, xmm14
+paddd xmm0, xmm9
+paddd xmm0, xmm10
+movdqa xmm14, [4*4*((24-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((24-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((24-16)&0xf) + rsp]
+paddd xmm9, [4*4*((24-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm4
+movdqa xmm9, xmm4
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm5
+pxor xmm10, xmm6
+pand xmm10, xmm4
+pxor xmm10, xmm6
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(24&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm4
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm7, xmm10
+movdqa xmm10, xmm0
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm7, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm0
+movdqa xmm14, xmm0
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm2
+add rbx, 4*4
+pand xmm14, xmm1
+paddd xmm7, xmm8
+paddd xmm3, xmm7
+pxor xmm10, xmm0
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm0
+pand xmm9, xmm2
+por xmm9, xmm14
+paddd xmm7, xmm9
+paddd xmm7, xmm10
+movdqa xmm14, [4*4*((25-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((25-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((25-16)&0xf) + rsp]
+paddd xmm9, [4*4*((25-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm3
+movdqa xmm9, xmm3
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm4
+pxor xmm10, xmm5
+pand xmm10, xmm3
+pxor xmm10, xmm5
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(25&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm3
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm6, xmm10
+movdqa xmm10, xmm7
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm6, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm7
+movdqa xmm14, xmm7
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm1
+add rbx, 4*4
+pand xmm14, xmm0
+paddd xmm6, xmm8
+paddd xmm2, xmm6
+pxor xmm10, xmm7
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm7
+pand xmm9, xmm1
+por xmm9, xmm14
+paddd xmm6, xmm9
+paddd xmm6, xmm10
+movdqa xmm14, [4*4*((26-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((26-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((26-16)&0xf) + rsp]
+paddd xmm9, [4*4*((26-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm2
+movdqa xmm9, xmm2
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm3
+pxor xmm10, xmm4
+pand xmm10, xmm2
+pxor xmm10, xmm4
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(26&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm2
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm5, xmm10
+movdqa xmm10, xmm6
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm5, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm6
+movdqa xmm14, xmm6
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm0
+add rbx, 4*4
+pand xmm14, xmm7
+paddd xmm5, xmm8
+paddd xmm1, xmm5
+pxor xmm10, xmm6
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm6
+pand xmm9, xmm0
+por xmm9, xmm14
+paddd xmm5, xmm9
+paddd xmm5, xmm10
+movdqa xmm14, [4*4*((27-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((27-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((27-16)&0xf) + rsp]
+paddd xmm9, [4*4*((27-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm1
+movdqa xmm9, xmm1
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm2
+pxor xmm10, xmm3
+pand xmm10, xmm1
+pxor xmm10, xmm3
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(27&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm1
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm4, xmm10
+movdqa xmm10, xmm5
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm4, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm5
+movdqa xmm14, xmm5
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm7
+add rbx, 4*4
+pand xmm14, xmm6
+paddd xmm4, xmm8
+paddd xmm0, xmm4
+pxor xmm10, xmm5
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm5
+pand xmm9, xmm7
+por xmm9, xmm14
+paddd xmm4, xmm9
+paddd xmm4, xmm10
+movdqa xmm14, [4*4*((28-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((28-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((28-16)&0xf) + rsp]
+paddd xmm9, [4*4*((28-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm0
+movdqa xmm9, xmm0
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm1
+pxor xmm10, xmm2
+pand xmm10, xmm0
+pxor xmm10, xmm2
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(28&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm0
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm3, xmm10
+movdqa xmm10, xmm4
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm3, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm4
+movdqa xmm14, xmm4
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm6
+add rbx, 4*4
+pand xmm14, xmm5
+paddd xmm3, xmm8
+paddd xmm7, xmm3
+pxor xmm10, xmm4
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm4
+pand xmm9, xmm6
+por xmm9, xmm14
+paddd xmm3, xmm9
+paddd xmm3, xmm10
+movdqa xmm14, [4*4*((29-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((29-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((29-16)&0xf) + rsp]
+paddd xmm9, [4*4*((29-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm7
+movdqa xmm9, xmm7
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm0
+pxor xmm10, xmm1
+pand xmm10, xmm7
+pxor xmm10, xmm1
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(29&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm7
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm2, xmm10
+movdqa xmm10, xmm3
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm2, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm3
+movdqa xmm14, xmm3
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm5
+add rbx, 4*4
+pand xmm14, xmm4
+paddd xmm2, xmm8
+paddd xmm6, xmm2
+pxor xmm10, xmm3
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm3
+pand xmm9, xmm5
+por xmm9, xmm14
+paddd xmm2, xmm9
+paddd xmm2, xmm10
+movdqa xmm14, [4*4*((30-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((30-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((30-16)&0xf) + rsp]
+paddd xmm9, [4*4*((30-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm6
+movdqa xmm9, xmm6
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm7
+pxor xmm10, xmm0
+pand xmm10, xmm6
+pxor xmm10, xmm0
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(30&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm6
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm1, xmm10
+movdqa xmm10, xmm2
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm1, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm2
+movdqa xmm14, xmm2
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm4
+add rbx, 4*4
+pand xmm14, xmm3
+paddd xmm1, xmm8
+paddd xmm5, xmm1
+pxor xmm10, xmm2
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm2
+pand xmm9, xmm4
+por xmm9, xmm14
+paddd xmm1, xmm9
+paddd xmm1, xmm10
+movdqa xmm14, [4*4*((31-15)&0xf) + rsp]
+movdqa xmm9, [4*4*((31-2)&0xf) + rsp]
+movdqa xmm8, xmm14
+movdqa xmm15, xmm14
+psrld xmm14, 18-7
+pslld xmm15, (32-(18-7))
+por xmm14, xmm15
+movdqa xmm10, xmm9
+movdqa xmm15, xmm9
+psrld xmm9, 19-17
+pslld xmm15, (32-(19-17))
+por xmm9, xmm15
+pxor xmm14, xmm8
+movdqa xmm15, xmm14
+psrld xmm14, 7
+pslld xmm15, (32-(7))
+por xmm14, xmm15
+pxor xmm9, xmm10
+movdqa xmm15, xmm9
+psrld xmm9, 17
+pslld xmm15, (32-(17))
+por xmm9, xmm15
+psrld xmm8, 3
+pxor xmm14, xmm8
+psrld xmm10, 10
+pxor xmm9, xmm10
+paddd xmm14, [4*4*((31-16)&0xf) + rsp]
+paddd xmm9, [4*4*((31-7)&0xf) + rsp]
+paddd xmm14, xmm9
+movdqa xmm8, xmm5
+movdqa xmm9, xmm5
+movdqa xmm15, xmm8
+psrld xmm8, (11-6)
+pslld xmm15, (32-((11-6)))
+por xmm8, xmm15
+movdqa xmm10, xmm6
+pxor xmm10, xmm7
+pand xmm10, xmm5
+pxor xmm10, xmm7
+movdqa xmm15, xmm9
+psrld xmm9, 25
+pslld xmm15, (32-(25))
+por xmm9, xmm15
+movdqa [4*4*(31&0xf) + rsp],xmm14
+paddd xmm14,[r12 + rbx]
+pxor xmm8, xmm5
+movdqa xmm15, xmm8
+psrld xmm8, 6
+pslld xmm15, (32-(6))
+por xmm8, xmm15
+paddd xmm0, xmm10
+movdqa xmm10, xmm1
+movdqa xmm15, xmm10
+psrld xmm10, (13-2)
+pslld xmm15, (32-((13-2)))
+por xmm10, xmm15
+paddd xmm0, xmm14
+pxor xmm8, xmm9
+movdqa xmm9, xmm1
+movdqa xmm14, xmm1
+movdqa xmm15, xmm9
+psrld xmm9, 22
+pslld xmm15, (32-(22))
+por xmm9, xmm15
+pxor xmm14, xmm3
+add rbx, 4*4
+pand xmm14, xmm2
+paddd xmm0, xmm8
+paddd xmm4, xmm0
+pxor xmm10, xmm1
+movdqa xmm15, xmm10
+psrld xmm10, 2
+pslld xmm15, (32-(2))
+por xmm10, xmm15
+pxor xmm10, xmm9
+movdqa xmm9, xmm1
+pand xmm9, xmm3
+por xmm9, xmm14
+paddd xmm0, xmm9
+paddd xmm0, xmm10
+cmp rbx,64*4*4
+jb Lrounds_16_xx
+paddd xmm0, [rsp + (16*4*4) + 0*4*4]
+paddd xmm1, [rsp + (16*4*4) + 1*4*4]
+paddd xmm2, [rsp + (16*4*4) + 2*4*4]
+paddd xmm3, [rsp + (16*4*4) + 3*4*4]
+paddd xmm4, [rsp + (16*4*4) + 4*4*4]
+paddd xmm5, [rsp + (16*4*4) + 5*4*4]
+paddd xmm6, [rsp + (16*4*4) + 6*4*4]
+paddd xmm7, [rsp + (16*4*4) + 7*4*4]
+sub rsi, 1
+jne lloop
+movdqa [rdi+0*4*4],xmm0
+movdqa [rdi+1*4*4],xmm1
+movdqa [rdi+2*4*4],xmm2
+movdqa [rdi+3*4*4],xmm3
+movdqa [rdi+4*4*4],xmm4
+movdqa [rdi+5*4*4],xmm5
+movdqa [rdi+6*4*4],xmm6
+movdqa [rdi+7*4*4],xmm7
+add r8, rax
+mov [rdi + 512 + 0*8], r8
+add r9, rax
+mov [rdi + 512 + 1*8], r9
+add r10, rax
+mov [rdi + 512 + 2*8], r10
+add r11, rax
+mov [rdi + 512 + 3*8], r11
+add rsp, (16*4*4 + 8*4*4 + 1*8)
+ret
+.section .data
+.balign 64
+.balign 64
+K256_4_MB:
+.quad 0x428a2f98428a2f98, 0x428a2f98428a2f98
+.quad 0x7137449171374491, 0x7137449171374491
+.quad 0xb5c0fbcfb5c0fbcf, 0xb5c0fbcfb5c0fbcf
+.quad 0xe9b5dba5e9b5dba5, 0xe9b5dba5e9b5dba5
+.quad 0x3956c25b3956c25b, 0x3956c25b3956c25b
+.quad 0x59f111f159f111f1, 0x59f111f159f111f1
+.quad 0x923f82a4923f82a4, 0x923f82a4923f82a4
+.quad 0xab1c5ed5ab1c5ed5, 0xab1c5ed5ab1c5ed5
+.quad 0xd807aa98d807aa98, 0xd807aa98d807aa98
+.quad 0x12835b0112835b01, 0x12835b0112835b01
+.quad 0x243185be243185be, 0x243185be243185be
+.quad 0x550c7dc3550c7dc3, 0x550c7dc3550c7dc3
+.quad 0x72be5d7472be5d74, 0x72be5d7472be5d74
+.quad 0x80deb1fe80deb1fe, 0x80deb1fe80deb1fe
+.quad 0x9bdc06a79bdc06a7, 0x9bdc06a79bdc06a7
+.quad 0xc19bf174c19bf174, 0xc19bf174c19bf174
+.quad 0xe49b69c1e49b69c1, 0xe49b69c1e49b69c1
+.quad 0xefbe4786efbe4786, 0xefbe4786efbe4786
+.quad 0x0fc19dc60fc19dc6, 0x0fc19dc60fc19dc6
+.quad 0x240ca1cc240ca1cc, 0x240ca1cc240ca1cc
+.quad 0x2de92c6f2de92c6f, 0x2de92c6f2de92c6f
+.quad 0x4a7484aa4a7484aa, 0x4a7484aa4a7484aa
+.quad 0x5cb0a9dc5cb0a9dc, 0x5cb0a9dc5cb0a9dc
+.quad 0x76f988da76f988da, 0x76f988da76f988da
+.quad 0x983e5152983e5152, 0x983e5152983e5152
+.quad 0xa831c66da831c66d, 0xa831c66da831c66d
+.quad 0xb00327c8b00327c8, 0xb00327c8b00327c8
+.quad 0xbf597fc7bf597fc7, 0xbf597fc7bf597fc7
+.quad 0xc6e00bf3c6e00bf3, 0xc6e00bf3c6e00bf3
+.quad 0xd5a79147d5a79147, 0xd5a79147d5a79147
+.quad 0x06ca635106ca6351, 0x06ca635106ca6351
+.quad 0x1429296714292967, 0x1429296714292967
+.quad 0x27b70a8527b70a85, 0x27b70a8527b70a85
+.quad 0x2e1b21382e1b2138, 0x2e1b21382e1b2138
+.quad 0x4d2c6dfc4d2c6dfc, 0x4d2c6dfc4d2c6dfc
+.quad 0x53380d1353380d13, 0x53380d1353380d13
+.quad 0x650a7354650a7354, 0x650a7354650a7354
+.quad 0x766a0abb766a0abb, 0x766a0abb766a0abb
+.quad 0x81c2c92e81c2c92e, 0x81c2c92e81c2c92e
+.quad 0x92722c8592722c85, 0x92722c8592722c85
+.quad 0xa2bfe8a1a2bfe8a1, 0xa2bfe8a1a2bfe8a1
+.quad 0xa81a664ba81a664b, 0xa81a664ba81a664b
+.quad 0xc24b8b70c24b8b70, 0xc24b8b70c24b8b70
+.quad 0xc76c51a3c76c51a3, 0xc76c51a3c76c51a3
+.quad 0xd192e819d192e819, 0xd192e819d192e819
+.quad 0xd6990624d6990624, 0xd6990624d6990624
+.quad 0xf40e3585f40e3585, 0xf40e3585f40e3585
+.quad 0x106aa070106aa070, 0x106aa070106aa070
+.quad 0x19a4c11619a4c116, 0x19a4c11619a4c116
+.quad 0x1e376c081e376c08, 0x1e376c081e376c08
+.quad 0x2748774c2748774c, 0x2748774c2748774c
+.quad 0x34b0bcb534b0bcb5, 0x34b0bcb534b0bcb5
+.quad 0x391c0cb3391c0cb3, 0x391c0cb3391c0cb3
+.quad 0x4ed8aa4a4ed8aa4a, 0x4ed8aa4a4ed8aa4a
+.quad 0x5b9cca4f5b9cca4f, 0x5b9cca4f5b9cca4f
+.quad 0x682e6ff3682e6ff3, 0x682e6ff3682e6ff3
+.quad 0x748f82ee748f82ee, 0x748f82ee748f82ee
+.quad 0x78a5636f78a5636f, 0x78a5636f78a5636f
+.quad 0x84c8781484c87814, 0x84c8781484c87814
+.quad 0x8cc702088cc70208, 0x8cc702088cc70208
+.quad 0x90befffa90befffa, 0x90befffa90befffa
+.quad 0xa4506ceba4506ceb, 0xa4506ceba4506ceb
+.quad 0xbef9a3f7bef9a3f7, 0xbef9a3f7bef9a3f7
+.quad 0xc67178f2c67178f2, 0xc67178f2c67178f2
+PSHUFFLE_BYTE_FLIP_MASK:
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
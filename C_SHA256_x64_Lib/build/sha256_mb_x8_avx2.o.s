@@ -0,0 +1,1938 @@
+.intel_syntax noprefix
+.section .note.GNU-stack
+.section .text
+.section .text
+.globl sha256_mb_x8_avx2
+.balign 16
+sha256_mb_x8_avx2:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+mov rax, rsp
+sub rsp, 904
+and rsp, ~31
+mov [rsp + 896], rax
+vmovdqu ymm0,[rdi + 0*(8 * 4)]
+vmovdqu ymm1,[rdi + 1*(8 * 4)]
+vmovdqu ymm2,[rdi + 2*(8 * 4)]
+vmovdqu ymm3,[rdi + 3*(8 * 4)]
+vmovdqu ymm4,[rdi + 4*(8 * 4)]
+vmovdqu ymm5,[rdi + 5*(8 * 4)]
+vmovdqu ymm6,[rdi + 6*(8 * 4)]
+vmovdqu ymm7,[rdi + 7*(8 * 4)]
+lea rcx,[rip + K256_8_MB]
+mov r9,[rdi + 512 + 0*8]
+mov r10,[rdi + 512 + 1*8]
+mov r11,[rdi + 512 + 2*8]
+mov r12,[rdi + 512 + 3*8]
+mov r13,[rdi + 512 + 4*8]
+mov r14,[rdi + 512 + 5*8]
+mov r15,[rdi + 512 + 6*8]
+mov rdx,[rdi + 512 + 7*8]
+xor rax, rax
+lloop:
+xor rbx, rbx
+vmovdqa [rsp + 512 + 0*8*4], ymm0
+vmovdqa [rsp + 512 + 1*8*4], ymm1
+vmovdqa [rsp + 512 + 2*8*4], ymm2
+vmovdqa [rsp + 512 + 3*8*4], ymm3
+vmovdqa [rsp + 512 + 4*8*4], ymm4
+vmovdqa [rsp + 512 + 5*8*4], ymm5
+vmovdqa [rsp + 512 + 6*8*4], ymm6
+vmovdqa [rsp + 512 + 7*8*4], ymm7
+vmovups ymm8,[r9+rax+0*32]
+vmovups ymm9,[r10+rax+0*32]
+vmovups ymm10,[r11+rax+0*32]
+vmovups ymm11,[r12+rax+0*32]
+vmovups ymm12,[r13+rax+0*32]
+vmovups ymm13,[r14+rax+0*32]
+vmovups ymm14,[r15+rax+0*32]
+vmovups ymm15,[rdx+rax+0*32]
+vmovdqa [rsp + 768 + 0*8*4], ymm6
+vmovdqa [rsp + 768 + 1*8*4], ymm7
+vshufps ymm6, ymm8, ymm9, 0x44
+vshufps ymm8, ymm8, ymm9, 0xEE
+vshufps ymm7, ymm10, ymm11, 0x44
+vshufps ymm10, ymm10, ymm11, 0xEE
+vshufps ymm11, ymm6, ymm7, 0xDD
+vshufps ymm9, ymm8, ymm10, 0x88
+vshufps ymm8, ymm8, ymm10, 0xDD
+vshufps ymm6, ymm6, ymm7, 0x88
+vshufps ymm10, ymm12, ymm13, 0x44
+vshufps ymm12, ymm12, ymm13, 0xEE
+vshufps ymm7, ymm14, ymm15, 0x44
+vshufps ymm14, ymm14, ymm15, 0xEE
+vshufps ymm15, ymm10, ymm7, 0xDD
+vshufps ymm13, ymm12, ymm14, 0x88
+vshufps ymm12, ymm12, ymm14, 0xDD
+vshufps ymm7, ymm10, ymm7, 0x88
+vperm2f128 ymm14, ymm13, ymm9, 0x13
+vperm2f128 ymm10, ymm13, ymm9, 0x02
+vperm2f128 ymm13, ymm15, ymm11, 0x13
+vperm2f128 ymm9, ymm15, ymm11, 0x02
+vperm2f128 ymm15, ymm12, ymm8, 0x13
+vperm2f128 ymm11, ymm12, ymm8, 0x02
+vperm2f128 ymm12, ymm7, ymm6, 0x13
+vperm2f128 ymm8, ymm7, ymm6, 0x02
+vmovdqa ymm7, [rip + PSHUFFLE_BYTE_FLIP_MASK]
+vmovdqa ymm6, [rsp + 768 + 0*8*4]
+vpshufb ymm8, ymm8, ymm7
+vpshufb ymm9, ymm9, ymm7
+vpshufb ymm10, ymm10, ymm7
+vpshufb ymm11, ymm11, ymm7
+vpshufb ymm12, ymm12, ymm7
+vpshufb ymm13, ymm13, ymm7
+vpshufb ymm14, ymm14, ymm7
+vpshufb ymm15, ymm15, ymm7
+vmovdqa ymm7, [rsp + 768 + 1*8*4]
+vmovdqa [rsp + 768 + 0*8*4], ymm12
+vmovdqa [rsp + 768 + 1*8*4], ymm13
+vmovdqa [rsp + 768 + 2*8*4], ymm14
+vmovdqa [rsp + 768 + 3*8*4], ymm15
+vpslld ymm15, ymm4, (32-((11-6)))
+vpsrld ymm12, ymm4, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm5, ymm6
+vpand ymm14, ymm14, ymm4
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm4, (32-(25))
+vpsrld ymm13, ymm4, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((0*8+0)&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm4
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm7, ymm7, ymm14
+vpslld ymm15, ymm0, (32-((13-2)))
+vpsrld ymm14, ymm0, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm7, ymm7, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm0, (32-(22))
+vpsrld ymm13, ymm0, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm0, ymm2
+add rbx, 8*4
+vpand ymm8, ymm8, ymm1
+vpaddd ymm7, ymm7, ymm12
+vpaddd ymm3, ymm3, ymm7
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm0, ymm2
+vpor ymm13, ymm13, ymm8
+vpaddd ymm7, ymm7, ymm13
+vpaddd ymm7, ymm7, ymm14
+vmovdqa ymm8, [rsp + 768 + 0*8*4]
+vpslld ymm15, ymm3, (32-((11-6)))
+vpsrld ymm12, ymm3, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm4, ymm5
+vpand ymm14, ymm14, ymm3
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm3, (32-(25))
+vpsrld ymm13, ymm3, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((0*8+1)&0xf) + rsp], ymm9
+vpaddd ymm9, ymm9, [rcx + rbx]
+vpxor ymm12, ymm12, ymm3
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm6, ymm6, ymm14
+vpslld ymm15, ymm7, (32-((13-2)))
+vpsrld ymm14, ymm7, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm6, ymm6, ymm9
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm7, (32-(22))
+vpsrld ymm13, ymm7, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm9, ymm7, ymm1
+add rbx, 8*4
+vpand ymm9, ymm9, ymm0
+vpaddd ymm6, ymm6, ymm12
+vpaddd ymm2, ymm2, ymm6
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm7, ymm1
+vpor ymm13, ymm13, ymm9
+vpaddd ymm6, ymm6, ymm13
+vpaddd ymm6, ymm6, ymm14
+vmovdqa ymm9, [rsp + 768 + 1*8*4]
+vpslld ymm15, ymm2, (32-((11-6)))
+vpsrld ymm12, ymm2, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm3, ymm4
+vpand ymm14, ymm14, ymm2
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm2, (32-(25))
+vpsrld ymm13, ymm2, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((0*8+2)&0xf) + rsp], ymm10
+vpaddd ymm10, ymm10, [rcx + rbx]
+vpxor ymm12, ymm12, ymm2
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm5, ymm5, ymm14
+vpslld ymm15, ymm6, (32-((13-2)))
+vpsrld ymm14, ymm6, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm5, ymm5, ymm10
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm6, (32-(22))
+vpsrld ymm13, ymm6, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm10, ymm6, ymm0
+add rbx, 8*4
+vpand ymm10, ymm10, ymm7
+vpaddd ymm5, ymm5, ymm12
+vpaddd ymm1, ymm1, ymm5
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm6, ymm0
+vpor ymm13, ymm13, ymm10
+vpaddd ymm5, ymm5, ymm13
+vpaddd ymm5, ymm5, ymm14
+vmovdqa ymm10, [rsp + 768 + 2*8*4]
+vpslld ymm15, ymm1, (32-((11-6)))
+vpsrld ymm12, ymm1, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm2, ymm3
+vpand ymm14, ymm14, ymm1
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm1, (32-(25))
+vpsrld ymm13, ymm1, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((0*8+3)&0xf) + rsp], ymm11
+vpaddd ymm11, ymm11, [rcx + rbx]
+vpxor ymm12, ymm12, ymm1
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm4, ymm4, ymm14
+vpslld ymm15, ymm5, (32-((13-2)))
+vpsrld ymm14, ymm5, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm4, ymm4, ymm11
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm5, (32-(22))
+vpsrld ymm13, ymm5, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm11, ymm5, ymm7
+add rbx, 8*4
+vpand ymm11, ymm11, ymm6
+vpaddd ymm4, ymm4, ymm12
+vpaddd ymm0, ymm0, ymm4
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm5, ymm7
+vpor ymm13, ymm13, ymm11
+vpaddd ymm4, ymm4, ymm13
+vpaddd ymm4, ymm4, ymm14
+vmovdqa ymm11, [rsp + 768 + 3*8*4]
+vpslld ymm15, ymm0, (32-((11-6)))
+vpsrld ymm12, ymm0, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm1, ymm2
+vpand ymm14, ymm14, ymm0
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm0, (32-(25))
+vpsrld ymm13, ymm0, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((0*8+4)&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm0
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm3, ymm3, ymm14
+vpslld ymm15, ymm4, (32-((13-2)))
+vpsrld ymm14, ymm4, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm3, ymm3, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm4, (32-(22))
+vpsrld ymm13, ymm4, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm4, ymm6
+add rbx, 8*4
+vpand ymm8, ymm8, ymm5
+vpaddd ymm3, ymm3, ymm12
+vpaddd ymm7, ymm7, ymm3
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm4, ymm6
+vpor ymm13, ymm13, ymm8
+vpaddd ymm3, ymm3, ymm13
+vpaddd ymm3, ymm3, ymm14
+vpslld ymm15, ymm7, (32-((11-6)))
+vpsrld ymm12, ymm7, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm0, ymm1
+vpand ymm14, ymm14, ymm7
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm7, (32-(25))
+vpsrld ymm13, ymm7, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((0*8+5)&0xf) + rsp], ymm9
+vpaddd ymm9, ymm9, [rcx + rbx]
+vpxor ymm12, ymm12, ymm7
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm2, ymm2, ymm14
+vpslld ymm15, ymm3, (32-((13-2)))
+vpsrld ymm14, ymm3, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm2, ymm2, ymm9
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm3, (32-(22))
+vpsrld ymm13, ymm3, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm9, ymm3, ymm5
+add rbx, 8*4
+vpand ymm9, ymm9, ymm4
+vpaddd ymm2, ymm2, ymm12
+vpaddd ymm6, ymm6, ymm2
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm3, ymm5
+vpor ymm13, ymm13, ymm9
+vpaddd ymm2, ymm2, ymm13
+vpaddd ymm2, ymm2, ymm14
+vpslld ymm15, ymm6, (32-((11-6)))
+vpsrld ymm12, ymm6, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm7, ymm0
+vpand ymm14, ymm14, ymm6
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm6, (32-(25))
+vpsrld ymm13, ymm6, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((0*8+6)&0xf) + rsp], ymm10
+vpaddd ymm10, ymm10, [rcx + rbx]
+vpxor ymm12, ymm12, ymm6
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm1, ymm1, ymm14
+vpslld ymm15, ymm2, (32-((13-2)))
+vpsrld ymm14, ymm2, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm1, ymm1, ymm10
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm2, (32-(22))
+vpsrld ymm13, ymm2, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm10, ymm2, ymm4
+add rbx, 8*4
+vpand ymm10, ymm10, ymm3
+vpaddd ymm1, ymm1, ymm12
+vpaddd ymm5, ymm5, ymm1
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm2, ymm4
+vpor ymm13, ymm13, ymm10
+vpaddd ymm1, ymm1, ymm13
+vpaddd ymm1, ymm1, ymm14
+vpslld ymm15, ymm5, (32-((11-6)))
+vpsrld ymm12, ymm5, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm6, ymm7
+vpand ymm14, ymm14, ymm5
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm5, (32-(25))
+vpsrld ymm13, ymm5, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((0*8+7)&0xf) + rsp], ymm11
+vpaddd ymm11, ymm11, [rcx + rbx]
+vpxor ymm12, ymm12, ymm5
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm0, ymm0, ymm14
+vpslld ymm15, ymm1, (32-((13-2)))
+vpsrld ymm14, ymm1, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm0, ymm0, ymm11
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm1, (32-(22))
+vpsrld ymm13, ymm1, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm11, ymm1, ymm3
+add rbx, 8*4
+vpand ymm11, ymm11, ymm2
+vpaddd ymm0, ymm0, ymm12
+vpaddd ymm4, ymm4, ymm0
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm1, ymm3
+vpor ymm13, ymm13, ymm11
+vpaddd ymm0, ymm0, ymm13
+vpaddd ymm0, ymm0, ymm14
+vmovups ymm8,[r9+rax+1*32]
+vmovups ymm9,[r10+rax+1*32]
+vmovups ymm10,[r11+rax+1*32]
+vmovups ymm11,[r12+rax+1*32]
+vmovups ymm12,[r13+rax+1*32]
+vmovups ymm13,[r14+rax+1*32]
+vmovups ymm14,[r15+rax+1*32]
+vmovups ymm15,[rdx+rax+1*32]
+vmovdqa [rsp + 768 + 0*8*4], ymm6
+vmovdqa [rsp + 768 + 1*8*4], ymm7
+vshufps ymm6, ymm8, ymm9, 0x44
+vshufps ymm8, ymm8, ymm9, 0xEE
+vshufps ymm7, ymm10, ymm11, 0x44
+vshufps ymm10, ymm10, ymm11, 0xEE
+vshufps ymm11, ymm6, ymm7, 0xDD
+vshufps ymm9, ymm8, ymm10, 0x88
+vshufps ymm8, ymm8, ymm10, 0xDD
+vshufps ymm6, ymm6, ymm7, 0x88
+vshufps ymm10, ymm12, ymm13, 0x44
+vshufps ymm12, ymm12, ymm13, 0xEE
+vshufps ymm7, ymm14, ymm15, 0x44
+vshufps ymm14, ymm14, ymm15, 0xEE
+vshufps ymm15, ymm10, ymm7, 0xDD
+vshufps ymm13, ymm12, ymm14, 0x88
+vshufps ymm12, ymm12, ymm14, 0xDD
+vshufps ymm7, ymm10, ymm7, 0x88
+vperm2f128 ymm14, ymm13, ymm9, 0x13
+vperm2f128 ymm10, ymm13, ymm9, 0x02
+vperm2f128 ymm13, ymm15, ymm11, 0x13
+vperm2f128 ymm9, ymm15, ymm11, 0x02
+vperm2f128 ymm15, ymm12, ymm8, 0x13
+vperm2f128 ymm11, ymm12, ymm8, 0x02
+vperm2f128 ymm12, ymm7, ymm6, 0x13
+vperm2f128 ymm8, ymm7, ymm6, 0x02
+vmovdqa ymm7, [rip + PSHUFFLE_BYTE_FLIP_MASK]
+vmovdqa ymm6, [rsp + 768 + 0*8*4]
+vpshufb ymm8, ymm8, ymm7
+vpshufb ymm9, ymm9, ymm7
+vpshufb ymm10, ymm10, ymm7
+vpshufb ymm11, ymm11, ymm7
+vpshufb ymm12, ymm12, ymm7
+vpshufb ymm13, ymm13, ymm7
+vpshufb ymm14, ymm14, ymm7
+vpshufb ymm15, ymm15, ymm7
+vmovdqa ymm7, [rsp + 768 + 1*8*4]
+vmovdqa [rsp + 768 + 0*8*4], ymm12
+vmovdqa [rsp + 768 + 1*8*4], ymm13
+vmovdqa [rsp + 768 + 2*8*4], ymm14
+vmovdqa [rsp + 768 + 3*8*4], ymm15
+vpslld ymm15, ymm4, (32-((11-6)))
+vpsrld ymm12, ymm4, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm5, ymm6
+vpand ymm14, ymm14, ymm4
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm4, (32-(25))
+vpsrld ymm13, ymm4, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((1*8+0)&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm4
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm7, ymm7, ymm14
+vpslld ymm15, ymm0, (32-((13-2)))
+vpsrld ymm14, ymm0, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm7, ymm7, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm0, (32-(22))
+vpsrld ymm13, ymm0, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm0, ymm2
+add rbx, 8*4
+vpand ymm8, ymm8, ymm1
+vpaddd ymm7, ymm7, ymm12
+vpaddd ymm3, ymm3, ymm7
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm0, ymm2
+vpor ymm13, ymm13, ymm8
+vpaddd ymm7, ymm7, ymm13
+vpaddd ymm7, ymm7, ymm14
+vmovdqa ymm8, [rsp + 768 + 0*8*4]
+vpslld ymm15, ymm3, (32-((11-6)))
+vpsrld ymm12, ymm3, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm4, ymm5
+vpand ymm14, ymm14, ymm3
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm3, (32-(25))
+vpsrld ymm13, ymm3, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((1*8+1)&0xf) + rsp], ymm9
+vpaddd ymm9, ymm9, [rcx + rbx]
+vpxor ymm12, ymm12, ymm3
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm6, ymm6, ymm14
+vpslld ymm15, ymm7, (32-((13-2)))
+vpsrld ymm14, ymm7, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm6, ymm6, ymm9
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm7, (32-(22))
+vpsrld ymm13, ymm7, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm9, ymm7, ymm1
+add rbx, 8*4
+vpand ymm9, ymm9, ymm0
+vpaddd ymm6, ymm6, ymm12
+vpaddd ymm2, ymm2, ymm6
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm7, ymm1
+vpor ymm13, ymm13, ymm9
+vpaddd ymm6, ymm6, ymm13
+vpaddd ymm6, ymm6, ymm14
+vmovdqa ymm9, [rsp + 768 + 1*8*4]
+vpslld ymm15, ymm2, (32-((11-6)))
+vpsrld ymm12, ymm2, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm3, ymm4
+vpand ymm14, ymm14, ymm2
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm2, (32-(25))
+vpsrld ymm13, ymm2, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((1*8+2)&0xf) + rsp], ymm10
+vpaddd ymm10, ymm10, [rcx + rbx]
+vpxor ymm12, ymm12, ymm2
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm5, ymm5, ymm14
+vpslld ymm15, ymm6, (32-((13-2)))
+vpsrld ymm14, ymm6, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm5, ymm5, ymm10
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm6, (32-(22))
+vpsrld ymm13, ymm6, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm10, ymm6, ymm0
+add rbx, 8*4
+vpand ymm10, ymm10, ymm7
+vpaddd ymm5, ymm5, ymm12
+vpaddd ymm1, ymm1, ymm5
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm6, ymm0
+vpor ymm13, ymm13, ymm10
+vpaddd ymm5, ymm5, ymm13
+vpaddd ymm5, ymm5, ymm14
+vmovdqa ymm10, [rsp + 768 + 2*8*4]
+vpslld ymm15, ymm1, (32-((11-6)))
+vpsrld ymm12, ymm1, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm2, ymm3
+vpand ymm14, ymm14, ymm1
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm1, (32-(25))
+vpsrld ymm13, ymm1, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((1*8+3)&0xf) + rsp], ymm11
+vpaddd ymm11, ymm11, [rcx + rbx]
+vpxor ymm12, ymm12, ymm1
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm4, ymm4, ymm14
+vpslld ymm15, ymm5, (32-((13-2)))
+vpsrld ymm14, ymm5, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm4, ymm4, ymm11
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm5, (32-(22))
+vpsrld ymm13, ymm5, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm11, ymm5, ymm7
+add rbx, 8*4
+vpand ymm11, ymm11, ymm6
+vpaddd ymm4, ymm4, ymm12
+vpaddd ymm0, ymm0, ymm4
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm5, ymm7
+vpor ymm13, ymm13, ymm11
+vpaddd ymm4, ymm4, ymm13
+vpaddd ymm4, ymm4, ymm14
+vmovdqa ymm11, [rsp + 768 + 3*8*4]
+vpslld ymm15, ymm0, (32-((11-6)))
+vpsrld ymm12, ymm0, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm1, ymm2
+vpand ymm14, ymm14, ymm0
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm0, (32-(25))
+vpsrld ymm13, ymm0, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((1*8+4)&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm0
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm3, ymm3, ymm14
+vpslld ymm15, ymm4, (32-((13-2)))
+vpsrld ymm14, ymm4, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm3, ymm3, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm4, (32-(22))
+vpsrld ymm13, ymm4, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm4, ymm6
+add rbx, 8*4
+vpand ymm8, ymm8, ymm5
+vpaddd ymm3, ymm3, ymm12
+vpaddd ymm7, ymm7, ymm3
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm4, ymm6
+vpor ymm13, ymm13, ymm8
+vpaddd ymm3, ymm3, ymm13
+vpaddd ymm3, ymm3, ymm14
+vpslld ymm15, ymm7, (32-((11-6)))
+vpsrld ymm12, ymm7, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm0, ymm1
+vpand ymm14, ymm14, ymm7
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm7, (32-(25))
+vpsrld ymm13, ymm7, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((1*8+5)&0xf) + rsp], ymm9
+vpaddd ymm9, ymm9, [rcx + rbx]
+vpxor ymm12, ymm12, ymm7
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm2, ymm2, ymm14
+vpslld ymm15, ymm3, (32-((13-2)))
+vpsrld ymm14, ymm3, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm2, ymm2, ymm9
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm3, (32-(22))
+vpsrld ymm13, ymm3, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm9, ymm3, ymm5
+add rbx, 8*4
+vpand ymm9, ymm9, ymm4
+vpaddd ymm2, ymm2, ymm12
+vpaddd ymm6, ymm6, ymm2
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm3, ymm5
+vpor ymm13, ymm13, ymm9
+vpaddd ymm2, ymm2, ymm13
+vpaddd ymm2, ymm2, ymm14
+vpslld ymm15, ymm6, (32-((11-6)))
+vpsrld ymm12, ymm6, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm7, ymm0
+vpand ymm14, ymm14, ymm6
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm6, (32-(25))
+vpsrld ymm13, ymm6, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((1*8+6)&0xf) + rsp], ymm10
+vpaddd ymm10, ymm10, [rcx + rbx]
+vpxor ymm12, ymm12, ymm6
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm1, ymm1, ymm14
+vpslld ymm15, ymm2, (32-((13-2)))
+vpsrld ymm14, ymm2, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm1, ymm1, ymm10
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm2, (32-(22))
+vpsrld ymm13, ymm2, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm10, ymm2, ymm4
+add rbx, 8*4
+vpand ymm10, ymm10, ymm3
+vpaddd ymm1, ymm1, ymm12
+vpaddd ymm5, ymm5, ymm1
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm2, ymm4
+vpor ymm13, ymm13, ymm10
+vpaddd ymm1, ymm1, ymm13
+vpaddd ymm1, ymm1, ymm14
+vpslld ymm15, ymm5, (32-((11-6)))
+vpsrld ymm12, ymm5, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm6, ymm7
+vpand ymm14, ymm14, ymm5
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm5, (32-(25))
+vpsrld ymm13, ymm5, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*((1*8+7)&0xf) + rsp], ymm11
+vpaddd ymm11, ymm11, [rcx + rbx]
+vpxor ymm12, ymm12, ymm5
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm0, ymm0, ymm14
+vpslld ymm15, ymm1, (32-((13-2)))
+vpsrld ymm14, ymm1, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm0, ymm0, ymm11
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm1, (32-(22))
+vpsrld ymm13, ymm1, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm11, ymm1, ymm3
+add rbx, 8*4
+vpand ymm11, ymm11, ymm2
+vpaddd ymm0, ymm0, ymm12
+vpaddd ymm4, ymm4, ymm0
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm1, ymm3
+vpor ymm13, ymm13, ymm11
+vpaddd ymm0, ymm0, ymm13
+vpaddd ymm0, ymm0, ymm14
+add rax, 4*4*4
+jmp Lrounds_16_xx
+.balign 16
+Lrounds_16_xx:
+vmovdqa ymm8, [8*4*((16-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((16-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((16-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((16-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm4, (32-((11-6)))
+vpsrld ymm12, ymm4, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm5, ymm6
+vpand ymm14, ymm14, ymm4
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm4, (32-(25))
+vpsrld ymm13, ymm4, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(16&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm4
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm7, ymm7, ymm14
+vpslld ymm15, ymm0, (32-((13-2)))
+vpsrld ymm14, ymm0, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm7, ymm7, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm0, (32-(22))
+vpsrld ymm13, ymm0, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm0, ymm2
+add rbx, 8*4
+vpand ymm8, ymm8, ymm1
+vpaddd ymm7, ymm7, ymm12
+vpaddd ymm3, ymm3, ymm7
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm0, ymm2
+vpor ymm13, ymm13, ymm8
+vpaddd ymm7, ymm7, ymm13
+vpaddd ymm7, ymm7, ymm14
+vmovdqa ymm8, [8*4*((17-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((17-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((17-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((17-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm3, (32-((11-6)))
+vpsrld ymm12, ymm3, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm4, ymm5
+vpand ymm14, ymm14, ymm3
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm3, (32-(25))
+vpsrld ymm13, ymm3, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(17&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm3
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm6, ymm6, ymm14
+vpslld ymm15, ymm7, (32-((13-2)))
+vpsrld ymm14, ymm7, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm6, ymm6, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm7, (32-(22))
+vpsrld ymm13, ymm7, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm7, ymm1
+add rbx, 8*4
+vpand ymm8, ymm8, ymm0
+vpaddd ymm6, ymm6, ymm12
+vpaddd ymm2, ymm2, ymm6
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm7, ymm1
+vpor ymm13, ymm13, ymm8
+vpaddd ymm6, ymm6, ymm13
+vpaddd ymm6, ymm6, ymm14
+vmovdqa ymm8, [8*4*((18-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((18-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((18-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((18-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm2, (32-((11-6)))
+vpsrld ymm12, ymm2, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm3, ymm4
+vpand ymm14, ymm14, ymm2
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm2, (32-(25))
+vpsrld ymm13, ymm2, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(18&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm2
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm5, ymm5, ymm14
+vpslld ymm15, ymm6, (32-((13-2)))
+vpsrld ymm14, ymm6, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm5, ymm5, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm6, (32-(22))
+vpsrld ymm13, ymm6, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm6, ymm0
+add rbx, 8*4
+vpand ymm8, ymm8, ymm7
+vpaddd ymm5, ymm5, ymm12
+vpaddd ymm1, ymm1, ymm5
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm6, ymm0
+vpor ymm13, ymm13, ymm8
+vpaddd ymm5, ymm5, ymm13
+vpaddd ymm5, ymm5, ymm14
+vmovdqa ymm8, [8*4*((19-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((19-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((19-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((19-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm1, (32-((11-6)))
+vpsrld ymm12, ymm1, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm2, ymm3
+vpand ymm14, ymm14, ymm1
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm1, (32-(25))
+vpsrld ymm13, ymm1, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(19&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm1
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm4, ymm4, ymm14
+vpslld ymm15, ymm5, (32-((13-2)))
+vpsrld ymm14, ymm5, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm4, ymm4, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm5, (32-(22))
+vpsrld ymm13, ymm5, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm5, ymm7
+add rbx, 8*4
+vpand ymm8, ymm8, ymm6
+vpaddd ymm4, ymm4, ymm12
+vpaddd ymm0, ymm0, ymm4
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm5, ymm7
+vpor ymm13, ymm13, ymm8
+vpaddd ymm4, ymm4, ymm13
+vpaddd ymm4, ymm4, ymm14
+vmovdqa ymm8, [8*4*((20-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((20-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((20-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((20-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm0, (32-((11-6)))
+vpsrld ymm12, ymm0, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm1, ymm2
+vpand ymm14, ymm14, ymm0
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm0, (32-(25))
+vpsrld ymm13, ymm0, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(20&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm0
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm3, ymm3, ymm14
+vpslld ymm15, ymm4, (32-((13-2)))
+vpsrld ymm14, ymm4, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm3, ymm3, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm4, (32-(22))
+vpsrld ymm13, ymm4, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm4, ymm6
+add rbx, 8*4
+vpand ymm8, ymm8, ymm5
+vpaddd ymm3, ymm3, ymm12
+vpaddd ymm7, ymm7, ymm3
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm4, ymm6
+vpor ymm13, ymm13, ymm8
+vpaddd ymm3, ymm3, ymm13
+vpaddd ymm3, ymm3, ymm14
+vmovdqa ymm8, [8*4*((21-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((21-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((21-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((21-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm7, (32-((11-6)))
+vpsrld ymm12, ymm7, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm0, ymm1
+vpand ymm14, ymm14, ymm7
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm7, (32-(25))
+vpsrld ymm13, ymm7, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(21&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm7
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm2, ymm2, ymm14
+vpslld ymm15, ymm3, (32-((13-2)))
+vpsrld ymm14, ymm3, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm2, ymm2, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm3, (32-(22))
+vpsrld ymm13, ymm3, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm3, ymm5
+add rbx, 8*4
+vpand ymm8, ymm8, ymm4
+vpaddd ymm2, ymm2, ymm12
+vpaddd ymm6, ymm6, ymm2
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm3, ymm5
+vpor ymm13, ymm13, ymm8
+vpaddd ymm2, ymm2, ymm13
+vpaddd ymm2, ymm2, ymm14
+vmovdqa ymm8, [8*4*((22-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((22-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((22-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((22-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm6, (32-((11-6)))
+vpsrld ymm12, ymm6, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm7, ymm0
+vpand ymm14, ymm14, ymm6
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm6, (32-(25))
+vpsrld ymm13, ymm6, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(22&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm6
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm1, ymm1, ymm14
+vpslld ymm15, ymm2, (32-((13-2)))
+vpsrld ymm14, ymm2, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm1, ymm1, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm2, (32-(22))
+vpsrld ymm13, ymm2, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm2, ymm4
+add rbx, 8*4
+vpand ymm8, ymm8, ymm3
+vpaddd ymm1, ymm1, ymm12
+vpaddd ymm5, ymm5, ymm1
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm2, ymm4
+vpor ymm13, ymm13, ymm8
+vpaddd ymm1, ymm1, ymm13
+vpaddd ymm1, ymm1, ymm14
+vmovdqa ymm8, [8*4*((23-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((23-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((23-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((23-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm5, (32-((11-6)))
+vpsrld ymm12, ymm5, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm6, ymm7
+vpand ymm14, ymm14, ymm5
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm5, (32-(25))
+vpsrld ymm13, ymm5, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(23&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm5
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm0, ymm0, ymm14
+vpslld ymm15, ymm1, (32-((13-2)))
+vpsrld ymm14, ymm1, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm0, ymm0, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm1, (32-(22))
+vpsrld ymm13, ymm1, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm1, ymm3
+add rbx, 8*4
+vpand ymm8, ymm8, ymm2
+vpaddd ymm0, ymm0, ymm12
+vpaddd ymm4, ymm4, ymm0
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm1, ymm3
+vpor ymm13, ymm13, ymm8
+vpaddd ymm0, ymm0, ymm13
+vpaddd ymm0, ymm0, ymm14
+vmovdqa ymm8, [8*4*((24-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((24-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((24-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((24-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm4, (32-((11-6)))
+vpsrld ymm12, ymm4, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm5, ymm6
+vpand ymm14, ymm14, ymm4
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm4, (32-(25))
+vpsrld ymm13, ymm4, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(24&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm4
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm7, ymm7, ymm14
+vpslld ymm15, ymm0, (32-((13-2)))
+vpsrld ymm14, ymm0, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm7, ymm7, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm0, (32-(22))
+vpsrld ymm13, ymm0, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm0, ymm2
+add rbx, 8*4
+vpand ymm8, ymm8, ymm1
+vpaddd ymm7, ymm7, ymm12
+vpaddd ymm3, ymm3, ymm7
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm0, ymm2
+vpor ymm13, ymm13, ymm8
+vpaddd ymm7, ymm7, ymm13
+vpaddd ymm7, ymm7, ymm14
+vmovdqa ymm8, [8*4*((25-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((25-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((25-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((25-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm3, (32-((11-6)))
+vpsrld ymm12, ymm3, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm4, ymm5
+vpand ymm14, ymm14, ymm3
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm3, (32-(25))
+vpsrld ymm13, ymm3, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(25&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm3
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm6, ymm6, ymm14
+vpslld ymm15, ymm7, (32-((13-2)))
+vpsrld ymm14, ymm7, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm6, ymm6, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm7, (32-(22))
+vpsrld ymm13, ymm7, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm7, ymm1
+add rbx, 8*4
+vpand ymm8, ymm8, ymm0
+vpaddd ymm6, ymm6, ymm12
+vpaddd ymm2, ymm2, ymm6
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm7, ymm1
+vpor ymm13, ymm13, ymm8
+vpaddd ymm6, ymm6, ymm13
+vpaddd ymm6, ymm6, ymm14
+vmovdqa ymm8, [8*4*((26-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((26-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((26-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((26-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm2, (32-((11-6)))
+vpsrld ymm12, ymm2, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm3, ymm4
+vpand ymm14, ymm14, ymm2
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm2, (32-(25))
+vpsrld ymm13, ymm2, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(26&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm2
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm5, ymm5, ymm14
+vpslld ymm15, ymm6, (32-((13-2)))
+vpsrld ymm14, ymm6, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm5, ymm5, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm6, (32-(22))
+vpsrld ymm13, ymm6, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm6, ymm0
+add rbx, 8*4
+vpand ymm8, ymm8, ymm7
+vpaddd ymm5, ymm5, ymm12
+vpaddd ymm1, ymm1, ymm5
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm6, ymm0
+vpor ymm13, ymm13, ymm8
+vpaddd ymm5, ymm5, ymm13
+vpaddd ymm5, ymm5, ymm14
+vmovdqa ymm8, [8*4*((27-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((27-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((27-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((27-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm1, (32-((11-6)))
+vpsrld ymm12, ymm1, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm2, ymm3
+vpand ymm14, ymm14, ymm1
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm1, (32-(25))
+vpsrld ymm13, ymm1, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(27&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm1
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm4, ymm4, ymm14
+vpslld ymm15, ymm5, (32-((13-2)))
+vpsrld ymm14, ymm5, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm4, ymm4, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm5, (32-(22))
+vpsrld ymm13, ymm5, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm5, ymm7
+add rbx, 8*4
+vpand ymm8, ymm8, ymm6
+vpaddd ymm4, ymm4, ymm12
+vpaddd ymm0, ymm0, ymm4
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm5, ymm7
+vpor ymm13, ymm13, ymm8
+vpaddd ymm4, ymm4, ymm13
+vpaddd ymm4, ymm4, ymm14
+vmovdqa ymm8, [8*4*((28-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((28-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((28-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((28-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm0, (32-((11-6)))
+vpsrld ymm12, ymm0, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm1, ymm2
+vpand ymm14, ymm14, ymm0
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm0, (32-(25))
+vpsrld ymm13, ymm0, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(28&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm0
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm3, ymm3, ymm14
+vpslld ymm15, ymm4, (32-((13-2)))
+vpsrld ymm14, ymm4, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm3, ymm3, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm4, (32-(22))
+vpsrld ymm13, ymm4, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm4, ymm6
+add rbx, 8*4
+vpand ymm8, ymm8, ymm5
+vpaddd ymm3, ymm3, ymm12
+vpaddd ymm7, ymm7, ymm3
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm4, ymm6
+vpor ymm13, ymm13, ymm8
+vpaddd ymm3, ymm3, ymm13
+vpaddd ymm3, ymm3, ymm14
+vmovdqa ymm8, [8*4*((29-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((29-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((29-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((29-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm7, (32-((11-6)))
+vpsrld ymm12, ymm7, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm0, ymm1
+vpand ymm14, ymm14, ymm7
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm7, (32-(25))
+vpsrld ymm13, ymm7, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(29&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm7
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm2, ymm2, ymm14
+vpslld ymm15, ymm3, (32-((13-2)))
+vpsrld ymm14, ymm3, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm2, ymm2, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm3, (32-(22))
+vpsrld ymm13, ymm3, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm3, ymm5
+add rbx, 8*4
+vpand ymm8, ymm8, ymm4
+vpaddd ymm2, ymm2, ymm12
+vpaddd ymm6, ymm6, ymm2
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm3, ymm5
+vpor ymm13, ymm13, ymm8
+vpaddd ymm2, ymm2, ymm13
+vpaddd ymm2, ymm2, ymm14
+vmovdqa ymm8, [8*4*((30-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((30-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((30-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((30-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm6, (32-((11-6)))
+vpsrld ymm12, ymm6, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm7, ymm0
+vpand ymm14, ymm14, ymm6
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm6, (32-(25))
+vpsrld ymm13, ymm6, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(30&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm6
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm1, ymm1, ymm14
+vpslld ymm15, ymm2, (32-((13-2)))
+vpsrld ymm14, ymm2, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm1, ymm1, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm2, (32-(22))
+vpsrld ymm13, ymm2, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm2, ymm4
+add rbx, 8*4
+vpand ymm8, ymm8, ymm3
+vpaddd ymm1, ymm1, ymm12
+vpaddd ymm5, ymm5, ymm1
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm2, ymm4
+vpor ymm13, ymm13, ymm8
+vpaddd ymm1, ymm1, ymm13
+vpaddd ymm1, ymm1, ymm14
+vmovdqa ymm8, [8*4*((31-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((31-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((31-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((31-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vpslld ymm15, ymm5, (32-((11-6)))
+vpsrld ymm12, ymm5, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm6, ymm7
+vpand ymm14, ymm14, ymm5
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm5, (32-(25))
+vpsrld ymm13, ymm5, 25
+vpor ymm13, ymm13, ymm15
+vmovdqa [8*4*(31&0xf) + rsp], ymm8
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm5
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm0, ymm0, ymm14
+vpslld ymm15, ymm1, (32-((13-2)))
+vpsrld ymm14, ymm1, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm0, ymm0, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm1, (32-(22))
+vpsrld ymm13, ymm1, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm1, ymm3
+add rbx, 8*4
+vpand ymm8, ymm8, ymm2
+vpaddd ymm0, ymm0, ymm12
+vpaddd ymm4, ymm4, ymm0
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm1, ymm3
+vpor ymm13, ymm13, ymm8
+vpaddd ymm0, ymm0, ymm13
+vpaddd ymm0, ymm0, ymm14
+cmp rbx,64*8*4
+jb Lrounds_16_xx
+vpaddd ymm0, ymm0, [rsp + 512 + 0*8*4]
+vpaddd ymm1, ymm1, [rsp + 512 + 1*8*4]
+vpaddd ymm2, ymm2, [rsp + 512 + 2*8*4]
+vpaddd ymm3, ymm3, [rsp + 512 + 3*8*4]
+vpaddd ymm4, ymm4, [rsp + 512 + 4*8*4]
+vpaddd ymm5, ymm5, [rsp + 512 + 5*8*4]
+vpaddd ymm6, ymm6, [rsp + 512 + 6*8*4]
+vpaddd ymm7, ymm7, [rsp + 512 + 7*8*4]
+sub rsi, 1
+jne lloop
+vmovdqu [rdi + 0*(8 * 4)],ymm0
+vmovdqu [rdi + 1*(8 * 4)],ymm1
+vmovdqu [rdi + 2*(8 * 4)],ymm2
+vmovdqu [rdi + 3*(8 * 4)],ymm3
+vmovdqu [rdi + 4*(8 * 4)],ymm4
+vmovdqu [rdi + 5*(8 * 4)],ymm5
+vmovdqu [rdi + 6*(8 * 4)],ymm6
+vmovdqu [rdi + 7*(8 * 4)],ymm7
+add r9, rax
+mov [rdi + 512 + 0*8], r9
+add r10, rax
+mov [rdi + 512 + 1*8], r10
+add r11, rax
+mov [rdi + 512 + 2*8], r11
+add r12, rax
+mov [rdi + 512 + 3*8], r12
+add r13, rax
+mov [rdi + 512 + 4*8], r13
+add r14, rax
+mov [rdi + 512 + 5*8], r14
+add r15, rax
+mov [rdi + 512 + 6*8], r15
+add rdx, rax
+mov [rdi + 512 + 7*8], rdx
+mov rsp, [rsp + 896]
+ret
+.section .data
+.balign 64
+K256_8_MB:
+.quad 0x428a2f98428a2f98, 0x428a2f98428a2f98
+.quad 0x428a2f98428a2f98, 0x428a2f98428a2f98
+.quad 0x7137449171374491, 0x7137449171374491
+.quad 0x7137449171374491, 0x7137449171374491
+.quad 0xb5c0fbcfb5c0fbcf, 0xb5c0fbcfb5c0fbcf
+.quad 0xb5c0fbcfb5c0fbcf, 0xb5c0fbcfb5c0fbcf
+.quad 0xe9b5dba5e9b5dba5, 0xe9b5dba5e9b5dba5
+.quad 0xe9b5dba5e9b5dba5, 0xe9b5dba5e9b5dba5
+.quad 0x3956c25b3956c25b, 0x3956c25b3956c25b
+.quad 0x3956c25b3956c25b, 0x3956c25b3956c25b
+.quad 0x59f111f159f111f1, 0x59f111f159f111f1
+.quad 0x59f111f159f111f1, 0x59f111f159f111f1
+.quad 0x923f82a4923f82a4, 0x923f82a4923f82a4
+.quad 0x923f82a4923f82a4, 0x923f82a4923f82a4
+.quad 0xab1c5ed5ab1c5ed5, 0xab1c5ed5ab1c5ed5
+.quad 0xab1c5ed5ab1c5ed5, 0xab1c5ed5ab1c5ed5
+.quad 0xd807aa98d807aa98, 0xd807aa98d807aa98
+.quad 0xd807aa98d807aa98, 0xd807aa98d807aa98
+.quad 0x12835b0112835b01, 0x12835b0112835b01
+.quad 0x12835b0112835b01, 0x12835b0112835b01
+.quad 0x243185be243185be, 0x243185be243185be
+.quad 0x243185be243185be, 0x243185be243185be
+.quad 0x550c7dc3550c7dc3, 0x550c7dc3550c7dc3
+.quad 0x550c7dc3550c7dc3, 0x550c7dc3550c7dc3
+.quad 0x72be5d7472be5d74, 0x72be5d7472be5d74
+.quad 0x72be5d7472be5d74, 0x72be5d7472be5d74
+.quad 0x80deb1fe80deb1fe, 0x80deb1fe80deb1fe
+.quad 0x80deb1fe80deb1fe, 0x80deb1fe80deb1fe
+.quad 0x9bdc06a79bdc06a7, 0x9bdc06a79bdc06a7
+.quad 0x9bdc06a79bdc06a7, 0x9bdc06a79bdc06a7
+.quad 0xc19bf174c19bf174, 0xc19bf174c19bf174
+.quad 0xc19bf174c19bf174, 0xc19bf174c19bf174
+.quad 0xe49b69c1e49b69c1, 0xe49b69c1e49b69c1
+.quad 0xe49b69c1e49b69c1, 0xe49b69c1e49b69c1
+.quad 0xefbe4786efbe4786, 0xefbe4786efbe4786
+.quad 0xefbe4786efbe4786, 0xefbe4786efbe4786
+.quad 0x0fc19dc60fc19dc6, 0x0fc19dc60fc19dc6
+.quad 0x0fc19dc60fc19dc6, 0x0fc19dc60fc19dc6
+.quad 0x240ca1cc240ca1cc, 0x240ca1cc240ca1cc
+.quad 0x240ca1cc240ca1cc, 0x240ca1cc240ca1cc
+.quad 0x2de92c6f2de92c6f, 0x2de92c6f2de92c6f
+.quad 0x2de92c6f2de92c6f, 0x2de92c6f2de92c6f
+.quad 0x4a7484aa4a7484aa, 0x4a7484aa4a7484aa
+.quad 0x4a7484aa4a7484aa, 0x4a7484aa4a7484aa
+.quad 0x5cb0a9dc5cb0a9dc, 0x5cb0a9dc5cb0a9dc
+.quad 0x5cb0a9dc5cb0a9dc, 0x5cb0a9dc5cb0a9dc
+.quad 0x76f988da76f988da, 0x76f988da76f988da
+.quad 0x76f988da76f988da, 0x76f988da76f988da
+.quad 0x983e5152983e5152, 0x983e5152983e5152
+.quad 0x983e5152983e5152, 0x983e5152983e5152
+.quad 0xa831c66da831c66d, 0xa831c66da831c66d
+.quad 0xa831c66da831c66d, 0xa831c66da831c66d
+.quad 0xb00327c8b00327c8, 0xb00327c8b00327c8
+.quad 0xb00327c8b00327c8, 0xb00327c8b00327c8
+.quad 0xbf597fc7bf597fc7, 0xbf597fc7bf597fc7
+.quad 0xbf597fc7bf597fc7, 0xbf597fc7bf597fc7
+.quad 0xc6e00bf3c6e00bf3, 0xc6e00bf3c6e00bf3
+.quad 0xc6e00bf3c6e00bf3, 0xc6e00bf3c6e00bf3
+.quad 0xd5a79147d5a79147, 0xd5a79147d5a79147
+.quad 0xd5a79147d5a79147, 0xd5a79147d5a79147
+.quad 0x06ca635106ca6351, 0x06ca635106ca6351
+.quad 0x06ca635106ca6351, 0x06ca635106ca6351
+.quad 0x1429296714292967, 0x1429296714292967
+.quad 0x1429296714292967, 0x1429296714292967
+.quad 0x27b70a8527b70a85, 0x27b70a8527b70a85
+.quad 0x27b70a8527b70a85, 0x27b70a8527b70a85
+.quad 0x2e1b21382e1b2138, 0x2e1b21382e1b2138
+.quad 0x2e1b21382e1b2138, 0x2e1b21382e1b2138
+.quad 0x4d2c6dfc4d2c6dfc, 0x4d2c6dfc4d2c6dfc
+.quad 0x4d2c6dfc4d2c6dfc, 0x4d2c6dfc4d2c6dfc
+.quad 0x53380d1353380d13, 0x53380d1353380d13
+.quad 0x53380d1353380d13, 0x53380d1353380d13
+.quad 0x650a7354650a7354, 0x650a7354650a7354
+.quad 0x650a7354650a7354, 0x650a7354650a7354
+.quad 0x766a0abb766a0abb, 0x766a0abb766a0abb
+.quad 0x766a0abb766a0abb, 0x766a0abb766a0abb
+.quad 0x81c2c92e81c2c92e, 0x81c2c92e81c2c92e
+.quad 0x81c2c92e81c2c92e, 0x81c2c92e81c2c92e
+.quad 0x92722c8592722c85, 0x92722c8592722c85
+.quad 0x92722c8592722c85, 0x92722c8592722c85
+.quad 0xa2bfe8a1a2bfe8a1, 0xa2bfe8a1a2bfe8a1
+.quad 0xa2bfe8a1a2bfe8a1, 0xa2bfe8a1a2bfe8a1
+.quad 0xa81a664ba81a664b, 0xa81a664ba81a664b
+.quad 0xa81a664ba81a664b, 0xa81a664ba81a664b
+.quad 0xc24b8b70c24b8b70, 0xc24b8b70c24b8b70
+.quad 0xc24b8b70c24b8b70, 0xc24b8b70c24b8b70
+.quad 0xc76c51a3c76c51a3, 0xc76c51a3c76c51a3
+.quad 0xc76c51a3c76c51a3, 0xc76c51a3c76c51a3
+.quad 0xd192e819d192e819, 0xd192e819d192e819
+.quad 0xd192e819d192e819, 0xd192e819d192e819
+.quad 0xd6990624d6990624, 0xd6990624d6990624
+.quad 0xd6990624d6990624, 0xd6990624d6990624
+.quad 0xf40e3585f40e3585, 0xf40e3585f40e3585
+.quad 0xf40e3585f40e3585, 0xf40e3585f40e3585
+.quad 0x106aa070106aa070, 0x106aa070106aa070
+.quad 0x106aa070106aa070, 0x106aa070106aa070
+.quad 0x19a4c11619a4c116, 0x19a4c11619a4c116
+.quad 0x19a4c11619a4c116, 0x19a4c11619a4c116
+.quad 0x1e376c081e376c08, 0x1e376c081e376c08
+.quad 0x1e376c081e376c08, 0x1e376c081e376c08
+.quad 0x2748774c2748774c, 0x2748774c2748774c
+.quad 0x2748774c2748774c, 0x2748774c2748774c
+.quad 0x34b0bcb534b0bcb5, 0x34b0bcb534b0bcb5
+.quad 0x34b0bcb534b0bcb5, 0x34b0bcb534b0bcb5
+.quad 0x391c0cb3391c0cb3, 0x391c0cb3391c0cb3
+.quad 0x391c0cb3391c0cb3, 0x391c0cb3391c0cb3
+.quad 0x4ed8aa4a4ed8aa4a, 0x4ed8aa4a4ed8aa4a
+.quad 0x4ed8aa4a4ed8aa4a, 0x4ed8aa4a4ed8aa4a
+.quad 0x5b9cca4f5b9cca4f, 0x5b9cca4f5b9cca4f
+.quad 0x5b9cca4f5b9cca4f, 0x5b9cca4f5b9cca4f
+.quad 0x682e6ff3682e6ff3, 0x682e6ff3682e6ff3
+.quad 0x682e6ff3682e6ff3, 0x682e6ff3682e6ff3
+.quad 0x748f82ee748f82ee, 0x748f82ee748f82ee
+.quad 0x748f82ee748f82ee, 0x748f82ee748f82ee
+.quad 0x78a5636f78a5636f, 0x78a5636f78a5636f
+.quad 0x78a5636f78a5636f, 0x78a5636f78a5636f
+.quad 0x84c8781484c87814, 0x84c8781484c87814
+.quad 0x84c8781484c87814, 0x84c8781484c87814
+.quad 0x8cc702088cc70208, 0x8cc702088cc70208
+.quad 0x8cc702088cc70208, 0x8cc702088cc70208
+.quad 0x90befffa90befffa, 0x90befffa90befffa
+.quad 0x90befffa90befffa, 0x90befffa90befffa
+.quad 0xa4506ceba4506ceb, 0xa4506ceba4506ceb
+.quad 0xa4506ceba4506ceb, 0xa4506ceba4506ceb
+.quad 0xbef9a3f7bef9a3f7, 0xbef9a3f7bef9a3f7
+.quad 0xbef9a3f7bef9a3f7, 0xbef9a3f7bef9a3f7
+.quad 0xc67178f2c67178f2, 0xc67178f2c67178f2
+.quad 0xc67178f2c67178f2, 0xc67178f2c67178f2
+PSHUFFLE_BYTE_FLIP_MASK:
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
@@ -0,0 +1,238 @@
+.intel_syntax noprefix
+.section .note.GNU-stack
+.section .text
+.section .text
+.globl sha256_mb_x16_avx512_wrapper
+.globl sha256_mb_x16_avx512_wrapper
+.balign 64
+sha256_mb_x16_avx512_wrapper:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+sub rsp, 232
+mov [rsp + 160 + 8*0], rbx
+mov [rsp + 160 + 8*3], rbp
+mov [rsp + 160 + 8*4], r12
+mov [rsp + 160 + 8*5], r13
+mov [rsp + 160 + 8*6], r14
+mov [rsp + 160 + 8*7], r15
+call sha256_mb_x16_avx512@PLT
+mov rbx, [rsp + 160 + 8*0]
+mov rbp, [rsp + 160 + 8*3]
+mov r12, [rsp + 160 + 8*4]
+mov r13, [rsp + 160 + 8*5]
+mov r14, [rsp + 160 + 8*6]
+mov r15, [rsp + 160 + 8*7]
+add rsp, 232
+ret
+.globl sha256_mb_x8_avx2_wrapper
+.globl sha256_mb_x8_avx2_wrapper
+.balign 64
+sha256_mb_x8_avx2_wrapper:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+sub rsp, 232
+mov [rsp + 160 + 8*0], rbx
+mov [rsp + 160 + 8*3], rbp
+mov [rsp + 160 + 8*4], r12
+mov [rsp + 160 + 8*5], r13
+mov [rsp + 160 + 8*6], r14
+mov [rsp + 160 + 8*7], r15
+call sha256_mb_x8_avx2@PLT
+mov rbx, [rsp + 160 + 8*0]
+mov rbp, [rsp + 160 + 8*3]
+mov r12, [rsp + 160 + 8*4]
+mov r13, [rsp + 160 + 8*5]
+mov r14, [rsp + 160 + 8*6]
+mov r15, [rsp + 160 + 8*7]
+add rsp, 232
+ret
+.globl sha256_mb_x8_avx512vl_wrapper
+.globl sha256_mb_x8_avx512vl_wrapper
+.balign 64
+sha256_mb_x8_avx512vl_wrapper:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+sub rsp, 232
+mov [rsp + 160 + 8*0], rbx
+mov [rsp + 160 + 8*3], rbp
+mov [rsp + 160 + 8*4], r12
+mov [rsp + 160 + 8*5], r13
+mov [rsp + 160 + 8*6], r14
+mov [rsp + 160 + 8*7], r15
+call sha256_mb_x8_avx512vl@PLT
+mov rbx, [rsp + 160 + 8*0]
+mov rbp, [rsp + 160 + 8*3]
+mov r12, [rsp + 160 + 8*4]
+mov r13, [rsp + 160 + 8*5]
+mov r14, [rsp + 160 + 8*6]
+mov r15, [rsp + 160 + 8*7]
+add rsp, 232
+ret
+.globl sha256_mb_x4_avx_wrapper
+.globl sha256_mb_x4_avx_wrapper
+.balign 64
+sha256_mb_x4_avx_wrapper:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+sub rsp, 232
+mov [rsp + 160 + 8*0], rbx
+mov [rsp + 160 + 8*3], rbp
+mov [rsp + 160 + 8*4], r12
+mov [rsp + 160 + 8*5], r13
+mov [rsp + 160 + 8*6], r14
+mov [rsp + 160 + 8*7], r15
+call sha256_mb_x4_avx@PLT
+mov rbx, [rsp + 160 + 8*0]
+mov rbp, [rsp + 160 + 8*3]
+mov r12, [rsp + 160 + 8*4]
+mov r13, [rsp + 160 + 8*5]
+mov r14, [rsp + 160 + 8*6]
+mov r15, [rsp + 160 + 8*7]
+add rsp, 232
+ret
+.globl sha256_mb_x4_sse_wrapper
+.globl sha256_mb_x4_sse_wrapper
+.balign 64
+sha256_mb_x4_sse_wrapper:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+sub rsp, 232
+mov [rsp + 160 + 8*0], rbx
+mov [rsp + 160 + 8*3], rbp
+mov [rsp + 160 + 8*4], r12
+mov [rsp + 160 + 8*5], r13
+mov [rsp + 160 + 8*6], r14
+mov [rsp + 160 + 8*7], r15
+call sha256_mb_x4_sse@PLT
+mov rbx, [rsp + 160 + 8*0]
+mov rbp, [rsp + 160 + 8*3]
+mov r12, [rsp + 160 + 8*4]
+mov r13, [rsp + 160 + 8*5]
+mov r14, [rsp + 160 + 8*6]
+mov r15, [rsp + 160 + 8*7]
+add rsp, 232
+ret
+.globl sha256_mb_x4_sha_sse41_wrapper
+.globl sha256_mb_x4_sha_sse41_wrapper
+.balign 64
+sha256_mb_x4_sha_sse41_wrapper:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+sub rsp, 232
+mov [rsp + 160 + 8*0], rbx
+mov [rsp + 160 + 8*3], rbp
+mov [rsp + 160 + 8*4], r12
+mov [rsp + 160 + 8*5], r13
+mov [rsp + 160 + 8*6], r14
+mov [rsp + 160 + 8*7], r15
+call sha256_mb_x4_sha_sse41@PLT
+mov rbx, [rsp + 160 + 8*0]
+mov rbp, [rsp + 160 + 8*3]
+mov r12, [rsp + 160 + 8*4]
+mov r13, [rsp + 160 + 8*5]
+mov r14, [rsp + 160 + 8*6]
+mov r15, [rsp + 160 + 8*7]
+add rsp, 232
+ret
+.globl sha256_mb_x2_sha_sse41_wrapper
+.globl sha256_mb_x2_sha_sse41_wrapper
+.balign 64
+sha256_mb_x2_sha_sse41_wrapper:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+sub rsp, 232
+mov [rsp + 160 + 8*0], rbx
+mov [rsp + 160 + 8*3], rbp
+mov [rsp + 160 + 8*4], r12
+mov [rsp + 160 + 8*5], r13
+mov [rsp + 160 + 8*6], r14
+mov [rsp + 160 + 8*7], r15
+call sha256_mb_x2_sha_sse41@PLT
+mov rbx, [rsp + 160 + 8*0]
+mov rbp, [rsp + 160 + 8*3]
+mov r12, [rsp + 160 + 8*4]
+mov r13, [rsp + 160 + 8*5]
+mov r14, [rsp + 160 + 8*6]
+mov r15, [rsp + 160 + 8*7]
+add rsp, 232
+ret
+.globl sha256_mine_x16_avx512_wrapper
+.globl sha256_mine_x16_avx512_wrapper
+.balign 64
+sha256_mine_x16_avx512_wrapper:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+sub rsp, 232
+mov [rsp + 160 + 8*0], rbx
+mov [rsp + 160 + 8*3], rbp
+mov [rsp + 160 + 8*4], r12
+mov [rsp + 160 + 8*5], r13
+mov [rsp + 160 + 8*6], r14
+mov [rsp + 160 + 8*7], r15
+call sha256_mine_x16_avx512@PLT
+mov rbx, [rsp + 160 + 8*0]
+mov rbp, [rsp + 160 + 8*3]
+mov r12, [rsp + 160 + 8*4]
+mov r13, [rsp + 160 + 8*5]
+mov r14, [rsp + 160 + 8*6]
+mov r15, [rsp + 160 + 8*7]
+add rsp, 232
+ret
+.globl sha256_mine_x8_avx2_wrapper
+.globl sha256_mine_x8_avx2_wrapper
+.balign 64
+sha256_mine_x8_avx2_wrapper:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+sub rsp, 232
+mov [rsp + 160 + 8*0], rbx
+mov [rsp + 160 + 8*3], rbp
+mov [rsp + 160 + 8*4], r12
+mov [rsp + 160 + 8*5], r13
+mov [rsp + 160 + 8*6], r14
+mov [rsp + 160 + 8*7], r15
+call sha256_mine_x8_avx2@PLT
+mov rbx, [rsp + 160 + 8*0]
+mov rbp, [rsp + 160 + 8*3]
+mov r12, [rsp + 160 + 8*4]
+mov r13, [rsp + 160 + 8*5]
+mov r14, [rsp + 160 + 8*6]
+mov r15, [rsp + 160 + 8*7]
+add rsp, 232
+ret
+.globl sha256_mine_x8_avx512vl_wrapper
+.globl sha256_mine_x8_avx512vl_wrapper
+.balign 64
+sha256_mine_x8_avx512vl_wrapper:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+sub rsp, 232
+mov [rsp + 160 + 8*0], rbx
+mov [rsp + 160 + 8*3], rbp
+mov [rsp + 160 + 8*4], r12
+mov [rsp + 160 + 8*5], r13
+mov [rsp + 160 + 8*6], r14
+mov [rsp + 160 + 8*7], r15
+call sha256_mine_x8_avx512vl@PLT
+mov rbx, [rsp + 160 + 8*0]
+mov rbp, [rsp + 160 + 8*3]
+mov r12, [rsp + 160 + 8*4]
+mov r13, [rsp + 160 + 8*5]
+mov r14, [rsp + 160 + 8*6]
+mov r15, [rsp + 160 + 8*7]
+add rsp, 232
+ret
+.globl sha256_ni_x1_wrapper
+.globl sha256_ni_x1_wrapper
+.balign 64
+sha256_ni_x1_wrapper:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+sub rsp, 232
+mov [rsp + 160 + 8*0], rbx
+mov [rsp + 160 + 8*3], rbp
+mov [rsp + 160 + 8*4], r12
+mov [rsp + 160 + 8*5], r13
+mov [rsp + 160 + 8*6], r14
+mov [rsp + 160 + 8*7], r15
+lea r10, [rcx*4]
+shl r10, 8
+or r10, rdx
+call sha256_ni_x1@PLT
+mov rbx, [rsp + 160 + 8*0]
+mov rbp, [rsp + 160 + 8*3]
+mov r12, [rsp + 160 + 8*4]
+mov r13, [rsp + 160 + 8*5]
+mov r14, [rsp + 160 + 8*6]
+mov r15, [rsp + 160 + 8*7]
+add rsp, 232
+ret
@@ -0,0 +1,335 @@
+.intel_syntax noprefix
+.section .note.GNU-stack
+.section .text
+.section .text
+.balign 32
+.globl sha256_mine_sha_sse41
+sha256_mine_sha_sse41:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+sub rsp, 232
+movdqu xmm0, [rsi + 384]
+movdqu xmm10, [rsi + 384 + 16]
+pshufd xmm0, xmm0, 0xB1
+pshufd xmm10, xmm10, 0x1B
+movdqa xmm9, xmm0
+palignr xmm9, xmm10, 8
+pblendw xmm10, xmm0, 0xF0
+movdqu xmm0, [rsi + 416]
+movdqu xmm2, [rsi + 416 + 16]
+pshufd xmm0, xmm0, 0xB1
+pshufd xmm2, xmm2, 0x1B
+movdqa xmm1, xmm0
+palignr xmm1, xmm2, 8
+pblendw xmm2, xmm0, 0xF0
+movdqa xmm8, [rip + PSHUFFLE_SHANI_MASK]
+lea rax, [rip + TABLE]
+mov r11, rdi
+mov r9d, [rsi + 452]
+and r9d, 2
+mov r10d, [rsi + 448]
+cmp r10d, 4
+jb sha256_mine_sha_sse41_rounds_0
+movdqu xmm3, [r11 + 0*16]
+pshufb xmm3, xmm8
+je sha256_mine_sha_sse41_rounds_4
+movdqu xmm4, [r11 + 1*16]
+pshufb xmm4, xmm8
+sha256msg1 xmm3, xmm4
+cmp r10d, 8
+je sha256_mine_sha_sse41_rounds_8
+movdqu xmm5, [r11 + 2*16]
+pshufb xmm5, xmm8
+sha256msg1 xmm4, xmm5
+jmp sha256_mine_sha_sse41_rounds_12
+sha256_mine_sha_sse41_rounds_0:
+movdqu xmm0, [r11 + 0*16]
+pshufb xmm0, xmm8
+movdqa xmm3, xmm0
+paddd xmm0, [rax + 0*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256_mine_sha_sse41_rounds_4:
+movdqu xmm0, [r11 + 1*16]
+pshufb xmm0, xmm8
+movdqa xmm4, xmm0
+paddd xmm0, [rax + 1*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm3, xmm4
+sha256_mine_sha_sse41_rounds_8:
+movdqu xmm0, [r11 + 2*16]
+pshufb xmm0, xmm8
+movdqa xmm5, xmm0
+paddd xmm0, [rax + 2*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm4, xmm5
+sha256_mine_sha_sse41_rounds_12:
+movdqu xmm0, [r11 + 3*16]
+pshufb xmm0, xmm8
+movdqa xmm6, xmm0
+paddd xmm0, [rax + 3*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm6
+palignr xmm7, xmm5, 4
+paddd xmm3, xmm7
+sha256msg2 xmm3, xmm6
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm5, xmm6
+movdqa xmm0, xmm3
+paddd xmm0, [rax + 4*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm3
+palignr xmm7, xmm6, 4
+paddd xmm4, xmm7
+sha256msg2 xmm4, xmm3
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm6, xmm3
+movdqa xmm0, xmm4
+paddd xmm0, [rax + 5*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm4
+palignr xmm7, xmm3, 4
+paddd xmm5, xmm7
+sha256msg2 xmm5, xmm4
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm3, xmm4
+movdqa xmm0, xmm5
+paddd xmm0, [rax + 6*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm5
+palignr xmm7, xmm4, 4
+paddd xmm6, xmm7
+sha256msg2 xmm6, xmm5
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm4, xmm5
+movdqa xmm0, xmm6
+paddd xmm0, [rax + 7*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm6
+palignr xmm7, xmm5, 4
+paddd xmm3, xmm7
+sha256msg2 xmm3, xmm6
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm5, xmm6
+movdqa xmm0, xmm3
+paddd xmm0, [rax + 8*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm3
+palignr xmm7, xmm6, 4
+paddd xmm4, xmm7
+sha256msg2 xmm4, xmm3
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm6, xmm3
+movdqa xmm0, xmm4
+paddd xmm0, [rax + 9*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm4
+palignr xmm7, xmm3, 4
+paddd xmm5, xmm7
+sha256msg2 xmm5, xmm4
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm3, xmm4
+movdqa xmm0, xmm5
+paddd xmm0, [rax + 10*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm5
+palignr xmm7, xmm4, 4
+paddd xmm6, xmm7
+sha256msg2 xmm6, xmm5
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm4, xmm5
+movdqa xmm0, xmm6
+paddd xmm0, [rax + 11*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm6
+palignr xmm7, xmm5, 4
+paddd xmm3, xmm7
+sha256msg2 xmm3, xmm6
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm5, xmm6
+movdqa xmm0, xmm3
+paddd xmm0, [rax + 12*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm3
+palignr xmm7, xmm6, 4
+paddd xmm4, xmm7
+sha256msg2 xmm4, xmm3
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm6, xmm3
+movdqa xmm0, xmm4
+paddd xmm0, [rax + 13*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm4
+palignr xmm7, xmm3, 4
+paddd xmm5, xmm7
+sha256msg2 xmm5, xmm4
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, xmm5
+paddd xmm0, [rax + 14*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm5
+palignr xmm7, xmm4, 4
+paddd xmm6, xmm7
+sha256msg2 xmm6, xmm5
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, xmm6
+paddd xmm0, [rax + 15*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sub rdx, 1
+je sha256_mine_sha_sse41_last_block
+paddd xmm1, xmm9
+paddd xmm2, xmm10
+movdqa xmm9, xmm1
+movdqa xmm10, xmm2
+test dword ptr [rsi + 452], 1
+jnz sha256_mine_sha_sse41_const_block
+add r11, 64
+jmp sha256_mine_sha_sse41_rounds_0
+sha256_mine_sha_sse41_const_block:
+movdqa xmm0, [rsi + 0 + 0*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 1*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 2*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 3*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 4*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 5*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 6*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 7*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 8*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 9*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 10*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 11*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 12*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 13*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 14*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, [rsi + 0 + 15*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256_mine_sha_sse41_last_block:
+test r9d, r9d
+jnz sha256_mine_sha_sse41_second_hash
+paddd xmm1, xmm9
+pextrd r10d, xmm1, 3
+xor eax, eax
+cmp r10d, [rsi + 456]
+setbe al
+add rsp, 232
+ret
+sha256_mine_sha_sse41_second_hash:
+xor r9d, r9d
+paddd xmm1, xmm9
+paddd xmm2, xmm10
+movdqa xmm3, xmm1
+punpckhdq xmm3, xmm2
+pshufd xmm3, xmm3, 0x72
+punpckldq xmm1, xmm2
+pshufd xmm1, xmm1, 0x72
+pshufb xmm3, xmm8
+pshufb xmm1, xmm8
+movdqu [rsp + 160 + 0*16], xmm3
+movdqu [rsp + 160 + 1*16], xmm1
+movdqa xmm3, [rip + SHA256D_PAD + 0*16]
+movdqu [rsp + 160 + 2*16], xmm3
+movdqa xmm3, [rip + SHA256D_PAD + 1*16]
+movdqu [rsp + 160 + 3*16], xmm3
+movdqu xmm0, [rip + SHA256_IV]
+movdqu xmm2, [rip + SHA256_IV + 16]
+pshufd xmm0, xmm0, 0xB1
+pshufd xmm2, xmm2, 0x1B
+movdqa xmm1, xmm0
+palignr xmm1, xmm2, 8
+pblendw xmm2, xmm0, 0xF0
+movdqa xmm9, xmm1
+movdqa xmm10, xmm2
+lea r11, [rsp + 160]
+mov rdx, 1
+jmp sha256_mine_sha_sse41_rounds_0
+.section .data
+.balign 16
+PSHUFFLE_SHANI_MASK:
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
+SHA256_IV:
+.long 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a
+.long 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+SHA256D_PAD:
+.quad 0x80, 0, 0, 0x0001000000000000
+TABLE:
+.long 0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5
+.long 0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5
+.long 0xd807aa98,0x12835b01,0x243185be,0x550c7dc3
+.long 0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174
+.long 0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc
+.long 0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da
+.long 0x983e5152,0xa831c66d,0xb00327c8,0xbf597fc7
+.long 0xc6e00bf3,0xd5a79147,0x06ca6351,0x14292967
+.long 0x27b70a85,0x2e1b2138,0x4d2c6dfc,0x53380d13
+.long 0x650a7354,0x766a0abb,0x81c2c92e,0x92722c85
+.long 0xa2bfe8a1,0xa81a664b,0xc24b8b70,0xc76c51a3
+.long 0xd192e819,0xd6990624,0xf40e3585,0x106aa070
+.long 0x19a4c116,0x1e376c08,0x2748774c,0x34b0bcb5
+.long 0x391c0cb3,0x4ed8aa4a,0x5b9cca4f,0x682e6ff3
+.long 0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208
+.long 0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
@@ -0,0 +1,2707 @@
+.intel_syntax noprefix
+.section .note.GNU-stack
+.section .text
+.section .text
+.balign 64
+.globl sha256_mine_x16_avx512
+sha256_mine_x16_avx512:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+mov rax, rsp
+sub rsp, 2800
+and rsp, ~63
+mov [rsp + 2792], rax
+lea rcx, [rip + TABLE]
+vpbroadcastq zmm9, [rsi + 0]
+vpaddq zmm10, zmm9, [rip + NONCE_LANE_OFFSETS + 64*0]
+vpaddq zmm9, zmm9, [rip + NONCE_LANE_OFFSETS + 64*1]
+vmovdqa64 [rsp + 2560 + 64*0], zmm10
+vmovdqa64 [rsp + 2560 + 64*1], zmm9
+vpbroadcastq zmm9, [rsi + 24]
+vmovdqa64 [rsp + 2688], zmm9
+mov eax, [rdi + 464]
+mov [rsp + 2752], rax
+neg eax
+add eax, 32
+mov [rsp + 2768], rax
+vpbroadcastd zmm9, [rdi + 256 + 4*0]
+vmovdqa32 [rsp + 512 + 64*0], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*1]
+vmovdqa32 [rsp + 512 + 64*1], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*2]
+vmovdqa32 [rsp + 512 + 64*2], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*3]
+vmovdqa32 [rsp + 512 + 64*3], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*4]
+vmovdqa32 [rsp + 512 + 64*4], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*5]
+vmovdqa32 [rsp + 512 + 64*5], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*6]
+vmovdqa32 [rsp + 512 + 64*6], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*7]
+vmovdqa32 [rsp + 512 + 64*7], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*8]
+vmovdqa32 [rsp + 512 + 64*8], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*9]
+vmovdqa32 [rsp + 512 + 64*9], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*10]
+vmovdqa32 [rsp + 512 + 64*10], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*11]
+vmovdqa32 [rsp + 512 + 64*11], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*12]
+vmovdqa32 [rsp + 512 + 64*12], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*13]
+vmovdqa32 [rsp + 512 + 64*13], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*14]
+vmovdqa32 [rsp + 512 + 64*14], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*15]
+vmovdqa32 [rsp + 512 + 64*15], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*16]
+vmovdqa32 [rsp + 512 + 64*16], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*17]
+vmovdqa32 [rsp + 512 + 64*17], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*18]
+vmovdqa32 [rsp + 512 + 64*18], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*19]
+vmovdqa32 [rsp + 512 + 64*19], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*20]
+vmovdqa32 [rsp + 512 + 64*20], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*21]
+vmovdqa32 [rsp + 512 + 64*21], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*22]
+vmovdqa32 [rsp + 512 + 64*22], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*23]
+vmovdqa32 [rsp + 512 + 64*23], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*24]
+vmovdqa32 [rsp + 512 + 64*24], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*25]
+vmovdqa32 [rsp + 512 + 64*25], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*26]
+vmovdqa32 [rsp + 512 + 64*26], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*27]
+vmovdqa32 [rsp + 512 + 64*27], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*28]
+vmovdqa32 [rsp + 512 + 64*28], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*29]
+vmovdqa32 [rsp + 512 + 64*29], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*30]
+vmovdqa32 [rsp + 512 + 64*30], zmm9
+vpbroadcastd zmm9, [rdi + 256 + 4*31]
+vmovdqa32 [rsp + 512 + 64*31], zmm9
+mov eax, [rdi + 460]
+lea r12, [rdi + 256 + 4*rax]
+shl rax, 6
+lea r11, [rsp + 512 + rax]
+xor eax, eax
+mov r10, [rsi + 8]
+test r10, r10
+jz sha256_mine_x16_avx512_done
+sha256_mine_x16_avx512_batch_loop:
+vmovdqa64 zmm9, [rsp + 2560 + 64*0]
+vmovdqa64 zmm10, [rsp + 2560 + 64*1]
+vmovdqa32 zmm11, [rip + NONCE_LO_PERM]
+vpermi2d zmm11, zmm9, zmm10
+vmovdqa32 zmm12, [rip + NONCE_HI_PERM]
+vpermi2d zmm12, zmm9, zmm10
+vpaddq zmm9, zmm9, [rsp + 2688]
+vpaddq zmm10, zmm10, [rsp + 2688]
+vmovdqa64 [rsp + 2560 + 64*0], zmm9
+vmovdqa64 [rsp + 2560 + 64*1], zmm10
+vmovdqa32 zmm15, [rip + PSHUFFLE_BYTE_FLIP_MASK]
+vpslld zmm13, zmm11, [rsp + 2752]
+vpsrld zmm11, zmm11, [rsp + 2768]
+vpslld zmm14, zmm12, [rsp + 2752]
+vpsrld zmm12, zmm12, [rsp + 2768]
+vpord zmm11, zmm11, zmm14
+vpshufb zmm13, zmm13, zmm15
+vpshufb zmm11, zmm11, zmm15
+vpshufb zmm12, zmm12, zmm15
+vpord zmm13, zmm13, [r12 + 4*0]{1to16}
+vpord zmm11, zmm11, [r12 + 4*1]{1to16}
+vpord zmm12, zmm12, [r12 + 4*2]{1to16}
+vmovdqa32 [r11 + 64*0], zmm13
+vmovdqa32 [r11 + 64*1], zmm11
+vmovdqa32 [r11 + 64*2], zmm12
+vpbroadcastd zmm9, [rdi + 384 + 4*0]
+vmovdqa32 [rsp + 0 + 64*0], zmm9
+vpbroadcastd zmm9, [rdi + 384 + 4*1]
+vmovdqa32 [rsp + 0 + 64*1], zmm9
+vpbroadcastd zmm9, [rdi + 384 + 4*2]
+vmovdqa32 [rsp + 0 + 64*2], zmm9
+vpbroadcastd zmm9, [rdi + 384 + 4*3]
+vmovdqa32 [rsp + 0 + 64*3], zmm9
+vpbroadcastd zmm9, [rdi + 384 + 4*4]
+vmovdqa32 [rsp + 0 + 64*4], zmm9
+vpbroadcastd zmm9, [rdi + 384 + 4*5]
+vmovdqa32 [rsp + 0 + 64*5], zmm9
+vpbroadcastd zmm9, [rdi + 384 + 4*6]
+vmovdqa32 [rsp + 0 + 64*6], zmm9
+vpbroadcastd zmm9, [rdi + 384 + 4*7]
+vmovdqa32 [rsp + 0 + 64*7], zmm9
+mov r9, rdx
+mov eax, [rdi + 452]
+and eax, 2
+mov [rsp + 2784], rax
+vmovdqa32 zmm16, [rsp + 512 + 64*(0*16 + 0)]
+vmovdqa32 zmm17, [rsp + 512 + 64*(0*16 + 1)]
+vmovdqa32 zmm18, [rsp + 512 + 64*(0*16 + 2)]
+vmovdqa32 zmm19, [rsp + 512 + 64*(0*16 + 3)]
+vmovdqa32 zmm20, [rsp + 512 + 64*(0*16 + 4)]
+vmovdqa32 zmm21, [rsp + 512 + 64*(0*16 + 5)]
+vmovdqa32 zmm22, [rsp + 512 + 64*(0*16 + 6)]
+vmovdqa32 zmm23, [rsp + 512 + 64*(0*16 + 7)]
+vmovdqa32 zmm24, [rsp + 512 + 64*(0*16 + 8)]
+vmovdqa32 zmm25, [rsp + 512 + 64*(0*16 + 9)]
+vmovdqa32 zmm26, [rsp + 512 + 64*(0*16 + 10)]
+vmovdqa32 zmm27, [rsp + 512 + 64*(0*16 + 11)]
+vmovdqa32 zmm28, [rsp + 512 + 64*(0*16 + 12)]
+vmovdqa32 zmm29, [rsp + 512 + 64*(0*16 + 13)]
+vmovdqa32 zmm30, [rsp + 512 + 64*(0*16 + 14)]
+vmovdqa32 zmm31, [rsp + 512 + 64*(0*16 + 15)]
+mov eax, [rdi + 448]
+cmp eax, 0
+je sha256_mine_x16_avx512_enter_0
+vprord zmm13, zmm30, 17
+vprord zmm14, zmm30, 19
+vpsrld zmm15, zmm30, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm16, zmm16, zmm13
+vpaddd zmm16, zmm16, zmm25
+vprord zmm13, zmm17, 7
+vprord zmm14, zmm17, 18
+vpsrld zmm15, zmm17, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm16, zmm16, zmm13
+cmp eax, 1
+je sha256_mine_x16_avx512_enter_1
+vprord zmm13, zmm31, 17
+vprord zmm14, zmm31, 19
+vpsrld zmm15, zmm31, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm17, zmm17, zmm13
+vpaddd zmm17, zmm17, zmm26
+vprord zmm13, zmm18, 7
+vprord zmm14, zmm18, 18
+vpsrld zmm15, zmm18, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm17, zmm17, zmm13
+cmp eax, 2
+je sha256_mine_x16_avx512_enter_2
+vprord zmm13, zmm16, 17
+vprord zmm14, zmm16, 19
+vpsrld zmm15, zmm16, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm18, zmm18, zmm13
+vpaddd zmm18, zmm18, zmm27
+vprord zmm13, zmm19, 7
+vprord zmm14, zmm19, 18
+vpsrld zmm15, zmm19, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm18, zmm18, zmm13
+cmp eax, 3
+je sha256_mine_x16_avx512_enter_3
+vprord zmm13, zmm17, 17
+vprord zmm14, zmm17, 19
+vpsrld zmm15, zmm17, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm19, zmm19, zmm13
+vpaddd zmm19, zmm19, zmm28
+vprord zmm13, zmm20, 7
+vprord zmm14, zmm20, 18
+vpsrld zmm15, zmm20, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm19, zmm19, zmm13
+cmp eax, 4
+je sha256_mine_x16_avx512_enter_4
+vprord zmm13, zmm18, 17
+vprord zmm14, zmm18, 19
+vpsrld zmm15, zmm18, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm20, zmm20, zmm13
+vpaddd zmm20, zmm20, zmm29
+vprord zmm13, zmm21, 7
+vprord zmm14, zmm21, 18
+vpsrld zmm15, zmm21, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm20, zmm20, zmm13
+cmp eax, 5
+je sha256_mine_x16_avx512_enter_5
+vprord zmm13, zmm19, 17
+vprord zmm14, zmm19, 19
+vpsrld zmm15, zmm19, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm21, zmm21, zmm13
+vpaddd zmm21, zmm21, zmm30
+vprord zmm13, zmm22, 7
+vprord zmm14, zmm22, 18
+vpsrld zmm15, zmm22, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm21, zmm21, zmm13
+cmp eax, 6
+je sha256_mine_x16_avx512_enter_6
+vprord zmm13, zmm20, 17
+vprord zmm14, zmm20, 19
+vpsrld zmm15, zmm20, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm22, zmm22, zmm13
+vpaddd zmm22, zmm22, zmm31
+vprord zmm13, zmm23, 7
+vprord zmm14, zmm23, 18
+vpsrld zmm15, zmm23, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm22, zmm22, zmm13
+cmp eax, 7
+je sha256_mine_x16_avx512_enter_7
+vprord zmm13, zmm21, 17
+vprord zmm14, zmm21, 19
+vpsrld zmm15, zmm21, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm23, zmm23, zmm13
+vpaddd zmm23, zmm23, zmm16
+vprord zmm13, zmm24, 7
+vprord zmm14, zmm24, 18
+vpsrld zmm15, zmm24, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm23, zmm23, zmm13
+cmp eax, 8
+je sha256_mine_x16_avx512_enter_8
+vprord zmm13, zmm22, 17
+vprord zmm14, zmm22, 19
+vpsrld zmm15, zmm22, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm24, zmm24, zmm13
+vpaddd zmm24, zmm24, zmm17
+vprord zmm13, zmm25, 7
+vprord zmm14, zmm25, 18
+vpsrld zmm15, zmm25, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm24, zmm24, zmm13
+cmp eax, 9
+je sha256_mine_x16_avx512_enter_9
+vprord zmm13, zmm23, 17
+vprord zmm14, zmm23, 19
+vpsrld zmm15, zmm23, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm25, zmm25, zmm13
+vpaddd zmm25, zmm25, zmm18
+vprord zmm13, zmm26, 7
+vprord zmm14, zmm26, 18
+vpsrld zmm15, zmm26, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm25, zmm25, zmm13
+cmp eax, 10
+je sha256_mine_x16_avx512_enter_10
+vprord zmm13, zmm24, 17
+vprord zmm14, zmm24, 19
+vpsrld zmm15, zmm24, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm26, zmm26, zmm13
+vpaddd zmm26, zmm26, zmm19
+vprord zmm13, zmm27, 7
+vprord zmm14, zmm27, 18
+vpsrld zmm15, zmm27, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm26, zmm26, zmm13
+cmp eax, 11
+je sha256_mine_x16_avx512_enter_11
+vprord zmm13, zmm25, 17
+vprord zmm14, zmm25, 19
+vpsrld zmm15, zmm25, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm27, zmm27, zmm13
+vpaddd zmm27, zmm27, zmm20
+vprord zmm13, zmm28, 7
+vprord zmm14, zmm28, 18
+vpsrld zmm15, zmm28, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm27, zmm27, zmm13
+cmp eax, 12
+je sha256_mine_x16_avx512_enter_12
+vprord zmm13, zmm26, 17
+vprord zmm14, zmm26, 19
+vpsrld zmm15, zmm26, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm28, zmm28, zmm13
+vpaddd zmm28, zmm28, zmm21
+vprord zmm13, zmm29, 7
+vprord zmm14, zmm29, 18
+vpsrld zmm15, zmm29, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm28, zmm28, zmm13
+cmp eax, 13
+je sha256_mine_x16_avx512_enter_13
+vprord zmm13, zmm27, 17
+vprord zmm14, zmm27, 19
+vpsrld zmm15, zmm27, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm29, zmm29, zmm13
+vpaddd zmm29, zmm29, zmm22
+vprord zmm13, zmm30, 7
+vprord zmm14, zmm30, 18
+vpsrld zmm15, zmm30, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm29, zmm29, zmm13
+cmp eax, 14
+je sha256_mine_x16_avx512_enter_14
+vprord zmm13, zmm28, 17
+vprord zmm14, zmm28, 19
+vpsrld zmm15, zmm28, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm30, zmm30, zmm13
+vpaddd zmm30, zmm30, zmm23
+vprord zmm13, zmm31, 7
+vprord zmm14, zmm31, 18
+vpsrld zmm15, zmm31, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm30, zmm30, zmm13
+sha256_mine_x16_avx512_enter_15:
+vpbroadcastd zmm1, [rdi + 416 + 4*0]
+vpbroadcastd zmm2, [rdi + 416 + 4*1]
+vpbroadcastd zmm3, [rdi + 416 + 4*2]
+vpbroadcastd zmm4, [rdi + 416 + 4*3]
+vpbroadcastd zmm5, [rdi + 416 + 4*4]
+vpbroadcastd zmm6, [rdi + 416 + 4*5]
+vpbroadcastd zmm7, [rdi + 416 + 4*6]
+vpbroadcastd zmm0, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_15
+sha256_mine_x16_avx512_enter_14:
+vpbroadcastd zmm2, [rdi + 416 + 4*0]
+vpbroadcastd zmm3, [rdi + 416 + 4*1]
+vpbroadcastd zmm4, [rdi + 416 + 4*2]
+vpbroadcastd zmm5, [rdi + 416 + 4*3]
+vpbroadcastd zmm6, [rdi + 416 + 4*4]
+vpbroadcastd zmm7, [rdi + 416 + 4*5]
+vpbroadcastd zmm0, [rdi + 416 + 4*6]
+vpbroadcastd zmm1, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_14
+sha256_mine_x16_avx512_enter_13:
+vpbroadcastd zmm3, [rdi + 416 + 4*0]
+vpbroadcastd zmm4, [rdi + 416 + 4*1]
+vpbroadcastd zmm5, [rdi + 416 + 4*2]
+vpbroadcastd zmm6, [rdi + 416 + 4*3]
+vpbroadcastd zmm7, [rdi + 416 + 4*4]
+vpbroadcastd zmm0, [rdi + 416 + 4*5]
+vpbroadcastd zmm1, [rdi + 416 + 4*6]
+vpbroadcastd zmm2, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_13
+sha256_mine_x16_avx512_enter_12:
+vpbroadcastd zmm4, [rdi + 416 + 4*0]
+vpbroadcastd zmm5, [rdi + 416 + 4*1]
+vpbroadcastd zmm6, [rdi + 416 + 4*2]
+vpbroadcastd zmm7, [rdi + 416 + 4*3]
+vpbroadcastd zmm0, [rdi + 416 + 4*4]
+vpbroadcastd zmm1, [rdi + 416 + 4*5]
+vpbroadcastd zmm2, [rdi + 416 + 4*6]
+vpbroadcastd zmm3, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_12
+sha256_mine_x16_avx512_enter_11:
+vpbroadcastd zmm5, [rdi + 416 + 4*0]
+vpbroadcastd zmm6, [rdi + 416 + 4*1]
+vpbroadcastd zmm7, [rdi + 416 + 4*2]
+vpbroadcastd zmm0, [rdi + 416 + 4*3]
+vpbroadcastd zmm1, [rdi + 416 + 4*4]
+vpbroadcastd zmm2, [rdi + 416 + 4*5]
+vpbroadcastd zmm3, [rdi + 416 + 4*6]
+vpbroadcastd zmm4, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_11
+sha256_mine_x16_avx512_enter_10:
+vpbroadcastd zmm6, [rdi + 416 + 4*0]
+vpbroadcastd zmm7, [rdi + 416 + 4*1]
+vpbroadcastd zmm0, [rdi + 416 + 4*2]
+vpbroadcastd zmm1, [rdi + 416 + 4*3]
+vpbroadcastd zmm2, [rdi + 416 + 4*4]
+vpbroadcastd zmm3, [rdi + 416 + 4*5]
+vpbroadcastd zmm4, [rdi + 416 + 4*6]
+vpbroadcastd zmm5, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_10
+sha256_mine_x16_avx512_enter_9:
+vpbroadcastd zmm7, [rdi + 416 + 4*0]
+vpbroadcastd zmm0, [rdi + 416 + 4*1]
+vpbroadcastd zmm1, [rdi + 416 + 4*2]
+vpbroadcastd zmm2, [rdi + 416 + 4*3]
+vpbroadcastd zmm3, [rdi + 416 + 4*4]
+vpbroadcastd zmm4, [rdi + 416 + 4*5]
+vpbroadcastd zmm5, [rdi + 416 + 4*6]
+vpbroadcastd zmm6, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_9
+sha256_mine_x16_avx512_enter_8:
+vpbroadcastd zmm0, [rdi + 416 + 4*0]
+vpbroadcastd zmm1, [rdi + 416 + 4*1]
+vpbroadcastd zmm2, [rdi + 416 + 4*2]
+vpbroadcastd zmm3, [rdi + 416 + 4*3]
+vpbroadcastd zmm4, [rdi + 416 + 4*4]
+vpbroadcastd zmm5, [rdi + 416 + 4*5]
+vpbroadcastd zmm6, [rdi + 416 + 4*6]
+vpbroadcastd zmm7, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_8
+sha256_mine_x16_avx512_enter_7:
+vpbroadcastd zmm1, [rdi + 416 + 4*0]
+vpbroadcastd zmm2, [rdi + 416 + 4*1]
+vpbroadcastd zmm3, [rdi + 416 + 4*2]
+vpbroadcastd zmm4, [rdi + 416 + 4*3]
+vpbroadcastd zmm5, [rdi + 416 + 4*4]
+vpbroadcastd zmm6, [rdi + 416 + 4*5]
+vpbroadcastd zmm7, [rdi + 416 + 4*6]
+vpbroadcastd zmm0, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_7
+sha256_mine_x16_avx512_enter_6:
+vpbroadcastd zmm2, [rdi + 416 + 4*0]
+vpbroadcastd zmm3, [rdi + 416 + 4*1]
+vpbroadcastd zmm4, [rdi + 416 + 4*2]
+vpbroadcastd zmm5, [rdi + 416 + 4*3]
+vpbroadcastd zmm6, [rdi + 416 + 4*4]
+vpbroadcastd zmm7, [rdi + 416 + 4*5]
+vpbroadcastd zmm0, [rdi + 416 + 4*6]
+vpbroadcastd zmm1, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_6
+sha256_mine_x16_avx512_enter_5:
+vpbroadcastd zmm3, [rdi + 416 + 4*0]
+vpbroadcastd zmm4, [rdi + 416 + 4*1]
+vpbroadcastd zmm5, [rdi + 416 + 4*2]
+vpbroadcastd zmm6, [rdi + 416 + 4*3]
+vpbroadcastd zmm7, [rdi + 416 + 4*4]
+vpbroadcastd zmm0, [rdi + 416 + 4*5]
+vpbroadcastd zmm1, [rdi + 416 + 4*6]
+vpbroadcastd zmm2, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_5
+sha256_mine_x16_avx512_enter_4:
+vpbroadcastd zmm4, [rdi + 416 + 4*0]
+vpbroadcastd zmm5, [rdi + 416 + 4*1]
+vpbroadcastd zmm6, [rdi + 416 + 4*2]
+vpbroadcastd zmm7, [rdi + 416 + 4*3]
+vpbroadcastd zmm0, [rdi + 416 + 4*4]
+vpbroadcastd zmm1, [rdi + 416 + 4*5]
+vpbroadcastd zmm2, [rdi + 416 + 4*6]
+vpbroadcastd zmm3, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_4
+sha256_mine_x16_avx512_enter_3:
+vpbroadcastd zmm5, [rdi + 416 + 4*0]
+vpbroadcastd zmm6, [rdi + 416 + 4*1]
+vpbroadcastd zmm7, [rdi + 416 + 4*2]
+vpbroadcastd zmm0, [rdi + 416 + 4*3]
+vpbroadcastd zmm1, [rdi + 416 + 4*4]
+vpbroadcastd zmm2, [rdi + 416 + 4*5]
+vpbroadcastd zmm3, [rdi + 416 + 4*6]
+vpbroadcastd zmm4, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_3
+sha256_mine_x16_avx512_enter_2:
+vpbroadcastd zmm6, [rdi + 416 + 4*0]
+vpbroadcastd zmm7, [rdi + 416 + 4*1]
+vpbroadcastd zmm0, [rdi + 416 + 4*2]
+vpbroadcastd zmm1, [rdi + 416 + 4*3]
+vpbroadcastd zmm2, [rdi + 416 + 4*4]
+vpbroadcastd zmm3, [rdi + 416 + 4*5]
+vpbroadcastd zmm4, [rdi + 416 + 4*6]
+vpbroadcastd zmm5, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_2
+sha256_mine_x16_avx512_enter_1:
+vpbroadcastd zmm7, [rdi + 416 + 4*0]
+vpbroadcastd zmm0, [rdi + 416 + 4*1]
+vpbroadcastd zmm1, [rdi + 416 + 4*2]
+vpbroadcastd zmm2, [rdi + 416 + 4*3]
+vpbroadcastd zmm3, [rdi + 416 + 4*4]
+vpbroadcastd zmm4, [rdi + 416 + 4*5]
+vpbroadcastd zmm5, [rdi + 416 + 4*6]
+vpbroadcastd zmm6, [rdi + 416 + 4*7]
+jmp sha256_mine_x16_avx512_round_1
+sha256_mine_x16_avx512_enter_0:
+vpbroadcastd zmm0, [rdi + 416 + 4*0]
+vpbroadcastd zmm1, [rdi + 416 + 4*1]
+vpbroadcastd zmm2, [rdi + 416 + 4*2]
+vpbroadcastd zmm3, [rdi + 416 + 4*3]
+vpbroadcastd zmm4, [rdi + 416 + 4*4]
+vpbroadcastd zmm5, [rdi + 416 + 4*5]
+vpbroadcastd zmm6, [rdi + 416 + 4*6]
+vpbroadcastd zmm7, [rdi + 416 + 4*7]
+sha256_mine_x16_avx512_round_0:
+vpaddd zmm8, zmm7, [rcx + 4*0]{1to16}
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm16
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vprord zmm13, zmm30, 17
+vprord zmm14, zmm30, 19
+vpsrld zmm15, zmm30, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm16, zmm16, zmm13
+vpaddd zmm16, zmm16, zmm25
+vprord zmm13, zmm17, 7
+vprord zmm14, zmm17, 18
+vpsrld zmm15, zmm17, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm16, zmm16, zmm13
+sha256_mine_x16_avx512_round_1:
+vpaddd zmm8, zmm6, [rcx + 4*1]{1to16}
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm17
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vprord zmm13, zmm31, 17
+vprord zmm14, zmm31, 19
+vpsrld zmm15, zmm31, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm17, zmm17, zmm13
+vpaddd zmm17, zmm17, zmm26
+vprord zmm13, zmm18, 7
+vprord zmm14, zmm18, 18
+vpsrld zmm15, zmm18, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm17, zmm17, zmm13
+sha256_mine_x16_avx512_round_2:
+vpaddd zmm8, zmm5, [rcx + 4*2]{1to16}
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm18
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vprord zmm13, zmm16, 17
+vprord zmm14, zmm16, 19
+vpsrld zmm15, zmm16, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm18, zmm18, zmm13
+vpaddd zmm18, zmm18, zmm27
+vprord zmm13, zmm19, 7
+vprord zmm14, zmm19, 18
+vpsrld zmm15, zmm19, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm18, zmm18, zmm13
+sha256_mine_x16_avx512_round_3:
+vpaddd zmm8, zmm4, [rcx + 4*3]{1to16}
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm19
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vprord zmm13, zmm17, 17
+vprord zmm14, zmm17, 19
+vpsrld zmm15, zmm17, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm19, zmm19, zmm13
+vpaddd zmm19, zmm19, zmm28
+vprord zmm13, zmm20, 7
+vprord zmm14, zmm20, 18
+vpsrld zmm15, zmm20, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm19, zmm19, zmm13
+sha256_mine_x16_avx512_round_4:
+vpaddd zmm8, zmm3, [rcx + 4*4]{1to16}
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm20
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vprord zmm13, zmm18, 17
+vprord zmm14, zmm18, 19
+vpsrld zmm15, zmm18, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm20, zmm20, zmm13
+vpaddd zmm20, zmm20, zmm29
+vprord zmm13, zmm21, 7
+vprord zmm14, zmm21, 18
+vpsrld zmm15, zmm21, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm20, zmm20, zmm13
+sha256_mine_x16_avx512_round_5:
+vpaddd zmm8, zmm2, [rcx + 4*5]{1to16}
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm21
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vprord zmm13, zmm19, 17
+vprord zmm14, zmm19, 19
+vpsrld zmm15, zmm19, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm21, zmm21, zmm13
+vpaddd zmm21, zmm21, zmm30
+vprord zmm13, zmm22, 7
+vprord zmm14, zmm22, 18
+vpsrld zmm15, zmm22, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm21, zmm21, zmm13
+sha256_mine_x16_avx512_round_6:
+vpaddd zmm8, zmm1, [rcx + 4*6]{1to16}
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm22
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vprord zmm13, zmm20, 17
+vprord zmm14, zmm20, 19
+vpsrld zmm15, zmm20, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm22, zmm22, zmm13
+vpaddd zmm22, zmm22, zmm31
+vprord zmm13, zmm23, 7
+vprord zmm14, zmm23, 18
+vpsrld zmm15, zmm23, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm22, zmm22, zmm13
+sha256_mine_x16_avx512_round_7:
+vpaddd zmm8, zmm0, [rcx + 4*7]{1to16}
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm23
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vprord zmm13, zmm21, 17
+vprord zmm14, zmm21, 19
+vpsrld zmm15, zmm21, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm23, zmm23, zmm13
+vpaddd zmm23, zmm23, zmm16
+vprord zmm13, zmm24, 7
+vprord zmm14, zmm24, 18
+vpsrld zmm15, zmm24, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm23, zmm23, zmm13
+sha256_mine_x16_avx512_round_8:
+vpaddd zmm8, zmm7, [rcx + 4*8]{1to16}
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm24
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vprord zmm13, zmm22, 17
+vprord zmm14, zmm22, 19
+vpsrld zmm15, zmm22, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm24, zmm24, zmm13
+vpaddd zmm24, zmm24, zmm17
+vprord zmm13, zmm25, 7
+vprord zmm14, zmm25, 18
+vpsrld zmm15, zmm25, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm24, zmm24, zmm13
+sha256_mine_x16_avx512_round_9:
+vpaddd zmm8, zmm6, [rcx + 4*9]{1to16}
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm25
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vprord zmm13, zmm23, 17
+vprord zmm14, zmm23, 19
+vpsrld zmm15, zmm23, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm25, zmm25, zmm13
+vpaddd zmm25, zmm25, zmm18
+vprord zmm13, zmm26, 7
+vprord zmm14, zmm26, 18
+vpsrld zmm15, zmm26, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm25, zmm25, zmm13
+sha256_mine_x16_avx512_round_10:
+vpaddd zmm8, zmm5, [rcx + 4*10]{1to16}
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm26
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vprord zmm13, zmm24, 17
+vprord zmm14, zmm24, 19
+vpsrld zmm15, zmm24, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm26, zmm26, zmm13
+vpaddd zmm26, zmm26, zmm19
+vprord zmm13, zmm27, 7
+vprord zmm14, zmm27, 18
+vpsrld zmm15, zmm27, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm26, zmm26, zmm13
+sha256_mine_x16_avx512_round_11:
+vpaddd zmm8, zmm4, [rcx + 4*11]{1to16}
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm27
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vprord zmm13, zmm25, 17
+vprord zmm14, zmm25, 19
+vpsrld zmm15, zmm25, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm27, zmm27, zmm13
+vpaddd zmm27, zmm27, zmm20
+vprord zmm13, zmm28, 7
+vprord zmm14, zmm28, 18
+vpsrld zmm15, zmm28, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm27, zmm27, zmm13
+sha256_mine_x16_avx512_round_12:
+vpaddd zmm8, zmm3, [rcx + 4*12]{1to16}
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm28
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vprord zmm13, zmm26, 17
+vprord zmm14, zmm26, 19
+vpsrld zmm15, zmm26, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm28, zmm28, zmm13
+vpaddd zmm28, zmm28, zmm21
+vprord zmm13, zmm29, 7
+vprord zmm14, zmm29, 18
+vpsrld zmm15, zmm29, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm28, zmm28, zmm13
+sha256_mine_x16_avx512_round_13:
+vpaddd zmm8, zmm2, [rcx + 4*13]{1to16}
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm29
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vprord zmm13, zmm27, 17
+vprord zmm14, zmm27, 19
+vpsrld zmm15, zmm27, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm29, zmm29, zmm13
+vpaddd zmm29, zmm29, zmm22
+vprord zmm13, zmm30, 7
+vprord zmm14, zmm30, 18
+vpsrld zmm15, zmm30, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm29, zmm29, zmm13
+sha256_mine_x16_avx512_round_14:
+vpaddd zmm8, zmm1, [rcx + 4*14]{1to16}
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm30
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vprord zmm13, zmm28, 17
+vprord zmm14, zmm28, 19
+vpsrld zmm15, zmm28, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm30, zmm30, zmm13
+vpaddd zmm30, zmm30, zmm23
+vprord zmm13, zmm31, 7
+vprord zmm14, zmm31, 18
+vpsrld zmm15, zmm31, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm30, zmm30, zmm13
+sha256_mine_x16_avx512_round_15:
+vpaddd zmm8, zmm0, [rcx + 4*15]{1to16}
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm31
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vprord zmm13, zmm29, 17
+vprord zmm14, zmm29, 19
+vpsrld zmm15, zmm29, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm31, zmm31, zmm13
+vpaddd zmm31, zmm31, zmm24
+vprord zmm13, zmm16, 7
+vprord zmm14, zmm16, 18
+vpsrld zmm15, zmm16, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm31, zmm31, zmm13
+vpaddd zmm8, zmm7, [rcx + 4*16]{1to16}
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm16
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vprord zmm13, zmm30, 17
+vprord zmm14, zmm30, 19
+vpsrld zmm15, zmm30, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm16, zmm16, zmm13
+vpaddd zmm16, zmm16, zmm25
+vprord zmm13, zmm17, 7
+vprord zmm14, zmm17, 18
+vpsrld zmm15, zmm17, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm16, zmm16, zmm13
+vpaddd zmm8, zmm6, [rcx + 4*17]{1to16}
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm17
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vprord zmm13, zmm31, 17
+vprord zmm14, zmm31, 19
+vpsrld zmm15, zmm31, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm17, zmm17, zmm13
+vpaddd zmm17, zmm17, zmm26
+vprord zmm13, zmm18, 7
+vprord zmm14, zmm18, 18
+vpsrld zmm15, zmm18, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm17, zmm17, zmm13
+vpaddd zmm8, zmm5, [rcx + 4*18]{1to16}
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm18
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vprord zmm13, zmm16, 17
+vprord zmm14, zmm16, 19
+vpsrld zmm15, zmm16, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm18, zmm18, zmm13
+vpaddd zmm18, zmm18, zmm27
+vprord zmm13, zmm19, 7
+vprord zmm14, zmm19, 18
+vpsrld zmm15, zmm19, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm18, zmm18, zmm13
+vpaddd zmm8, zmm4, [rcx + 4*19]{1to16}
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm19
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vprord zmm13, zmm17, 17
+vprord zmm14, zmm17, 19
+vpsrld zmm15, zmm17, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm19, zmm19, zmm13
+vpaddd zmm19, zmm19, zmm28
+vprord zmm13, zmm20, 7
+vprord zmm14, zmm20, 18
+vpsrld zmm15, zmm20, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm19, zmm19, zmm13
+vpaddd zmm8, zmm3, [rcx + 4*20]{1to16}
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm20
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vprord zmm13, zmm18, 17
+vprord zmm14, zmm18, 19
+vpsrld zmm15, zmm18, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm20, zmm20, zmm13
+vpaddd zmm20, zmm20, zmm29
+vprord zmm13, zmm21, 7
+vprord zmm14, zmm21, 18
+vpsrld zmm15, zmm21, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm20, zmm20, zmm13
+vpaddd zmm8, zmm2, [rcx + 4*21]{1to16}
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm21
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vprord zmm13, zmm19, 17
+vprord zmm14, zmm19, 19
+vpsrld zmm15, zmm19, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm21, zmm21, zmm13
+vpaddd zmm21, zmm21, zmm30
+vprord zmm13, zmm22, 7
+vprord zmm14, zmm22, 18
+vpsrld zmm15, zmm22, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm21, zmm21, zmm13
+vpaddd zmm8, zmm1, [rcx + 4*22]{1to16}
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm22
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vprord zmm13, zmm20, 17
+vprord zmm14, zmm20, 19
+vpsrld zmm15, zmm20, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm22, zmm22, zmm13
+vpaddd zmm22, zmm22, zmm31
+vprord zmm13, zmm23, 7
+vprord zmm14, zmm23, 18
+vpsrld zmm15, zmm23, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm22, zmm22, zmm13
+vpaddd zmm8, zmm0, [rcx + 4*23]{1to16}
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm23
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vprord zmm13, zmm21, 17
+vprord zmm14, zmm21, 19
+vpsrld zmm15, zmm21, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm23, zmm23, zmm13
+vpaddd zmm23, zmm23, zmm16
+vprord zmm13, zmm24, 7
+vprord zmm14, zmm24, 18
+vpsrld zmm15, zmm24, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm23, zmm23, zmm13
+vpaddd zmm8, zmm7, [rcx + 4*24]{1to16}
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm24
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vprord zmm13, zmm22, 17
+vprord zmm14, zmm22, 19
+vpsrld zmm15, zmm22, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm24, zmm24, zmm13
+vpaddd zmm24, zmm24, zmm17
+vprord zmm13, zmm25, 7
+vprord zmm14, zmm25, 18
+vpsrld zmm15, zmm25, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm24, zmm24, zmm13
+vpaddd zmm8, zmm6, [rcx + 4*25]{1to16}
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm25
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vprord zmm13, zmm23, 17
+vprord zmm14, zmm23, 19
+vpsrld zmm15, zmm23, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm25, zmm25, zmm13
+vpaddd zmm25, zmm25, zmm18
+vprord zmm13, zmm26, 7
+vprord zmm14, zmm26, 18
+vpsrld zmm15, zmm26, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm25, zmm25, zmm13
+vpaddd zmm8, zmm5, [rcx + 4*26]{1to16}
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm26
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vprord zmm13, zmm24, 17
+vprord zmm14, zmm24, 19
+vpsrld zmm15, zmm24, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm26, zmm26, zmm13
+vpaddd zmm26, zmm26, zmm19
+vprord zmm13, zmm27, 7
+vprord zmm14, zmm27, 18
+vpsrld zmm15, zmm27, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm26, zmm26, zmm13
+vpaddd zmm8, zmm4, [rcx + 4*27]{1to16}
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm27
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vprord zmm13, zmm25, 17
+vprord zmm14, zmm25, 19
+vpsrld zmm15, zmm25, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm27, zmm27, zmm13
+vpaddd zmm27, zmm27, zmm20
+vprord zmm13, zmm28, 7
+vprord zmm14, zmm28, 18
+vpsrld zmm15, zmm28, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm27, zmm27, zmm13
+vpaddd zmm8, zmm3, [rcx + 4*28]{1to16}
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm28
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vprord zmm13, zmm26, 17
+vprord zmm14, zmm26, 19
+vpsrld zmm15, zmm26, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm28, zmm28, zmm13
+vpaddd zmm28, zmm28, zmm21
+vprord zmm13, zmm29, 7
+vprord zmm14, zmm29, 18
+vpsrld zmm15, zmm29, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm28, zmm28, zmm13
+vpaddd zmm8, zmm2, [rcx + 4*29]{1to16}
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm29
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vprord zmm13, zmm27, 17
+vprord zmm14, zmm27, 19
+vpsrld zmm15, zmm27, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm29, zmm29, zmm13
+vpaddd zmm29, zmm29, zmm22
+vprord zmm13, zmm30, 7
+vprord zmm14, zmm30, 18
+vpsrld zmm15, zmm30, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm29, zmm29, zmm13
+vpaddd zmm8, zmm1, [rcx + 4*30]{1to16}
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm30
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vprord zmm13, zmm28, 17
+vprord zmm14, zmm28, 19
+vpsrld zmm15, zmm28, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm30, zmm30, zmm13
+vpaddd zmm30, zmm30, zmm23
+vprord zmm13, zmm31, 7
+vprord zmm14, zmm31, 18
+vpsrld zmm15, zmm31, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm30, zmm30, zmm13
+vpaddd zmm8, zmm0, [rcx + 4*31]{1to16}
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm31
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vprord zmm13, zmm29, 17
+vprord zmm14, zmm29, 19
+vpsrld zmm15, zmm29, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm31, zmm31, zmm13
+vpaddd zmm31, zmm31, zmm24
+vprord zmm13, zmm16, 7
+vprord zmm14, zmm16, 18
+vpsrld zmm15, zmm16, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm31, zmm31, zmm13
+vpaddd zmm8, zmm7, [rcx + 4*32]{1to16}
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm16
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vprord zmm13, zmm30, 17
+vprord zmm14, zmm30, 19
+vpsrld zmm15, zmm30, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm16, zmm16, zmm13
+vpaddd zmm16, zmm16, zmm25
+vprord zmm13, zmm17, 7
+vprord zmm14, zmm17, 18
+vpsrld zmm15, zmm17, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm16, zmm16, zmm13
+vpaddd zmm8, zmm6, [rcx + 4*33]{1to16}
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm17
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vprord zmm13, zmm31, 17
+vprord zmm14, zmm31, 19
+vpsrld zmm15, zmm31, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm17, zmm17, zmm13
+vpaddd zmm17, zmm17, zmm26
+vprord zmm13, zmm18, 7
+vprord zmm14, zmm18, 18
+vpsrld zmm15, zmm18, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm17, zmm17, zmm13
+vpaddd zmm8, zmm5, [rcx + 4*34]{1to16}
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm18
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vprord zmm13, zmm16, 17
+vprord zmm14, zmm16, 19
+vpsrld zmm15, zmm16, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm18, zmm18, zmm13
+vpaddd zmm18, zmm18, zmm27
+vprord zmm13, zmm19, 7
+vprord zmm14, zmm19, 18
+vpsrld zmm15, zmm19, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm18, zmm18, zmm13
+vpaddd zmm8, zmm4, [rcx + 4*35]{1to16}
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm19
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vprord zmm13, zmm17, 17
+vprord zmm14, zmm17, 19
+vpsrld zmm15, zmm17, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm19, zmm19, zmm13
+vpaddd zmm19, zmm19, zmm28
+vprord zmm13, zmm20, 7
+vprord zmm14, zmm20, 18
+vpsrld zmm15, zmm20, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm19, zmm19, zmm13
+vpaddd zmm8, zmm3, [rcx + 4*36]{1to16}
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm20
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vprord zmm13, zmm18, 17
+vprord zmm14, zmm18, 19
+vpsrld zmm15, zmm18, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm20, zmm20, zmm13
+vpaddd zmm20, zmm20, zmm29
+vprord zmm13, zmm21, 7
+vprord zmm14, zmm21, 18
+vpsrld zmm15, zmm21, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm20, zmm20, zmm13
+vpaddd zmm8, zmm2, [rcx + 4*37]{1to16}
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm21
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vprord zmm13, zmm19, 17
+vprord zmm14, zmm19, 19
+vpsrld zmm15, zmm19, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm21, zmm21, zmm13
+vpaddd zmm21, zmm21, zmm30
+vprord zmm13, zmm22, 7
+vprord zmm14, zmm22, 18
+vpsrld zmm15, zmm22, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm21, zmm21, zmm13
+vpaddd zmm8, zmm1, [rcx + 4*38]{1to16}
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm22
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vprord zmm13, zmm20, 17
+vprord zmm14, zmm20, 19
+vpsrld zmm15, zmm20, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm22, zmm22, zmm13
+vpaddd zmm22, zmm22, zmm31
+vprord zmm13, zmm23, 7
+vprord zmm14, zmm23, 18
+vpsrld zmm15, zmm23, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm22, zmm22, zmm13
+vpaddd zmm8, zmm0, [rcx + 4*39]{1to16}
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm23
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vprord zmm13, zmm21, 17
+vprord zmm14, zmm21, 19
+vpsrld zmm15, zmm21, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm23, zmm23, zmm13
+vpaddd zmm23, zmm23, zmm16
+vprord zmm13, zmm24, 7
+vprord zmm14, zmm24, 18
+vpsrld zmm15, zmm24, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm23, zmm23, zmm13
+vpaddd zmm8, zmm7, [rcx + 4*40]{1to16}
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm24
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vprord zmm13, zmm22, 17
+vprord zmm14, zmm22, 19
+vpsrld zmm15, zmm22, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm24, zmm24, zmm13
+vpaddd zmm24, zmm24, zmm17
+vprord zmm13, zmm25, 7
+vprord zmm14, zmm25, 18
+vpsrld zmm15, zmm25, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm24, zmm24, zmm13
+vpaddd zmm8, zmm6, [rcx + 4*41]{1to16}
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm25
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vprord zmm13, zmm23, 17
+vprord zmm14, zmm23, 19
+vpsrld zmm15, zmm23, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm25, zmm25, zmm13
+vpaddd zmm25, zmm25, zmm18
+vprord zmm13, zmm26, 7
+vprord zmm14, zmm26, 18
+vpsrld zmm15, zmm26, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm25, zmm25, zmm13
+vpaddd zmm8, zmm5, [rcx + 4*42]{1to16}
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm26
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vprord zmm13, zmm24, 17
+vprord zmm14, zmm24, 19
+vpsrld zmm15, zmm24, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm26, zmm26, zmm13
+vpaddd zmm26, zmm26, zmm19
+vprord zmm13, zmm27, 7
+vprord zmm14, zmm27, 18
+vpsrld zmm15, zmm27, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm26, zmm26, zmm13
+vpaddd zmm8, zmm4, [rcx + 4*43]{1to16}
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm27
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vprord zmm13, zmm25, 17
+vprord zmm14, zmm25, 19
+vpsrld zmm15, zmm25, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm27, zmm27, zmm13
+vpaddd zmm27, zmm27, zmm20
+vprord zmm13, zmm28, 7
+vprord zmm14, zmm28, 18
+vpsrld zmm15, zmm28, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm27, zmm27, zmm13
+vpaddd zmm8, zmm3, [rcx + 4*44]{1to16}
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm28
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vprord zmm13, zmm26, 17
+vprord zmm14, zmm26, 19
+vpsrld zmm15, zmm26, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm28, zmm28, zmm13
+vpaddd zmm28, zmm28, zmm21
+vprord zmm13, zmm29, 7
+vprord zmm14, zmm29, 18
+vpsrld zmm15, zmm29, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm28, zmm28, zmm13
+vpaddd zmm8, zmm2, [rcx + 4*45]{1to16}
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm29
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vprord zmm13, zmm27, 17
+vprord zmm14, zmm27, 19
+vpsrld zmm15, zmm27, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm29, zmm29, zmm13
+vpaddd zmm29, zmm29, zmm22
+vprord zmm13, zmm30, 7
+vprord zmm14, zmm30, 18
+vpsrld zmm15, zmm30, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm29, zmm29, zmm13
+vpaddd zmm8, zmm1, [rcx + 4*46]{1to16}
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm30
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vprord zmm13, zmm28, 17
+vprord zmm14, zmm28, 19
+vpsrld zmm15, zmm28, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm30, zmm30, zmm13
+vpaddd zmm30, zmm30, zmm23
+vprord zmm13, zmm31, 7
+vprord zmm14, zmm31, 18
+vpsrld zmm15, zmm31, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm30, zmm30, zmm13
+vpaddd zmm8, zmm0, [rcx + 4*47]{1to16}
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm31
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vprord zmm13, zmm29, 17
+vprord zmm14, zmm29, 19
+vpsrld zmm15, zmm29, 10
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm31, zmm31, zmm13
+vpaddd zmm31, zmm31, zmm24
+vprord zmm13, zmm16, 7
+vprord zmm14, zmm16, 18
+vpsrld zmm15, zmm16, 3
+vpternlogd zmm13, zmm14, zmm15, 0x96
+vpaddd zmm31, zmm31, zmm13
+vpaddd zmm8, zmm7, [rcx + 4*48]{1to16}
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm16
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vpaddd zmm8, zmm6, [rcx + 4*49]{1to16}
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm17
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vpaddd zmm8, zmm5, [rcx + 4*50]{1to16}
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm18
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vpaddd zmm8, zmm4, [rcx + 4*51]{1to16}
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm19
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vpaddd zmm8, zmm3, [rcx + 4*52]{1to16}
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm20
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vpaddd zmm8, zmm2, [rcx + 4*53]{1to16}
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm21
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vpaddd zmm8, zmm1, [rcx + 4*54]{1to16}
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm22
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vpaddd zmm8, zmm0, [rcx + 4*55]{1to16}
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm23
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vpaddd zmm8, zmm7, [rcx + 4*56]{1to16}
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpaddd zmm8, zmm8, zmm24
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vpaddd zmm8, zmm6, [rcx + 4*57]{1to16}
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpaddd zmm8, zmm8, zmm25
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vpaddd zmm8, zmm5, [rcx + 4*58]{1to16}
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpaddd zmm8, zmm8, zmm26
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vpaddd zmm8, zmm4, [rcx + 4*59]{1to16}
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpaddd zmm8, zmm8, zmm27
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vpaddd zmm8, zmm3, [rcx + 4*60]{1to16}
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpaddd zmm8, zmm8, zmm28
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vpaddd zmm8, zmm2, [rcx + 4*61]{1to16}
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpaddd zmm8, zmm8, zmm29
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vpaddd zmm8, zmm1, [rcx + 4*62]{1to16}
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpaddd zmm8, zmm8, zmm30
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vpaddd zmm8, zmm0, [rcx + 4*63]{1to16}
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpaddd zmm8, zmm8, zmm31
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+sub r9, 1
+je sha256_mine_x16_avx512_last_block
+vpaddd zmm0, zmm0, [rsp + 0 + 64*0]
+vpaddd zmm1, zmm1, [rsp + 0 + 64*1]
+vpaddd zmm2, zmm2, [rsp + 0 + 64*2]
+vpaddd zmm3, zmm3, [rsp + 0 + 64*3]
+vpaddd zmm4, zmm4, [rsp + 0 + 64*4]
+vpaddd zmm5, zmm5, [rsp + 0 + 64*5]
+vpaddd zmm6, zmm6, [rsp + 0 + 64*6]
+vpaddd zmm7, zmm7, [rsp + 0 + 64*7]
+vmovdqa32 [rsp + 0 + 64*0], zmm0
+vmovdqa32 [rsp + 0 + 64*1], zmm1
+vmovdqa32 [rsp + 0 + 64*2], zmm2
+vmovdqa32 [rsp + 0 + 64*3], zmm3
+vmovdqa32 [rsp + 0 + 64*4], zmm4
+vmovdqa32 [rsp + 0 + 64*5], zmm5
+vmovdqa32 [rsp + 0 + 64*6], zmm6
+vmovdqa32 [rsp + 0 + 64*7], zmm7
+test dword ptr [rdi + 452], 1
+jnz sha256_mine_x16_avx512_const_block
+vmovdqa32 zmm16, [rsp + 512 + 64*(1*16 + 0)]
+vmovdqa32 zmm17, [rsp + 512 + 64*(1*16 + 1)]
+vmovdqa32 zmm18, [rsp + 512 + 64*(1*16 + 2)]
+vmovdqa32 zmm19, [rsp + 512 + 64*(1*16 + 3)]
+vmovdqa32 zmm20, [rsp + 512 + 64*(1*16 + 4)]
+vmovdqa32 zmm21, [rsp + 512 + 64*(1*16 + 5)]
+vmovdqa32 zmm22, [rsp + 512 + 64*(1*16 + 6)]
+vmovdqa32 zmm23, [rsp + 512 + 64*(1*16 + 7)]
+vmovdqa32 zmm24, [rsp + 512 + 64*(1*16 + 8)]
+vmovdqa32 zmm25, [rsp + 512 + 64*(1*16 + 9)]
+vmovdqa32 zmm26, [rsp + 512 + 64*(1*16 + 10)]
+vmovdqa32 zmm27, [rsp + 512 + 64*(1*16 + 11)]
+vmovdqa32 zmm28, [rsp + 512 + 64*(1*16 + 12)]
+vmovdqa32 zmm29, [rsp + 512 + 64*(1*16 + 13)]
+vmovdqa32 zmm30, [rsp + 512 + 64*(1*16 + 14)]
+vmovdqa32 zmm31, [rsp + 512 + 64*(1*16 + 15)]
+jmp sha256_mine_x16_avx512_round_0
+sha256_mine_x16_avx512_const_block:
+lea r13, [rdi + 0]
+lea r14, [rdi + 0 + 4*64]
+sha256_mine_x16_avx512_const_loop:
+vpaddd zmm8, zmm7, [r13 + 4*0]{1to16}
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vpaddd zmm8, zmm6, [r13 + 4*1]{1to16}
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vpaddd zmm8, zmm5, [r13 + 4*2]{1to16}
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vpaddd zmm8, zmm4, [r13 + 4*3]{1to16}
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vpaddd zmm8, zmm3, [r13 + 4*4]{1to16}
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vpaddd zmm8, zmm2, [r13 + 4*5]{1to16}
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vpaddd zmm8, zmm1, [r13 + 4*6]{1to16}
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vpaddd zmm8, zmm0, [r13 + 4*7]{1to16}
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+vpaddd zmm8, zmm7, [r13 + 4*8]{1to16}
+vmovdqa32 zmm9, zmm4
+vprord zmm10, zmm4, 6
+vprord zmm11, zmm4, 11
+vprord zmm12, zmm4, 25
+vpternlogd zmm9, zmm5, zmm6, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm3, zmm3, zmm8
+vprord zmm7, zmm0, 2
+vprord zmm11, zmm0, 13
+vprord zmm12, zmm0, 22
+vmovdqa32 zmm9, zmm0
+vpternlogd zmm9, zmm1, zmm2, 0xE8
+vpternlogd zmm7, zmm11, zmm12, 0x96
+vpaddd zmm7, zmm7, zmm9
+vpaddd zmm7, zmm7, zmm8
+vpaddd zmm8, zmm6, [r13 + 4*9]{1to16}
+vmovdqa32 zmm9, zmm3
+vprord zmm10, zmm3, 6
+vprord zmm11, zmm3, 11
+vprord zmm12, zmm3, 25
+vpternlogd zmm9, zmm4, zmm5, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm2, zmm2, zmm8
+vprord zmm6, zmm7, 2
+vprord zmm11, zmm7, 13
+vprord zmm12, zmm7, 22
+vmovdqa32 zmm9, zmm7
+vpternlogd zmm9, zmm0, zmm1, 0xE8
+vpternlogd zmm6, zmm11, zmm12, 0x96
+vpaddd zmm6, zmm6, zmm9
+vpaddd zmm6, zmm6, zmm8
+vpaddd zmm8, zmm5, [r13 + 4*10]{1to16}
+vmovdqa32 zmm9, zmm2
+vprord zmm10, zmm2, 6
+vprord zmm11, zmm2, 11
+vprord zmm12, zmm2, 25
+vpternlogd zmm9, zmm3, zmm4, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm1, zmm1, zmm8
+vprord zmm5, zmm6, 2
+vprord zmm11, zmm6, 13
+vprord zmm12, zmm6, 22
+vmovdqa32 zmm9, zmm6
+vpternlogd zmm9, zmm7, zmm0, 0xE8
+vpternlogd zmm5, zmm11, zmm12, 0x96
+vpaddd zmm5, zmm5, zmm9
+vpaddd zmm5, zmm5, zmm8
+vpaddd zmm8, zmm4, [r13 + 4*11]{1to16}
+vmovdqa32 zmm9, zmm1
+vprord zmm10, zmm1, 6
+vprord zmm11, zmm1, 11
+vprord zmm12, zmm1, 25
+vpternlogd zmm9, zmm2, zmm3, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm0, zmm0, zmm8
+vprord zmm4, zmm5, 2
+vprord zmm11, zmm5, 13
+vprord zmm12, zmm5, 22
+vmovdqa32 zmm9, zmm5
+vpternlogd zmm9, zmm6, zmm7, 0xE8
+vpternlogd zmm4, zmm11, zmm12, 0x96
+vpaddd zmm4, zmm4, zmm9
+vpaddd zmm4, zmm4, zmm8
+vpaddd zmm8, zmm3, [r13 + 4*12]{1to16}
+vmovdqa32 zmm9, zmm0
+vprord zmm10, zmm0, 6
+vprord zmm11, zmm0, 11
+vprord zmm12, zmm0, 25
+vpternlogd zmm9, zmm1, zmm2, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm7, zmm7, zmm8
+vprord zmm3, zmm4, 2
+vprord zmm11, zmm4, 13
+vprord zmm12, zmm4, 22
+vmovdqa32 zmm9, zmm4
+vpternlogd zmm9, zmm5, zmm6, 0xE8
+vpternlogd zmm3, zmm11, zmm12, 0x96
+vpaddd zmm3, zmm3, zmm9
+vpaddd zmm3, zmm3, zmm8
+vpaddd zmm8, zmm2, [r13 + 4*13]{1to16}
+vmovdqa32 zmm9, zmm7
+vprord zmm10, zmm7, 6
+vprord zmm11, zmm7, 11
+vprord zmm12, zmm7, 25
+vpternlogd zmm9, zmm0, zmm1, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm6, zmm6, zmm8
+vprord zmm2, zmm3, 2
+vprord zmm11, zmm3, 13
+vprord zmm12, zmm3, 22
+vmovdqa32 zmm9, zmm3
+vpternlogd zmm9, zmm4, zmm5, 0xE8
+vpternlogd zmm2, zmm11, zmm12, 0x96
+vpaddd zmm2, zmm2, zmm9
+vpaddd zmm2, zmm2, zmm8
+vpaddd zmm8, zmm1, [r13 + 4*14]{1to16}
+vmovdqa32 zmm9, zmm6
+vprord zmm10, zmm6, 6
+vprord zmm11, zmm6, 11
+vprord zmm12, zmm6, 25
+vpternlogd zmm9, zmm7, zmm0, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm5, zmm5, zmm8
+vprord zmm1, zmm2, 2
+vprord zmm11, zmm2, 13
+vprord zmm12, zmm2, 22
+vmovdqa32 zmm9, zmm2
+vpternlogd zmm9, zmm3, zmm4, 0xE8
+vpternlogd zmm1, zmm11, zmm12, 0x96
+vpaddd zmm1, zmm1, zmm9
+vpaddd zmm1, zmm1, zmm8
+vpaddd zmm8, zmm0, [r13 + 4*15]{1to16}
+vmovdqa32 zmm9, zmm5
+vprord zmm10, zmm5, 6
+vprord zmm11, zmm5, 11
+vprord zmm12, zmm5, 25
+vpternlogd zmm9, zmm6, zmm7, 0xCA
+vpternlogd zmm10, zmm11, zmm12, 0x96
+vpaddd zmm8, zmm8, zmm9
+vpaddd zmm8, zmm8, zmm10
+vpaddd zmm4, zmm4, zmm8
+vprord zmm0, zmm1, 2
+vprord zmm11, zmm1, 13
+vprord zmm12, zmm1, 22
+vmovdqa32 zmm9, zmm1
+vpternlogd zmm9, zmm2, zmm3, 0xE8
+vpternlogd zmm0, zmm11, zmm12, 0x96
+vpaddd zmm0, zmm0, zmm9
+vpaddd zmm0, zmm0, zmm8
+add r13, 4*16
+cmp r13, r14
+jb sha256_mine_x16_avx512_const_loop
+sha256_mine_x16_avx512_last_block:
+cmp qword ptr [rsp + 2784], 0
+jne sha256_mine_x16_avx512_second_hash
+vpaddd zmm0, zmm0, [rsp + 0 + 64*0]
+vpcmpud k1, zmm0, [rdi + 456]{1to16}, 2
+kmovw eax, k1
+sub r10, 1
+test eax, eax
+jnz sha256_mine_x16_avx512_done
+test r10, r10
+jnz sha256_mine_x16_avx512_batch_loop
+jmp sha256_mine_x16_avx512_done
+sha256_mine_x16_avx512_second_hash:
+mov qword ptr [rsp + 2784], 0
+vpaddd zmm0, zmm0, [rsp + 0 + 64*0]
+vpaddd zmm1, zmm1, [rsp + 0 + 64*1]
+vpaddd zmm2, zmm2, [rsp + 0 + 64*2]
+vpaddd zmm3, zmm3, [rsp + 0 + 64*3]
+vpaddd zmm4, zmm4, [rsp + 0 + 64*4]
+vpaddd zmm5, zmm5, [rsp + 0 + 64*5]
+vpaddd zmm6, zmm6, [rsp + 0 + 64*6]
+vpaddd zmm7, zmm7, [rsp + 0 + 64*7]
+vmovdqa32 zmm16, zmm0
+vmovdqa32 zmm17, zmm1
+vmovdqa32 zmm18, zmm2
+vmovdqa32 zmm19, zmm3
+vmovdqa32 zmm20, zmm4
+vmovdqa32 zmm21, zmm5
+vmovdqa32 zmm22, zmm6
+vmovdqa32 zmm23, zmm7
+vpbroadcastd zmm24, [rip + SHA256D_PAD + 4*(8-8)]
+vpbroadcastd zmm25, [rip + SHA256D_PAD + 4*(9-8)]
+vpbroadcastd zmm26, [rip + SHA256D_PAD + 4*(10-8)]
+vpbroadcastd zmm27, [rip + SHA256D_PAD + 4*(11-8)]
+vpbroadcastd zmm28, [rip + SHA256D_PAD + 4*(12-8)]
+vpbroadcastd zmm29, [rip + SHA256D_PAD + 4*(13-8)]
+vpbroadcastd zmm30, [rip + SHA256D_PAD + 4*(14-8)]
+vpbroadcastd zmm31, [rip + SHA256D_PAD + 4*(15-8)]
+vpbroadcastd zmm0, [rip + SHA256_IV + 4*0]
+vpbroadcastd zmm1, [rip + SHA256_IV + 4*1]
+vpbroadcastd zmm2, [rip + SHA256_IV + 4*2]
+vpbroadcastd zmm3, [rip + SHA256_IV + 4*3]
+vpbroadcastd zmm4, [rip + SHA256_IV + 4*4]
+vpbroadcastd zmm5, [rip + SHA256_IV + 4*5]
+vpbroadcastd zmm6, [rip + SHA256_IV + 4*6]
+vpbroadcastd zmm7, [rip + SHA256_IV + 4*7]
+vmovdqa32 [rsp + 0 + 64*0], zmm0
+vmovdqa32 [rsp + 0 + 64*1], zmm1
+vmovdqa32 [rsp + 0 + 64*2], zmm2
+vmovdqa32 [rsp + 0 + 64*3], zmm3
+vmovdqa32 [rsp + 0 + 64*4], zmm4
+vmovdqa32 [rsp + 0 + 64*5], zmm5
+vmovdqa32 [rsp + 0 + 64*6], zmm6
+vmovdqa32 [rsp + 0 + 64*7], zmm7
+mov r9, 1
+jmp sha256_mine_x16_avx512_round_0
+sha256_mine_x16_avx512_done:
+mov [rsi + 8], r10
+mov r15, [rsp + 2560]
+mov [rsi + 0], r15
+sub r15, [rsi + 24]
+mov [rsi + 16], r15
+mov rsp, [rsp + 2792]
+ret
+.section .data
+.balign 64
+TABLE:
+.long 0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5
+.long 0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5
+.long 0xd807aa98,0x12835b01,0x243185be,0x550c7dc3
+.long 0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174
+.long 0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc
+.long 0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da
+.long 0x983e5152,0xa831c66d,0xb00327c8,0xbf597fc7
+.long 0xc6e00bf3,0xd5a79147,0x06ca6351,0x14292967
+.long 0x27b70a85,0x2e1b2138,0x4d2c6dfc,0x53380d13
+.long 0x650a7354,0x766a0abb,0x81c2c92e,0x92722c85
+.long 0xa2bfe8a1,0xa81a664b,0xc24b8b70,0xc76c51a3
+.long 0xd192e819,0xd6990624,0xf40e3585,0x106aa070
+.long 0x19a4c116,0x1e376c08,0x2748774c,0x34b0bcb5
+.long 0x391c0cb3,0x4ed8aa4a,0x5b9cca4f,0x682e6ff3
+.long 0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208
+.long 0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
+.balign 64
+PSHUFFLE_BYTE_FLIP_MASK:
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
+NONCE_LANE_OFFSETS:
+.quad 0, 1, 2, 3, 4, 5, 6, 7
+.quad 8, 9, 10, 11, 12, 13, 14, 15
+SHA256_IV:
+.long 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a
+.long 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+SHA256D_PAD:
+.long 0x80000000, 0, 0, 0, 0, 0, 0, 256
+NONCE_LO_PERM:
+.long 0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22, 24, 26, 28, 30
+NONCE_HI_PERM:
+.long 1, 3, 5, 7, 9, 11, 13, 15, 17, 19, 21, 23, 25, 27, 29, 31
@@ -0,0 +1,2897 @@
+.intel_syntax noprefix
+.section .note.GNU-stack
+.section .text
+.section .text
+.globl sha256_mine_x8_avx2
+.balign 16
+sha256_mine_x8_avx2:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+mov rax, rsp
+sub rsp, 1936
+and rsp, ~31
+mov [rsp + 1928], rax
+lea rcx,[rip + K256_8_MB]
+vpbroadcastq ymm8, [rsi + 0]
+vpaddq ymm9, ymm8, [rip + NONCE_LANE_OFFSETS + 0*8*4]
+vpaddq ymm8, ymm8, [rip + NONCE_LANE_OFFSETS + 1*8*4]
+vmovdqa [rsp + 1792 + 0*8*4], ymm9
+vmovdqa [rsp + 1792 + 1*8*4], ymm8
+vpbroadcastq ymm8, [rsi + 24]
+vmovdqa [rsp + 1856], ymm8
+mov eax, [rdi + 464]
+mov [rsp + 1888], rax
+neg eax
+add eax, 32
+mov [rsp + 1904], rax
+vpbroadcastd ymm8, [rdi + 256 + 0*4]
+vmovdqa [rsp + 768 + 0*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 1*4]
+vmovdqa [rsp + 768 + 1*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 2*4]
+vmovdqa [rsp + 768 + 2*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 3*4]
+vmovdqa [rsp + 768 + 3*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 4*4]
+vmovdqa [rsp + 768 + 4*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 5*4]
+vmovdqa [rsp + 768 + 5*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 6*4]
+vmovdqa [rsp + 768 + 6*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 7*4]
+vmovdqa [rsp + 768 + 7*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 8*4]
+vmovdqa [rsp + 768 + 8*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 9*4]
+vmovdqa [rsp + 768 + 9*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 10*4]
+vmovdqa [rsp + 768 + 10*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 11*4]
+vmovdqa [rsp + 768 + 11*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 12*4]
+vmovdqa [rsp + 768 + 12*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 13*4]
+vmovdqa [rsp + 768 + 13*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 14*4]
+vmovdqa [rsp + 768 + 14*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 15*4]
+vmovdqa [rsp + 768 + 15*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 16*4]
+vmovdqa [rsp + 768 + 16*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 17*4]
+vmovdqa [rsp + 768 + 17*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 18*4]
+vmovdqa [rsp + 768 + 18*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 19*4]
+vmovdqa [rsp + 768 + 19*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 20*4]
+vmovdqa [rsp + 768 + 20*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 21*4]
+vmovdqa [rsp + 768 + 21*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 22*4]
+vmovdqa [rsp + 768 + 22*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 23*4]
+vmovdqa [rsp + 768 + 23*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 24*4]
+vmovdqa [rsp + 768 + 24*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 25*4]
+vmovdqa [rsp + 768 + 25*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 26*4]
+vmovdqa [rsp + 768 + 26*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 27*4]
+vmovdqa [rsp + 768 + 27*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 28*4]
+vmovdqa [rsp + 768 + 28*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 29*4]
+vmovdqa [rsp + 768 + 29*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 30*4]
+vmovdqa [rsp + 768 + 30*8*4], ymm8
+vpbroadcastd ymm8, [rdi + 256 + 31*4]
+vmovdqa [rsp + 768 + 31*8*4], ymm8
+mov eax, [rdi + 460]
+lea r12, [rdi + 256 + 4*rax]
+shl rax, 5
+lea r11, [rsp + 768 + rax]
+xor eax, eax
+mov r10, [rsi + 8]
+test r10, r10
+jz sha256_mine_x8_avx2_done
+sha256_mine_x8_avx2_batch_loop:
+vmovdqa ymm8, [rsp + 1792 + 0*8*4]
+vmovdqa ymm9, [rsp + 1792 + 1*8*4]
+vshufps ymm10, ymm8, ymm9, 0x88
+vpermq ymm10, ymm10, 0xD8
+vshufps ymm11, ymm8, ymm9, 0xDD
+vpermq ymm11, ymm11, 0xD8
+vpaddq ymm8, ymm8, [rsp + 1856]
+vpaddq ymm9, ymm9, [rsp + 1856]
+vmovdqa [rsp + 1792 + 0*8*4], ymm8
+vmovdqa [rsp + 1792 + 1*8*4], ymm9
+vmovdqa ymm15, [rip + PSHUFFLE_BYTE_FLIP_MASK]
+vpslld ymm12, ymm10, [rsp + 1888]
+vpsrld ymm10, ymm10, [rsp + 1904]
+vpslld ymm13, ymm11, [rsp + 1888]
+vpsrld ymm11, ymm11, [rsp + 1904]
+vpor ymm10, ymm10, ymm13
+vpshufb ymm12, ymm12, ymm15
+vpshufb ymm10, ymm10, ymm15
+vpshufb ymm11, ymm11, ymm15
+vpbroadcastd ymm8, [r12 + 4*0]
+vpbroadcastd ymm9, [r12 + 4*1]
+vpbroadcastd ymm13, [r12 + 4*2]
+vpor ymm12, ymm12, ymm8
+vpor ymm10, ymm10, ymm9
+vpor ymm11, ymm11, ymm13
+vmovdqa [r11 + 0*8*4], ymm12
+vmovdqa [r11 + 1*8*4], ymm10
+vmovdqa [r11 + 2*8*4], ymm11
+vpbroadcastd ymm12, [rdi + 384 + 0*4]
+vmovdqa [rsp + 512 + 0*8*4], ymm12
+vpbroadcastd ymm12, [rdi + 384 + 1*4]
+vmovdqa [rsp + 512 + 1*8*4], ymm12
+vpbroadcastd ymm12, [rdi + 384 + 2*4]
+vmovdqa [rsp + 512 + 2*8*4], ymm12
+vpbroadcastd ymm12, [rdi + 384 + 3*4]
+vmovdqa [rsp + 512 + 3*8*4], ymm12
+vpbroadcastd ymm12, [rdi + 384 + 4*4]
+vmovdqa [rsp + 512 + 4*8*4], ymm12
+vpbroadcastd ymm12, [rdi + 384 + 5*4]
+vmovdqa [rsp + 512 + 5*8*4], ymm12
+vpbroadcastd ymm12, [rdi + 384 + 6*4]
+vmovdqa [rsp + 512 + 6*8*4], ymm12
+vpbroadcastd ymm12, [rdi + 384 + 7*4]
+vmovdqa [rsp + 512 + 7*8*4], ymm12
+mov r9, rdx
+mov eax, [rdi + 452]
+and eax, 2
+mov [rsp + 1920], rax
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 0)]
+vmovdqa [8*4*0 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 1)]
+vmovdqa [8*4*1 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 2)]
+vmovdqa [8*4*2 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 3)]
+vmovdqa [8*4*3 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 4)]
+vmovdqa [8*4*4 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 5)]
+vmovdqa [8*4*5 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 6)]
+vmovdqa [8*4*6 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 7)]
+vmovdqa [8*4*7 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 8)]
+vmovdqa [8*4*8 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 9)]
+vmovdqa [8*4*9 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 10)]
+vmovdqa [8*4*10 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 11)]
+vmovdqa [8*4*11 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 12)]
+vmovdqa [8*4*12 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 13)]
+vmovdqa [8*4*13 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 14)]
+vmovdqa [8*4*14 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(0*16 + 15)]
+vmovdqa [8*4*15 + rsp], ymm15
+mov eax, [rdi + 448]
+cmp eax, 1
+je sha256_mine_x8_avx2_enter_1
+cmp eax, 2
+je sha256_mine_x8_avx2_enter_2
+cmp eax, 3
+je sha256_mine_x8_avx2_enter_3
+cmp eax, 4
+je sha256_mine_x8_avx2_enter_4
+cmp eax, 5
+je sha256_mine_x8_avx2_enter_5
+cmp eax, 6
+je sha256_mine_x8_avx2_enter_6
+cmp eax, 7
+je sha256_mine_x8_avx2_enter_7
+cmp eax, 8
+je sha256_mine_x8_avx2_enter_8
+cmp eax, 9
+je sha256_mine_x8_avx2_enter_9
+cmp eax, 10
+je sha256_mine_x8_avx2_enter_10
+cmp eax, 11
+je sha256_mine_x8_avx2_enter_11
+cmp eax, 12
+je sha256_mine_x8_avx2_enter_12
+cmp eax, 13
+je sha256_mine_x8_avx2_enter_13
+cmp eax, 14
+je sha256_mine_x8_avx2_enter_14
+cmp eax, 15
+je sha256_mine_x8_avx2_enter_15
+vpbroadcastd ymm0, [rdi + 416 + 0*4]
+vpbroadcastd ymm1, [rdi + 416 + 1*4]
+vpbroadcastd ymm2, [rdi + 416 + 2*4]
+vpbroadcastd ymm3, [rdi + 416 + 3*4]
+vpbroadcastd ymm4, [rdi + 416 + 4*4]
+vpbroadcastd ymm5, [rdi + 416 + 5*4]
+vpbroadcastd ymm6, [rdi + 416 + 6*4]
+vpbroadcastd ymm7, [rdi + 416 + 7*4]
+mov rbx, 0*8*4
+sha256_mine_x8_avx2_round_0:
+vmovdqa ymm8, [8*4*0 + rsp]
+vpslld ymm15, ymm4, (32-((11-6)))
+vpsrld ymm12, ymm4, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm5, ymm6
+vpand ymm14, ymm14, ymm4
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm4, (32-(25))
+vpsrld ymm13, ymm4, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm4
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm7, ymm7, ymm14
+vpslld ymm15, ymm0, (32-((13-2)))
+vpsrld ymm14, ymm0, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm7, ymm7, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm0, (32-(22))
+vpsrld ymm13, ymm0, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm0, ymm2
+add rbx, 8*4
+vpand ymm8, ymm8, ymm1
+vpaddd ymm7, ymm7, ymm12
+vpaddd ymm3, ymm3, ymm7
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm0, ymm2
+vpor ymm13, ymm13, ymm8
+vpaddd ymm7, ymm7, ymm13
+vpaddd ymm7, ymm7, ymm14
+sha256_mine_x8_avx2_round_1:
+vmovdqa ymm8, [8*4*1 + rsp]
+vpslld ymm15, ymm3, (32-((11-6)))
+vpsrld ymm12, ymm3, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm4, ymm5
+vpand ymm14, ymm14, ymm3
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm3, (32-(25))
+vpsrld ymm13, ymm3, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm3
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm6, ymm6, ymm14
+vpslld ymm15, ymm7, (32-((13-2)))
+vpsrld ymm14, ymm7, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm6, ymm6, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm7, (32-(22))
+vpsrld ymm13, ymm7, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm7, ymm1
+add rbx, 8*4
+vpand ymm8, ymm8, ymm0
+vpaddd ymm6, ymm6, ymm12
+vpaddd ymm2, ymm2, ymm6
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm7, ymm1
+vpor ymm13, ymm13, ymm8
+vpaddd ymm6, ymm6, ymm13
+vpaddd ymm6, ymm6, ymm14
+sha256_mine_x8_avx2_round_2:
+vmovdqa ymm8, [8*4*2 + rsp]
+vpslld ymm15, ymm2, (32-((11-6)))
+vpsrld ymm12, ymm2, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm3, ymm4
+vpand ymm14, ymm14, ymm2
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm2, (32-(25))
+vpsrld ymm13, ymm2, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm2
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm5, ymm5, ymm14
+vpslld ymm15, ymm6, (32-((13-2)))
+vpsrld ymm14, ymm6, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm5, ymm5, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm6, (32-(22))
+vpsrld ymm13, ymm6, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm6, ymm0
+add rbx, 8*4
+vpand ymm8, ymm8, ymm7
+vpaddd ymm5, ymm5, ymm12
+vpaddd ymm1, ymm1, ymm5
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm6, ymm0
+vpor ymm13, ymm13, ymm8
+vpaddd ymm5, ymm5, ymm13
+vpaddd ymm5, ymm5, ymm14
+sha256_mine_x8_avx2_round_3:
+vmovdqa ymm8, [8*4*3 + rsp]
+vpslld ymm15, ymm1, (32-((11-6)))
+vpsrld ymm12, ymm1, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm2, ymm3
+vpand ymm14, ymm14, ymm1
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm1, (32-(25))
+vpsrld ymm13, ymm1, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm1
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm4, ymm4, ymm14
+vpslld ymm15, ymm5, (32-((13-2)))
+vpsrld ymm14, ymm5, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm4, ymm4, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm5, (32-(22))
+vpsrld ymm13, ymm5, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm5, ymm7
+add rbx, 8*4
+vpand ymm8, ymm8, ymm6
+vpaddd ymm4, ymm4, ymm12
+vpaddd ymm0, ymm0, ymm4
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm5, ymm7
+vpor ymm13, ymm13, ymm8
+vpaddd ymm4, ymm4, ymm13
+vpaddd ymm4, ymm4, ymm14
+sha256_mine_x8_avx2_round_4:
+vmovdqa ymm8, [8*4*4 + rsp]
+vpslld ymm15, ymm0, (32-((11-6)))
+vpsrld ymm12, ymm0, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm1, ymm2
+vpand ymm14, ymm14, ymm0
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm0, (32-(25))
+vpsrld ymm13, ymm0, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm0
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm3, ymm3, ymm14
+vpslld ymm15, ymm4, (32-((13-2)))
+vpsrld ymm14, ymm4, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm3, ymm3, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm4, (32-(22))
+vpsrld ymm13, ymm4, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm4, ymm6
+add rbx, 8*4
+vpand ymm8, ymm8, ymm5
+vpaddd ymm3, ymm3, ymm12
+vpaddd ymm7, ymm7, ymm3
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm4, ymm6
+vpor ymm13, ymm13, ymm8
+vpaddd ymm3, ymm3, ymm13
+vpaddd ymm3, ymm3, ymm14
+sha256_mine_x8_avx2_round_5:
+vmovdqa ymm8, [8*4*5 + rsp]
+vpslld ymm15, ymm7, (32-((11-6)))
+vpsrld ymm12, ymm7, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm0, ymm1
+vpand ymm14, ymm14, ymm7
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm7, (32-(25))
+vpsrld ymm13, ymm7, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm7
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm2, ymm2, ymm14
+vpslld ymm15, ymm3, (32-((13-2)))
+vpsrld ymm14, ymm3, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm2, ymm2, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm3, (32-(22))
+vpsrld ymm13, ymm3, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm3, ymm5
+add rbx, 8*4
+vpand ymm8, ymm8, ymm4
+vpaddd ymm2, ymm2, ymm12
+vpaddd ymm6, ymm6, ymm2
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm3, ymm5
+vpor ymm13, ymm13, ymm8
+vpaddd ymm2, ymm2, ymm13
+vpaddd ymm2, ymm2, ymm14
+sha256_mine_x8_avx2_round_6:
+vmovdqa ymm8, [8*4*6 + rsp]
+vpslld ymm15, ymm6, (32-((11-6)))
+vpsrld ymm12, ymm6, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm7, ymm0
+vpand ymm14, ymm14, ymm6
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm6, (32-(25))
+vpsrld ymm13, ymm6, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm6
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm1, ymm1, ymm14
+vpslld ymm15, ymm2, (32-((13-2)))
+vpsrld ymm14, ymm2, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm1, ymm1, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm2, (32-(22))
+vpsrld ymm13, ymm2, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm2, ymm4
+add rbx, 8*4
+vpand ymm8, ymm8, ymm3
+vpaddd ymm1, ymm1, ymm12
+vpaddd ymm5, ymm5, ymm1
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm2, ymm4
+vpor ymm13, ymm13, ymm8
+vpaddd ymm1, ymm1, ymm13
+vpaddd ymm1, ymm1, ymm14
+sha256_mine_x8_avx2_round_7:
+vmovdqa ymm8, [8*4*7 + rsp]
+vpslld ymm15, ymm5, (32-((11-6)))
+vpsrld ymm12, ymm5, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm6, ymm7
+vpand ymm14, ymm14, ymm5
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm5, (32-(25))
+vpsrld ymm13, ymm5, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm5
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm0, ymm0, ymm14
+vpslld ymm15, ymm1, (32-((13-2)))
+vpsrld ymm14, ymm1, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm0, ymm0, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm1, (32-(22))
+vpsrld ymm13, ymm1, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm1, ymm3
+add rbx, 8*4
+vpand ymm8, ymm8, ymm2
+vpaddd ymm0, ymm0, ymm12
+vpaddd ymm4, ymm4, ymm0
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm1, ymm3
+vpor ymm13, ymm13, ymm8
+vpaddd ymm0, ymm0, ymm13
+vpaddd ymm0, ymm0, ymm14
+sha256_mine_x8_avx2_round_8:
+vmovdqa ymm8, [8*4*8 + rsp]
+vpslld ymm15, ymm4, (32-((11-6)))
+vpsrld ymm12, ymm4, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm5, ymm6
+vpand ymm14, ymm14, ymm4
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm4, (32-(25))
+vpsrld ymm13, ymm4, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm4
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm7, ymm7, ymm14
+vpslld ymm15, ymm0, (32-((13-2)))
+vpsrld ymm14, ymm0, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm7, ymm7, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm0, (32-(22))
+vpsrld ymm13, ymm0, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm0, ymm2
+add rbx, 8*4
+vpand ymm8, ymm8, ymm1
+vpaddd ymm7, ymm7, ymm12
+vpaddd ymm3, ymm3, ymm7
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm0, ymm2
+vpor ymm13, ymm13, ymm8
+vpaddd ymm7, ymm7, ymm13
+vpaddd ymm7, ymm7, ymm14
+sha256_mine_x8_avx2_round_9:
+vmovdqa ymm8, [8*4*9 + rsp]
+vpslld ymm15, ymm3, (32-((11-6)))
+vpsrld ymm12, ymm3, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm4, ymm5
+vpand ymm14, ymm14, ymm3
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm3, (32-(25))
+vpsrld ymm13, ymm3, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm3
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm6, ymm6, ymm14
+vpslld ymm15, ymm7, (32-((13-2)))
+vpsrld ymm14, ymm7, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm6, ymm6, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm7, (32-(22))
+vpsrld ymm13, ymm7, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm7, ymm1
+add rbx, 8*4
+vpand ymm8, ymm8, ymm0
+vpaddd ymm6, ymm6, ymm12
+vpaddd ymm2, ymm2, ymm6
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm7, ymm1
+vpor ymm13, ymm13, ymm8
+vpaddd ymm6, ymm6, ymm13
+vpaddd ymm6, ymm6, ymm14
+sha256_mine_x8_avx2_round_10:
+vmovdqa ymm8, [8*4*10 + rsp]
+vpslld ymm15, ymm2, (32-((11-6)))
+vpsrld ymm12, ymm2, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm3, ymm4
+vpand ymm14, ymm14, ymm2
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm2, (32-(25))
+vpsrld ymm13, ymm2, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm2
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm5, ymm5, ymm14
+vpslld ymm15, ymm6, (32-((13-2)))
+vpsrld ymm14, ymm6, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm5, ymm5, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm6, (32-(22))
+vpsrld ymm13, ymm6, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm6, ymm0
+add rbx, 8*4
+vpand ymm8, ymm8, ymm7
+vpaddd ymm5, ymm5, ymm12
+vpaddd ymm1, ymm1, ymm5
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm6, ymm0
+vpor ymm13, ymm13, ymm8
+vpaddd ymm5, ymm5, ymm13
+vpaddd ymm5, ymm5, ymm14
+sha256_mine_x8_avx2_round_11:
+vmovdqa ymm8, [8*4*11 + rsp]
+vpslld ymm15, ymm1, (32-((11-6)))
+vpsrld ymm12, ymm1, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm2, ymm3
+vpand ymm14, ymm14, ymm1
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm1, (32-(25))
+vpsrld ymm13, ymm1, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm1
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm4, ymm4, ymm14
+vpslld ymm15, ymm5, (32-((13-2)))
+vpsrld ymm14, ymm5, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm4, ymm4, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm5, (32-(22))
+vpsrld ymm13, ymm5, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm5, ymm7
+add rbx, 8*4
+vpand ymm8, ymm8, ymm6
+vpaddd ymm4, ymm4, ymm12
+vpaddd ymm0, ymm0, ymm4
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm5, ymm7
+vpor ymm13, ymm13, ymm8
+vpaddd ymm4, ymm4, ymm13
+vpaddd ymm4, ymm4, ymm14
+sha256_mine_x8_avx2_round_12:
+vmovdqa ymm8, [8*4*12 + rsp]
+vpslld ymm15, ymm0, (32-((11-6)))
+vpsrld ymm12, ymm0, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm1, ymm2
+vpand ymm14, ymm14, ymm0
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm0, (32-(25))
+vpsrld ymm13, ymm0, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm0
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm3, ymm3, ymm14
+vpslld ymm15, ymm4, (32-((13-2)))
+vpsrld ymm14, ymm4, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm3, ymm3, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm4, (32-(22))
+vpsrld ymm13, ymm4, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm4, ymm6
+add rbx, 8*4
+vpand ymm8, ymm8, ymm5
+vpaddd ymm3, ymm3, ymm12
+vpaddd ymm7, ymm7, ymm3
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm4, ymm6
+vpor ymm13, ymm13, ymm8
+vpaddd ymm3, ymm3, ymm13
+vpaddd ymm3, ymm3, ymm14
+sha256_mine_x8_avx2_round_13:
+vmovdqa ymm8, [8*4*13 + rsp]
+vpslld ymm15, ymm7, (32-((11-6)))
+vpsrld ymm12, ymm7, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm0, ymm1
+vpand ymm14, ymm14, ymm7
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm7, (32-(25))
+vpsrld ymm13, ymm7, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm7
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm2, ymm2, ymm14
+vpslld ymm15, ymm3, (32-((13-2)))
+vpsrld ymm14, ymm3, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm2, ymm2, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm3, (32-(22))
+vpsrld ymm13, ymm3, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm3, ymm5
+add rbx, 8*4
+vpand ymm8, ymm8, ymm4
+vpaddd ymm2, ymm2, ymm12
+vpaddd ymm6, ymm6, ymm2
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm3, ymm5
+vpor ymm13, ymm13, ymm8
+vpaddd ymm2, ymm2, ymm13
+vpaddd ymm2, ymm2, ymm14
+sha256_mine_x8_avx2_round_14:
+vmovdqa ymm8, [8*4*14 + rsp]
+vpslld ymm15, ymm6, (32-((11-6)))
+vpsrld ymm12, ymm6, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm7, ymm0
+vpand ymm14, ymm14, ymm6
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm6, (32-(25))
+vpsrld ymm13, ymm6, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm6
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm1, ymm1, ymm14
+vpslld ymm15, ymm2, (32-((13-2)))
+vpsrld ymm14, ymm2, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm1, ymm1, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm2, (32-(22))
+vpsrld ymm13, ymm2, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm2, ymm4
+add rbx, 8*4
+vpand ymm8, ymm8, ymm3
+vpaddd ymm1, ymm1, ymm12
+vpaddd ymm5, ymm5, ymm1
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm2, ymm4
+vpor ymm13, ymm13, ymm8
+vpaddd ymm1, ymm1, ymm13
+vpaddd ymm1, ymm1, ymm14
+sha256_mine_x8_avx2_round_15:
+vmovdqa ymm8, [8*4*15 + rsp]
+vpslld ymm15, ymm5, (32-((11-6)))
+vpsrld ymm12, ymm5, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm6, ymm7
+vpand ymm14, ymm14, ymm5
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm5, (32-(25))
+vpsrld ymm13, ymm5, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm5
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm0, ymm0, ymm14
+vpslld ymm15, ymm1, (32-((13-2)))
+vpsrld ymm14, ymm1, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm0, ymm0, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm1, (32-(22))
+vpsrld ymm13, ymm1, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm1, ymm3
+add rbx, 8*4
+vpand ymm8, ymm8, ymm2
+vpaddd ymm0, ymm0, ymm12
+vpaddd ymm4, ymm4, ymm0
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm1, ymm3
+vpor ymm13, ymm13, ymm8
+vpaddd ymm0, ymm0, ymm13
+vpaddd ymm0, ymm0, ymm14
+jmp sha256_mine_x8_avx2_rounds_16_xx
+.balign 16
+sha256_mine_x8_avx2_rounds_16_xx:
+vmovdqa ymm8, [8*4*((16-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((16-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((16-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((16-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(16&0xf) + rsp], ymm8
+vpslld ymm15, ymm4, (32-((11-6)))
+vpsrld ymm12, ymm4, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm5, ymm6
+vpand ymm14, ymm14, ymm4
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm4, (32-(25))
+vpsrld ymm13, ymm4, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm4
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm7, ymm7, ymm14
+vpslld ymm15, ymm0, (32-((13-2)))
+vpsrld ymm14, ymm0, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm7, ymm7, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm0, (32-(22))
+vpsrld ymm13, ymm0, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm0, ymm2
+add rbx, 8*4
+vpand ymm8, ymm8, ymm1
+vpaddd ymm7, ymm7, ymm12
+vpaddd ymm3, ymm3, ymm7
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm0, ymm2
+vpor ymm13, ymm13, ymm8
+vpaddd ymm7, ymm7, ymm13
+vpaddd ymm7, ymm7, ymm14
+vmovdqa ymm8, [8*4*((17-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((17-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((17-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((17-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(17&0xf) + rsp], ymm8
+vpslld ymm15, ymm3, (32-((11-6)))
+vpsrld ymm12, ymm3, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm4, ymm5
+vpand ymm14, ymm14, ymm3
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm3, (32-(25))
+vpsrld ymm13, ymm3, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm3
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm6, ymm6, ymm14
+vpslld ymm15, ymm7, (32-((13-2)))
+vpsrld ymm14, ymm7, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm6, ymm6, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm7, (32-(22))
+vpsrld ymm13, ymm7, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm7, ymm1
+add rbx, 8*4
+vpand ymm8, ymm8, ymm0
+vpaddd ymm6, ymm6, ymm12
+vpaddd ymm2, ymm2, ymm6
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm7, ymm1
+vpor ymm13, ymm13, ymm8
+vpaddd ymm6, ymm6, ymm13
+vpaddd ymm6, ymm6, ymm14
+vmovdqa ymm8, [8*4*((18-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((18-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((18-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((18-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(18&0xf) + rsp], ymm8
+vpslld ymm15, ymm2, (32-((11-6)))
+vpsrld ymm12, ymm2, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm3, ymm4
+vpand ymm14, ymm14, ymm2
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm2, (32-(25))
+vpsrld ymm13, ymm2, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm2
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm5, ymm5, ymm14
+vpslld ymm15, ymm6, (32-((13-2)))
+vpsrld ymm14, ymm6, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm5, ymm5, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm6, (32-(22))
+vpsrld ymm13, ymm6, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm6, ymm0
+add rbx, 8*4
+vpand ymm8, ymm8, ymm7
+vpaddd ymm5, ymm5, ymm12
+vpaddd ymm1, ymm1, ymm5
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm6, ymm0
+vpor ymm13, ymm13, ymm8
+vpaddd ymm5, ymm5, ymm13
+vpaddd ymm5, ymm5, ymm14
+vmovdqa ymm8, [8*4*((19-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((19-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((19-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((19-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(19&0xf) + rsp], ymm8
+vpslld ymm15, ymm1, (32-((11-6)))
+vpsrld ymm12, ymm1, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm2, ymm3
+vpand ymm14, ymm14, ymm1
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm1, (32-(25))
+vpsrld ymm13, ymm1, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm1
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm4, ymm4, ymm14
+vpslld ymm15, ymm5, (32-((13-2)))
+vpsrld ymm14, ymm5, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm4, ymm4, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm5, (32-(22))
+vpsrld ymm13, ymm5, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm5, ymm7
+add rbx, 8*4
+vpand ymm8, ymm8, ymm6
+vpaddd ymm4, ymm4, ymm12
+vpaddd ymm0, ymm0, ymm4
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm5, ymm7
+vpor ymm13, ymm13, ymm8
+vpaddd ymm4, ymm4, ymm13
+vpaddd ymm4, ymm4, ymm14
+vmovdqa ymm8, [8*4*((20-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((20-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((20-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((20-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(20&0xf) + rsp], ymm8
+vpslld ymm15, ymm0, (32-((11-6)))
+vpsrld ymm12, ymm0, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm1, ymm2
+vpand ymm14, ymm14, ymm0
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm0, (32-(25))
+vpsrld ymm13, ymm0, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm0
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm3, ymm3, ymm14
+vpslld ymm15, ymm4, (32-((13-2)))
+vpsrld ymm14, ymm4, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm3, ymm3, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm4, (32-(22))
+vpsrld ymm13, ymm4, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm4, ymm6
+add rbx, 8*4
+vpand ymm8, ymm8, ymm5
+vpaddd ymm3, ymm3, ymm12
+vpaddd ymm7, ymm7, ymm3
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm4, ymm6
+vpor ymm13, ymm13, ymm8
+vpaddd ymm3, ymm3, ymm13
+vpaddd ymm3, ymm3, ymm14
+vmovdqa ymm8, [8*4*((21-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((21-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((21-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((21-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(21&0xf) + rsp], ymm8
+vpslld ymm15, ymm7, (32-((11-6)))
+vpsrld ymm12, ymm7, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm0, ymm1
+vpand ymm14, ymm14, ymm7
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm7, (32-(25))
+vpsrld ymm13, ymm7, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm7
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm2, ymm2, ymm14
+vpslld ymm15, ymm3, (32-((13-2)))
+vpsrld ymm14, ymm3, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm2, ymm2, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm3, (32-(22))
+vpsrld ymm13, ymm3, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm3, ymm5
+add rbx, 8*4
+vpand ymm8, ymm8, ymm4
+vpaddd ymm2, ymm2, ymm12
+vpaddd ymm6, ymm6, ymm2
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm3, ymm5
+vpor ymm13, ymm13, ymm8
+vpaddd ymm2, ymm2, ymm13
+vpaddd ymm2, ymm2, ymm14
+vmovdqa ymm8, [8*4*((22-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((22-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((22-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((22-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(22&0xf) + rsp], ymm8
+vpslld ymm15, ymm6, (32-((11-6)))
+vpsrld ymm12, ymm6, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm7, ymm0
+vpand ymm14, ymm14, ymm6
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm6, (32-(25))
+vpsrld ymm13, ymm6, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm6
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm1, ymm1, ymm14
+vpslld ymm15, ymm2, (32-((13-2)))
+vpsrld ymm14, ymm2, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm1, ymm1, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm2, (32-(22))
+vpsrld ymm13, ymm2, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm2, ymm4
+add rbx, 8*4
+vpand ymm8, ymm8, ymm3
+vpaddd ymm1, ymm1, ymm12
+vpaddd ymm5, ymm5, ymm1
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm2, ymm4
+vpor ymm13, ymm13, ymm8
+vpaddd ymm1, ymm1, ymm13
+vpaddd ymm1, ymm1, ymm14
+vmovdqa ymm8, [8*4*((23-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((23-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((23-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((23-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(23&0xf) + rsp], ymm8
+vpslld ymm15, ymm5, (32-((11-6)))
+vpsrld ymm12, ymm5, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm6, ymm7
+vpand ymm14, ymm14, ymm5
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm5, (32-(25))
+vpsrld ymm13, ymm5, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm5
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm0, ymm0, ymm14
+vpslld ymm15, ymm1, (32-((13-2)))
+vpsrld ymm14, ymm1, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm0, ymm0, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm1, (32-(22))
+vpsrld ymm13, ymm1, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm1, ymm3
+add rbx, 8*4
+vpand ymm8, ymm8, ymm2
+vpaddd ymm0, ymm0, ymm12
+vpaddd ymm4, ymm4, ymm0
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm1, ymm3
+vpor ymm13, ymm13, ymm8
+vpaddd ymm0, ymm0, ymm13
+vpaddd ymm0, ymm0, ymm14
+vmovdqa ymm8, [8*4*((24-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((24-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((24-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((24-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(24&0xf) + rsp], ymm8
+vpslld ymm15, ymm4, (32-((11-6)))
+vpsrld ymm12, ymm4, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm5, ymm6
+vpand ymm14, ymm14, ymm4
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm4, (32-(25))
+vpsrld ymm13, ymm4, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm4
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm7, ymm7, ymm14
+vpslld ymm15, ymm0, (32-((13-2)))
+vpsrld ymm14, ymm0, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm7, ymm7, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm0, (32-(22))
+vpsrld ymm13, ymm0, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm0, ymm2
+add rbx, 8*4
+vpand ymm8, ymm8, ymm1
+vpaddd ymm7, ymm7, ymm12
+vpaddd ymm3, ymm3, ymm7
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm0, ymm2
+vpor ymm13, ymm13, ymm8
+vpaddd ymm7, ymm7, ymm13
+vpaddd ymm7, ymm7, ymm14
+vmovdqa ymm8, [8*4*((25-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((25-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((25-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((25-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(25&0xf) + rsp], ymm8
+vpslld ymm15, ymm3, (32-((11-6)))
+vpsrld ymm12, ymm3, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm4, ymm5
+vpand ymm14, ymm14, ymm3
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm3, (32-(25))
+vpsrld ymm13, ymm3, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm3
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm6, ymm6, ymm14
+vpslld ymm15, ymm7, (32-((13-2)))
+vpsrld ymm14, ymm7, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm6, ymm6, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm7, (32-(22))
+vpsrld ymm13, ymm7, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm7, ymm1
+add rbx, 8*4
+vpand ymm8, ymm8, ymm0
+vpaddd ymm6, ymm6, ymm12
+vpaddd ymm2, ymm2, ymm6
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm7, ymm1
+vpor ymm13, ymm13, ymm8
+vpaddd ymm6, ymm6, ymm13
+vpaddd ymm6, ymm6, ymm14
+vmovdqa ymm8, [8*4*((26-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((26-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((26-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((26-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(26&0xf) + rsp], ymm8
+vpslld ymm15, ymm2, (32-((11-6)))
+vpsrld ymm12, ymm2, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm3, ymm4
+vpand ymm14, ymm14, ymm2
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm2, (32-(25))
+vpsrld ymm13, ymm2, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm2
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm5, ymm5, ymm14
+vpslld ymm15, ymm6, (32-((13-2)))
+vpsrld ymm14, ymm6, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm5, ymm5, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm6, (32-(22))
+vpsrld ymm13, ymm6, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm6, ymm0
+add rbx, 8*4
+vpand ymm8, ymm8, ymm7
+vpaddd ymm5, ymm5, ymm12
+vpaddd ymm1, ymm1, ymm5
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm6, ymm0
+vpor ymm13, ymm13, ymm8
+vpaddd ymm5, ymm5, ymm13
+vpaddd ymm5, ymm5, ymm14
+vmovdqa ymm8, [8*4*((27-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((27-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((27-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((27-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(27&0xf) + rsp], ymm8
+vpslld ymm15, ymm1, (32-((11-6)))
+vpsrld ymm12, ymm1, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm2, ymm3
+vpand ymm14, ymm14, ymm1
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm1, (32-(25))
+vpsrld ymm13, ymm1, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm1
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm4, ymm4, ymm14
+vpslld ymm15, ymm5, (32-((13-2)))
+vpsrld ymm14, ymm5, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm4, ymm4, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm5, (32-(22))
+vpsrld ymm13, ymm5, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm5, ymm7
+add rbx, 8*4
+vpand ymm8, ymm8, ymm6
+vpaddd ymm4, ymm4, ymm12
+vpaddd ymm0, ymm0, ymm4
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm5, ymm7
+vpor ymm13, ymm13, ymm8
+vpaddd ymm4, ymm4, ymm13
+vpaddd ymm4, ymm4, ymm14
+vmovdqa ymm8, [8*4*((28-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((28-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((28-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((28-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(28&0xf) + rsp], ymm8
+vpslld ymm15, ymm0, (32-((11-6)))
+vpsrld ymm12, ymm0, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm1, ymm2
+vpand ymm14, ymm14, ymm0
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm0, (32-(25))
+vpsrld ymm13, ymm0, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm0
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm3, ymm3, ymm14
+vpslld ymm15, ymm4, (32-((13-2)))
+vpsrld ymm14, ymm4, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm3, ymm3, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm4, (32-(22))
+vpsrld ymm13, ymm4, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm4, ymm6
+add rbx, 8*4
+vpand ymm8, ymm8, ymm5
+vpaddd ymm3, ymm3, ymm12
+vpaddd ymm7, ymm7, ymm3
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm4, ymm6
+vpor ymm13, ymm13, ymm8
+vpaddd ymm3, ymm3, ymm13
+vpaddd ymm3, ymm3, ymm14
+vmovdqa ymm8, [8*4*((29-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((29-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((29-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((29-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(29&0xf) + rsp], ymm8
+vpslld ymm15, ymm7, (32-((11-6)))
+vpsrld ymm12, ymm7, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm0, ymm1
+vpand ymm14, ymm14, ymm7
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm7, (32-(25))
+vpsrld ymm13, ymm7, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm7
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm2, ymm2, ymm14
+vpslld ymm15, ymm3, (32-((13-2)))
+vpsrld ymm14, ymm3, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm2, ymm2, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm3, (32-(22))
+vpsrld ymm13, ymm3, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm3, ymm5
+add rbx, 8*4
+vpand ymm8, ymm8, ymm4
+vpaddd ymm2, ymm2, ymm12
+vpaddd ymm6, ymm6, ymm2
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm3, ymm5
+vpor ymm13, ymm13, ymm8
+vpaddd ymm2, ymm2, ymm13
+vpaddd ymm2, ymm2, ymm14
+vmovdqa ymm8, [8*4*((30-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((30-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((30-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((30-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(30&0xf) + rsp], ymm8
+vpslld ymm15, ymm6, (32-((11-6)))
+vpsrld ymm12, ymm6, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm7, ymm0
+vpand ymm14, ymm14, ymm6
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm6, (32-(25))
+vpsrld ymm13, ymm6, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm6
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm1, ymm1, ymm14
+vpslld ymm15, ymm2, (32-((13-2)))
+vpsrld ymm14, ymm2, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm1, ymm1, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm2, (32-(22))
+vpsrld ymm13, ymm2, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm2, ymm4
+add rbx, 8*4
+vpand ymm8, ymm8, ymm3
+vpaddd ymm1, ymm1, ymm12
+vpaddd ymm5, ymm5, ymm1
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm2, ymm4
+vpor ymm13, ymm13, ymm8
+vpaddd ymm1, ymm1, ymm13
+vpaddd ymm1, ymm1, ymm14
+vmovdqa ymm8, [8*4*((31-15)&0xf) + rsp]
+vmovdqa ymm13, [8*4*((31-2)&0xf) + rsp]
+vmovdqa ymm12, ymm8
+vpslld ymm15, ymm8, (32-(18-7))
+vpsrld ymm8, ymm8, 18-7
+vpor ymm8, ymm8, ymm15
+vmovdqa ymm14, ymm13
+vpslld ymm15, ymm13, (32-(19-17))
+vpsrld ymm13, ymm13, 19-17
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm8, ymm12
+vpslld ymm15, ymm8, (32-(7))
+vpsrld ymm8, ymm8, 7
+vpor ymm8, ymm8, ymm15
+vpxor ymm13, ymm13, ymm14
+vpslld ymm15, ymm13, (32-(17))
+vpsrld ymm13, ymm13, 17
+vpor ymm13, ymm13, ymm15
+vpsrld ymm12, ymm12, 3
+vpxor ymm8, ymm8, ymm12
+vpsrld ymm14, ymm14, 10
+vpxor ymm13, ymm13, ymm14
+vpaddd ymm8, ymm8, [8*4*((31-16)&0xf) + rsp]
+vpaddd ymm13, ymm13, [8*4*((31-7)&0xf) + rsp]
+vpaddd ymm8, ymm8, ymm13
+vmovdqa [8*4*(31&0xf) + rsp], ymm8
+vpslld ymm15, ymm5, (32-((11-6)))
+vpsrld ymm12, ymm5, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm6, ymm7
+vpand ymm14, ymm14, ymm5
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm5, (32-(25))
+vpsrld ymm13, ymm5, 25
+vpor ymm13, ymm13, ymm15
+vpaddd ymm8, ymm8, [rcx + rbx]
+vpxor ymm12, ymm12, ymm5
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm0, ymm0, ymm14
+vpslld ymm15, ymm1, (32-((13-2)))
+vpsrld ymm14, ymm1, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm0, ymm0, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm1, (32-(22))
+vpsrld ymm13, ymm1, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm1, ymm3
+add rbx, 8*4
+vpand ymm8, ymm8, ymm2
+vpaddd ymm0, ymm0, ymm12
+vpaddd ymm4, ymm4, ymm0
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm1, ymm3
+vpor ymm13, ymm13, ymm8
+vpaddd ymm0, ymm0, ymm13
+vpaddd ymm0, ymm0, ymm14
+cmp rbx,64*8*4
+jb sha256_mine_x8_avx2_rounds_16_xx
+sub r9, 1
+je sha256_mine_x8_avx2_last_block
+vpaddd ymm0, ymm0, [rsp + 512 + 0*8*4]
+vpaddd ymm1, ymm1, [rsp + 512 + 1*8*4]
+vpaddd ymm2, ymm2, [rsp + 512 + 2*8*4]
+vpaddd ymm3, ymm3, [rsp + 512 + 3*8*4]
+vpaddd ymm4, ymm4, [rsp + 512 + 4*8*4]
+vpaddd ymm5, ymm5, [rsp + 512 + 5*8*4]
+vpaddd ymm6, ymm6, [rsp + 512 + 6*8*4]
+vpaddd ymm7, ymm7, [rsp + 512 + 7*8*4]
+vmovdqa [rsp + 512 + 0*8*4], ymm0
+vmovdqa [rsp + 512 + 1*8*4], ymm1
+vmovdqa [rsp + 512 + 2*8*4], ymm2
+vmovdqa [rsp + 512 + 3*8*4], ymm3
+vmovdqa [rsp + 512 + 4*8*4], ymm4
+vmovdqa [rsp + 512 + 5*8*4], ymm5
+vmovdqa [rsp + 512 + 6*8*4], ymm6
+vmovdqa [rsp + 512 + 7*8*4], ymm7
+test dword ptr [rdi + 452], 1
+jnz sha256_mine_x8_avx2_const_block
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 0)]
+vmovdqa [8*4*0 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 1)]
+vmovdqa [8*4*1 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 2)]
+vmovdqa [8*4*2 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 3)]
+vmovdqa [8*4*3 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 4)]
+vmovdqa [8*4*4 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 5)]
+vmovdqa [8*4*5 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 6)]
+vmovdqa [8*4*6 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 7)]
+vmovdqa [8*4*7 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 8)]
+vmovdqa [8*4*8 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 9)]
+vmovdqa [8*4*9 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 10)]
+vmovdqa [8*4*10 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 11)]
+vmovdqa [8*4*11 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 12)]
+vmovdqa [8*4*12 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 13)]
+vmovdqa [8*4*13 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 14)]
+vmovdqa [8*4*14 + rsp], ymm15
+vmovdqa ymm15, [rsp + 768 + 8*4*(1*16 + 15)]
+vmovdqa [8*4*15 + rsp], ymm15
+xor rbx, rbx
+jmp sha256_mine_x8_avx2_round_0
+sha256_mine_x8_avx2_const_block:
+lea r13, [rdi + 0]
+lea r14, [rdi + 0 + 4*64]
+sha256_mine_x8_avx2_const_loop:
+vpbroadcastd ymm8, [r13 + 4*0]
+vpslld ymm15, ymm4, (32-((11-6)))
+vpsrld ymm12, ymm4, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm5, ymm6
+vpand ymm14, ymm14, ymm4
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm4, (32-(25))
+vpsrld ymm13, ymm4, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm4
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm7, ymm7, ymm14
+vpslld ymm15, ymm0, (32-((13-2)))
+vpsrld ymm14, ymm0, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm7, ymm7, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm0, (32-(22))
+vpsrld ymm13, ymm0, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm0, ymm2
+add rbx, 8*4
+vpand ymm8, ymm8, ymm1
+vpaddd ymm7, ymm7, ymm12
+vpaddd ymm3, ymm3, ymm7
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm0, ymm2
+vpor ymm13, ymm13, ymm8
+vpaddd ymm7, ymm7, ymm13
+vpaddd ymm7, ymm7, ymm14
+vpbroadcastd ymm8, [r13 + 4*1]
+vpslld ymm15, ymm3, (32-((11-6)))
+vpsrld ymm12, ymm3, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm4, ymm5
+vpand ymm14, ymm14, ymm3
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm3, (32-(25))
+vpsrld ymm13, ymm3, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm3
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm6, ymm6, ymm14
+vpslld ymm15, ymm7, (32-((13-2)))
+vpsrld ymm14, ymm7, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm6, ymm6, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm7, (32-(22))
+vpsrld ymm13, ymm7, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm7, ymm1
+add rbx, 8*4
+vpand ymm8, ymm8, ymm0
+vpaddd ymm6, ymm6, ymm12
+vpaddd ymm2, ymm2, ymm6
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm7, ymm1
+vpor ymm13, ymm13, ymm8
+vpaddd ymm6, ymm6, ymm13
+vpaddd ymm6, ymm6, ymm14
+vpbroadcastd ymm8, [r13 + 4*2]
+vpslld ymm15, ymm2, (32-((11-6)))
+vpsrld ymm12, ymm2, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm3, ymm4
+vpand ymm14, ymm14, ymm2
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm2, (32-(25))
+vpsrld ymm13, ymm2, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm2
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm5, ymm5, ymm14
+vpslld ymm15, ymm6, (32-((13-2)))
+vpsrld ymm14, ymm6, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm5, ymm5, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm6, (32-(22))
+vpsrld ymm13, ymm6, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm6, ymm0
+add rbx, 8*4
+vpand ymm8, ymm8, ymm7
+vpaddd ymm5, ymm5, ymm12
+vpaddd ymm1, ymm1, ymm5
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm6, ymm0
+vpor ymm13, ymm13, ymm8
+vpaddd ymm5, ymm5, ymm13
+vpaddd ymm5, ymm5, ymm14
+vpbroadcastd ymm8, [r13 + 4*3]
+vpslld ymm15, ymm1, (32-((11-6)))
+vpsrld ymm12, ymm1, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm2, ymm3
+vpand ymm14, ymm14, ymm1
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm1, (32-(25))
+vpsrld ymm13, ymm1, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm1
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm4, ymm4, ymm14
+vpslld ymm15, ymm5, (32-((13-2)))
+vpsrld ymm14, ymm5, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm4, ymm4, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm5, (32-(22))
+vpsrld ymm13, ymm5, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm5, ymm7
+add rbx, 8*4
+vpand ymm8, ymm8, ymm6
+vpaddd ymm4, ymm4, ymm12
+vpaddd ymm0, ymm0, ymm4
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm5, ymm7
+vpor ymm13, ymm13, ymm8
+vpaddd ymm4, ymm4, ymm13
+vpaddd ymm4, ymm4, ymm14
+vpbroadcastd ymm8, [r13 + 4*4]
+vpslld ymm15, ymm0, (32-((11-6)))
+vpsrld ymm12, ymm0, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm1, ymm2
+vpand ymm14, ymm14, ymm0
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm0, (32-(25))
+vpsrld ymm13, ymm0, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm0
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm3, ymm3, ymm14
+vpslld ymm15, ymm4, (32-((13-2)))
+vpsrld ymm14, ymm4, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm3, ymm3, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm4, (32-(22))
+vpsrld ymm13, ymm4, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm4, ymm6
+add rbx, 8*4
+vpand ymm8, ymm8, ymm5
+vpaddd ymm3, ymm3, ymm12
+vpaddd ymm7, ymm7, ymm3
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm4, ymm6
+vpor ymm13, ymm13, ymm8
+vpaddd ymm3, ymm3, ymm13
+vpaddd ymm3, ymm3, ymm14
+vpbroadcastd ymm8, [r13 + 4*5]
+vpslld ymm15, ymm7, (32-((11-6)))
+vpsrld ymm12, ymm7, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm0, ymm1
+vpand ymm14, ymm14, ymm7
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm7, (32-(25))
+vpsrld ymm13, ymm7, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm7
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm2, ymm2, ymm14
+vpslld ymm15, ymm3, (32-((13-2)))
+vpsrld ymm14, ymm3, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm2, ymm2, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm3, (32-(22))
+vpsrld ymm13, ymm3, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm3, ymm5
+add rbx, 8*4
+vpand ymm8, ymm8, ymm4
+vpaddd ymm2, ymm2, ymm12
+vpaddd ymm6, ymm6, ymm2
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm3, ymm5
+vpor ymm13, ymm13, ymm8
+vpaddd ymm2, ymm2, ymm13
+vpaddd ymm2, ymm2, ymm14
+vpbroadcastd ymm8, [r13 + 4*6]
+vpslld ymm15, ymm6, (32-((11-6)))
+vpsrld ymm12, ymm6, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm7, ymm0
+vpand ymm14, ymm14, ymm6
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm6, (32-(25))
+vpsrld ymm13, ymm6, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm6
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm1, ymm1, ymm14
+vpslld ymm15, ymm2, (32-((13-2)))
+vpsrld ymm14, ymm2, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm1, ymm1, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm2, (32-(22))
+vpsrld ymm13, ymm2, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm2, ymm4
+add rbx, 8*4
+vpand ymm8, ymm8, ymm3
+vpaddd ymm1, ymm1, ymm12
+vpaddd ymm5, ymm5, ymm1
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm2, ymm4
+vpor ymm13, ymm13, ymm8
+vpaddd ymm1, ymm1, ymm13
+vpaddd ymm1, ymm1, ymm14
+vpbroadcastd ymm8, [r13 + 4*7]
+vpslld ymm15, ymm5, (32-((11-6)))
+vpsrld ymm12, ymm5, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm6, ymm7
+vpand ymm14, ymm14, ymm5
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm5, (32-(25))
+vpsrld ymm13, ymm5, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm5
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm0, ymm0, ymm14
+vpslld ymm15, ymm1, (32-((13-2)))
+vpsrld ymm14, ymm1, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm0, ymm0, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm1, (32-(22))
+vpsrld ymm13, ymm1, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm1, ymm3
+add rbx, 8*4
+vpand ymm8, ymm8, ymm2
+vpaddd ymm0, ymm0, ymm12
+vpaddd ymm4, ymm4, ymm0
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm1, ymm3
+vpor ymm13, ymm13, ymm8
+vpaddd ymm0, ymm0, ymm13
+vpaddd ymm0, ymm0, ymm14
+vpbroadcastd ymm8, [r13 + 4*8]
+vpslld ymm15, ymm4, (32-((11-6)))
+vpsrld ymm12, ymm4, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm5, ymm6
+vpand ymm14, ymm14, ymm4
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm4, (32-(25))
+vpsrld ymm13, ymm4, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm4
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm7, ymm7, ymm14
+vpslld ymm15, ymm0, (32-((13-2)))
+vpsrld ymm14, ymm0, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm7, ymm7, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm0, (32-(22))
+vpsrld ymm13, ymm0, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm0, ymm2
+add rbx, 8*4
+vpand ymm8, ymm8, ymm1
+vpaddd ymm7, ymm7, ymm12
+vpaddd ymm3, ymm3, ymm7
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm0, ymm2
+vpor ymm13, ymm13, ymm8
+vpaddd ymm7, ymm7, ymm13
+vpaddd ymm7, ymm7, ymm14
+vpbroadcastd ymm8, [r13 + 4*9]
+vpslld ymm15, ymm3, (32-((11-6)))
+vpsrld ymm12, ymm3, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm4, ymm5
+vpand ymm14, ymm14, ymm3
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm3, (32-(25))
+vpsrld ymm13, ymm3, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm3
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm6, ymm6, ymm14
+vpslld ymm15, ymm7, (32-((13-2)))
+vpsrld ymm14, ymm7, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm6, ymm6, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm7, (32-(22))
+vpsrld ymm13, ymm7, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm7, ymm1
+add rbx, 8*4
+vpand ymm8, ymm8, ymm0
+vpaddd ymm6, ymm6, ymm12
+vpaddd ymm2, ymm2, ymm6
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm7, ymm1
+vpor ymm13, ymm13, ymm8
+vpaddd ymm6, ymm6, ymm13
+vpaddd ymm6, ymm6, ymm14
+vpbroadcastd ymm8, [r13 + 4*10]
+vpslld ymm15, ymm2, (32-((11-6)))
+vpsrld ymm12, ymm2, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm3, ymm4
+vpand ymm14, ymm14, ymm2
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm2, (32-(25))
+vpsrld ymm13, ymm2, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm2
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm5, ymm5, ymm14
+vpslld ymm15, ymm6, (32-((13-2)))
+vpsrld ymm14, ymm6, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm5, ymm5, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm6, (32-(22))
+vpsrld ymm13, ymm6, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm6, ymm0
+add rbx, 8*4
+vpand ymm8, ymm8, ymm7
+vpaddd ymm5, ymm5, ymm12
+vpaddd ymm1, ymm1, ymm5
+vpxor ymm14, ymm14, ymm6
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm6, ymm0
+vpor ymm13, ymm13, ymm8
+vpaddd ymm5, ymm5, ymm13
+vpaddd ymm5, ymm5, ymm14
+vpbroadcastd ymm8, [r13 + 4*11]
+vpslld ymm15, ymm1, (32-((11-6)))
+vpsrld ymm12, ymm1, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm2, ymm3
+vpand ymm14, ymm14, ymm1
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm1, (32-(25))
+vpsrld ymm13, ymm1, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm1
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm4, ymm4, ymm14
+vpslld ymm15, ymm5, (32-((13-2)))
+vpsrld ymm14, ymm5, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm4, ymm4, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm5, (32-(22))
+vpsrld ymm13, ymm5, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm5, ymm7
+add rbx, 8*4
+vpand ymm8, ymm8, ymm6
+vpaddd ymm4, ymm4, ymm12
+vpaddd ymm0, ymm0, ymm4
+vpxor ymm14, ymm14, ymm5
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm5, ymm7
+vpor ymm13, ymm13, ymm8
+vpaddd ymm4, ymm4, ymm13
+vpaddd ymm4, ymm4, ymm14
+vpbroadcastd ymm8, [r13 + 4*12]
+vpslld ymm15, ymm0, (32-((11-6)))
+vpsrld ymm12, ymm0, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm1, ymm2
+vpand ymm14, ymm14, ymm0
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm0, (32-(25))
+vpsrld ymm13, ymm0, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm0
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm3, ymm3, ymm14
+vpslld ymm15, ymm4, (32-((13-2)))
+vpsrld ymm14, ymm4, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm3, ymm3, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm4, (32-(22))
+vpsrld ymm13, ymm4, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm4, ymm6
+add rbx, 8*4
+vpand ymm8, ymm8, ymm5
+vpaddd ymm3, ymm3, ymm12
+vpaddd ymm7, ymm7, ymm3
+vpxor ymm14, ymm14, ymm4
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm4, ymm6
+vpor ymm13, ymm13, ymm8
+vpaddd ymm3, ymm3, ymm13
+vpaddd ymm3, ymm3, ymm14
+vpbroadcastd ymm8, [r13 + 4*13]
+vpslld ymm15, ymm7, (32-((11-6)))
+vpsrld ymm12, ymm7, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm0, ymm1
+vpand ymm14, ymm14, ymm7
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm7, (32-(25))
+vpsrld ymm13, ymm7, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm7
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm2, ymm2, ymm14
+vpslld ymm15, ymm3, (32-((13-2)))
+vpsrld ymm14, ymm3, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm2, ymm2, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm3, (32-(22))
+vpsrld ymm13, ymm3, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm3, ymm5
+add rbx, 8*4
+vpand ymm8, ymm8, ymm4
+vpaddd ymm2, ymm2, ymm12
+vpaddd ymm6, ymm6, ymm2
+vpxor ymm14, ymm14, ymm3
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm3, ymm5
+vpor ymm13, ymm13, ymm8
+vpaddd ymm2, ymm2, ymm13
+vpaddd ymm2, ymm2, ymm14
+vpbroadcastd ymm8, [r13 + 4*14]
+vpslld ymm15, ymm6, (32-((11-6)))
+vpsrld ymm12, ymm6, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm7, ymm0
+vpand ymm14, ymm14, ymm6
+vpxor ymm14, ymm14, ymm0
+vpslld ymm15, ymm6, (32-(25))
+vpsrld ymm13, ymm6, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm6
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm1, ymm1, ymm14
+vpslld ymm15, ymm2, (32-((13-2)))
+vpsrld ymm14, ymm2, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm1, ymm1, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm2, (32-(22))
+vpsrld ymm13, ymm2, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm2, ymm4
+add rbx, 8*4
+vpand ymm8, ymm8, ymm3
+vpaddd ymm1, ymm1, ymm12
+vpaddd ymm5, ymm5, ymm1
+vpxor ymm14, ymm14, ymm2
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm2, ymm4
+vpor ymm13, ymm13, ymm8
+vpaddd ymm1, ymm1, ymm13
+vpaddd ymm1, ymm1, ymm14
+vpbroadcastd ymm8, [r13 + 4*15]
+vpslld ymm15, ymm5, (32-((11-6)))
+vpsrld ymm12, ymm5, (11-6)
+vpor ymm12, ymm12, ymm15
+vpxor ymm14, ymm6, ymm7
+vpand ymm14, ymm14, ymm5
+vpxor ymm14, ymm14, ymm7
+vpslld ymm15, ymm5, (32-(25))
+vpsrld ymm13, ymm5, 25
+vpor ymm13, ymm13, ymm15
+vpxor ymm12, ymm12, ymm5
+vpslld ymm15, ymm12, (32-(6))
+vpsrld ymm12, ymm12, 6
+vpor ymm12, ymm12, ymm15
+vpaddd ymm0, ymm0, ymm14
+vpslld ymm15, ymm1, (32-((13-2)))
+vpsrld ymm14, ymm1, (13-2)
+vpor ymm14, ymm14, ymm15
+vpaddd ymm0, ymm0, ymm8
+vpxor ymm12, ymm12, ymm13
+vpslld ymm15, ymm1, (32-(22))
+vpsrld ymm13, ymm1, 22
+vpor ymm13, ymm13, ymm15
+vpxor ymm8, ymm1, ymm3
+add rbx, 8*4
+vpand ymm8, ymm8, ymm2
+vpaddd ymm0, ymm0, ymm12
+vpaddd ymm4, ymm4, ymm0
+vpxor ymm14, ymm14, ymm1
+vpslld ymm15, ymm14, (32-(2))
+vpsrld ymm14, ymm14, 2
+vpor ymm14, ymm14, ymm15
+vpxor ymm14, ymm14, ymm13
+vpand ymm13, ymm1, ymm3
+vpor ymm13, ymm13, ymm8
+vpaddd ymm0, ymm0, ymm13
+vpaddd ymm0, ymm0, ymm14
+add r13, 4*16
+cmp r13, r14
+jb sha256_mine_x8_avx2_const_loop
+sha256_mine_x8_avx2_last_block:
+cmp qword ptr [rsp + 1920], 0
+jne sha256_mine_x8_avx2_second_hash
+vpaddd ymm0, ymm0, [rsp + 512 + 0*8*4]
+vpbroadcastd ymm15, [rdi + 456]
+vpminud ymm15, ymm15, ymm0
+vpcmpeqd ymm15, ymm15, ymm0
+vmovmskps eax, ymm15
+sub r10, 1
+test eax, eax
+jnz sha256_mine_x8_avx2_done
+test r10, r10
+jnz sha256_mine_x8_avx2_batch_loop
+jmp sha256_mine_x8_avx2_done
+sha256_mine_x8_avx2_second_hash:
+mov qword ptr [rsp + 1920], 0
+vpaddd ymm0, ymm0, [rsp + 512 + 0*8*4]
+vpaddd ymm1, ymm1, [rsp + 512 + 1*8*4]
+vpaddd ymm2, ymm2, [rsp + 512 + 2*8*4]
+vpaddd ymm3, ymm3, [rsp + 512 + 3*8*4]
+vpaddd ymm4, ymm4, [rsp + 512 + 4*8*4]
+vpaddd ymm5, ymm5, [rsp + 512 + 5*8*4]
+vpaddd ymm6, ymm6, [rsp + 512 + 6*8*4]
+vpaddd ymm7, ymm7, [rsp + 512 + 7*8*4]
+vmovdqa [8*4*0 + rsp], ymm0
+vmovdqa [8*4*1 + rsp], ymm1
+vmovdqa [8*4*2 + rsp], ymm2
+vmovdqa [8*4*3 + rsp], ymm3
+vmovdqa [8*4*4 + rsp], ymm4
+vmovdqa [8*4*5 + rsp], ymm5
+vmovdqa [8*4*6 + rsp], ymm6
+vmovdqa [8*4*7 + rsp], ymm7
+vpbroadcastd ymm15, [rip + SHA256D_PAD + 0*4]
+vmovdqa [8*4*(8+0) + rsp], ymm15
+vpbroadcastd ymm15, [rip + SHA256_IV + 0*4]
+vmovdqa [rsp + 512 + 0*8*4], ymm15
+vpbroadcastd ymm15, [rip + SHA256D_PAD + 1*4]
+vmovdqa [8*4*(8+1) + rsp], ymm15
+vpbroadcastd ymm15, [rip + SHA256_IV + 1*4]
+vmovdqa [rsp + 512 + 1*8*4], ymm15
+vpbroadcastd ymm15, [rip + SHA256D_PAD + 2*4]
+vmovdqa [8*4*(8+2) + rsp], ymm15
+vpbroadcastd ymm15, [rip + SHA256_IV + 2*4]
+vmovdqa [rsp + 512 + 2*8*4], ymm15
+vpbroadcastd ymm15, [rip + SHA256D_PAD + 3*4]
+vmovdqa [8*4*(8+3) + rsp], ymm15
+vpbroadcastd ymm15, [rip + SHA256_IV + 3*4]
+vmovdqa [rsp + 512 + 3*8*4], ymm15
+vpbroadcastd ymm15, [rip + SHA256D_PAD + 4*4]
+vmovdqa [8*4*(8+4) + rsp], ymm15
+vpbroadcastd ymm15, [rip + SHA256_IV + 4*4]
+vmovdqa [rsp + 512 + 4*8*4], ymm15
+vpbroadcastd ymm15, [rip + SHA256D_PAD + 5*4]
+vmovdqa [8*4*(8+5) + rsp], ymm15
+vpbroadcastd ymm15, [rip + SHA256_IV + 5*4]
+vmovdqa [rsp + 512 + 5*8*4], ymm15
+vpbroadcastd ymm15, [rip + SHA256D_PAD + 6*4]
+vmovdqa [8*4*(8+6) + rsp], ymm15
+vpbroadcastd ymm15, [rip + SHA256_IV + 6*4]
+vmovdqa [rsp + 512 + 6*8*4], ymm15
+vpbroadcastd ymm15, [rip + SHA256D_PAD + 7*4]
+vmovdqa [8*4*(8+7) + rsp], ymm15
+vpbroadcastd ymm15, [rip + SHA256_IV + 7*4]
+vmovdqa [rsp + 512 + 7*8*4], ymm15
+vpbroadcastd ymm0, [rip + SHA256_IV + 0*4]
+vpbroadcastd ymm1, [rip + SHA256_IV + 1*4]
+vpbroadcastd ymm2, [rip + SHA256_IV + 2*4]
+vpbroadcastd ymm3, [rip + SHA256_IV + 3*4]
+vpbroadcastd ymm4, [rip + SHA256_IV + 4*4]
+vpbroadcastd ymm5, [rip + SHA256_IV + 5*4]
+vpbroadcastd ymm6, [rip + SHA256_IV + 6*4]
+vpbroadcastd ymm7, [rip + SHA256_IV + 7*4]
+mov r9, 1
+xor rbx, rbx
+jmp sha256_mine_x8_avx2_round_0
+sha256_mine_x8_avx2_done:
+mov [rsi + 8], r10
+mov r15, [rsp + 1792]
+mov [rsi + 0], r15
+sub r15, [rsi + 24]
+mov [rsi + 16], r15
+mov rsp, [rsp + 1928]
+ret
+sha256_mine_x8_avx2_enter_1:
+vpbroadcastd ymm7, [rdi + 416 + 0*4]
+vpbroadcastd ymm0, [rdi + 416 + 1*4]
+vpbroadcastd ymm1, [rdi + 416 + 2*4]
+vpbroadcastd ymm2, [rdi + 416 + 3*4]
+vpbroadcastd ymm3, [rdi + 416 + 4*4]
+vpbroadcastd ymm4, [rdi + 416 + 5*4]
+vpbroadcastd ymm5, [rdi + 416 + 6*4]
+vpbroadcastd ymm6, [rdi + 416 + 7*4]
+mov rbx, 1*8*4
+jmp sha256_mine_x8_avx2_round_1
+sha256_mine_x8_avx2_enter_2:
+vpbroadcastd ymm6, [rdi + 416 + 0*4]
+vpbroadcastd ymm7, [rdi + 416 + 1*4]
+vpbroadcastd ymm0, [rdi + 416 + 2*4]
+vpbroadcastd ymm1, [rdi + 416 + 3*4]
+vpbroadcastd ymm2, [rdi + 416 + 4*4]
+vpbroadcastd ymm3, [rdi + 416 + 5*4]
+vpbroadcastd ymm4, [rdi + 416 + 6*4]
+vpbroadcastd ymm5, [rdi + 416 + 7*4]
+mov rbx, 2*8*4
+jmp sha256_mine_x8_avx2_round_2
+sha256_mine_x8_avx2_enter_3:
+vpbroadcastd ymm5, [rdi + 416 + 0*4]
+vpbroadcastd ymm6, [rdi + 416 + 1*4]
+vpbroadcastd ymm7, [rdi + 416 + 2*4]
+vpbroadcastd ymm0, [rdi + 416 + 3*4]
+vpbroadcastd ymm1, [rdi + 416 + 4*4]
+vpbroadcastd ymm2, [rdi + 416 + 5*4]
+vpbroadcastd ymm3, [rdi + 416 + 6*4]
+vpbroadcastd ymm4, [rdi + 416 + 7*4]
+mov rbx, 3*8*4
+jmp sha256_mine_x8_avx2_round_3
+sha256_mine_x8_avx2_enter_4:
+vpbroadcastd ymm4, [rdi + 416 + 0*4]
+vpbroadcastd ymm5, [rdi + 416 + 1*4]
+vpbroadcastd ymm6, [rdi + 416 + 2*4]
+vpbroadcastd ymm7, [rdi + 416 + 3*4]
+vpbroadcastd ymm0, [rdi + 416 + 4*4]
+vpbroadcastd ymm1, [rdi + 416 + 5*4]
+vpbroadcastd ymm2, [rdi + 416 + 6*4]
+vpbroadcastd ymm3, [rdi + 416 + 7*4]
+mov rbx, 4*8*4
+jmp sha256_mine_x8_avx2_round_4
+sha256_mine_x8_avx2_enter_5:
+vpbroadcastd ymm3, [rdi + 416 + 0*4]
+vpbroadcastd ymm4, [rdi + 416 + 1*4]
+vpbroadcastd ymm5, [rdi + 416 + 2*4]
+vpbroadcastd ymm6, [rdi + 416 + 3*4]
+vpbroadcastd ymm7, [rdi + 416 + 4*4]
+vpbroadcastd ymm0, [rdi + 416 + 5*4]
+vpbroadcastd ymm1, [rdi + 416 + 6*4]
+vpbroadcastd ymm2, [rdi + 416 + 7*4]
+mov rbx, 5*8*4
+jmp sha256_mine_x8_avx2_round_5
+sha256_mine_x8_avx2_enter_6:
+vpbroadcastd ymm2, [rdi + 416 + 0*4]
+vpbroadcastd ymm3, [rdi + 416 + 1*4]
+vpbroadcastd ymm4, [rdi + 416 + 2*4]
+vpbroadcastd ymm5, [rdi + 416 + 3*4]
+vpbroadcastd ymm6, [rdi + 416 + 4*4]
+vpbroadcastd ymm7, [rdi + 416 + 5*4]
+vpbroadcastd ymm0, [rdi + 416 + 6*4]
+vpbroadcastd ymm1, [rdi + 416 + 7*4]
+mov rbx, 6*8*4
+jmp sha256_mine_x8_avx2_round_6
+sha256_mine_x8_avx2_enter_7:
+vpbroadcastd ymm1, [rdi + 416 + 0*4]
+vpbroadcastd ymm2, [rdi + 416 + 1*4]
+vpbroadcastd ymm3, [rdi + 416 + 2*4]
+vpbroadcastd ymm4, [rdi + 416 + 3*4]
+vpbroadcastd ymm5, [rdi + 416 + 4*4]
+vpbroadcastd ymm6, [rdi + 416 + 5*4]
+vpbroadcastd ymm7, [rdi + 416 + 6*4]
+vpbroadcastd ymm0, [rdi + 416 + 7*4]
+mov rbx, 7*8*4
+jmp sha256_mine_x8_avx2_round_7
+sha256_mine_x8_avx2_enter_8:
+vpbroadcastd ymm0, [rdi + 416 + 0*4]
+vpbroadcastd ymm1, [rdi + 416 + 1*4]
+vpbroadcastd ymm2, [rdi + 416 + 2*4]
+vpbroadcastd ymm3, [rdi + 416 + 3*4]
+vpbroadcastd ymm4, [rdi + 416 + 4*4]
+vpbroadcastd ymm5, [rdi + 416 + 5*4]
+vpbroadcastd ymm6, [rdi + 416 + 6*4]
+vpbroadcastd ymm7, [rdi + 416 + 7*4]
+mov rbx, 8*8*4
+jmp sha256_mine_x8_avx2_round_8
+sha256_mine_x8_avx2_enter_9:
+vpbroadcastd ymm7, [rdi + 416 + 0*4]
+vpbroadcastd ymm0, [rdi + 416 + 1*4]
+vpbroadcastd ymm1, [rdi + 416 + 2*4]
+vpbroadcastd ymm2, [rdi + 416 + 3*4]
+vpbroadcastd ymm3, [rdi + 416 + 4*4]
+vpbroadcastd ymm4, [rdi + 416 + 5*4]
+vpbroadcastd ymm5, [rdi + 416 + 6*4]
+vpbroadcastd ymm6, [rdi + 416 + 7*4]
+mov rbx, 9*8*4
+jmp sha256_mine_x8_avx2_round_9
+sha256_mine_x8_avx2_enter_10:
+vpbroadcastd ymm6, [rdi + 416 + 0*4]
+vpbroadcastd ymm7, [rdi + 416 + 1*4]
+vpbroadcastd ymm0, [rdi + 416 + 2*4]
+vpbroadcastd ymm1, [rdi + 416 + 3*4]
+vpbroadcastd ymm2, [rdi + 416 + 4*4]
+vpbroadcastd ymm3, [rdi + 416 + 5*4]
+vpbroadcastd ymm4, [rdi + 416 + 6*4]
+vpbroadcastd ymm5, [rdi + 416 + 7*4]
+mov rbx, 10*8*4
+jmp sha256_mine_x8_avx2_round_10
+sha256_mine_x8_avx2_enter_11:
+vpbroadcastd ymm5, [rdi + 416 + 0*4]
+vpbroadcastd ymm6, [rdi + 416 + 1*4]
+vpbroadcastd ymm7, [rdi + 416 + 2*4]
+vpbroadcastd ymm0, [rdi + 416 + 3*4]
+vpbroadcastd ymm1, [rdi + 416 + 4*4]
+vpbroadcastd ymm2, [rdi + 416 + 5*4]
+vpbroadcastd ymm3, [rdi + 416 + 6*4]
+vpbroadcastd ymm4, [rdi + 416 + 7*4]
+mov rbx, 11*8*4
+jmp sha256_mine_x8_avx2_round_11
+sha256_mine_x8_avx2_enter_12:
+vpbroadcastd ymm4, [rdi + 416 + 0*4]
+vpbroadcastd ymm5, [rdi + 416 + 1*4]
+vpbroadcastd ymm6, [rdi + 416 + 2*4]
+vpbroadcastd ymm7, [rdi + 416 + 3*4]
+vpbroadcastd ymm0, [rdi + 416 + 4*4]
+vpbroadcastd ymm1, [rdi + 416 + 5*4]
+vpbroadcastd ymm2, [rdi + 416 + 6*4]
+vpbroadcastd ymm3, [rdi + 416 + 7*4]
+mov rbx, 12*8*4
+jmp sha256_mine_x8_avx2_round_12
+sha256_mine_x8_avx2_enter_13:
+vpbroadcastd ymm3, [rdi + 416 + 0*4]
+vpbroadcastd ymm4, [rdi + 416 + 1*4]
+vpbroadcastd ymm5, [rdi + 416 + 2*4]
+vpbroadcastd ymm6, [rdi + 416 + 3*4]
+vpbroadcastd ymm7, [rdi + 416 + 4*4]
+vpbroadcastd ymm0, [rdi + 416 + 5*4]
+vpbroadcastd ymm1, [rdi + 416 + 6*4]
+vpbroadcastd ymm2, [rdi + 416 + 7*4]
+mov rbx, 13*8*4
+jmp sha256_mine_x8_avx2_round_13
+sha256_mine_x8_avx2_enter_14:
+vpbroadcastd ymm2, [rdi + 416 + 0*4]
+vpbroadcastd ymm3, [rdi + 416 + 1*4]
+vpbroadcastd ymm4, [rdi + 416 + 2*4]
+vpbroadcastd ymm5, [rdi + 416 + 3*4]
+vpbroadcastd ymm6, [rdi + 416 + 4*4]
+vpbroadcastd ymm7, [rdi + 416 + 5*4]
+vpbroadcastd ymm0, [rdi + 416 + 6*4]
+vpbroadcastd ymm1, [rdi + 416 + 7*4]
+mov rbx, 14*8*4
+jmp sha256_mine_x8_avx2_round_14
+sha256_mine_x8_avx2_enter_15:
+vpbroadcastd ymm1, [rdi + 416 + 0*4]
+vpbroadcastd ymm2, [rdi + 416 + 1*4]
+vpbroadcastd ymm3, [rdi + 416 + 2*4]
+vpbroadcastd ymm4, [rdi + 416 + 3*4]
+vpbroadcastd ymm5, [rdi + 416 + 4*4]
+vpbroadcastd ymm6, [rdi + 416 + 5*4]
+vpbroadcastd ymm7, [rdi + 416 + 6*4]
+vpbroadcastd ymm0, [rdi + 416 + 7*4]
+mov rbx, 15*8*4
+jmp sha256_mine_x8_avx2_round_15
+.section .data
+.balign 64
+K256_8_MB:
+.quad 0x428a2f98428a2f98, 0x428a2f98428a2f98
+.quad 0x428a2f98428a2f98, 0x428a2f98428a2f98
+.quad 0x7137449171374491, 0x7137449171374491
+.quad 0x7137449171374491, 0x7137449171374491
+.quad 0xb5c0fbcfb5c0fbcf, 0xb5c0fbcfb5c0fbcf
+.quad 0xb5c0fbcfb5c0fbcf, 0xb5c0fbcfb5c0fbcf
+.quad 0xe9b5dba5e9b5dba5, 0xe9b5dba5e9b5dba5
+.quad 0xe9b5dba5e9b5dba5, 0xe9b5dba5e9b5dba5
+.quad 0x3956c25b3956c25b, 0x3956c25b3956c25b
+.quad 0x3956c25b3956c25b, 0x3956c25b3956c25b
+.quad 0x59f111f159f111f1, 0x59f111f159f111f1
+.quad 0x59f111f159f111f1, 0x59f111f159f111f1
+.quad 0x923f82a4923f82a4, 0x923f82a4923f82a4
+.quad 0x923f82a4923f82a4, 0x923f82a4923f82a4
+.quad 0xab1c5ed5ab1c5ed5, 0xab1c5ed5ab1c5ed5
+.quad 0xab1c5ed5ab1c5ed5, 0xab1c5ed5ab1c5ed5
+.quad 0xd807aa98d807aa98, 0xd807aa98d807aa98
+.quad 0xd807aa98d807aa98, 0xd807aa98d807aa98
+.quad 0x12835b0112835b01, 0x12835b0112835b01
+.quad 0x12835b0112835b01, 0x12835b0112835b01
+.quad 0x243185be243185be, 0x243185be243185be
+.quad 0x243185be243185be, 0x243185be243185be
+.quad 0x550c7dc3550c7dc3, 0x550c7dc3550c7dc3
+.quad 0x550c7dc3550c7dc3, 0x550c7dc3550c7dc3
+.quad 0x72be5d7472be5d74, 0x72be5d7472be5d74
+.quad 0x72be5d7472be5d74, 0x72be5d7472be5d74
+.quad 0x80deb1fe80deb1fe, 0x80deb1fe80deb1fe
+.quad 0x80deb1fe80deb1fe, 0x80deb1fe80deb1fe
+.quad 0x9bdc06a79bdc06a7, 0x9bdc06a79bdc06a7
+.quad 0x9bdc06a79bdc06a7, 0x9bdc06a79bdc06a7
+.quad 0xc19bf174c19bf174, 0xc19bf174c19bf174
+.quad 0xc19bf174c19bf174, 0xc19bf174c19bf174
+.quad 0xe49b69c1e49b69c1, 0xe49b69c1e49b69c1
+.quad 0xe49b69c1e49b69c1, 0xe49b69c1e49b69c1
+.quad 0xefbe4786efbe4786, 0xefbe4786efbe4786
+.quad 0xefbe4786efbe4786, 0xefbe4786efbe4786
+.quad 0x0fc19dc60fc19dc6, 0x0fc19dc60fc19dc6
+.quad 0x0fc19dc60fc19dc6, 0x0fc19dc60fc19dc6
+.quad 0x240ca1cc240ca1cc, 0x240ca1cc240ca1cc
+.quad 0x240ca1cc240ca1cc, 0x240ca1cc240ca1cc
+.quad 0x2de92c6f2de92c6f, 0x2de92c6f2de92c6f
+.quad 0x2de92c6f2de92c6f, 0x2de92c6f2de92c6f
+.quad 0x4a7484aa4a7484aa, 0x4a7484aa4a7484aa
+.quad 0x4a7484aa4a7484aa, 0x4a7484aa4a7484aa
+.quad 0x5cb0a9dc5cb0a9dc, 0x5cb0a9dc5cb0a9dc
+.quad 0x5cb0a9dc5cb0a9dc, 0x5cb0a9dc5cb0a9dc
+.quad 0x76f988da76f988da, 0x76f988da76f988da
+.quad 0x76f988da76f988da, 0x76f988da76f988da
+.quad 0x983e5152983e5152, 0x983e5152983e5152
+.quad 0x983e5152983e5152, 0x983e5152983e5152
+.quad 0xa831c66da831c66d, 0xa831c66da831c66d
+.quad 0xa831c66da831c66d, 0xa831c66da831c66d
+.quad 0xb00327c8b00327c8, 0xb00327c8b00327c8
+.quad 0xb00327c8b00327c8, 0xb00327c8b00327c8
+.quad 0xbf597fc7bf597fc7, 0xbf597fc7bf597fc7
+.quad 0xbf597fc7bf597fc7, 0xbf597fc7bf597fc7
+.quad 0xc6e00bf3c6e00bf3, 0xc6e00bf3c6e00bf3
+.quad 0xc6e00bf3c6e00bf3, 0xc6e00bf3c6e00bf3
+.quad 0xd5a79147d5a79147, 0xd5a79147d5a79147
+.quad 0xd5a79147d5a79147, 0xd5a79147d5a79147
+.quad 0x06ca635106ca6351, 0x06ca635106ca6351
+.quad 0x06ca635106ca6351, 0x06ca635106ca6351
+.quad 0x1429296714292967, 0x1429296714292967
+.quad 0x1429296714292967, 0x1429296714292967
+.quad 0x27b70a8527b70a85, 0x27b70a8527b70a85
+.quad 0x27b70a8527b70a85, 0x27b70a8527b70a85
+.quad 0x2e1b21382e1b2138, 0x2e1b21382e1b2138
+.quad 0x2e1b21382e1b2138, 0x2e1b21382e1b2138
+.quad 0x4d2c6dfc4d2c6dfc, 0x4d2c6dfc4d2c6dfc
+.quad 0x4d2c6dfc4d2c6dfc, 0x4d2c6dfc4d2c6dfc
+.quad 0x53380d1353380d13, 0x53380d1353380d13
+.quad 0x53380d1353380d13, 0x53380d1353380d13
+.quad 0x650a7354650a7354, 0x650a7354650a7354
+.quad 0x650a7354650a7354, 0x650a7354650a7354
+.quad 0x766a0abb766a0abb, 0x766a0abb766a0abb
+.quad 0x766a0abb766a0abb, 0x766a0abb766a0abb
+.quad 0x81c2c92e81c2c92e, 0x81c2c92e81c2c92e
+.quad 0x81c2c92e81c2c92e, 0x81c2c92e81c2c92e
+.quad 0x92722c8592722c85, 0x92722c8592722c85
+.quad 0x92722c8592722c85, 0x92722c8592722c85
+.quad 0xa2bfe8a1a2bfe8a1, 0xa2bfe8a1a2bfe8a1
+.quad 0xa2bfe8a1a2bfe8a1, 0xa2bfe8a1a2bfe8a1
+.quad 0xa81a664ba81a664b, 0xa81a664ba81a664b
+.quad 0xa81a664ba81a664b, 0xa81a664ba81a664b
+.quad 0xc24b8b70c24b8b70, 0xc24b8b70c24b8b70
+.quad 0xc24b8b70c24b8b70, 0xc24b8b70c24b8b70
+.quad 0xc76c51a3c76c51a3, 0xc76c51a3c76c51a3
+.quad 0xc76c51a3c76c51a3, 0xc76c51a3c76c51a3
+.quad 0xd192e819d192e819, 0xd192e819d192e819
+.quad 0xd192e819d192e819, 0xd192e819d192e819
+.quad 0xd6990624d6990624, 0xd6990624d6990624
+.quad 0xd6990624d6990624, 0xd6990624d6990624
+.quad 0xf40e3585f40e3585, 0xf40e3585f40e3585
+.quad 0xf40e3585f40e3585, 0xf40e3585f40e3585
+.quad 0x106aa070106aa070, 0x106aa070106aa070
+.quad 0x106aa070106aa070, 0x106aa070106aa070
+.quad 0x19a4c11619a4c116, 0x19a4c11619a4c116
+.quad 0x19a4c11619a4c116, 0x19a4c11619a4c116
+.quad 0x1e376c081e376c08, 0x1e376c081e376c08
+.quad 0x1e376c081e376c08, 0x1e376c081e376c08
+.quad 0x2748774c2748774c, 0x2748774c2748774c
+.quad 0x2748774c2748774c, 0x2748774c2748774c
+.quad 0x34b0bcb534b0bcb5, 0x34b0bcb534b0bcb5
+.quad 0x34b0bcb534b0bcb5, 0x34b0bcb534b0bcb5
+.quad 0x391c0cb3391c0cb3, 0x391c0cb3391c0cb3
+.quad 0x391c0cb3391c0cb3, 0x391c0cb3391c0cb3
+.quad 0x4ed8aa4a4ed8aa4a, 0x4ed8aa4a4ed8aa4a
+.quad 0x4ed8aa4a4ed8aa4a, 0x4ed8aa4a4ed8aa4a
+.quad 0x5b9cca4f5b9cca4f, 0x5b9cca4f5b9cca4f
+.quad 0x5b9cca4f5b9cca4f, 0x5b9cca4f5b9cca4f
+.quad 0x682e6ff3682e6ff3, 0x682e6ff3682e6ff3
+.quad 0x682e6ff3682e6ff3, 0x682e6ff3682e6ff3
+.quad 0x748f82ee748f82ee, 0x748f82ee748f82ee
+.quad 0x748f82ee748f82ee, 0x748f82ee748f82ee
+.quad 0x78a5636f78a5636f, 0x78a5636f78a5636f
+.quad 0x78a5636f78a5636f, 0x78a5636f78a5636f
+.quad 0x84c8781484c87814, 0x84c8781484c87814
+.quad 0x84c8781484c87814, 0x84c8781484c87814
+.quad 0x8cc702088cc70208, 0x8cc702088cc70208
+.quad 0x8cc702088cc70208, 0x8cc702088cc70208
+.quad 0x90befffa90befffa, 0x90befffa90befffa
+.quad 0x90befffa90befffa, 0x90befffa90befffa
+.quad 0xa4506ceba4506ceb, 0xa4506ceba4506ceb
+.quad 0xa4506ceba4506ceb, 0xa4506ceba4506ceb
+.quad 0xbef9a3f7bef9a3f7, 0xbef9a3f7bef9a3f7
+.quad 0xbef9a3f7bef9a3f7, 0xbef9a3f7bef9a3f7
+.quad 0xc67178f2c67178f2, 0xc67178f2c67178f2
+.quad 0xc67178f2c67178f2, 0xc67178f2c67178f2
+PSHUFFLE_BYTE_FLIP_MASK:
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
+NONCE_LANE_OFFSETS:
+.quad 0, 1, 2, 3, 4, 5, 6, 7
+SHA256_IV:
+.long 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a
+.long 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+SHA256D_PAD:
+.long 0x80000000, 0, 0, 0, 0, 0, 0, 256
@@ -0,0 +1,219 @@
+.intel_syntax noprefix
+.section .note.GNU-stack
+.section .text
+.section .text
+.balign 32
+.globl sha256_ni_x1
+sha256_ni_x1:
+.byte 0xf3, 0x0f, 0x1e, 0xfa
+shl rsi, 6
+jz backto_mgr
+mov r8, r10
+shr r10, 8
+and r8, 0xff
+lea r9, [rdi + 4*r8]
+pinsrd xmm1, [r9], 3
+pinsrd xmm1, [r9 + 1*r10], 2
+pinsrd xmm2, [r9 + 2*r10], 3
+lea r9, [r9 + 2*r10]
+pinsrd xmm2, [r9 + 1*r10], 2
+pinsrd xmm1, [r9 + 2*r10], 1
+pinsrd xmm2, [r9 + 4*r10], 1
+lea r9, [r9 + 1*r10]
+pinsrd xmm1, [r9 + 2*r10], 0
+pinsrd xmm2, [r9 + 4*r10], 0
+movdqa xmm8, [rip + PSHUFFLE_SHANI_MASK]
+lea rax, [rip + TABLE]
+mov r11, [rdi + 512 + r8*8]
+add rsi, r11
+lloop:
+movdqa xmm9, xmm1
+movdqa xmm10, xmm2
+movdqu xmm0, [r11 + 0*16]
+pshufb xmm0, xmm8
+movdqa xmm3, xmm0
+paddd xmm0, [rax + 0*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqu xmm0, [r11 + 1*16]
+pshufb xmm0, xmm8
+movdqa xmm4, xmm0
+paddd xmm0, [rax + 1*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm3, xmm4
+movdqu xmm0, [r11 + 2*16]
+pshufb xmm0, xmm8
+movdqa xmm5, xmm0
+paddd xmm0, [rax + 2*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm4, xmm5
+movdqu xmm0, [r11 + 3*16]
+pshufb xmm0, xmm8
+movdqa xmm6, xmm0
+paddd xmm0, [rax + 3*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm6
+palignr xmm7, xmm5, 4
+paddd xmm3, xmm7
+sha256msg2 xmm3, xmm6
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm5, xmm6
+movdqa xmm0, xmm3
+paddd xmm0, [rax + 4*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm3
+palignr xmm7, xmm6, 4
+paddd xmm4, xmm7
+sha256msg2 xmm4, xmm3
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm6, xmm3
+movdqa xmm0, xmm4
+paddd xmm0, [rax + 5*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm4
+palignr xmm7, xmm3, 4
+paddd xmm5, xmm7
+sha256msg2 xmm5, xmm4
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm3, xmm4
+movdqa xmm0, xmm5
+paddd xmm0, [rax + 6*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm5
+palignr xmm7, xmm4, 4
+paddd xmm6, xmm7
+sha256msg2 xmm6, xmm5
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm4, xmm5
+movdqa xmm0, xmm6
+paddd xmm0, [rax + 7*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm6
+palignr xmm7, xmm5, 4
+paddd xmm3, xmm7
+sha256msg2 xmm3, xmm6
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm5, xmm6
+movdqa xmm0, xmm3
+paddd xmm0, [rax + 8*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm3
+palignr xmm7, xmm6, 4
+paddd xmm4, xmm7
+sha256msg2 xmm4, xmm3
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm6, xmm3
+movdqa xmm0, xmm4
+paddd xmm0, [rax + 9*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm4
+palignr xmm7, xmm3, 4
+paddd xmm5, xmm7
+sha256msg2 xmm5, xmm4
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm3, xmm4
+movdqa xmm0, xmm5
+paddd xmm0, [rax + 10*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm5
+palignr xmm7, xmm4, 4
+paddd xmm6, xmm7
+sha256msg2 xmm6, xmm5
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm4, xmm5
+movdqa xmm0, xmm6
+paddd xmm0, [rax + 11*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm6
+palignr xmm7, xmm5, 4
+paddd xmm3, xmm7
+sha256msg2 xmm3, xmm6
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm5, xmm6
+movdqa xmm0, xmm3
+paddd xmm0, [rax + 12*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm3
+palignr xmm7, xmm6, 4
+paddd xmm4, xmm7
+sha256msg2 xmm4, xmm3
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+sha256msg1 xmm6, xmm3
+movdqa xmm0, xmm4
+paddd xmm0, [rax + 13*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm4
+palignr xmm7, xmm3, 4
+paddd xmm5, xmm7
+sha256msg2 xmm5, xmm4
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, xmm5
+paddd xmm0, [rax + 14*16]
+sha256rnds2 xmm2, xmm1, xmm0
+movdqa xmm7, xmm5
+palignr xmm7, xmm4, 4
+paddd xmm6, xmm7
+sha256msg2 xmm6, xmm5
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+movdqa xmm0, xmm6
+paddd xmm0, [rax + 15*16]
+sha256rnds2 xmm2, xmm1, xmm0
+pshufd xmm0, xmm0, 0x0E
+sha256rnds2 xmm1, xmm2, xmm0
+paddd xmm1, xmm9
+paddd xmm2, xmm10
+add r11, 64
+cmp r11, rsi
+jne lloop
+lea r9, [rdi + 4*r8]
+pextrd [r9], xmm1, 3
+pextrd [r9 + 1*r10], xmm1, 2
+pextrd [r9 + 2*r10], xmm2, 3
+lea r9, [r9 + 2*r10]
+pextrd [r9 + 1*r10], xmm2, 2
+pextrd [r9 + 2*r10], xmm1, 1
+pextrd [r9 + 4*r10], xmm2, 1
+lea r9, [r9 + 1*r10]
+pextrd [r9 + 2*r10], xmm1, 0
+pextrd [r9 + 4*r10], xmm2, 0
+mov [rdi + 512 + r8*8], r11
+backto_mgr:
+ret
+.section .data
+.balign 16
+PSHUFFLE_SHANI_MASK:
+.quad 0x0405060700010203, 0x0c0d0e0f08090a0b
+TABLE:
+.long 0x428a2f98,0x71374491,0xb5c0fbcf,0xe9b5dba5
+.long 0x3956c25b,0x59f111f1,0x923f82a4,0xab1c5ed5
+.long 0xd807aa98,0x12835b01,0x243185be,0x550c7dc3
+.long 0x72be5d74,0x80deb1fe,0x9bdc06a7,0xc19bf174
+.long 0xe49b69c1,0xefbe4786,0x0fc19dc6,0x240ca1cc
+.long 0x2de92c6f,0x4a7484aa,0x5cb0a9dc,0x76f988da
+.long 0x983e5152,0xa831c66d,0xb00327c8,0xbf597fc7
+.long 0xc6e00bf3,0xd5a79147,0x06ca6351,0x14292967
+.long 0x27b70a85,0x2e1b2138,0x4d2c6dfc,0x53380d13
+.long 0x650a7354,0x766a0abb,0x81c2c92e,0x92722c85
+.long 0xa2bfe8a1,0xa81a664b,0xc24b8b70,0xc76c51a3
+.long 0xd192e819,0xd6990624,0xf40e3585,0x106aa070
+.long 0x19a4c116,0x1e376c08,0x2748774c,0x34b0bcb5
+.long 0x391c0cb3,0x4ed8aa4a,0x5b9cca4f,0x682e6ff3
+.long 0x748f82ee,0x78a5636f,0x84c87814,0x8cc70208
+.long 0x90befffa,0xa4506ceb,0xbef9a3f7,0xc67178f2
@@ -0,0 +1,225 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+// benchmark of every hashing function, and of the mining path over the thread counts, built and run by 'make bench'
+// usage: mine_bench [csv_path] [seconds_per_run] [max_threads], the CSV goes to stdout without a path
+// every run is first checked against sha256_process (itself checked against a known answer), the exit code is 1 if one was wrong
+
+#include "pch.h"
+
+#include "mine_xcoin.h"
+#include "sha256_scalar.h"
+
+// initial state
+static const uint32_t SHA256_IV[DIGEST_NUM_WORDS] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+// all the vector functions use the same sized struct, see inside the file sha256_mb_wrapper.h
+struct alignas(64) BenchArgs {
+    uint32_t digest[DIGEST_NUM_WORDS * SHA256_MAX_LANES];   // transposed form, word w of lane j at w * lanes + j
+    uint8_t* data_ptr[SHA256_MAX_LANES];
+};
+
+// one hashing function, over lanes messages of the same number of blocks at a time
+struct BenchKernel {
+    const char* name;
+    SHA256_Acceleration needs;  // only run if this one is supported
+    int lanes;
+    void (*hash)(BenchArgs& args, uint64_t num_blocks);
+};
+
+static const BenchKernel kernels[] = {
+    { "sha256_mb_x16_avx512", SHA256_Acceleration::AVX512, 16,
+        [](BenchArgs& args, uint64_t num_blocks) { sha256_mb_x16_avx512_wrapper((SHA256_MB_ARGS_X16*)&args, num_blocks); } },
+    { "sha256_mb_x8_avx2", SHA256_Acceleration::AVX2, 8,
+        [](BenchArgs& args, uint64_t num_blocks) { sha256_mb_x8_avx2_wrapper((SHA256_MB_ARGS_X8*)&args, num_blocks); } },
+    { "sha256_mb_x8_avx512vl", SHA256_Acceleration::AVX512VL, 8,
+        [](BenchArgs& args, uint64_t num_blocks) { sha256_mb_x8_avx512vl_wrapper((SHA256_MB_ARGS_X8*)&args, num_blocks); } },
+    { "sha256_mb_x4_avx", SHA256_Acceleration::AVX, 4,
+        [](BenchArgs& args, uint64_t num_blocks) { sha256_mb_x4_avx_wrapper((SHA256_MB_ARGS_X4*)&args, num_blocks); } },
+    { "sha256_mb_x4_sse", SHA256_Acceleration::SSE41, 4,
+        [](BenchArgs& args, uint64_t num_blocks) { sha256_mb_x4_sse_wrapper((SHA256_MB_ARGS_X4*)&args, num_blocks); } },
+    { "sha256_mb_x4_sha_sse41", SHA256_Acceleration::SHA_X4, 4,
+        [](BenchArgs& args, uint64_t num_blocks) { sha256_mb_x4_sha_sse41_wrapper((SHA256_MB_ARGS_X4*)&args, num_blocks); } },
+    { "sha256_mb_x2_sha_sse41", SHA256_Acceleration::SHA_X2, 2,
+        [](BenchArgs& args, uint64_t num_blocks) { sha256_mb_x2_sha_sse41_wrapper((SHA256_MB_ARGS_X2*)&args, num_blocks); } },
+    { "sha256_sha_sse41", SHA256_Acceleration::SHA, 1,
+        [](BenchArgs& args, uint64_t num_blocks) { sha256_sha_sse41(args.digest, args.data_ptr[0], num_blocks); } },
+    { "sha256_process", SHA256_Acceleration::NO_ACCEL, 1,
+        [](BenchArgs& args, uint64_t num_blocks) { sha256_process(args.digest, args.data_ptr[0], (uint32_t)(num_blocks * BLOCK_SIZE_BYTES)); } },
+    { "sha256_scalar", SHA256_Acceleration::NO_ACCEL, 1,
+        [](BenchArgs& args, uint64_t num_blocks) { sha256_scalar(args.digest, args.data_ptr[0], num_blocks); } },
+};
+
+static const char* acceleration_names[NUM_ACCELERATIONS] = { "AVX512", "SHA", "AVX2", "AVX", "SSE41", "NO_ACCEL", "SHA_X4", "SHA_X2",
+    "AVX512VL" };
+
+// bytes per message: the 1-block and 2-block tails of mining, then bulk buffers
+static const uint64_t kernel_sizes[] = { 64, 128, 4096, 65536, 1048576 };
+// the nonce ends up in the first block of a 1-block tail, and of a 2-block tail with a constant second block, as in mine_xcoin_calibrate
+static const uint64_t mine_message_lens[2] = { 32, 48 };
+
+// SHA256 of a whole message, with the padding, as a big endian digest
+static void reference_sha256(const uint8_t message[], uint64_t len_bytes, uint8_t digest[DIGEST_SIZE_BYTES])
+{
+    uint64_t padded_len = (len_bytes + 1 + 8 + BLOCK_SIZE_BYTES - 1) / BLOCK_SIZE_BYTES * BLOCK_SIZE_BYTES;
+    std::vector<uint8_t> padded(padded_len, 0x0);
+    std::memcpy(padded.data(), message, len_bytes);
+    padded[len_bytes] = 0x80;
+    for (int i = 0; i < 8; i++)
+        padded[padded_len - 1 - i] = (uint8_t)((len_bytes * 8) >> (8 * i));
+    uint32_t state[DIGEST_NUM_WORDS];
+    std::memcpy(state, SHA256_IV, DIGEST_SIZE_BYTES);
+    sha256_process(state, padded.data(), (uint32_t)padded_len);
+    for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)
+        ((uint32_t*)digest)[w] = byteswap32(state[w]);
+}
+
+// the reference itself, on the "abc" test vector of FIPS 180-2
+static bool reference_known_answer()
+{
+    static const uint8_t expected[DIGEST_SIZE_BYTES] = {
+        0xba, 0x78, 0x16, 0xbf, 0x8f, 0x01, 0xcf, 0xea, 0x41, 0x41, 0x40, 0xde, 0x5d, 0xae, 0x22, 0x23,
+        0xb0, 0x03, 0x61, 0xa3, 0x96, 0x17, 0x7a, 0x9c, 0xb4, 0x10, 0xff, 0x61, 0xf2, 0x00, 0x15, 0xad
+    };
+    uint8_t digest[DIGEST_SIZE_BYTES];
+    reference_sha256((const uint8_t*)"abc", 3, digest);
+    return std::memcmp(digest, expected, DIGEST_SIZE_BYTES) == 0;
+}
+
+static void write_row(std::ostream& out, const std::string& function, const char* workload, uint64_t bytes_per_message, int lanes,
+    uint32_t num_threads, double seconds, uint64_t messages, bool ok)
+{
+    out << function << ',' << workload << ',' << bytes_per_message << ',' << lanes << ',' << num_threads << ','
+        << std::fixed << std::setprecision(3) << seconds << ',' << messages << ','
+        << messages * bytes_per_message / seconds / 1e6 << ',' << messages / seconds / 1e6 << ','
+        << (ok ? "ok" : "FAIL") << '\n' << std::defaultfloat;
+}
+
+// one kernel on lanes messages of bytes_per_message each, single thread, for about seconds
+static bool bench_kernel(std::ostream& out, const BenchKernel& kernel, uint64_t bytes_per_message, double seconds, bool reference_ok)
+{
+    uint64_t num_blocks = bytes_per_message / BLOCK_SIZE_BYTES;
+    std::vector<uint8_t> data(bytes_per_message * kernel.lanes);
+    for (size_t i = 0; i < data.size(); i++)
+        data[i] = (uint8_t)(i * 131 + (i >> 11));   // a different message in every lane
+    BenchArgs args;
+    // the Intel vector functions increment the pointers because they have a reference to them through the args struct, so set them every time
+    auto hash_once = [&] {
+        for (int j = 0; j < kernel.lanes; j++)
+            args.data_ptr[j] = data.data() + bytes_per_message * j;
+        kernel.hash(args, num_blocks);
+    };
+
+    for (int j = 0; j < kernel.lanes; j++)
+        for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)
+            args.digest[w * kernel.lanes + j] = SHA256_IV[w];
+    hash_once();
+    bool ok = reference_ok;
+    for (int j = 0; j < kernel.lanes; j++) {
+        uint32_t expected[DIGEST_NUM_WORDS];
+        std::memcpy(expected, SHA256_IV, DIGEST_SIZE_BYTES);
+        sha256_process(expected, data.data() + bytes_per_message * j, (uint32_t)bytes_per_message);
+        for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)
+            ok = ok && args.digest[w * kernel.lanes + j] == expected[w];
+    }
+
+    // the clock is read once per 64 KiB or so, so that it does not weigh on the short messages
+    uint64_t calls_per_read = std::max<uint64_t>(1, 65536 / (bytes_per_message * kernel.lanes));
+    uint64_t calls = 0;
+    auto start = std::chrono::steady_clock::now();
+    double elapsed = 0.0;
+    do {
+        for (uint64_t c = 0; c < calls_per_read; c++)
+            hash_once();
+        calls += calls_per_read;
+        elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (elapsed < seconds);
+
+    write_row(out, kernel.name, num_blocks <= 2 ? "tail" : "bulk", bytes_per_message, kernel.lanes, 1, elapsed, calls * kernel.lanes, ok);
+    return ok;
+}
+
+// mine_xcoin with one acceleration on all the worker threads, with a target no nonce can meet, so the job hashes until its timeout
+// the best digest so far is checked against the reference
+static bool bench_mine(std::ostream& out, SHA256_Acceleration acceleration, uint64_t message_len, double seconds)
+{
+    static const uint8_t impossible_target[DIGEST_SIZE_BYTES] = { 0x0 };
+    uint8_t message[64] = { 0x0 };
+    for (uint64_t i = 0; i < message_len; i++)
+        message[i] = (uint8_t)(i * 7 + 1);
+
+    MineJob* job = mine_xcoin_start(impossible_target, message, message_len, acceleration, seconds, 0, nullptr, nullptr, nullptr);
+    if (job == nullptr)
+        return false;
+    mine_xcoin_wait(job, -1.0);
+    MineStats total;
+    double elapsed_seconds;
+    uint32_t threads_used = mine_xcoin_telemetry(job, &total, nullptr, 0, &elapsed_seconds);
+    uint8_t best_id[DIGEST_SIZE_BYTES];
+    uint64_t best_nonce[1], best_extranonce[1];
+    bool ok = mine_xcoin_best(job, best_id, best_nonce, best_extranonce);
+    mine_xcoin_free(job);
+
+    if (ok) {
+        *((uint64_t*)(message + message_len)) = best_nonce[0];
+        uint8_t expected[DIGEST_SIZE_BYTES];
+        reference_sha256(message, message_len + NONCE_SIZE_BYTES, expected);
+        ok = std::memcmp(best_id, expected, DIGEST_SIZE_BYTES) == 0;
+    }
+    uint64_t tail_bytes = (message_len + NONCE_SIZE_BYTES + 1 + 8 + BLOCK_SIZE_BYTES - 1) / BLOCK_SIZE_BYTES * BLOCK_SIZE_BYTES;
+    write_row(out, std::string("mine_xcoin_") + acceleration_names[(int)acceleration], "mine", tail_bytes, lane_counts[(int)acceleration],
+        threads_used, elapsed_seconds, total.nonces_hashed, ok);
+    return ok;
+}
+
+int main(int argc, char* argv[])
+{
+    std::ofstream file;
+    if (argc > 1) {
+        file.open(argv[1], std::ios::trunc);
+        if (!file) {
+            std::cerr << "cannot write " << argv[1] << '\n';
+            return 2;
+        }
+    }
+    std::ostream& out = argc > 1 ? file : std::cout;
+    double seconds = argc > 2 ? std::atof(argv[2]) : 0.25;
+    uint32_t max_threads = argc > 3 ? (uint32_t)std::atoi(argv[3]) : std::max(1u, std::thread::hardware_concurrency());
+
+    // bytes_per_message is the whole padded tail for the mining rows, messages are nonces there
+    out << "function,workload,bytes_per_message,lanes,threads,seconds,messages,mb_per_second,mhash_per_second,check\n";
+    bool reference_ok = reference_known_answer();
+    int failures = 0;
+    for (const BenchKernel& kernel : kernels) {
+        if (!sha256_acceleration_supported(kernel.needs)) continue;
+        for (uint64_t bytes_per_message : kernel_sizes)
+            failures += !bench_kernel(out, kernel, bytes_per_message, seconds, reference_ok);
+    }
+
+    // 1, 2, 4, ... threads, and max_threads itself
+    std::vector<uint32_t> thread_counts;
+    for (uint32_t n = 1; n < max_threads; n *= 2)
+        thread_counts.push_back(n);
+    thread_counts.push_back(max_threads);
+    for (uint32_t num_threads : thread_counts) {
+        if (!mine_xcoin_set_threads(num_threads, nullptr, 0, MinePlacement::OS)) {
+            std::cerr << "cannot start " << num_threads << " threads\n";
+            failures++;
+            continue;
+        }
+        for (uint64_t message_len : mine_message_lens)
+            for (int a = 0; a < NUM_ACCELERATIONS; a++) {
+                if (!sha256_acceleration_supported((SHA256_Acceleration)a)) continue;
+                failures += !bench_mine(out, SHA256_Acceleration(a), message_len, seconds);
+            }
+    }
+    mine_xcoin_set_threads(0, nullptr, 0, MinePlacement::OS);   // back to the default
+
+    out.flush();
+    if (failures > 0)
+        std::cerr << failures << " runs did not match the reference digest\n";
+    return failures > 0 ? 1 : 0;
+}
@@ -0,0 +1,228 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "pch.h"
+
+#include "mine_pool.h"
+
+#if defined(_MSC_VER ) && defined(_WIN64)
+#define ALLOC_ALIGNED(A, S) (_aligned_malloc(S, A))
+#define FREE_ALIGNED(P) (_aligned_free(P))
+#endif
+
+#if defined(__GNUC__)
+#define ALLOC_ALIGNED(A, S) (std::aligned_alloc(A, S))
+#define FREE_ALIGNED(P) (std::free(P))
+#endif
+
+MineArena::~MineArena()
+{
+    if (buffer != nullptr)
+        FREE_ALIGNED(buffer);
+}
+
+uint8_t* MineArena::reserve(size_t size_bytes)
+{
+    if (size_bytes <= capacity)
+        return buffer;
+    size_t new_capacity = (size_bytes + 63) & ~(size_t)63;    // aligned_alloc needs a multiple of the alignment
+    if (buffer != nullptr)
+        FREE_ALIGNED(buffer);
+    buffer = (uint8_t*)ALLOC_ALIGNED(64, new_capacity);
+    capacity = buffer != nullptr ? new_capacity : 0;
+    return buffer;
+}
+
+MinePool::MinePool(MineThreadLayout layout)
+    : thread_layout(std::move(layout)), arenas(thread_layout.thread_cpus.size()), results(thread_layout.thread_cpus.size())
+{
+    for (size_t i = 0; i < thread_layout.thread_cpus.size(); i++)
+        threads.emplace_back(&MinePool::worker_loop, this, (int)(i + 1));
+}
+
+MinePool::~MinePool()
+{
+    {
+        std::unique_lock<std::mutex> lock(mutex);
+        job_done.wait(lock, [this] { return !busy; });
+        stopping = true;
+    }
+    job_ready.notify_all();
+    for (auto& th : threads)
+        th.join();
+}
+
+void MinePool::start(Job new_job, Done new_done)
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    job_done.wait(lock, [this] { return !busy; });
+    job = std::move(new_job);
+    done = std::move(new_done);
+    running = (uint32_t)threads.size();
+    busy = true;
+    generation++;
+    job_ready.notify_all();
+}
+
+void MinePool::run(Job new_job)
+{
+    start(std::move(new_job), [] {});
+    std::unique_lock<std::mutex> lock(mutex);
+    job_done.wait(lock, [this] { return !busy; });
+}
+
+void MinePool::worker_loop(int thread_num)
+{
+    pin_current_thread(thread_layout.thread_cpus[thread_num - 1]);  // best effort, a thread the OS does not pin still mines
+    uint64_t seen_generation = 0;
+    for (;;) {
+        const Job* current;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            job_ready.wait(lock, [&] { return stopping || generation != seen_generation; });
+            if (stopping)
+                return;
+            seen_generation = generation;
+            current = &job;     // not replaced before this job is done, see start()
+        }
+        (*current)(thread_num, arenas[thread_num - 1], results[thread_num - 1]);
+        bool last;
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            last = --running == 0;
+        }
+        if (last) {
+            done();
+            {
+                std::lock_guard<std::mutex> lock(mutex);
+                job = nullptr;
+                done = nullptr;
+                busy = false;
+            }
+            job_done.notify_all();
+        }
+    }
+}
+
+// never destroyed: joining threads while the library is being unloaded can deadlock on Windows,
+// the idle workers are just blocked and go away with the process
+static MinePool* pool = nullptr;
+static MinePool* bulk = nullptr;
+
+// one unpinned thread per hardware thread, until mine_xcoin_set_threads
+static MineThreadLayout default_layout()
+{
+    MineThreadLayout layout;
+    layout.thread_cpus.resize(std::max(1u, std::thread::hardware_concurrency()));
+    return layout;
+}
+
+std::mutex& mine_pool_mutex()
+{
+    static std::mutex* pool_mutex = new std::mutex();
+    return *pool_mutex;
+}
+
+MinePool& mine_pool()
+{
+    if (pool == nullptr)
+        pool = new MinePool(default_layout());
+    return *pool;
+}
+
+void mine_pool_replace(MineThreadLayout layout)
+{
+    delete pool;
+    pool = new MinePool(layout);
+    std::lock_guard<std::mutex> bulk_lock(bulk_pool_mutex());   // waits for a bulk call to end
+    delete bulk;
+    bulk = new MinePool(std::move(layout));
+}
+
+std::mutex& bulk_pool_mutex()
+{
+    static std::mutex* pool_mutex = new std::mutex();
+    return *pool_mutex;
+}
+
+MinePool& bulk_pool()
+{
+    if (bulk == nullptr)
+        bulk = new MinePool(default_layout());
+    return *bulk;
+}
+
+MineWatchdog::MineWatchdog()
+    : thread(&MineWatchdog::loop, this)
+{
+}
+
+MineWatchdog::~MineWatchdog()
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    changed.notify_all();
+    thread.join();
+}
+
+uint64_t MineWatchdog::arm(std::chrono::steady_clock::time_point deadline, Fire fire)
+{
+    uint64_t id;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        id = next_id++;
+        timers.emplace(id, std::make_pair(deadline, std::move(fire)));
+    }
+    changed.notify_all();
+    return id;
+}
+
+bool MineWatchdog::rearm(uint64_t id, std::chrono::steady_clock::time_point deadline)
+{
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto timer = timers.find(id);
+        if (timer == timers.end())
+            return false;
+        timer->second.first = deadline;
+    }
+    changed.notify_all();
+    return true;
+}
+
+void MineWatchdog::disarm(uint64_t id)
+{
+    std::lock_guard<std::mutex> lock(mutex);    // waits for a callback firing right now
+    timers.erase(id);
+}
+
+void MineWatchdog::loop()
+{
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!stopping) {
+        if (timers.empty()) {
+            changed.wait(lock);
+            continue;
+        }
+        // a few jobs at most, a scan is cheaper than keeping a heap in step with rearm
+        auto earliest = timers.begin();
+        for (auto timer = timers.begin(); timer != timers.end(); ++timer)
+            if (timer->second.first < earliest->second.first)
+                earliest = timer;
+        if (std::chrono::steady_clock::now() < earliest->second.first) {
+            changed.wait_until(lock, earliest->second.first);   // woken up early by arm and rearm, then look again
+            continue;
+        }
+        Fire fire = std::move(earliest->second.second);
+        timers.erase(earliest);
+        fire();     // with the mutex held, see disarm
+    }
+}
+
+MineWatchdog& mine_watchdog()
+{
+    static MineWatchdog* watchdog = new MineWatchdog();
+    return *watchdog;
+}
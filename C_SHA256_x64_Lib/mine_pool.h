@@ -0,0 +1,125 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef _MINE_POOL_H_
+#define _MINE_POOL_H_
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "mine_topology.h"
+
+// scratch memory of one worker thread, kept across jobs so that a new job does not allocate
+struct alignas(64) MineArena {
+    MineArena() = default;
+    MineArena(const MineArena&) = delete;
+    MineArena& operator=(const MineArena&) = delete;
+    ~MineArena();
+
+    // returns at least size_bytes of 64-byte aligned memory, only reallocated (contents lost) when it has to grow
+    uint8_t* reserve(size_t size_bytes);
+
+private:
+    uint8_t* buffer = nullptr;
+    size_t capacity = 0;
+};
+
+// result of one worker thread, a cache line of its own so the workers never share one while hashing
+struct alignas(64) MineResultSlot {
+    uint32_t state[8];  // start state in, winning digest out
+    uint64_t nonce;     // winning nonce out
+    uint64_t extranonce;    // and the extranonce it goes with
+};
+
+// long-lived worker threads, each with its own arena and result slot
+// a job is run on all the workers at once, and its done callback is called once every worker has finished it
+// the workers pin themselves as laid out before they touch their arenas, so the arena memory is first touched, and placed, on their own NUMA node
+class MinePool {
+public:
+    // thread_num counts from 1, as 0 is the early abort value of the winning thread, see worker_mine
+    typedef std::function<void(int thread_num, MineArena& arena, MineResultSlot& result)> Job;
+    typedef std::function<void()> Done;
+
+    explicit MinePool(MineThreadLayout layout);
+    ~MinePool();    // waits for the current job to complete
+
+    uint32_t size() const { return (uint32_t)threads.size(); }
+    const MineThreadLayout& layout() const { return thread_layout; }
+    MineResultSlot& result(int thread_num) { return results[thread_num - 1]; }
+
+    // one job at a time: waits for the previous job to complete, then returns as soon as the workers are woken up
+    // done is called on the last worker to finish, the result slots are not reused by the next job before it returns
+    void start(Job job, Done done);
+    // as start, but returns once every worker has finished the job
+    void run(Job job);
+
+private:
+    void worker_loop(int thread_num);
+
+    MineThreadLayout thread_layout;
+    std::vector<std::thread> threads;
+    std::vector<MineArena> arenas;
+    std::vector<MineResultSlot> results;
+
+    std::mutex mutex;               // guards the members below
+    std::condition_variable job_ready;
+    std::condition_variable job_done;
+    Job job;
+    Done done;
+    uint64_t generation = 0;        // bumped for every job, the workers wait for it to change
+    uint32_t running = 0;           // workers still running the current job
+    bool busy = false;              // the current job or its done callback is not finished yet
+    bool stopping = false;
+};
+
+// the pool shared by all the calls, created on first use with one unpinned thread per hardware thread
+// it can be replaced, so hold mine_pool_mutex() for as long as the reference is used
+std::mutex& mine_pool_mutex();
+MinePool& mine_pool();
+// new worker threads for the following jobs, with mine_pool_mutex() held, waits for the current job to complete
+// the bulk pool below is replaced with the same layout
+void mine_pool_replace(MineThreadLayout layout);
+
+// the pool of the bulk hashing functions (sha256_multihash, sha256_merkle_root, sha256_files), so that they never wait for a
+// mining job to end; it has the threads layout of mine_pool(), and is created and replaced with it
+// hold bulk_pool_mutex() for as long as the reference is used, it is taken after mine_pool_mutex() if both are
+std::mutex& bulk_pool_mutex();
+MinePool& bulk_pool();
+
+// one thread for the deadlines of all the jobs, so that the workers never read the clock while hashing
+// it sleeps until the earliest deadline and then calls its fire callback, which is only meant to raise a stop flag
+class MineWatchdog {
+public:
+    typedef std::function<void()> Fire;
+
+    MineWatchdog();
+    ~MineWatchdog();
+
+    // fire is called once, on the watchdog thread, at the deadline unless disarmed before; returns the ID of the timer
+    uint64_t arm(std::chrono::steady_clock::time_point deadline, Fire fire);
+    // a new deadline for a timer, returns false if it had already fired or was disarmed
+    bool rearm(uint64_t id, std::chrono::steady_clock::time_point deadline);
+    // once this returns, fire is neither running nor called later, so whatever it refers to can go
+    void disarm(uint64_t id);
+
+private:
+    void loop();
+
+    std::mutex mutex;               // guards the members below, held while a callback fires
+    std::condition_variable changed;
+    std::map<uint64_t, std::pair<std::chrono::steady_clock::time_point, Fire>> timers;
+    uint64_t next_id = 1;
+    bool stopping = false;
+    std::thread thread;             // last, started once the members above are ready
+};
+
+// the watchdog shared by all the jobs, created on first use and never destroyed, as the pool
+MineWatchdog& mine_watchdog();
+
+#endif // _MINE_POOL_H_
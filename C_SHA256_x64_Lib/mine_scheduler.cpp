@@ -0,0 +1,139 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "pch.h"
+
+#include "mine_scheduler.h"
+
+MineScheduler::MineScheduler(uint32_t num_workers, uint64_t num_lanes, uint64_t max_nonce)
+    : num_lanes(num_lanes), last_batch(max_nonce / num_lanes), num_chunks(last_batch / MINE_CHUNK_BATCHES + 1), slots(new Slot[num_workers]),
+    num_slots(num_workers)
+{
+}
+
+void MineScheduler::resume(uint64_t frontier, const std::vector<std::pair<uint64_t, uint64_t>>& gaps)
+{
+    if (frontier == UINT64_MAX || frontier / num_lanes > last_batch)
+        num_chunks = 0;     // all handed out, only the gaps are left
+    else {
+        chunk_base = frontier / num_lanes;
+        num_chunks = (last_batch - chunk_base) / MINE_CHUNK_BATCHES + 1;
+    }
+    for (const auto& gap : gaps) {
+        if (gap.second == 0 || gap.first / num_lanes > last_batch)
+            continue;
+        uint64_t last_nonce = gap.second - 1 > UINT64_MAX - gap.first ? UINT64_MAX : gap.first + (gap.second - 1);
+        uint64_t first = gap.first / num_lanes;
+        uint64_t last = std::min(last_batch, last_nonce / num_lanes);
+        for (; first <= last; first += MINE_CHUNK_BATCHES) {  // split, so that a gap fits in a slot
+            resume_gaps.emplace_back(first, std::min(MINE_CHUNK_BATCHES - 1, last - first) + 1);
+            if (last - first < MINE_CHUNK_BATCHES)
+                break;
+        }
+    }
+}
+
+void MineScheduler::refill(Slot& slot, uint64_t first_batch, uint64_t num_batches)
+{
+    uint64_t next_generation = (generation(slot.range.load()) + 1) & 0xFFFF;
+    slot.range.store(pack(next_generation, 0, 0));  // empty, so nobody steals from it while the base changes
+    slot.base.store(first_batch);
+    slot.range.store(pack(next_generation, 0, num_batches));
+}
+
+bool MineScheduler::take(Slot& victim, bool whole, uint64_t& first_batch, uint64_t& num_batches)
+{
+    for (;;) {
+        uint64_t range = victim.range.load();
+        uint64_t count = whole ? end(range) - begin(range) : (end(range) - begin(range)) / 2;
+        if (count == 0)
+            return false;
+        uint64_t base = victim.base.load();     // the base of this generation, or the exchange below fails
+        if (victim.range.compare_exchange_weak(range, pack(generation(range), begin(range), end(range) - count))) {
+            first_batch = base + end(range) - count;
+            num_batches = count;
+            return true;
+        }
+    }
+}
+
+bool MineScheduler::claim(uint32_t worker, uint32_t num_active, uint64_t max_batches, uint64_t& first_batch, uint64_t& num_batches)
+{
+    Slot& own = slots[worker];
+    for (;;) {
+        uint64_t range = own.range.load();
+        if (begin(range) < end(range)) {
+            uint64_t count = std::min(max_batches, end(range) - begin(range));
+            if (own.range.compare_exchange_weak(range, pack(generation(range), begin(range) + count, end(range)))) {
+                first_batch = own.base.load(std::memory_order_relaxed) + begin(range);
+                num_batches = count;
+                return true;
+            }
+            continue;   // a steal got in first
+        }
+
+        uint64_t first = 0, count = 0;
+        bool found = false;
+        for (uint32_t v = num_active; v < num_slots && !found; v++)     // left over by the inactive workers
+            if (v != worker)
+                found = take(slots[v], true, first, count);
+        if (!found && next_gap.load(std::memory_order_relaxed) < resume_gaps.size()) {
+            size_t gap = next_gap.fetch_add(1);
+            if (gap < resume_gaps.size()) {
+                first = resume_gaps[gap].first;
+                count = resume_gaps[gap].second;
+                found = true;
+            }
+        }
+        if (!found && next_chunk.load(std::memory_order_relaxed) < num_chunks) {
+            uint64_t chunk = next_chunk.fetch_add(1);
+            if (chunk < num_chunks) {
+                first = chunk_base + chunk * MINE_CHUNK_BATCHES;
+                count = std::min(MINE_CHUNK_BATCHES - 1, last_batch - first) + 1;     // the last chunk can be short
+                found = true;
+            }
+        }
+        while (!found) {    // all handed out, split the biggest range left
+            Slot* victim = nullptr;
+            uint64_t most = 1;
+            for (uint32_t v = 0; v < num_slots; v++) {
+                uint64_t victim_range = slots[v].range.load();
+                if (v != worker && end(victim_range) - begin(victim_range) > most) {
+                    most = end(victim_range) - begin(victim_range);
+                    victim = &slots[v];
+                }
+            }
+            if (victim == nullptr)
+                return false;
+            found = take(*victim, false, first, count);
+        }
+        refill(own, first, count);
+    }
+}
+
+void MineScheduler::unfinished(uint32_t worker, uint64_t first_batch, uint64_t num_batches)
+{
+    slots[worker].unfinished_first = first_batch;
+    slots[worker].unfinished_count = num_batches;
+}
+
+uint64_t MineScheduler::coverage(std::vector<std::pair<uint64_t, uint64_t>>& gaps) const
+{
+    gaps.clear();
+    for (uint32_t v = 0; v < num_slots; v++) {
+        const Slot& slot = slots[v];
+        uint64_t range = slot.range.load();
+        if (begin(range) < end(range))
+            gaps.emplace_back((slot.base.load() + begin(range)) * num_lanes, (end(range) - begin(range)) * num_lanes);
+        if (slot.unfinished_count > 0)
+            gaps.emplace_back(slot.unfinished_first * num_lanes, slot.unfinished_count * num_lanes);
+    }
+    for (size_t g = next_gap.load(); g < resume_gaps.size(); g++)    // never claimed
+        gaps.emplace_back(resume_gaps[g].first * num_lanes, resume_gaps[g].second * num_lanes);
+    std::sort(gaps.begin(), gaps.end());
+
+    uint64_t chunks = next_chunk.load();
+    if (chunks >= num_chunks)
+        return UINT64_MAX;
+    return (chunk_base + chunks * MINE_CHUNK_BATCHES) * num_lanes;
+}
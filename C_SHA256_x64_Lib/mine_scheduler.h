@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef _MINE_SCHEDULER_H_
+#define _MINE_SCHEDULER_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <utility>
+#include <vector>
+
+// batches handed out to a worker at a time when it has nothing left, so the shared counter is touched rarely
+const uint64_t MINE_CHUNK_BATCHES = 1ULL << 20;
+
+// hands out the nonces of one template as contiguous ranges of batches, a batch being the nonces of lane 0 to num_lanes - 1
+// every worker has a slot with the rest of its current range, and takes its claims from the front of it
+// an empty slot is refilled, in this order, with the whole range left in the slot of an inactive worker, with a gap left by an
+// earlier job (see resume), with a fresh chunk from the shared counter, or once the nonce space is all handed out, with the back half
+// of the biggest range of an active worker
+// every claim is a compare-exchange of one 64-bit word, so nothing is locked, and no batch is ever handed out twice
+class MineScheduler {
+public:
+    // the nonces are 0 to max_nonce, a whole number of batches
+    MineScheduler(uint32_t num_workers, uint64_t num_lanes, uint64_t max_nonce);
+    // skips the nonces an earlier job has hashed, as given by its coverage, before any claim
+    // the gaps are widened to whole batches, as that job may have had another lane count
+    void resume(uint64_t frontier, const std::vector<std::pair<uint64_t, uint64_t>>& gaps);
+
+    // the next range of at most max_batches for worker (from 0), the workers at or past num_active are the inactive ones
+    // returns false once there is nothing left to hash
+    bool claim(uint32_t worker, uint32_t num_active, uint64_t max_batches, uint64_t& first_batch, uint64_t& num_batches);
+    // the batches a worker had claimed but not hashed when it stopped, at most once per worker
+    void unfinished(uint32_t worker, uint64_t first_batch, uint64_t num_batches);
+
+    // once all the workers have stopped: every nonce below the returned frontier was hashed, except the gaps (first nonce, count)
+    // the frontier is UINT64_MAX if the whole nonce space was handed out
+    uint64_t coverage(std::vector<std::pair<uint64_t, uint64_t>>& gaps) const;
+
+private:
+    struct alignas(64) Slot {
+        std::atomic<uint64_t> range{ 0 };   // see pack(), the claims of the owner move begin up, the steals move end down
+        std::atomic<uint64_t> base{ 0 };    // batch of offset 0, only changed by the owner with the slot empty
+        uint64_t unfinished_first = 0;
+        uint64_t unfinished_count = 0;
+    };
+
+    // a refill bumps the generation, so that a steal seeing the slot before the refill cannot succeed after it
+    static uint64_t pack(uint64_t generation, uint64_t begin, uint64_t end) { return (generation << 48) | (begin << 24) | end; }
+    static uint64_t generation(uint64_t range) { return range >> 48; }
+    static uint64_t begin(uint64_t range) { return (range >> 24) & 0xFFFFFF; }
+    static uint64_t end(uint64_t range) { return range & 0xFFFFFF; }
+
+    void refill(Slot& slot, uint64_t first_batch, uint64_t num_batches);
+    bool take(Slot& victim, bool whole, uint64_t& first_batch, uint64_t& num_batches);
+
+    uint64_t num_lanes;
+    uint64_t last_batch;                    // the batch of the largest nonce
+    uint64_t chunk_base = 0;                // first batch of chunk 0
+    uint64_t num_chunks;                    // chunk_base to last_batch, the last one can be short
+    std::atomic<uint64_t> next_chunk{ 0 };
+    std::vector<std::pair<uint64_t, uint64_t>> resume_gaps;     // (first batch, count), at most a chunk each
+    std::atomic<size_t> next_gap{ 0 };
+    std::unique_ptr<Slot[]> slots;
+    uint32_t num_slots;
+};
+
+#endif // _MINE_SCHEDULER_H_
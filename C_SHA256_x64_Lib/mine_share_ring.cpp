@@ -0,0 +1,58 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "pch.h"
+
+#include "mine_share_ring.h"
+
+MineShareRing::MineShareRing(uint32_t capacity)
+    : cells(new Cell[capacity]), mask(capacity - 1)
+{
+    assert((capacity & (capacity - 1)) == 0);
+    for (uint32_t i = 0; i < capacity; i++)
+        cells[i].sequence.store(i, std::memory_order_relaxed);
+}
+
+bool MineShareRing::push(const MineShare& share)
+{
+    uint64_t position = push_position.load(std::memory_order_relaxed);
+    for (;;) {
+        Cell& cell = cells[position & mask];
+        int64_t turn = (int64_t)(cell.sequence.load(std::memory_order_acquire) - position);
+        if (turn == 0) {    // free, claim the position
+            if (push_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                cell.share = share;
+                cell.sequence.store(position + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (turn < 0) {    // still holds the share pushed one lap ago
+            num_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        else    // another worker got the position first
+            position = push_position.load(std::memory_order_relaxed);
+    }
+}
+
+uint32_t MineShareRing::pop(MineShare shares[], uint32_t max_shares)
+{
+    uint32_t count = 0;
+    uint64_t position = pop_position.load(std::memory_order_relaxed);
+    while (count < max_shares) {
+        Cell& cell = cells[position & mask];
+        int64_t turn = (int64_t)(cell.sequence.load(std::memory_order_acquire) - (position + 1));
+        if (turn == 0) {    // pushed, claim the position
+            if (pop_position.compare_exchange_weak(position, position + 1, std::memory_order_relaxed)) {
+                shares[count++] = cell.share;
+                cell.sequence.store(position + mask + 1, std::memory_order_release);    // free for the push one lap later
+                position++;
+            }
+        }
+        else if (turn < 0)  // empty
+            break;
+        else
+            position = pop_position.load(std::memory_order_relaxed);
+    }
+    return count;
+}
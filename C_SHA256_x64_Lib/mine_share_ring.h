@@ -0,0 +1,43 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef _MINE_SHARE_RING_H_
+#define _MINE_SHARE_RING_H_
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+// one nonce below the share target, see mine_xcoin_drain_shares
+struct MineShare {
+    uint64_t nonce;
+    uint64_t extranonce;    // 0 without extranonce, see MineNonceLayout
+    uint32_t epoch;         // template the nonce is for: 0 for the one of mine_xcoin_start, then one more for every mine_xcoin_replace
+    uint8_t id[32];         // the block ID, big endian as result_id
+};
+
+// bounded queue of shares, pushed by the workers without stopping, and popped by the caller while they run
+// every cell carries a sequence number that tells the pushers and poppers whose turn it is, so neither side locks
+// a push to a full ring drops the share and counts it, the workers never wait for the caller
+class MineShareRing {
+public:
+    explicit MineShareRing(uint32_t capacity);     // a power of 2
+
+    bool push(const MineShare& share);   // false if the ring is full
+    uint32_t pop(MineShare shares[], uint32_t max_shares);     // the oldest ones first, returns how many
+    uint64_t dropped() const { return num_dropped.load(std::memory_order_relaxed); }
+
+private:
+    struct alignas(64) Cell {
+        std::atomic<uint64_t> sequence;     // the position of the next push to it, or one past the position of the share to pop from it
+        MineShare share;
+    };
+
+    std::unique_ptr<Cell[]> cells;
+    uint64_t mask;
+    alignas(64) std::atomic<uint64_t> push_position{ 0 };
+    alignas(64) std::atomic<uint64_t> pop_position{ 0 };
+    std::atomic<uint64_t> num_dropped{ 0 };
+};
+
+#endif // _MINE_SHARE_RING_H_
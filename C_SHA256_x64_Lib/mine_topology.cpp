@@ -0,0 +1,220 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+#include "pch.h"
+
+#include "mine_topology.h"
+
+#include <set>
+#include <tuple>
+
+#if defined(_MSC_VER ) && defined(_WIN64)
+#include "framework.h"
+#endif
+
+#if defined(__GNUC__)
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+#if defined(_MSC_VER ) && defined(_WIN64)
+// only the first processor group, i.e. up to 64 logical CPUs, as SetThreadAffinityMask
+std::vector<MineCpu> host_cpus()
+{
+    DWORD_PTR process_mask = 0, system_mask = 0;
+    if (!GetProcessAffinityMask(GetCurrentProcess(), &process_mask, &system_mask))
+        process_mask = ~(DWORD_PTR)0;
+
+    std::vector<MineCpu> cpus;
+    DWORD size = 0;
+    GetLogicalProcessorInformation(nullptr, &size);
+    std::vector<SYSTEM_LOGICAL_PROCESSOR_INFORMATION> info(size / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION));
+    if (info.empty() || !GetLogicalProcessorInformation(info.data(), &size)) {  // no topology, every CPU a core of its own
+        for (int c = 0; c < (int)std::max(1u, std::thread::hardware_concurrency()) && c < 64; c++)
+            if ((process_mask >> c) & 1)
+                cpus.push_back({ c, c, 0 });
+        return cpus;
+    }
+
+    int num_cores = 0;
+    for (const auto& entry : info) {
+        if (entry.Relationship != RelationProcessorCore) continue;
+        for (int c = 0; c < 64; c++)
+            if (((entry.ProcessorMask & process_mask) >> c) & 1)
+                cpus.push_back({ c, num_cores, 0 });
+        num_cores++;
+    }
+    for (const auto& entry : info) {
+        if (entry.Relationship != RelationNumaNode) continue;
+        for (auto& cpu : cpus)
+            if ((entry.ProcessorMask >> cpu.cpu) & 1)
+                cpu.node = (int)entry.NumaNode.NodeNumber;
+    }
+    std::sort(cpus.begin(), cpus.end(), [](const MineCpu& a, const MineCpu& b) { return a.cpu < b.cpu; });
+    return cpus;
+}
+
+bool pin_current_thread(const std::vector<int>& cpus)
+{
+    if (cpus.empty()) return true;
+    DWORD_PTR mask = 0;
+    for (int c : cpus)
+        if (c < 64) mask |= (DWORD_PTR)1 << c;
+    return mask != 0 && SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+}
+#endif
+
+#if defined(__GNUC__)
+// "0-3,8,10-11" as in sysfs
+static std::vector<int> parse_cpu_list(const std::string& list)
+{
+    std::vector<int> cpus;
+    size_t pos = 0;
+    while (pos < list.size()) {
+        size_t end = list.find(',', pos);
+        if (end == std::string::npos) end = list.size();
+        std::string range = list.substr(pos, end - pos);
+        size_t dash = range.find('-');
+        try {
+            int first = std::stoi(range.substr(0, dash));
+            int last = dash == std::string::npos ? first : std::stoi(range.substr(dash + 1));
+            for (int c = first; c <= last; c++) cpus.push_back(c);
+        }
+        catch (const std::exception&) {}   // blank or garbled, skipped
+        pos = end + 1;
+    }
+    return cpus;
+}
+
+static std::string read_sysfs(const std::string& path)
+{
+    std::ifstream file(path);
+    std::string line;
+    std::getline(file, line);
+    return line;
+}
+
+static int read_sysfs_int(const std::string& path, int missing)
+{
+    try { return std::stoi(read_sysfs(path)); }
+    catch (const std::exception&) { return missing; }
+}
+
+std::vector<MineCpu> host_cpus()
+{
+    cpu_set_t allowed;
+    CPU_ZERO(&allowed);
+    bool have_allowed = sched_getaffinity(0, sizeof(allowed), &allowed) == 0;
+
+    std::vector<MineCpu> cpus;
+    const std::string cpu_dir = "/sys/devices/system/cpu/cpu";
+    std::vector<int> online = parse_cpu_list(read_sysfs("/sys/devices/system/cpu/online"));
+    if (online.empty())     // no sysfs, every CPU a core of its own
+        for (int c = 0; c < (int)std::max(1u, std::thread::hardware_concurrency()); c++) online.push_back(c);
+    for (int c : online) {
+        if (have_allowed && (c >= CPU_SETSIZE || !CPU_ISSET(c, &allowed))) continue;
+        int package = read_sysfs_int(cpu_dir + std::to_string(c) + "/topology/physical_package_id", 0);
+        int core_id = read_sysfs_int(cpu_dir + std::to_string(c) + "/topology/core_id", c);
+        cpus.push_back({ c, (package << 16) | core_id, 0 });
+    }
+    for (int node : parse_cpu_list(read_sysfs("/sys/devices/system/node/online"))) {
+        for (int c : parse_cpu_list(read_sysfs("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist")))
+            for (auto& cpu : cpus)
+                if (cpu.cpu == c) cpu.node = node;
+    }
+    return cpus;
+}
+
+bool pin_current_thread(const std::vector<int>& cpus)
+{
+    if (cpus.empty()) return true;
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (int c : cpus)
+        if (c < CPU_SETSIZE) CPU_SET(c, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+#endif
+
+// the CPUs in the order the threads take them
+static std::vector<MineCpu> order_cpus(const std::vector<MineCpu>& cpus, MinePlacement placement)
+{
+    // rank of a CPU among the SMT siblings of its core, 0 for the first one
+    std::vector<int> sibling(cpus.size(), 0);
+    for (size_t i = 0; i < cpus.size(); i++)
+        for (size_t k = 0; k < i; k++)
+            if (cpus[k].core == cpus[i].core) sibling[i]++;
+
+    std::vector<size_t> order(cpus.size());
+    for (size_t i = 0; i < order.size(); i++) order[i] = i;
+    auto by = [&](auto key) {
+        std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return key(a) < key(b); });
+    };
+    switch (placement) {
+        case MinePlacement::PHYSICAL_CORES:
+            by([&](size_t i) { return std::make_tuple(sibling[i], cpus[i].node, cpus[i].core); });
+            break;
+        case MinePlacement::FILL_SMT:
+            by([&](size_t i) { return std::make_tuple(cpus[i].node, cpus[i].core, sibling[i]); });
+            break;
+        case MinePlacement::SPREAD_NUMA: {
+            // one per core within each node first, then the nodes take turns
+            by([&](size_t i) { return std::make_tuple(cpus[i].node, sibling[i], cpus[i].core); });
+            std::vector<int> turn(cpus.size(), 0);
+            for (size_t k = 1; k < order.size(); k++)
+                if (cpus[order[k]].node == cpus[order[k - 1]].node) turn[order[k]] = turn[order[k - 1]] + 1;
+            by([&](size_t i) { return std::make_tuple(turn[i], cpus[i].node); });
+            break;
+        }
+        default:
+            break;
+    }
+
+    std::vector<MineCpu> ordered;
+    for (size_t i : order) ordered.push_back(cpus[i]);
+    return ordered;
+}
+
+MineThreadLayout plan_threads(uint32_t num_threads, const int32_t cpus[], uint32_t num_cpus, MinePlacement placement)
+{
+    std::vector<MineCpu> candidates;
+    for (const MineCpu& cpu : host_cpus()) {
+        bool wanted = cpus == nullptr || num_cpus == 0;
+        for (uint32_t i = 0; i < num_cpus && !wanted; i++)
+            wanted = cpus[i] == cpu.cpu;
+        if (wanted) candidates.push_back(cpu);
+    }
+    MineThreadLayout layout;
+    if (candidates.empty()) return layout;
+
+    std::set<int> all_cores;
+    for (const MineCpu& cpu : candidates) all_cores.insert(cpu.core);
+    if (num_threads == 0)
+        num_threads = placement == MinePlacement::PHYSICAL_CORES ? (uint32_t)all_cores.size() : (uint32_t)candidates.size();
+
+    std::vector<MineCpu> used;
+    if (placement == MinePlacement::OS) {
+        std::vector<int> mask;  // the whole CPU set if one is given, otherwise not pinned at all
+        if (cpus != nullptr && num_cpus > 0)
+            for (const MineCpu& cpu : candidates) mask.push_back(cpu.cpu);
+        layout.thread_cpus.assign(num_threads, mask);
+        used = candidates;
+    }
+    else {
+        std::vector<MineCpu> ordered = order_cpus(candidates, placement);
+        for (uint32_t t = 0; t < num_threads; t++) {
+            const MineCpu& cpu = ordered[t % ordered.size()];
+            layout.thread_cpus.push_back({ cpu.cpu });
+            used.push_back(cpu);
+        }
+    }
+
+    std::set<int> cores, nodes;
+    for (const MineCpu& cpu : used) {
+        cores.insert(cpu.core);
+        nodes.insert(cpu.node);
+    }
+    layout.num_cores = (uint32_t)cores.size();
+    layout.num_nodes = (uint32_t)nodes.size();
+    return layout;
+}
@@ -0,0 +1,42 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef _MINE_TOPOLOGY_H_
+#define _MINE_TOPOLOGY_H_
+
+#include <cstdint>
+#include <vector>
+
+// where the worker threads go, see mine_xcoin_set_threads
+// OS: not pinned, the scheduler moves them around (within the CPU set if one is given)
+// PHYSICAL_CORES: one thread per physical core, SMT siblings are only used once every core has a thread
+// FILL_SMT: the SMT siblings of a core before the next core, leaves whole cores free for other services
+// SPREAD_NUMA: round robin over the NUMA nodes, one thread per physical core within each node first
+enum class MinePlacement : uint8_t { OS = 0, PHYSICAL_CORES = 1, FILL_SMT = 2, SPREAD_NUMA = 3 };
+
+// one logical CPU of the host
+struct MineCpu {
+    int cpu;    // logical CPU number, as the OS numbers them for affinity
+    int core;   // physical core, unique across packages
+    int node;   // NUMA node
+};
+
+// the logical CPUs each worker thread is pinned to (empty: not pinned), and how many physical cores and NUMA nodes they span
+struct MineThreadLayout {
+    std::vector<std::vector<int>> thread_cpus;
+    uint32_t num_cores = 0;
+    uint32_t num_nodes = 0;
+};
+
+// the logical CPUs this process may run on, sorted by number
+std::vector<MineCpu> host_cpus();
+
+// num_threads 0 is one thread per physical core for PHYSICAL_CORES, and one per logical CPU otherwise
+// cpus (num_cpus of them, can be null) restricts the threads to those logical CPUs, the ones the process cannot run on are dropped
+// returns a layout without threads if no CPU is left
+MineThreadLayout plan_threads(uint32_t num_threads, const int32_t cpus[], uint32_t num_cpus, MinePlacement placement);
+
+// pins the calling thread to the logical CPUs, false if the OS refused
+bool pin_current_thread(const std::vector<int>& cpus);
+
+#endif // _MINE_TOPOLOGY_H_
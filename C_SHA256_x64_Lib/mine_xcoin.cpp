@@ -4,251 +4,1312 @@
 #include "pch.h"
 
 #include "mine_xcoin.h"
+#include "mine_pool.h"
+#include "mine_scheduler.h"
+#include "mine_share_ring.h"
+#include "sha256_files.h"
 
-#if defined(_MSC_VER ) && defined(_WIN64)
-#define ALLOC_ALIGNED(A, S) (_aligned_malloc(S, A))
-#define FREE_ALIGNED(P) (_aligned_free(P))
-#endif
+// SHA256 round constants, for the nonce-invariant precomputation below
+static const uint32_t K256[64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
 
-#if defined(__GNUC__)
-#define ALLOC_ALIGNED(A, S) (std::aligned_alloc(A, S))
-#define FREE_ALIGNED(P) (std::free(P))
-#endif
+// initial state
+static const uint32_t SHA256_IV[DIGEST_NUM_WORDS] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
 
-// function for each thread
-void worker_mine(int thread_num, const uint8_t target[DIGEST_SIZE_BYTES], uint32_t state[DIGEST_NUM_WORDS], uint64_t nonce_result[1], uint32_t residual_message_len,
-    const uint8_t tail_message[], uint64_t tail_message_len, uint64_t nonce_beg, uint64_t nonce_step, std::atomic<int>& winning_thread,
-    SHA256_Acceleration use_acceleration, const std::chrono::duration<double>& timeout_seconds)
+static inline uint32_t rotr32(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+// one SHA256 round on the working variables a..h, wk is W[t] + K[t]
+static inline void sha256_round(uint32_t v[DIGEST_NUM_WORDS], uint32_t wk)
+{
+    uint32_t t1 = v[7] + (rotr32(v[4], 6) ^ rotr32(v[4], 11) ^ rotr32(v[4], 25)) + ((v[4] & v[5]) ^ (~v[4] & v[6])) + wk;
+    uint32_t t2 = (rotr32(v[0], 2) ^ rotr32(v[0], 13) ^ rotr32(v[0], 22)) + ((v[0] & v[1]) ^ (v[0] & v[2]) ^ (v[1] & v[2]));
+    for (int w = DIGEST_NUM_WORDS - 1; w > 0; w--) v[w] = v[w - 1];
+    v[4] += t1;
+    v[0] = t1 + t2;
+}
+
+// all the candidate tail messages are the same except for the nonce, so compute the rounds before the first nonce word,
+// and the whole message schedule of a second block without any nonce byte, only once per job, see Intel/sha256_mine.h
+// round_granularity is the number of rounds the kernel can start at a multiple of, e.g. 4 for SHA-NI
+void precompute_mine(SHA256_MINE_PRECOMP* precomp, const uint32_t state[DIGEST_NUM_WORDS], const uint8_t tail_message[], uint64_t tail_message_len,
+    uint32_t nonce_offset, uint32_t nonce_bytes, uint32_t round_granularity)
+{
+    uint32_t w[64];
+    for (int t = 0; t < 16; t++)    // message words are big endian
+        w[t] = byteswap32(((const uint32_t*)tail_message)[t]);
+
+    uint32_t start_round = nonce_offset / DIGEST_WORD_SIZE_BYTES;  // first word with a nonce byte
+    start_round -= start_round % round_granularity;
+    std::memcpy(precomp->state, state, DIGEST_SIZE_BYTES);
+    std::memcpy(precomp->round_state, state, DIGEST_SIZE_BYTES);
+    for (uint32_t t = 0; t < start_round; t++)
+        sha256_round(precomp->round_state, w[t] + K256[t]);
+    precomp->start_round = start_round;
+    precomp->flags = 0;
+
+    if (tail_message_len == 2 * BLOCK_SIZE_BYTES && nonce_offset + nonce_bytes <= BLOCK_SIZE_BYTES) {
+        for (int t = 0; t < 16; t++)
+            w[t] = byteswap32(((const uint32_t*)(tail_message + BLOCK_SIZE_BYTES))[t]);
+        for (int t = 16; t < 64; t++) {
+            uint32_t s0 = rotr32(w[t - 15], 7) ^ rotr32(w[t - 15], 18) ^ (w[t - 15] >> 3);
+            uint32_t s1 = rotr32(w[t - 2], 17) ^ rotr32(w[t - 2], 19) ^ (w[t - 2] >> 10);
+            w[t] = w[t - 16] + s0 + w[t - 7] + s1;
+        }
+        for (int t = 0; t < 64; t++)
+            precomp->tail_wk[t] = w[t] + K256[t];
+        precomp->flags |= SHA256_MINE_CONST_TAIL;
+    }
+
+    // the message words for the kernels that build the nonce words themselves, with the nonce bytes left at zero
+    // they OR in all 8 bytes of the nonce, the ones past a narrower nonce field are always zero
+    uint8_t msg[2 * BLOCK_SIZE_BYTES] = {};
+    std::memcpy(msg, tail_message, tail_message_len);
+    std::memset(msg + nonce_offset, 0x00, nonce_bytes);
+    for (int t = 0; t < 32; t++)
+        precomp->msg[t] = byteswap32(((const uint32_t*)msg)[t]);
+    precomp->nonce_word = nonce_offset / DIGEST_WORD_SIZE_BYTES;
+    precomp->nonce_shift = 8 * (nonce_offset % DIGEST_WORD_SIZE_BYTES);
+}
+
+// the SHA-NI function where the CPU has it and sha256_scalar otherwise, for the message prefixes of the jobs, the streaming API, see
+// sha256_stream_update, and the checks of the hits of the mining kernels
+// looked up at every call, as the dispatch table may not be filled in yet while the static objects of this file are
+static void sha256_blocks(uint32_t state[DIGEST_NUM_WORDS], const uint8_t data[], uint64_t num_blocks)
+{
+    sha256_dispatch().blocks(state, data, num_blocks);
+}
+
+// a 32-byte digest is always hashed again as a single block, this writes the padding after it
+static void pad_digest_block(uint8_t block[BLOCK_SIZE_BYTES])
+{
+    std::memset(block + DIGEST_SIZE_BYTES, 0x00, BLOCK_SIZE_BYTES - DIGEST_SIZE_BYTES);
+    block[DIGEST_SIZE_BYTES] = 0x80;
+    *((uint64_t*)(block + BLOCK_SIZE_BYTES - 8)) = byteswap64(DIGEST_SIZE_BYTES * 8ULL);
+}
+
+// the second hash of sha256d, digest is replaced with the hash of its big endian bytes
+static void sha256_of_digest(uint32_t digest[DIGEST_NUM_WORDS])
+{
+    uint8_t block[BLOCK_SIZE_BYTES];
+    for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)
+        ((uint32_t*)block)[w] = byteswap32(digest[w]);
+    pad_digest_block(block);
+    std::memcpy(digest, SHA256_IV, DIGEST_SIZE_BYTES);
+    sha256_blocks(digest, block, 1);
+}
+
+// a below b, both in digest/state form, i.e. the block ID of a is lower
+static bool digest_less(const uint32_t a[DIGEST_NUM_WORDS], const uint32_t b[DIGEST_NUM_WORDS])
+{
+    for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)
+        if (a[w] != b[w])
+            return a[w] < b[w];
+    return false;
+}
+
+// everything the workers need about one block template, mine_xcoin_replace swaps it as a whole
+struct MineTemplate {
+    uint32_t target_state[DIGEST_NUM_WORDS];    // target in digest/state form
+    uint32_t share_state[DIGEST_NUM_WORDS];     // share target in digest/state form, if has_shares
+    bool has_shares;
+    uint32_t state[DIGEST_NUM_WORDS];           // after the whole blocks before the nonce
+    uint8_t tail_message[BLOCK_SIZE_BYTES * 2]; // the message from the block of the nonce on, with the nonce zeroed, and padding, max 2 blocks
+    uint64_t tail_message_len;                  // 64 or 128
+    uint32_t nonce_offset;                      // 0~118, offset of the nonce in tail_message
+    uint32_t nonce_bytes;                       // 1~8, the nonces hashed are its bytes read little endian, see field_value
+    bool nonce_big_endian;                      // the field value is then nonce byte swapped
+    uint64_t max_nonce;                         // largest nonce the field holds
+    uint64_t message_len;                       // in bytes, nonce included
+
+    // the extranonce is written into roll_message, whose whole blocks are hashed from roll_state to state, the rest is the tail
+    uint32_t extranonce_bytes;                  // 0 for none
+    bool extranonce_big_endian;
+    uint64_t extranonce;                        // value of the field
+    uint64_t extranonce_offset;                 // in roll_message
+    uint32_t roll_state[DIGEST_NUM_WORDS];      // after the whole blocks before roll_message
+    std::vector<uint8_t> roll_message;          // from the block of the extranonce, or of the nonce if earlier, to the end
+    uint64_t roll_bytes_num;                    // of the whole blocks before the tail, 0 if the extranonce is in the tail
+
+    std::shared_ptr<MineScheduler> scheduler;   // hands out the nonces of this template to the workers
+};
+
+// largest value of a field of num_bytes
+static uint64_t max_field_value(uint32_t num_bytes)
+{
+    return num_bytes >= 8 ? UINT64_MAX : (1ULL << (8 * num_bytes)) - 1;
+}
+
+// the value of a field whose bytes, read little endian, are bytes_le
+static uint64_t field_value(uint64_t bytes_le, uint32_t num_bytes, bool big_endian)
+{
+    return big_endian ? byteswap64(bytes_le) >> (64 - 8 * num_bytes) : bytes_le;
+}
+
+// writes value into a field of num_bytes
+static void put_field(uint8_t field[], uint64_t value, uint32_t num_bytes, bool big_endian)
+{
+    for (uint32_t b = 0; b < num_bytes; b++)
+        field[b] = (uint8_t)(value >> (8 * (big_endian ? num_bytes - 1 - b : b)));
+}
+
+// the counters of one worker, a cache line of its own, only stored by the worker and loaded by mine_xcoin_telemetry
+struct alignas(64) MineWorkerCounters {
+    std::atomic<uint64_t> nonces_hashed{ 0 };
+    std::atomic<uint64_t> kernel_calls{ 0 };
+    std::atomic<uint64_t> kernel_cycles{ 0 };
+    std::atomic<uint64_t> loop_cycles{ 0 };
+    std::atomic<uint64_t> idle_lanes{ 0 };
+
+    // a plain store each, as there is only one writer
+    void publish(const MineStats& stats)
+    {
+        nonces_hashed.store(stats.nonces_hashed, std::memory_order_relaxed);
+        kernel_calls.store(stats.kernel_calls, std::memory_order_relaxed);
+        kernel_cycles.store(stats.kernel_cycles, std::memory_order_relaxed);
+        loop_cycles.store(stats.loop_cycles, std::memory_order_relaxed);
+        idle_lanes.store(stats.idle_lanes, std::memory_order_relaxed);
+    }
+    MineStats snapshot() const
+    {
+        return { nonces_hashed.load(std::memory_order_relaxed), kernel_calls.load(std::memory_order_relaxed), kernel_cycles.load(std::memory_order_relaxed),
+            loop_cycles.load(std::memory_order_relaxed), idle_lanes.load(std::memory_order_relaxed) };
+    }
+};
+
+// shares kept for the caller to drain, the workers drop the ones past this until it does
+const uint32_t MINE_SHARE_RING_SIZE = 1024;
+
+// an asynchronous mining job, see mine_xcoin_start
+struct MineJob {
+    SHA256_Acceleration use_acceleration;
+    int num_lanes;
+    uint32_t num_threads;
+    uint32_t num_cores;
+    uint32_t num_nodes;
+    bool double_sha256;     // MINE_FLAG_SHA256D
+    std::mutex roll_mutex;  // one template change at a time, be it an extranonce roll or mine_xcoin_replace
+    uint64_t watchdog_timer;    // raises the early abort at the deadline, see mine_watchdog
+    std::chrono::steady_clock::time_point start;
+    std::unique_ptr<MineWorkerCounters[]> counters;     // one per worker thread
+    MineShareRing share_ring{ MINE_SHARE_RING_SIZE };
+
+    std::shared_ptr<const MineTemplate> tmpl;   // only through std::atomic_load and std::atomic_store
+    std::atomic<uint32_t> epoch{ 0 };           // bumped after tmpl is replaced, the workers check it between kernel calls
+    std::atomic<int> winning_thread{ -1 };      // this is how the threads let each other know when to stop i.e. once this is positive, then stop because we have a winner, or early abort (zero)
+                                                // the early abort comes from the watchdog at the deadline or from mine_xcoin_cancel, the workers only load it
+    std::atomic<uint32_t> active_workers{ 0 };  // the workers of threads 1 to this one claim nonces, the others are parked
+
+    // the lowest digest of epoch best_epoch, only improved by the workers, see update_best
+    std::mutex best_mutex;
+    bool has_best = false;
+    uint32_t best_epoch = 0;
+    uint32_t best_state[DIGEST_NUM_WORDS];
+    uint64_t best_nonce = 0;
+    uint64_t best_extranonce = 0;
+
+    // set by the pool once all the workers have returned
+    std::mutex mutex;
+    std::condition_variable finished_cv;
+    bool finished = false;
+    std::chrono::steady_clock::time_point end;
+    uint32_t result_state[DIGEST_NUM_WORDS];
+    uint64_t result_nonce = 0;
+    uint64_t result_extranonce = 0;
+    bool resume_won = false;                    // the best digest of the checkpoint resumed from is below the target
+    uint64_t coverage_frontier = 0;             // of the last template, see MineScheduler::coverage
+    std::vector<std::pair<uint64_t, uint64_t>> coverage_gaps;
+};
+
+// writes the extranonce, hashes the whole blocks of roll_message and lays out the padded tail block(s) from the rest
+static void lay_out_tail(MineTemplate& tmpl)
+{
+    uint8_t* roll_message = tmpl.roll_message.data();
+    if (tmpl.extranonce_bytes > 0)
+        put_field(roll_message + tmpl.extranonce_offset, tmpl.extranonce, tmpl.extranonce_bytes, tmpl.extranonce_big_endian);
+
+    uint64_t roll_bytes_num = tmpl.roll_bytes_num;
+    std::memcpy(tmpl.state, tmpl.roll_state, DIGEST_SIZE_BYTES);
+    if (roll_bytes_num > 0)
+        sha256_blocks(tmpl.state, roll_message, roll_bytes_num / BLOCK_SIZE_BYTES);
+
+    // the residual message is 1~119 bytes, nonce included, 1 byte for the 1 bit, 8 bytes for length
+    // tail_message_len should be either 64 bytes (512 bits) or 128 bytes (512 bits x 2)
+    uint64_t residual_message_len = tmpl.roll_message.size() - roll_bytes_num;
+    uint64_t num_chunks_left = 1ULL;  // 1 or 2
+    if (residual_message_len > BLOCK_SIZE_BYTES - 8 - 1) num_chunks_left = 2ULL;
+    uint64_t tail_message_len = BLOCK_SIZE_BYTES * num_chunks_left;
+    uint8_t* tail_message = tmpl.tail_message;
+    std::memset(tail_message, 0x00, sizeof(tmpl.tail_message));
+    std::memcpy(tail_message, roll_message + roll_bytes_num, residual_message_len);  // copy the residual message into tail message
+
+    // the 1 bit in padding after the message
+    tail_message[residual_message_len] = 0x80;
+    // total length excluding padding, in bytes, below is in bits
+    uint64_t total_bitlen_ex_pad = tmpl.message_len * 8ULL;   // times 8 to convert from bytes to bits
+    // now fill into padding using big endian i.e. lowest memory index is most significant byte
+    *((uint64_t*)(tail_message + tail_message_len - 8)) = byteswap64(total_bitlen_ex_pad);
+    tmpl.tail_message_len = tail_message_len;
+}
+
+// hash the whole blocks before the nonce and lay out the padded tail block(s)
+// without a layout the nonce is appended to the message, 8 bytes little endian, returns null if the layout does not fit the message
+static std::shared_ptr<MineTemplate> make_template(const uint8_t target[DIGEST_SIZE_BYTES], const uint8_t message_ex_nonce[], uint64_t len_bytes,
+    const uint8_t share_target[DIGEST_SIZE_BYTES], const MineNonceLayout* layout)
 {
-    auto start = std::chrono::steady_clock::now();
+    MineNonceLayout appended = { len_bytes, 0, 0, (uint32_t)NONCE_SIZE_BYTES, 0, 0, 0 };
+    uint64_t message_len = layout == nullptr ? len_bytes + NONCE_SIZE_BYTES : len_bytes;
+    if (layout == nullptr)
+        layout = &appended;
+    else {
+        if (layout->nonce_bytes < 1 || layout->nonce_bytes > NONCE_SIZE_BYTES || layout->nonce_bytes > len_bytes
+                || layout->nonce_offset > len_bytes - layout->nonce_bytes)
+            return nullptr;
+        if (layout->extranonce_bytes > 0) {
+            if (layout->extranonce_bytes > 8 || layout->extranonce_bytes > len_bytes || layout->extranonce_offset > len_bytes - layout->extranonce_bytes
+                    || layout->extranonce_start > max_field_value(layout->extranonce_bytes))
+                return nullptr;
+            if (layout->extranonce_offset < layout->nonce_offset + layout->nonce_bytes && layout->nonce_offset < layout->extranonce_offset + layout->extranonce_bytes)
+                return nullptr;     // overlapping fields
+        }
+    }
+    uint64_t tail_start = layout->nonce_offset / BLOCK_SIZE_BYTES * BLOCK_SIZE_BYTES;   // the tail is the block of the nonce on
+    if (message_len - tail_start > 2 * BLOCK_SIZE_BYTES - 8 - 1)
+        return nullptr;
 
-    int num_lanes = lane_counts[(uint8_t)use_acceleration];
-    uint64_t num_blocks = tail_message_len / BLOCK_SIZE_BYTES; // block size 64 bytes (512 bits), should be either 1 or 2
-    assert(num_blocks == 1 || num_blocks == 2);
+    auto tmpl = std::make_shared<MineTemplate>();
 
     // convert target number to state - see below in the search loop
-    uint32_t target_state[DIGEST_NUM_WORDS];
-    std::memset(target_state, 0, DIGEST_SIZE_BYTES);
-    uint32_t* target_ptr32 = (uint32_t*)target;
+    const uint32_t* target_ptr32 = (const uint32_t*)target;
     for (int w = 0; w < DIGEST_NUM_WORDS; w++) // convert big endian 32-byte integer (stored in a byte array) into digest/state form
-        target_state[w] = byteswap32(target_ptr32[w]);
+        tmpl->target_state[w] = byteswap32(target_ptr32[w]);
+    tmpl->has_shares = share_target != nullptr;
+    const uint32_t* share_ptr32 = (const uint32_t*)(tmpl->has_shares ? share_target : target);
+    for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)
+        tmpl->share_state[w] = byteswap32(share_ptr32[w]);
 
-    // copy start states or digests, and create test tail messages and point the nonces to their right location
-    // do not use the new[] aligned, Visual C++ throws exception on delete[], no idea why
-    // uint32_t* start_states = (uint32_t*) operator new[](sizeof(uint32_t) * (num_lanes* DIGEST_SIZE_BYTES), (std::align_val_t)(64)); // alignment just in case faster
-    // uint8_t* test_tail_messages = (uint8_t*) operator new[](sizeof(uint8_t) * (num_lanes* tail_message_len), (std::align_val_t)(64));   // alignment just in case faster
-    uint32_t* start_states = (uint32_t*)ALLOC_ALIGNED(64, sizeof(uint32_t) * num_lanes * DIGEST_SIZE_BYTES);  // alignment just in case faster
-    uint8_t* test_tail_messages = (uint8_t*)ALLOC_ALIGNED(64, sizeof(uint8_t) * num_lanes * tail_message_len);    // alignment just in case faster
+    // the blocks from the one the extranonce starts in are hashed again at every roll, the ones before only here
+    uint64_t roll_start = tail_start;
+    if (layout->extranonce_bytes > 0)
+        roll_start = std::min(roll_start, layout->extranonce_offset / BLOCK_SIZE_BYTES * BLOCK_SIZE_BYTES);
+    std::memcpy(tmpl->roll_state, SHA256_IV, DIGEST_SIZE_BYTES);
+    if (roll_start > 0)
+        sha256_blocks(tmpl->roll_state, message_ex_nonce, roll_start / BLOCK_SIZE_BYTES);
+    tmpl->roll_message.assign(message_ex_nonce + roll_start, message_ex_nonce + len_bytes);
+    tmpl->roll_message.resize(message_len - roll_start, 0x00);     // the appended nonce
+    std::memset(tmpl->roll_message.data() + (layout->nonce_offset - roll_start), 0x00, layout->nonce_bytes);
 
-    for (int j = 0; j < num_lanes; j++) {
-        for (int w = 0; w < DIGEST_NUM_WORDS; w++) start_states[w * num_lanes + j] = state[w];  // transposed form
-        std::memcpy(test_tail_messages + j * tail_message_len, tail_message, tail_message_len); // this is NOT in transposed form, because these are pointed to
+    tmpl->nonce_offset = (uint32_t)(layout->nonce_offset - tail_start);
+    tmpl->nonce_bytes = layout->nonce_bytes;
+    tmpl->nonce_big_endian = layout->nonce_big_endian != 0;
+    tmpl->max_nonce = max_field_value(layout->nonce_bytes);
+    tmpl->message_len = message_len;
+    tmpl->extranonce_bytes = layout->extranonce_bytes;
+    tmpl->extranonce_big_endian = layout->extranonce_big_endian != 0;
+    tmpl->extranonce = layout->extranonce_start;
+    tmpl->extranonce_offset = layout->extranonce_bytes > 0 ? layout->extranonce_offset - roll_start : 0;
+    tmpl->roll_bytes_num = tail_start - roll_start;
+    lay_out_tail(*tmpl);
+    return tmpl;
+}
+
+// the same template with the next extranonce, null if there is no extranonce or it is already the largest one
+// only the blocks from the one the extranonce starts in are hashed again
+static std::shared_ptr<MineTemplate> roll_template(const MineTemplate& current)
+{
+    if (current.extranonce_bytes == 0 || current.extranonce == max_field_value(current.extranonce_bytes))
+        return nullptr;
+    auto tmpl = std::make_shared<MineTemplate>(current);
+    tmpl->extranonce++;
+    tmpl->scheduler = nullptr;
+    lay_out_tail(*tmpl);
+    return tmpl;
+}
+
+// identifies the message, with the nonce zeroed and the extranonce written, the layout and the mode flags of a checkpoint
+// one compression of the SHA256 of the message followed by the positions and widths of the fields, and the flags
+static void template_fingerprint(const MineTemplate& tmpl, uint32_t mode_flags, uint8_t fingerprint[DIGEST_SIZE_BYTES])
+{
+    uint32_t digest[DIGEST_NUM_WORDS];
+    std::memcpy(digest, tmpl.state, DIGEST_SIZE_BYTES);
+    sha256_blocks(digest, tmpl.tail_message, tmpl.tail_message_len / BLOCK_SIZE_BYTES);
+
+    uint64_t roll_start = tmpl.message_len - tmpl.roll_message.size();
+    uint64_t block[BLOCK_SIZE_BYTES / 8] = {};
+    for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)
+        ((uint32_t*)block)[w] = byteswap32(digest[w]);
+    block[4] = roll_start + tmpl.roll_bytes_num + tmpl.nonce_offset;
+    block[5] = tmpl.extranonce_bytes > 0 ? roll_start + tmpl.extranonce_offset : 0;
+    block[6] = tmpl.nonce_bytes | (tmpl.extranonce_bytes << 8) | ((uint32_t)tmpl.nonce_big_endian << 16) | ((uint32_t)tmpl.extranonce_big_endian << 24);
+    block[7] = mode_flags;
+    std::memcpy(digest, SHA256_IV, DIGEST_SIZE_BYTES);
+    sha256_blocks(digest, (const uint8_t*)block, 1);
+    for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)
+        ((uint32_t*)fingerprint)[w] = byteswap32(digest[w]);
+}
+
+// moves the template on to the extranonce of the checkpoint, false if that is not one of the template's or the fingerprints differ
+static bool resume_template(MineTemplate& tmpl, const MineCheckpoint& checkpoint, uint32_t mode_flags)
+{
+    if (tmpl.extranonce_bytes == 0 ? checkpoint.extranonce != 0 : checkpoint.extranonce > max_field_value(tmpl.extranonce_bytes))
+        return false;
+    if (checkpoint.extranonce != tmpl.extranonce) {
+        tmpl.extranonce = checkpoint.extranonce;
+        lay_out_tail(tmpl);
     }
-    uint64_t* nonce_ptrs[SHA256_MAX_LANES];
-    for (int j = 0; j < num_lanes; j++)
-        nonce_ptrs[j] = (uint64_t*)&(test_tail_messages[residual_message_len + j * tail_message_len]);  // NOT transposed, see above
+    uint8_t fingerprint[DIGEST_SIZE_BYTES];
+    template_fingerprint(tmpl, mode_flags, fingerprint);
+    return std::memcmp(fingerprint, checkpoint.fingerprint, DIGEST_SIZE_BYTES) == 0;
+}
 
-    // now search for the winning nonce!
-    alignas(64) struct {
-        uint32_t digest[DIGEST_NUM_WORDS * SHA256_MAX_LANES];
-        uint8_t* data_ptr[SHA256_MAX_LANES];
-    } args_generic; // all the vector functions use the same sized struct, see inside the file sha256_mb_wrapper.h
-    for (int j = 0; j < num_lanes; j++)
-        args_generic.data_ptr[j] = test_tail_messages + tail_message_len * j;
-    uint64_t last_nonce = MAX_NONCE - ((MAX_NONCE - nonce_beg) % nonce_step);
-    uint64_t next_check_nonce = 0;  // for timer
-    for (uint64_t nonce = nonce_beg; nonce <= last_nonce; nonce+=nonce_step) {
-        // check for timeout
-        if (nonce_beg == 0 && nonce >= next_check_nonce) {   // save time, only check timer in 1 thread
-            auto end = std::chrono::steady_clock::now();
-            std::chrono::duration<double> elapsed = end - start;
-            if (elapsed > timeout_seconds)  winning_thread = 0; // signal early exit
-            if (nonce > nonce_step) {
-                auto remaining = timeout_seconds - elapsed;
-                double nonces_done = nonce - nonce_step;
-                // estimate a jump ahead before checking the timer again
-                next_check_nonce = nonce + uint64_t(nonces_done * (remaining / elapsed) * 0.5); // last factor is for conservatism, must be less than 1
-            }
+// batches of nonces per claim from the scheduler, and per call of the looping kernels, a few milliseconds
+// the active worker count is only checked between two claims, and the stop flag between two kernel calls, so this bounds how late a worker stops
+const uint64_t MINE_LOOP_BATCHES = 1ULL << 14;
+// how often a parked worker checks whether it is active again
+const std::chrono::milliseconds MINE_PARKED_POLL(1);
+// the functions hashing one batch per call are timed on one call in this many, as rdtsc can cost a good part of a batch
+const uint64_t MINE_TSC_SAMPLE = 64;
+
+// cycles between two back to back rdtsc, taken off every timed call before it is scaled up to the calls not timed
+static uint64_t tsc_overhead()
+{
+    static const uint64_t overhead = [] {
+        uint64_t least = UINT64_MAX;
+        for (int i = 0; i < 16; i++) {
+            uint64_t first = __rdtsc();
+            least = std::min<uint64_t>(least, __rdtsc() - first);
         }
+        return least;
+    }();
+    return overhead;
+}
+// longer timeouts never expire, about 30 years, so that the deadline cannot overflow the clock
+const double MINE_MAX_TIMEOUT_SECONDS = 1e9;
 
-        if (winning_thread >= 0) {   // early exit, another worker has won, or early abort signaled (zero)
-            FREE_ALIGNED(start_states);
-            FREE_ALIGNED(test_tail_messages);
-            return;
+// the deadline of a timeout counted from now, negative is already past
+static std::chrono::steady_clock::time_point deadline_after(double timeout_seconds)
+{
+    if (!(timeout_seconds < MINE_MAX_TIMEOUT_SECONDS))  // NaN too
+        timeout_seconds = MINE_MAX_TIMEOUT_SECONDS;
+    if (timeout_seconds < 0.0)
+        timeout_seconds = 0.0;
+    return std::chrono::steady_clock::now()
+        + std::chrono::duration_cast<std::chrono::steady_clock::duration>(std::chrono::duration<double>(timeout_seconds));
+}
+
+// moves the job on to the next extranonce of tmpl, unless another worker or mine_xcoin_replace has already changed the template
+// returns false if tmpl is still the template, and has no next extranonce
+static bool roll_extranonce(MineJob& job, const std::shared_ptr<const MineTemplate>& tmpl)
+{
+    std::lock_guard<std::mutex> lock(job.roll_mutex);
+    if (std::atomic_load(&job.tmpl) != tmpl)
+        return true;
+    std::shared_ptr<MineTemplate> rolled = roll_template(*tmpl);
+    if (rolled == nullptr)
+        return false;
+    rolled->scheduler = std::make_shared<MineScheduler>(job.num_threads, job.num_lanes, rolled->max_nonce);
+    std::atomic_store(&job.tmpl, std::shared_ptr<const MineTemplate>(rolled));  // same epoch, the hits of the last extranonce are still good
+    return true;
+}
+
+// best_state is the lowest digest a worker has seen, the job's one replaces it if lower, and digest the job's one if lower still
+// a worker on a replaced template (stale epoch) leaves the job's one alone
+static void update_best(MineJob& job, uint32_t epoch, const uint32_t digest[DIGEST_NUM_WORDS], uint64_t nonce, uint64_t extranonce,
+    uint32_t best_state[DIGEST_NUM_WORDS])
+{
+    std::lock_guard<std::mutex> lock(job.best_mutex);
+    if (digest != nullptr && job.epoch.load(std::memory_order_relaxed) == epoch
+            && (!job.has_best || job.best_epoch != epoch || digest_less(digest, job.best_state))) {
+        std::memcpy(job.best_state, digest, DIGEST_SIZE_BYTES);
+        job.best_nonce = nonce;
+        job.best_extranonce = extranonce;
+        job.best_epoch = epoch;
+        job.has_best = true;
+    }
+    if (job.has_best && job.best_epoch == epoch && digest_less(job.best_state, best_state))
+        std::memcpy(best_state, job.best_state, DIGEST_SIZE_BYTES);
+}
+
+// function for each thread
+// the nonces come from the scheduler of the template, in contiguous ranges, see mine_scheduler.h
+// the template is reloaded between two kernel calls whenever mine_xcoin_replace has bumped the epoch, and once the nonces of an
+// extranonce are all handed out
+void worker_mine(int thread_num, MineJob& job, MineArena& arena, MineResultSlot& result)
+{
+    SHA256_Acceleration use_acceleration = job.use_acceleration;
+    int num_lanes = job.num_lanes;
+    uint32_t worker = thread_num - 1;
+    std::atomic<int>& winning_thread = job.winning_thread;
+
+    // counted locally, and published to the worker's own cache line after every timed kernel call and on return
+    MineStats stats = {};
+    struct PublishOnReturn {
+        MineWorkerCounters& counters;
+        const MineStats& stats;
+        ~PublishOnReturn() { counters.publish(stats); }
+    } publish_on_return{ job.counters[worker], stats };
+    // the loop cycles are the cycles since the start, less the kernel cycles and the parked ones
+    uint64_t tsc_start = __rdtsc();
+    uint64_t tsc_parked = 0;
+    uint64_t tsc_timer = tsc_overhead();
+
+    if (job.resume_won) {   // nothing to hash, thread 1 reports the best digest of the checkpoint
+        if (thread_num == 1) {
+            std::lock_guard<std::mutex> lock(job.best_mutex);
+            std::memcpy(result.state, job.best_state, DIGEST_SIZE_BYTES);
+            result.nonce = job.best_nonce;
+            result.extranonce = job.best_extranonce;
+            winning_thread = thread_num;
         }
+        return;
+    }
 
-        // extra calc for final nonce when lanes > 1
-        uint64_t j_max = num_lanes - 1ULL;
-        if (nonce > MAX_NONCE - j_max)    // if nonce + j_max > MAX_NONCE
-            j_max = MAX_NONCE - nonce;    // so that nonce + j_max = MAX_NONCE
-        // copy state, start over
-        std::memcpy(args_generic.digest, start_states, num_lanes * DIGEST_SIZE_BYTES);
-        for (uint64_t j = 0; j <= j_max; j++)
-            *nonce_ptrs[j] = nonce + j; // fill little endian, this will modify test_tail_messages
-
-        // pick the SHA256 function to call
-        uint8_t checking[128];
-        std::memcpy(checking, args_generic.data_ptr[0], 128);
-        switch (use_acceleration) {
-            case SHA256_Acceleration::SHA:
-                sha256_sha_sse41(args_generic.digest, args_generic.data_ptr[0], num_blocks);
-                break;
-            case SHA256_Acceleration::AVX512:
-                sha256_mb_x16_avx512_wrapper((SHA256_MB_ARGS_X16*)&args_generic, num_blocks);
-                break;
-            case SHA256_Acceleration::AVX2:
-                sha256_mb_x8_avx2_wrapper((SHA256_MB_ARGS_X8*)&args_generic, num_blocks);
-                break;
-            case SHA256_Acceleration::AVX:
-                sha256_mb_x4_avx_wrapper((SHA256_MB_ARGS_X4*)&args_generic, num_blocks);
-                break;
-            case SHA256_Acceleration::SSE41:
-                sha256_mb_x4_sse_wrapper((SHA256_MB_ARGS_X4*)&args_generic, num_blocks);
-                break;
-            default:    // plain C
-                sha256_process(args_generic.digest, args_generic.data_ptr[0], (uint32_t)tail_message_len);
-                break;
+    for (;;) {  // once per template
+        uint32_t epoch = job.epoch.load(std::memory_order_acquire);
+        std::shared_ptr<const MineTemplate> tmpl = std::atomic_load(&job.tmpl);
+        const uint32_t* state = tmpl->state;
+        const uint32_t* target_state = tmpl->target_state;
+        const uint8_t* tail_message = tmpl->tail_message;
+        uint64_t tail_message_len = tmpl->tail_message_len;
+        uint32_t nonce_offset = tmpl->nonce_offset;
+        uint32_t nonce_bytes = tmpl->nonce_bytes;
+        uint64_t max_nonce = tmpl->max_nonce;
+
+        uint64_t num_blocks = tail_message_len / BLOCK_SIZE_BYTES; // block size 64 bytes (512 bits), should be either 1 or 2
+        assert(num_blocks == 1 || num_blocks == 2);
+
+        // copy start states or digests, and create test tail messages and point the nonces to their right location
+        // for sha256d the generic functions hash the digests again, from the initial state, as one padded block per lane
+        // all live in this thread's arena, which is kept by the pool across calls, so nothing is allocated once it is big enough
+        uint64_t states_size = num_lanes * DIGEST_SIZE_BYTES;
+        uint64_t test_tail_messages_size = num_lanes * tail_message_len;
+        uint8_t* arena_ptr = arena.reserve(2 * states_size + test_tail_messages_size + num_lanes * BLOCK_SIZE_BYTES);
+        uint32_t* start_states = (uint32_t*)arena_ptr;
+        uint32_t* iv_states = (uint32_t*)(arena_ptr + states_size);
+        uint8_t* test_tail_messages = arena_ptr + 2 * states_size;  // a multiple of 64, keeps the blocks aligned
+        uint8_t* digest_blocks = test_tail_messages + test_tail_messages_size;
+
+        for (int j = 0; j < num_lanes; j++) {
+            for (int w = 0; w < DIGEST_NUM_WORDS; w++) start_states[w * num_lanes + j] = state[w];  // transposed form
+            for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++) iv_states[w * num_lanes + j] = SHA256_IV[w];
+            std::memcpy(test_tail_messages + j * tail_message_len, tail_message, tail_message_len); // this is NOT in transposed form, because these are pointed to
+            pad_digest_block(digest_blocks + j * BLOCK_SIZE_BYTES);
         }
-        // the Intel vector functions increments the pointers because it has a reference to them through the args struct, so we need to undo that
-        if (num_lanes > 1) {
+        uint8_t* nonce_ptrs[SHA256_MAX_LANES];
+        for (int j = 0; j < num_lanes; j++)
+            nonce_ptrs[j] = &(test_tail_messages[nonce_offset + j * tail_message_len]);  // NOT transposed, see above
+        // fill little endian, this will modify test_tail_messages, only the bytes of the field for a narrower nonce
+        auto put_nonce = [&](int j, uint64_t lane_nonce) {
+            if (nonce_bytes == NONCE_SIZE_BYTES)
+                *(uint64_t*)nonce_ptrs[j] = lane_nonce;
+            else
+                std::memcpy(nonce_ptrs[j], &lane_nonce, nonce_bytes);
+        };
+
+        // the mining kernels start from the nonce-invariant rounds, and neither need the digest reset nor move the data pointers
+        // all of them, and the generic functions below, are looked up once per template and called through their pointers
+        const sha256_mine_loop_function mine_loop = sha256_dispatch().mine_loop[(uint8_t)use_acceleration];
+        bool loop_kernel = mine_loop != nullptr;
+        bool mine_kernel = loop_kernel || use_acceleration == SHA256_Acceleration::SHA;
+        alignas(64) SHA256_MINE_PRECOMP precomp;
+        precompute_mine(&precomp, state, tail_message, tail_message_len, nonce_offset, nonce_bytes, use_acceleration == SHA256_Acceleration::SHA ? 4 : 1);
+        // the kernels only finish H0, a hit on it is verified in full below, against the block target and the share target at once
+        const uint32_t* share_state = tmpl->share_state;
+        bool has_shares = tmpl->has_shares;
+        // and so do the lanes up to the best H0 so far, which gets lower fast, so that the best digest is known, see mine_xcoin_best
+        uint32_t h0_threshold = has_shares ? std::max(target_state[0], share_state[0]) : target_state[0];
+        uint32_t best_state[DIGEST_NUM_WORDS];
+        std::memset(best_state, 0xFF, DIGEST_SIZE_BYTES);
+        update_best(job, epoch, nullptr, 0, 0, best_state);
+        precomp.h0_threshold = std::max(h0_threshold, best_state[0]);
+        if (job.double_sha256)
+            precomp.flags |= SHA256_MINE_DOUBLE;    // the mining kernels hash the digest again straight from their registers
+
+        // now search for the winning nonce!
+        alignas(64) struct {
+            uint32_t digest[DIGEST_NUM_WORDS * SHA256_MAX_LANES];
+            uint8_t* data_ptr[SHA256_MAX_LANES];
+        } args_generic; // all the vector functions use the same sized struct, see inside the file sha256_mb_wrapper.h
+        // one pass of the generic functions over num_lanes messages of data_blocks each, from the digests already in args_generic
+        const sha256_lanes_function hash_lanes = sha256_dispatch().lanes[(uint8_t)use_acceleration];
+        auto hash_generic = [&](uint8_t* data, uint64_t data_blocks) {
+            // the Intel vector functions increment the pointers because they have a reference to them through the args struct, so set them every time
             for (int j = 0; j < num_lanes; j++)
-                args_generic.data_ptr[j] -= tail_message_len;
-        }
-        
-        // check if any of the result(s) is a winner
-        for (int j = 0; j <= j_max; j++) {
-            bool found = false;
-            for (int w = 0; w < DIGEST_NUM_WORDS; w++) {
-                uint32_t test_val = args_generic.digest[w * num_lanes + j];  // this is in transposed form
-                uint32_t target_val = target_state[w];
-                if (test_val < target_val) {
-                    found = true;
+                args_generic.data_ptr[j] = data + data_blocks * BLOCK_SIZE_BYTES * j;
+            hash_lanes((SHA256_MB_ARGS_X16*)&args_generic, data_blocks);
+        };
+        bool replaced = false;  // or rolled, either way the template is loaded again
+        MineScheduler& scheduler = *tmpl->scheduler;
+        uint64_t nonce = 0;         // nonce of lane 0 of the next batch to hash
+        uint64_t batches_left = 0;  // of the range claimed from the scheduler
+        // the claimed batches a worker stops before are reported as not hashed
+        auto stop_early = [&] { scheduler.unfinished(worker, nonce / num_lanes, batches_left); };
+        for (;;) {
+            if (batches_left == 0) {
+                if (winning_thread.load(std::memory_order_relaxed) >= 0)    // early exit, another worker has won, or early abort signaled (zero)
+                    return;
+                if (job.epoch.load(std::memory_order_relaxed) != epoch) {  // new template, start over with its own scheduler
+                    replaced = true;
                     break;
                 }
-                if (test_val > target_val) {
-                    found = false;
+                uint32_t num_active = job.active_workers.load(std::memory_order_relaxed);
+                if (worker >= num_active) {     // parked, the active workers take over the rest of this worker's range
+                    uint64_t tsc_sleep = __rdtsc();
+                    std::this_thread::sleep_for(MINE_PARKED_POLL);
+                    tsc_parked += __rdtsc() - tsc_sleep;
+                    continue;
+                }
+                uint64_t first_batch;
+                if (!scheduler.claim(worker, num_active, MINE_LOOP_BATCHES, first_batch, batches_left)) {
+                    // the whole nonce space is hashed or being hashed, go on with the next extranonce if there is one
+                    // the other workers finish their batches of this template first, so no lane waits for the roll
+                    replaced = roll_extranonce(job, tmpl);
                     break;
                 }
+                nonce = first_batch * num_lanes;
             }
-            if (found) {
-                winning_thread = thread_num;   // signal other workers to stop immediately
-                for (int w = 0; w < DIGEST_NUM_WORDS; w++)  // copy result to output
-                    state[w] = args_generic.digest[w * num_lanes + j]; // this is in transposed form
-                nonce_result[0] = nonce + j; // copy result to output
-                FREE_ALIGNED(start_states);
-                FREE_ALIGNED(test_tail_messages);
+
+            if (winning_thread.load(std::memory_order_relaxed) >= 0) {  // early exit, another worker has won, or early abort signaled (zero)
+                stop_early();
                 return;
             }
+            if (job.epoch.load(std::memory_order_relaxed) != epoch) {
+                replaced = true;
+                break;
+            }
+
+            uint64_t hit_nonce = nonce;  // nonce of lane 0 of the batch the hits are for
+            uint32_t hits = 0xFFFFFFFF;  // lanes worth checking, the generic functions give full digests for all of them
+            uint64_t tsc_sample = loop_kernel ? 1 : MINE_TSC_SAMPLE;
+            bool timed = stats.kernel_calls % tsc_sample == 0;
+            uint64_t tsc_kernel_start = 0, tsc_kernel_end = 0;
+            if (loop_kernel) {
+                // the x16 and x8 kernels build the nonces themselves and stay in their registers for many batches
+                SHA256_MINE_RANGE range = { nonce, batches_left, 0, (uint64_t)num_lanes };
+                uint64_t batches = range.iterations;
+                tsc_kernel_start = timed ? __rdtsc() : 0;
+                hits = mine_loop(&precomp, &range, num_blocks);
+                tsc_kernel_end = timed ? __rdtsc() : 0;
+                batches_left -= batches - range.iterations;
+                stats.nonces_hashed += (batches - range.iterations) * num_lanes;
+                nonce = range.nonce;
+                hit_nonce = range.hit_nonce;
+            }
+            else {
+                // extra calc for final nonce when lanes > 1
+                uint64_t j_max = num_lanes - 1ULL;
+                if (nonce > max_nonce - j_max)    // if nonce + j_max > max_nonce
+                    j_max = max_nonce - nonce;    // so that nonce + j_max = max_nonce
+                for (uint64_t j = 0; j <= j_max; j++)
+                    put_nonce((int)j, nonce + j);
+
+                tsc_kernel_start = timed ? __rdtsc() : 0;
+                if (mine_kernel)
+                    hits = sha256_mine_sha_sse41(test_tail_messages, &precomp, num_blocks);
+                else {
+                    // copy state, start over
+                    std::memcpy(args_generic.digest, start_states, num_lanes * DIGEST_SIZE_BYTES);
+                    hash_generic(test_tail_messages, num_blocks);
+                    if (job.double_sha256) {    // the digests become the messages of the second hash
+                        for (int j = 0; j < num_lanes; j++)
+                            for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)
+                                ((uint32_t*)(digest_blocks + j * BLOCK_SIZE_BYTES))[w] = byteswap32(args_generic.digest[w * num_lanes + j]);
+                        std::memcpy(args_generic.digest, iv_states, num_lanes * DIGEST_SIZE_BYTES);
+                        hash_generic(digest_blocks, 1);
+                    }
+                }
+                tsc_kernel_end = timed ? __rdtsc() : 0;
+                batches_left--;
+                stats.nonces_hashed += num_lanes;
+                nonce += num_lanes;
+            }
+            stats.kernel_calls++;
+            if (timed) {    // the calls not timed are taken to be as long as this one
+                uint64_t tsc_kernel = tsc_kernel_end - tsc_kernel_start;
+                stats.kernel_cycles += (tsc_kernel > tsc_timer ? tsc_kernel - tsc_timer : 0) * tsc_sample;
+                uint64_t tsc_busy = tsc_kernel_end - tsc_start - tsc_parked;
+                stats.loop_cycles = tsc_busy > stats.kernel_cycles ? tsc_busy - stats.kernel_cycles : 0;
+                job.counters[worker].publish(stats);
+            }
+
+            // check if any of the result(s) is a winner
+            uint64_t j_max = num_lanes - 1ULL;
+            if (hit_nonce > max_nonce - j_max) {    // lanes past max_nonce are not candidates
+                j_max = max_nonce - hit_nonce;
+                stats.idle_lanes += num_lanes - 1 - j_max;
+            }
+            for (int j = 0; j <= j_max; j++) {
+                if (!((hits >> j) & 1))
+                    continue;
+                if (mine_kernel) {  // only H0 passed the target, recompute the full digest of this lane to check the rest
+                    put_nonce(j, hit_nonce + j);   // the loop kernels never wrote it
+                    uint32_t digest[DIGEST_NUM_WORDS];
+                    std::memcpy(digest, state, DIGEST_SIZE_BYTES);
+                    sha256_blocks(digest, test_tail_messages + j * tail_message_len, tail_message_len / BLOCK_SIZE_BYTES);
+                    if (job.double_sha256)
+                        sha256_of_digest(digest);
+                    for (int w = 0; w < DIGEST_NUM_WORDS; w++)
+                        args_generic.digest[w * num_lanes + j] = digest[w]; // transposed form, as the generic functions leave it
+                }
+                // one pass over the digest for both targets, each one decided at the first word that differs from it
+                int vs_target = 0;                  // -1 below, 1 above, 0 equal so far
+                int vs_share = has_shares ? 0 : 1;  // the same, 1 when there is no share target
+                for (uint64_t w = 0; w < DIGEST_NUM_WORDS && (vs_target == 0 || vs_share == 0); w++) {
+                    uint32_t test_val = args_generic.digest[w * num_lanes + j];  // this is in transposed form
+                    if (vs_target == 0)
+                        vs_target = test_val < target_state[w] ? -1 : test_val > target_state[w] ? 1 : 0;
+                    if (vs_share == 0)
+                        vs_share = test_val < share_state[w] ? -1 : test_val > share_state[w] ? 1 : 0;
+                }
+                if (args_generic.digest[j] <= best_state[0]) {
+                    uint32_t digest[DIGEST_NUM_WORDS];
+                    for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)
+                        digest[w] = args_generic.digest[w * num_lanes + j];
+                    if (digest_less(digest, best_state)) {
+                        update_best(job, epoch, digest, field_value(hit_nonce + j, nonce_bytes, tmpl->nonce_big_endian), tmpl->extranonce, best_state);
+                        precomp.h0_threshold = std::max(h0_threshold, best_state[0]);
+                    }
+                }
+                bool found = vs_target < 0;
+                if ((found || vs_share < 0) && job.epoch.load(std::memory_order_acquire) != epoch)
+                    break;  // stale, the template was replaced while hashing, start over from the first nonce
+                if (vs_share < 0) {     // a block winner is a share too
+                    MineShare share;
+                    share.nonce = field_value(hit_nonce + j, nonce_bytes, tmpl->nonce_big_endian);
+                    share.extranonce = tmpl->extranonce;
+                    share.epoch = epoch;
+                    for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)  // big endian, as result_id
+                        ((uint32_t*)share.id)[w] = byteswap32(args_generic.digest[w * num_lanes + j]);
+                    job.share_ring.push(share);     // dropped if the caller is not draining, counted
+                }
+                if (found) {
+                    for (int w = 0; w < DIGEST_NUM_WORDS; w++)  // copy result to output
+                        result.state[w] = args_generic.digest[w * num_lanes + j]; // this is in transposed form
+                    result.nonce = field_value(hit_nonce + j, nonce_bytes, tmpl->nonce_big_endian); // copy result to output
+                    result.extranonce = tmpl->extranonce;
+                    stats.idle_lanes += num_lanes - 1 - j;
+                    stop_early();
+                    winning_thread = thread_num;   // signal other workers to stop immediately
+                    return;
+                }
+            }
         }
+
+        // failed to find a winner, and nothing left to claim
+        if (!replaced)
+            return;
     }
+}
+
+// the fastest acceleration measured on this host, for 1-block and 2-block tails, see mine_xcoin_calibrate
+struct MineProfile {
+    SHA256_Acceleration best[2] = { SHA256_Acceleration::AVX512, SHA256_Acceleration::AVX512 };
+    double nonces_per_second[2][NUM_ACCELERATIONS] = {};    // all threads together, 0 if not supported
+};
+static std::mutex profile_mutex;
+static MineProfile profile;
 
-    // failed to find a winner after trying all nonces that this worker is responsible for
-    FREE_ALIGNED(start_states);
-    FREE_ALIGNED(test_tail_messages);
-    return;
+static const char PROFILE_HEADER[] = "mine_xcoin_profile";
+static const int PROFILE_VERSION = 2;     // 2 with AVX512VL, one more timing per line
 
+// the CPU features and the thread count decide the timings, a profile made with others is not used
+static std::string host_signature()
+{
+    uint32_t num_threads;
+    {
+        std::lock_guard<std::mutex> lock(mine_pool_mutex());
+        num_threads = mine_pool().size();
+    }
+    std::string signature = std::to_string(num_threads);
+    signature += ':';
+    for (int a = 0; a < NUM_ACCELERATIONS; a++)
+        signature += sha256_dispatch().supported[a] ? '1' : '0';
+    return signature;
 }
 
+static SHA256_Acceleration auto_acceleration(uint64_t num_blocks)
+{
+    std::lock_guard<std::mutex> lock(profile_mutex);
+    return profile.best[num_blocks - 1];    // AVX512 until a profile is measured or loaded, which falls back in the usual order
+}
 
-// return true if successful
-bool mine_xcoin(const uint8_t target[DIGEST_SIZE_BYTES], const uint8_t message_ex_nonce[], uint64_t len_bytes, SHA256_Acceleration preferred_acceleration,
-    uint8_t result_id[DIGEST_SIZE_BYTES], uint64_t result_nonce[1], SHA256_Acceleration acceleration_used[1], uint32_t num_threads_used[1], double timeout_seconds)
+
+MineJob* mine_xcoin_start(const uint8_t target[DIGEST_SIZE_BYTES], const uint8_t message_ex_nonce[], uint64_t len_bytes, SHA256_Acceleration preferred_acceleration,
+    double timeout_seconds, uint32_t mode_flags, const uint8_t share_target[DIGEST_SIZE_BYTES], const MineNonceLayout layout[1],
+    const MineCheckpoint resume[1])
 {
-    // timeout timer
-    auto start = std::chrono::steady_clock::now();
+    std::shared_ptr<MineTemplate> tmpl = make_template(target, message_ex_nonce, len_bytes, share_target, layout);
+    if (tmpl == nullptr) return nullptr;
+    mode_flags &= MINE_FLAG_SHA256D;    // the flags known, as they go into the checkpoint fingerprint
+    if (resume != nullptr && !resume_template(*tmpl, resume[0], mode_flags)) return nullptr;
+    MineJob* job = new MineJob();
+    job->double_sha256 = (mode_flags & MINE_FLAG_SHA256D) != 0;
 
+    if (preferred_acceleration == SHA256_Acceleration::AUTO)    // kept for the whole job, even if replaced with another tail length
+        preferred_acceleration = sha256_dispatch().forced != SHA256_Acceleration::AUTO ? sha256_dispatch().forced
+            : auto_acceleration(tmpl->tail_message_len / BLOCK_SIZE_BYTES);
     // check the preferred acceleration method, and fallback to next best if not supported by CPU
-    // if (preferred_acceleration < SHA256_Acceleration::AVX512)   preferred_acceleration = SHA256_Acceleration::AVX512;  // this line is not possible, no need to check
-    if (preferred_acceleration > SHA256_Acceleration::NO_ACCEL) preferred_acceleration = SHA256_Acceleration::NO_ACCEL;
-    SHA256_Acceleration use_acceleration = preferred_acceleration;
-    // ignore the compiler warnings, the following 2 lines can never fail because the last element is always true
-    while (!supported_accelerations[(uint8_t)use_acceleration])  use_acceleration = SHA256_Acceleration((uint8_t)use_acceleration + 1);
-    int num_lanes = lane_counts[(uint8_t)use_acceleration];
+    SHA256_Acceleration use_acceleration = supported_acceleration(preferred_acceleration);
+    job->use_acceleration = use_acceleration;
+    job->num_lanes = lane_counts[(uint8_t)use_acceleration];
 
-    // set the number of threads to the number recommended by the standard library
-    uint64_t num_threads = std::thread::hardware_concurrency();
+    // the worker threads are kept alive across calls, see mine_pool.h and mine_xcoin_set_threads
+    std::lock_guard<std::mutex> pool_lock(mine_pool_mutex());
+    MinePool& pool = mine_pool();
+    job->num_threads = pool.size();
+    job->num_cores = pool.layout().num_cores;
+    job->num_nodes = pool.layout().num_nodes;
+    job->active_workers = job->num_threads;
+    tmpl->scheduler = std::make_shared<MineScheduler>(job->num_threads, job->num_lanes, tmpl->max_nonce);
+    if (resume != nullptr) {
+        std::vector<std::pair<uint64_t, uint64_t>> gaps;
+        for (uint32_t g = 0; g < resume[0].num_gaps && g < MINE_CHECKPOINT_MAX_GAPS; g++)
+            gaps.emplace_back(resume[0].gaps[2 * g], resume[0].gaps[2 * g + 1]);
+        tmpl->scheduler->resume(resume[0].frontier, gaps);
+        if (resume[0].has_best) {   // the nonces skipped are all above it, so it is the winner if below target
+            job->has_best = true;
+            for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)
+                job->best_state[w] = byteswap32(((const uint32_t*)resume[0].best_id)[w]);
+            job->best_nonce = resume[0].best_nonce;
+            job->best_extranonce = resume[0].best_extranonce;
+            job->resume_won = digest_less(job->best_state, tmpl->target_state);
+        }
+    }
+    job->tmpl = tmpl;
+    job->counters.reset(new MineWorkerCounters[job->num_threads]);
+    job->start = std::chrono::steady_clock::now();
+    // disarmed by the done callback below, before the job can be freed
+    job->watchdog_timer = mine_watchdog().arm(deadline_after(timeout_seconds), [job] { mine_xcoin_cancel(job); });
 
-    // return diagnostics
-    acceleration_used[0] = use_acceleration;
-    num_threads_used[0] = (uint32_t)num_threads;
-
-    // state is 8 32-bit words i.e. 32 bytes
-    // initial state
-    uint32_t state[DIGEST_NUM_WORDS] = {
-        0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
-        0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
-    };
+    // parallel processing, on the pool threads
+    pool.start([job](int thread_num, MineArena& arena, MineResultSlot& result) {
+            worker_mine(thread_num, *job, arena, result);
+        }, [job, &pool] {   // all workers are done, collect the winner before the pool moves on to the next job
+            mine_watchdog().disarm(job->watchdog_timer);
+            int winning_num = job->winning_thread;
+            std::vector<std::pair<uint64_t, uint64_t>> gaps;
+            uint64_t frontier = std::atomic_load(&job->tmpl)->scheduler->coverage(gaps);
+            std::lock_guard<std::mutex> lock(job->mutex);
+            job->coverage_frontier = frontier;
+            job->coverage_gaps = std::move(gaps);
+            if (winning_num > 0) {
+                const MineResultSlot& winning_result = pool.result(winning_num);
+                std::memcpy(job->result_state, winning_result.state, DIGEST_SIZE_BYTES);
+                job->result_nonce = winning_result.nonce;
+                job->result_extranonce = winning_result.extranonce;
+            }
+            job->end = std::chrono::steady_clock::now();
+            job->finished = true;
+            job->finished_cv.notify_all();
+        });
+    return job;
+}
 
-    // data is processed in 512-bit (64-byte) chunks (blocks)
-    uint64_t preprocess_chunks_num = len_bytes / BLOCK_SIZE_BYTES;
+MineJobStatus mine_xcoin_poll(MineJob* job)
+{
+    return mine_xcoin_wait(job, 0.0);
+}
 
-    uint64_t preprocess_bytes_num = preprocess_chunks_num * BLOCK_SIZE_BYTES;
-    const uint8_t* residual_message = message_ex_nonce + preprocess_bytes_num; // pointer to start of the incomplete chunk (block)
-    uint64_t residual_message_len = len_bytes - preprocess_bytes_num;  // between 0~64 bytes
+MineJobStatus mine_xcoin_wait(MineJob* job, double wait_seconds)
+{
+    std::unique_lock<std::mutex> lock(job->mutex);
+    if (wait_seconds < 0.0)
+        job->finished_cv.wait(lock, [job] { return job->finished; });
+    else
+        job->finished_cv.wait_for(lock, std::chrono::duration<double>(wait_seconds), [job] { return job->finished; });
+    if (!job->finished) return MineJobStatus::RUNNING;
+    return job->winning_thread > 0 ? MineJobStatus::FOUND : MineJobStatus::NOT_FOUND;
+}
 
-    // partial pre-processing
-    if (preprocess_chunks_num > 0)
-        sha256_process(state, message_ex_nonce, (uint32_t)preprocess_bytes_num);
+void mine_xcoin_cancel(MineJob* job)
+{
+    int running = -1;
+    job->winning_thread.compare_exchange_strong(running, 0);  // same early abort as the timeout, a winner already found is kept
+}
 
-    // residual_message is 0~63 bytes, nonce is 64 bit or 8 bytes, 1 byte for the 1 bit, 8 bytes for length
-    // tail_message_len should be either 64 bytes (512 bits) or 128 bytes (512 bits x 2)
-    uint64_t num_chunks_left = 1ULL;  // 1 or 2
-    if (residual_message_len + NONCE_SIZE_BYTES > BLOCK_SIZE_BYTES - 8 - 1) num_chunks_left = 2ULL;
-    uint64_t tail_message_len = BLOCK_SIZE_BYTES * num_chunks_left;
-    uint8_t tail_message[BLOCK_SIZE_BYTES * 2];  // max 2 blocks
-    std::memset(tail_message, 0x00, sizeof(tail_message));
-    std::memcpy(tail_message, residual_message, residual_message_len);  // copy the residual message into tail message
-    
-    // the 1 bit in padding after nonce
-    tail_message[residual_message_len + NONCE_SIZE_BYTES] = 0x80;
-    // total length excluding padding is len_bytes + 8 (nonce), in bytes, below is in bits
-    uint64_t total_bitlen_ex_pad = (len_bytes + NONCE_SIZE_BYTES) * 8ULL;   // times 8 to convert from bytes to bits
-    // now fill into padding using big endian i.e. lowest memory index is most significant byte
-    *((uint64_t*)(tail_message + tail_message_len - 8)) = byteswap64(total_bitlen_ex_pad);
+bool mine_xcoin_set_deadline(MineJob* job, double timeout_seconds)
+{
+    return mine_watchdog().rearm(job->watchdog_timer, deadline_after(timeout_seconds));
+}
+
+bool mine_xcoin_replace(MineJob* job, const uint8_t target[DIGEST_SIZE_BYTES], const uint8_t message_ex_nonce[], uint64_t len_bytes,
+    const uint8_t share_target[DIGEST_SIZE_BYTES], const MineNonceLayout layout[1])
+{
+    std::shared_ptr<MineTemplate> tmpl = make_template(target, message_ex_nonce, len_bytes, share_target, layout);
+    if (tmpl == nullptr) return false;
+    tmpl->scheduler = std::make_shared<MineScheduler>(job->num_threads, job->num_lanes, tmpl->max_nonce);
+    {
+        std::lock_guard<std::mutex> lock(job->roll_mutex);  // not overwritten by a roll of the template it replaces
+        std::atomic_store(&job->tmpl, std::shared_ptr<const MineTemplate>(tmpl));
+        job->epoch.fetch_add(1, std::memory_order_release);
+    }
+    return mine_xcoin_poll(job) == MineJobStatus::RUNNING;
+}
+
+uint32_t mine_xcoin_set_workers(MineJob* job, uint32_t num_active)
+{
+    num_active = std::max(1u, std::min(num_active, job->num_threads));
+    job->active_workers.store(num_active, std::memory_order_relaxed);
+    return num_active;
+}
+
+bool mine_xcoin_coverage(MineJob* job, uint64_t frontier[1], uint64_t gaps[], uint32_t max_gaps, uint32_t num_gaps[1])
+{
+    if (mine_xcoin_poll(job) == MineJobStatus::RUNNING) return false;
+    std::lock_guard<std::mutex> lock(job->mutex);
+    frontier[0] = job->coverage_frontier;
+    num_gaps[0] = (uint32_t)job->coverage_gaps.size();
+    for (uint32_t g = 0; g < num_gaps[0] && g < max_gaps; g++) {
+        gaps[2 * g] = job->coverage_gaps[g].first;
+        gaps[2 * g + 1] = job->coverage_gaps[g].second;
+    }
+    return true;
+}
+
+uint32_t mine_xcoin_drain_shares(MineJob* job, MineShare shares[], uint32_t max_shares, uint64_t num_dropped[1])
+{
+    num_dropped[0] = job->share_ring.dropped();
+    return job->share_ring.pop(shares, max_shares);
+}
 
-    // parallel processing
-    // copy the states
-    // do not use the new[] aligned, Visual C++ throws exception on delete[], no idea why
-    // uint32_t* states = (uint32_t*) operator new[](sizeof(uint32_t)* (DIGEST_NUM_WORDS * num_threads), (std::align_val_t)(64)); // alignment just in case faster
-    // uint64_t* nonces = (uint64_t*) operator new[](sizeof(uint64_t)* (num_threads), (std::align_val_t)(64)); // alignment just in case faster
-    uint32_t* states = (uint32_t*)ALLOC_ALIGNED(64, sizeof(uint32_t) * DIGEST_NUM_WORDS * num_threads); // alignment just in case faster
-    uint64_t* nonces = (uint64_t*)ALLOC_ALIGNED(64, sizeof(uint64_t) * num_threads); // alignment just in case faster
-
-    std::atomic<int> winning_thread = -1;    // this is how the threads let each other know when to stop i.e. once this is positive, then stop because we have a winner, or early abort (zero)
-    std::vector<std::thread> threads;
-    uint64_t nonce_step = num_threads * num_lanes;  // each thread would cover num_lanes in each iteration
-
-    // timeout timer
-    auto end = std::chrono::steady_clock::now();
-    std::chrono::duration<double> elapsed = end - start;
-    auto timeout_secs = std::chrono::duration<double>(timeout_seconds) - elapsed;
-    if (std::chrono::duration_cast<std::chrono::microseconds>(timeout_secs).count() <= 0)   return false;   // failed, already timed out
-    // create calculation threads and run
-    for (uint64_t i = 0; i < num_threads; i++) {
-        std::memcpy(states + i * DIGEST_NUM_WORDS, state, DIGEST_SIZE_BYTES);
-        threads.emplace_back(std::thread(worker_mine, (int)(i + 1), target, states + i * DIGEST_NUM_WORDS, nonces + i, (uint32_t)residual_message_len,
-            tail_message, tail_message_len, i * num_lanes, nonce_step, std::ref(winning_thread), use_acceleration, timeout_secs));
-    }
-    // wait for them to complete
-    for (auto& th : threads)
-        th.join();
-
-    // checking winning thread results and pass back
-    int winning_i = winning_thread - 1;
-    if (winning_i < 0) return false;   // all failed (winning_thread zero is early abort, -1 is initial value)
+uint32_t mine_xcoin_telemetry(MineJob* job, MineStats total[1], MineStats per_thread[], uint32_t max_threads, double elapsed_seconds[1])
+{
+    total[0] = {};
+    for (uint32_t t = 0; t < job->num_threads; t++) {
+        MineStats stats = job->counters[t].snapshot();
+        total[0].nonces_hashed += stats.nonces_hashed;
+        total[0].kernel_calls += stats.kernel_calls;
+        total[0].kernel_cycles += stats.kernel_cycles;
+        total[0].loop_cycles += stats.loop_cycles;
+        total[0].idle_lanes += stats.idle_lanes;
+        if (per_thread != nullptr && t < max_threads)
+            per_thread[t] = stats;
+    }
+    std::lock_guard<std::mutex> lock(job->mutex);
+    std::chrono::duration<double> elapsed = (job->finished ? job->end : std::chrono::steady_clock::now()) - job->start;
+    elapsed_seconds[0] = elapsed.count();
+    return job->num_threads;
+}
+
+bool mine_xcoin_result(MineJob* job, uint8_t result_id[DIGEST_SIZE_BYTES], uint64_t result_nonce[1], SHA256_Acceleration acceleration_used[1], uint32_t num_threads_used[1],
+    uint32_t num_cores_used[1], uint32_t num_nodes_used[1])
+{
+    // return diagnostics
+    acceleration_used[0] = job->use_acceleration;
+    num_threads_used[0] = job->num_threads;
+    num_cores_used[0] = job->num_cores;
+    num_nodes_used[0] = job->num_nodes;
+
+    if (mine_xcoin_poll(job) != MineJobStatus::FOUND) return false;
     // convert little-endian state into hash
-    uint32_t* winning_state = states + winning_i * DIGEST_NUM_WORDS;
     uint32_t* result_id_ptr32 = (uint32_t*)result_id;
     // the return output result is bytes array in big endian
     for (int w = 0; w < DIGEST_NUM_WORDS; w++)
-        result_id_ptr32[0 + w] = byteswap32(winning_state[0 + w]);
-    result_nonce[0] = nonces[winning_i];
+        result_id_ptr32[0 + w] = byteswap32(job->result_state[0 + w]);
+    result_nonce[0] = job->result_nonce;
+    return true;
+}
+
+bool mine_xcoin_best(MineJob* job, uint8_t best_id[DIGEST_SIZE_BYTES], uint64_t best_nonce[1], uint64_t best_extranonce[1])
+{
+    std::lock_guard<std::mutex> lock(job->best_mutex);
+    if (!job->has_best || job->best_epoch != job->epoch.load()) return false;
+    for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)  // big endian, as result_id
+        ((uint32_t*)best_id)[w] = byteswap32(job->best_state[w]);
+    best_nonce[0] = job->best_nonce;
+    best_extranonce[0] = job->best_extranonce;
+    return true;
+}
+
+bool mine_xcoin_checkpoint(MineJob* job, MineCheckpoint checkpoint[1])
+{
+    if (mine_xcoin_poll(job) == MineJobStatus::RUNNING) return false;
+    MineCheckpoint& saved = checkpoint[0];
+    saved = {};
+    std::shared_ptr<const MineTemplate> tmpl = std::atomic_load(&job->tmpl);
+    template_fingerprint(*tmpl, job->double_sha256 ? MINE_FLAG_SHA256D : 0, saved.fingerprint);
+    saved.extranonce = tmpl->extranonce;
+    {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        saved.frontier = job->coverage_frontier;
+        for (const auto& gap : job->coverage_gaps) {    // sorted, the ones left out are hashed again
+            if (saved.num_gaps == MINE_CHECKPOINT_MAX_GAPS) {
+                saved.frontier = gap.first;
+                break;
+            }
+            saved.gaps[2 * saved.num_gaps] = gap.first;
+            saved.gaps[2 * saved.num_gaps + 1] = gap.second;
+            saved.num_gaps++;
+        }
+    }
+    saved.has_best = mine_xcoin_best(job, saved.best_id, &saved.best_nonce, &saved.best_extranonce);
+    return true;
+}
+
+bool mine_xcoin_extranonce(MineJob* job, uint64_t extranonce[1])
+{
+    bool found = mine_xcoin_poll(job) == MineJobStatus::FOUND;
+    if (found) {
+        std::lock_guard<std::mutex> lock(job->mutex);
+        extranonce[0] = job->result_extranonce;
+    }
+    else
+        extranonce[0] = std::atomic_load(&job->tmpl)->extranonce;
+    return found;
+}
+
+void mine_xcoin_free(MineJob* job)
+{
+    if (job == nullptr) return;
+    mine_xcoin_cancel(job);
+    mine_xcoin_wait(job, -1.0);
+    delete job;
+}
+
+bool mine_xcoin_set_threads(uint32_t num_threads, const int32_t cpus[], uint32_t num_cpus, MinePlacement placement)
+{
+    MineThreadLayout layout = plan_threads(num_threads, cpus, num_cpus, placement);
+    if (layout.thread_cpus.empty()) return false;
+    std::lock_guard<std::mutex> pool_lock(mine_pool_mutex());
+    mine_pool_replace(std::move(layout));
+    return true;
+}
+
+
+// return true if successful
+bool mine_xcoin(const uint8_t target[DIGEST_SIZE_BYTES], const uint8_t message_ex_nonce[], uint64_t len_bytes, SHA256_Acceleration preferred_acceleration,
+    uint8_t result_id[DIGEST_SIZE_BYTES], uint64_t result_nonce[1], SHA256_Acceleration acceleration_used[1], uint32_t num_threads_used[1], double timeout_seconds)
+{
+    MineJob* job = mine_xcoin_start(target, message_ex_nonce, len_bytes, preferred_acceleration, timeout_seconds, 0, nullptr, nullptr, nullptr);
+    mine_xcoin_wait(job, -1.0);
+    uint32_t num_cores_used[1], num_nodes_used[1];  // the topology is only reported by the asynchronous version
+    bool found = mine_xcoin_result(job, result_id, result_nonce, acceleration_used, num_threads_used, num_cores_used, num_nodes_used);
+    mine_xcoin_free(job);
+    return found;
+}
+
+
+bool mine_xcoin_calibrate(const char* profile_path, double seconds_per_run)
+{
+    // a target no nonce can meet, so every run hashes until its timeout
+    static const uint8_t impossible_target[DIGEST_SIZE_BYTES] = { 0x0 };
+    // the nonce ends up in the first block of a 1-block tail, and of a 2-block tail with a constant second block
+    static const uint64_t message_lens[2] = { 32, 48 };
+    uint8_t message[48] = { 0x0 };
+
+    MineProfile measured;
+    for (int b = 0; b < 2; b++) {
+        double best_rate = 0.0;
+        for (int a = 0; a < NUM_ACCELERATIONS; a++) {
+            if (!sha256_dispatch().supported[a]) continue;
+            MineJob* job = mine_xcoin_start(impossible_target, message, message_lens[b], SHA256_Acceleration(a), seconds_per_run, 0, nullptr, nullptr, nullptr);
+            mine_xcoin_wait(job, -1.0);
+            MineStats total;
+            double elapsed_seconds;
+            mine_xcoin_telemetry(job, &total, nullptr, 0, &elapsed_seconds);
+            double rate = total.nonces_hashed / elapsed_seconds;
+            mine_xcoin_free(job);
+
+            measured.nonces_per_second[b][a] = rate;
+            if (rate > best_rate) {
+                best_rate = rate;
+                measured.best[b] = SHA256_Acceleration(a);
+            }
+        }
+    }
+    {
+        std::lock_guard<std::mutex> lock(profile_mutex);
+        profile = measured;
+    }
+
+    if (profile_path == nullptr) return true;
+    std::ofstream file(profile_path, std::ios::trunc);
+    file << PROFILE_HEADER << ' ' << PROFILE_VERSION << '\n';
+    file << "host " << host_signature() << '\n';
+    for (int b = 0; b < 2; b++) {   // the timings are only kept for reference
+        file << "blocks " << b + 1 << " best " << (int)measured.best[b] << " nonces_per_second";
+        for (int a = 0; a < NUM_ACCELERATIONS; a++)
+            file << ' ' << std::setprecision(6) << measured.nonces_per_second[b][a];
+        file << '\n';
+    }
+    file.close();
+    return !file.fail();
+}
+
+bool mine_xcoin_load_profile(const char* profile_path)
+{
+    std::ifstream file(profile_path);
+    std::string header, key, signature;
+    int version = 0;
+    file >> header >> version >> key >> signature;
+    if (!file || header != PROFILE_HEADER || version != PROFILE_VERSION || key != "host" || signature != host_signature())
+        return false;
 
-    // clean up
-    FREE_ALIGNED(states);
-    FREE_ALIGNED(nonces);
+    MineProfile loaded;
+    for (int b = 0; b < 2; b++) {
+        std::string blocks_key, best_key, rates_key;
+        int blocks = 0, best = -1;
+        file >> blocks_key >> blocks >> best_key >> best >> rates_key;
+        for (int a = 0; a < NUM_ACCELERATIONS; a++)
+            file >> loaded.nonces_per_second[b][a];
+        if (!file || blocks_key != "blocks" || blocks != b + 1 || best_key != "best" || best < 0 || best >= NUM_ACCELERATIONS
+                || !sha256_dispatch().supported[best])
+            return false;
+        loaded.best[b] = SHA256_Acceleration(best);
+    }
 
-    // return
+    std::lock_guard<std::mutex> lock(profile_mutex);
+    profile = loaded;
     return true;
 }
 
+bool sha256_acceleration_supported(SHA256_Acceleration acceleration)
+{
+    return (uint8_t)acceleration < NUM_ACCELERATIONS && sha256_dispatch().supported[(uint8_t)acceleration];
+}
+
+// the context manager picked once, see Sha256Dispatch, as all the calls on a manager have to go to the same one
+void sha256_ctx_mgr_init(SHA256_HASH_CTX_MGR* mgr)
+{
+    sha256_dispatch().ctx_mgr.init(mgr);
+}
+
+SHA256_HASH_CTX* sha256_ctx_mgr_submit(SHA256_HASH_CTX_MGR* mgr, SHA256_HASH_CTX* ctx, const void* buffer, uint32_t len, HASH_CTX_FLAG flags)
+{
+    return sha256_dispatch().ctx_mgr.submit(mgr, ctx, buffer, len, flags);
+}
+
+SHA256_HASH_CTX* sha256_ctx_mgr_flush(SHA256_HASH_CTX_MGR* mgr)
+{
+    return sha256_dispatch().ctx_mgr.flush(mgr);
+}
+
+void sha256_stream_init(Sha256Stream stream[1])
+{
+    std::memcpy(stream[0].state, SHA256_IV, DIGEST_SIZE_BYTES);
+    stream[0].total_len = 0;
+}
+
+void sha256_stream_update(Sha256Stream stream[1], const uint8_t data[], uint64_t len_bytes)
+{
+    Sha256Stream& s = stream[0];
+    uint64_t partial_len = s.total_len % BLOCK_SIZE_BYTES;
+    s.total_len += len_bytes;
+    if (partial_len > 0) {  // fill up the block left over by the last update first
+        uint64_t copy_len = std::min(len_bytes, BLOCK_SIZE_BYTES - partial_len);
+        std::memcpy(s.partial_block + partial_len, data, copy_len);
+        data += copy_len;
+        len_bytes -= copy_len;
+        if (partial_len + copy_len < BLOCK_SIZE_BYTES)
+            return;
+        sha256_blocks(s.state, s.partial_block, 1);
+    }
+    // the whole blocks are hashed where they are, in one call
+    uint64_t num_blocks = len_bytes / BLOCK_SIZE_BYTES;
+    if (num_blocks > 0)
+        sha256_blocks(s.state, data, num_blocks);
+    std::memcpy(s.partial_block, data + num_blocks * BLOCK_SIZE_BYTES, len_bytes % BLOCK_SIZE_BYTES);
+}
+
+void sha256_stream_final(Sha256Stream stream[1], uint8_t digest[DIGEST_SIZE_BYTES])
+{
+    Sha256Stream& s = stream[0];
+    // the 1 bit, and the bit length in the last 8 bytes of this block, or of the next one if it does not fit
+    uint8_t padding[2 * BLOCK_SIZE_BYTES] = { 0x0 };
+    uint64_t partial_len = s.total_len % BLOCK_SIZE_BYTES;
+    std::memcpy(padding, s.partial_block, partial_len);
+    padding[partial_len] = 0x80;
+    uint64_t num_blocks = partial_len + 1 + 8 > BLOCK_SIZE_BYTES ? 2 : 1;
+    *((uint64_t*)(padding + num_blocks * BLOCK_SIZE_BYTES - 8)) = byteswap64(s.total_len * 8);
+    sha256_blocks(s.state, padding, num_blocks);
+    for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)
+        ((uint32_t*)digest)[w] = byteswap32(s.state[w]);
+}
+
+// the acceleration the bulk hashing uses: the preferred one or its fallback, as for mining, or with AUTO the widest supported
+static SHA256_Acceleration bulk_acceleration(SHA256_Acceleration preferred_acceleration)
+{
+    return preferred_acceleration == SHA256_Acceleration::AUTO ? sha256_dispatch().widest : supported_acceleration(preferred_acceleration);
+}
+
+// segments first_segment to first_segment + lanes - 1 of sha256_multihash, one per lane
+// the full rounds of stripes go through the lanes together, then every lane finishes its segment with its stripe of the last round, if any
+static void multihash_segments(const uint8_t data[], uint64_t len_bytes, SHA256_Acceleration acceleration, uint32_t first_segment,
+    uint8_t segment_digests[])
+{
+    const int num_lanes = lane_counts[(uint8_t)acceleration];
+    const sha256_lanes_function hash_lanes = sha256_dispatch().lanes[(uint8_t)acceleration];
+    const uint64_t round_bytes = MULTIHASH_STRIPE_BYTES * MULTIHASH_SEGMENTS;
+    const uint64_t num_rounds = len_bytes / round_bytes;
+    alignas(64) SHA256_MB_ARGS_X16 args;
+    uint32_t* digests = (uint32_t*)args.digest;
+    for (int j = 0; j < num_lanes; j++)
+        for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++) digests[w * num_lanes + j] = SHA256_IV[w];  // transposed form
+    for (uint64_t r = 0; r < num_rounds; r++) {
+        for (int j = 0; j < num_lanes; j++)
+            args.data_ptr[j] = (uint8_t*)data + r * round_bytes + (first_segment + j) * MULTIHASH_STRIPE_BYTES;
+        hash_lanes(&args, MULTIHASH_STRIPE_BYTES / BLOCK_SIZE_BYTES);
+    }
+    for (int j = 0; j < num_lanes; j++) {
+        Sha256Stream stream;
+        for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++) stream.state[w] = digests[w * num_lanes + j];
+        stream.total_len = num_rounds * MULTIHASH_STRIPE_BYTES;
+        uint64_t stripe_start = num_rounds * round_bytes + (first_segment + j) * MULTIHASH_STRIPE_BYTES;
+        if (stripe_start < len_bytes)
+            sha256_stream_update(&stream, data + stripe_start, std::min(MULTIHASH_STRIPE_BYTES, len_bytes - stripe_start));
+        sha256_stream_final(&stream, segment_digests + (first_segment + j) * DIGEST_SIZE_BYTES);
+    }
+}
+
+SHA256_Acceleration sha256_multihash(const uint8_t data[], uint64_t len_bytes, SHA256_Acceleration preferred_acceleration, uint32_t num_threads,
+    uint8_t digest[DIGEST_SIZE_BYTES])
+{
+    SHA256_Acceleration acceleration = bulk_acceleration(preferred_acceleration);
+    const uint32_t num_lanes = lane_counts[(uint8_t)acceleration];
+    const uint32_t num_groups = MULTIHASH_SEGMENTS / num_lanes;
+    if (len_bytes <= MULTIHASH_STRIPE_BYTES * MULTIHASH_SEGMENTS)
+        num_threads = 1;    // at most one stripe per segment, not worth waking the workers for
+
+    // the groups of lanes segments are taken in turn by the threads, no more of them than groups, see MULTIHASH_SEGMENTS
+    std::vector<uint8_t> segment_digests(MULTIHASH_SEGMENTS * DIGEST_SIZE_BYTES);
+    std::atomic<uint32_t> next_group{ 0 };
+    auto hash_groups = [&] {
+        for (uint32_t group = next_group.fetch_add(1); group < num_groups; group = next_group.fetch_add(1))
+            multihash_segments(data, len_bytes, acceleration, group * num_lanes, segment_digests.data());
+    };
+    if (num_threads == 1)
+        hash_groups();
+    else {
+        std::lock_guard<std::mutex> pool_lock(bulk_pool_mutex());
+        MinePool& pool = bulk_pool();
+        uint32_t active_threads = std::min(num_threads == 0 ? pool.size() : std::min(num_threads, pool.size()), num_groups);
+        pool.run([&](int thread_num, MineArena&, MineResultSlot&) {
+            if ((uint32_t)thread_num <= active_threads)
+                hash_groups();
+        });
+    }
+
+    // the root hashes the segment digests in order, then the length, 8 bytes little endian
+    uint8_t len_le[8];
+    for (int i = 0; i < 8; i++) len_le[i] = (uint8_t)(len_bytes >> (8 * i));
+    Sha256Stream stream;
+    sha256_stream_init(&stream);
+    sha256_stream_update(&stream, segment_digests.data(), segment_digests.size());
+    sha256_stream_update(&stream, len_le, sizeof(len_le));
+    sha256_stream_final(&stream, digest);
+    return acceleration;
+}
+
+// pairs of one Merkle level per thread, a level with fewer than twice as many is hashed on the calling thread only
+const uint64_t MERKLE_THREAD_PAIRS = 1024;
+
+// the second block of every pair of nodes, the padding of a 64-byte message, the same for all the lanes
+alignas(64) static const uint8_t MERKLE_PADDING_BLOCK[BLOCK_SIZE_BYTES] = {
+    0x80, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0,
+    0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x0, 0x2, 0x0 };   // 512 bits, big endian
+
+// parents first_pair to first_pair + num_pairs - 1 of one Merkle level, from the nodes of the level below, num_lanes pairs at a time
+// a pair of nodes is exactly one block, so the lanes hash their pairs where they are, then all of them the shared padding block;
+// for sha256d the digests are hashed again the same way, see worker_mine
+static void merkle_parents(const uint8_t nodes[], uint64_t first_pair, uint64_t num_pairs, bool double_sha256, SHA256_Acceleration acceleration,
+    uint8_t parents[])
+{
+    const int num_lanes = lane_counts[(uint8_t)acceleration];
+    const sha256_lanes_function hash_lanes = sha256_dispatch().lanes[(uint8_t)acceleration];
+    alignas(64) SHA256_MB_ARGS_X16 args;
+    uint32_t* digests = (uint32_t*)args.digest;
+    alignas(64) uint8_t digest_blocks[SHA256_MAX_LANES * BLOCK_SIZE_BYTES];
+    if (double_sha256)
+        for (int j = 0; j < num_lanes; j++)
+            pad_digest_block(digest_blocks + j * BLOCK_SIZE_BYTES);
+
+    for (uint64_t pair = first_pair; pair < first_pair + num_pairs; pair += num_lanes) {
+        uint64_t used_lanes = std::min((uint64_t)num_lanes, first_pair + num_pairs - pair);
+        for (int j = 0; j < num_lanes; j++) {
+            for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++) digests[w * num_lanes + j] = SHA256_IV[w];  // transposed form
+            // the lanes past the last pair hash it again, for nothing
+            args.data_ptr[j] = (uint8_t*)nodes + (pair + std::min((uint64_t)j, used_lanes - 1)) * BLOCK_SIZE_BYTES;
+        }
+        hash_lanes(&args, 1);
+        for (int j = 0; j < num_lanes; j++)
+            args.data_ptr[j] = (uint8_t*)MERKLE_PADDING_BLOCK;   // only read
+        hash_lanes(&args, 1);
+        if (double_sha256) {
+            for (int j = 0; j < num_lanes; j++) {
+                for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++) {
+                    ((uint32_t*)(digest_blocks + j * BLOCK_SIZE_BYTES))[w] = byteswap32(digests[w * num_lanes + j]);
+                    digests[w * num_lanes + j] = SHA256_IV[w];
+                }
+                args.data_ptr[j] = digest_blocks + j * BLOCK_SIZE_BYTES;
+            }
+            hash_lanes(&args, 1);
+        }
+        for (uint64_t j = 0; j < used_lanes; j++)
+            for (uint64_t w = 0; w < DIGEST_NUM_WORDS; w++)
+                ((uint32_t*)(parents + (pair + j) * DIGEST_SIZE_BYTES))[w] = byteswap32(digests[w * num_lanes + j]);
+    }
+}
+
+bool sha256_merkle_root(const uint8_t leaves[], uint64_t num_leaves, uint32_t mode_flags, SHA256_Acceleration preferred_acceleration,
+    uint32_t num_threads, uint8_t root[DIGEST_SIZE_BYTES])
+{
+    if (num_leaves == 0)
+        return false;
+    SHA256_Acceleration acceleration = bulk_acceleration(preferred_acceleration);
+    const uint32_t num_lanes = lane_counts[(uint8_t)acceleration];
+    bool double_sha256 = (mode_flags & MINE_FLAG_SHA256D) != 0;
+
+    // the large levels are split between the workers of the bulk pool, held for the whole tree, see mine_xcoin_set_threads
+    std::unique_lock<std::mutex> pool_lock(bulk_pool_mutex(), std::defer_lock);
+    MinePool* pool = nullptr;
+    uint64_t max_threads = 1;
+    if (num_threads != 1 && (num_leaves + 1) / 2 >= 2 * MERKLE_THREAD_PAIRS) {
+        pool_lock.lock();
+        pool = &bulk_pool();
+        max_threads = num_threads == 0 ? pool->size() : std::min(num_threads, pool->size());
+    }
+
+    // the levels go back and forth between two buffers, each one with room for the copy of an odd last node
+    std::vector<uint8_t> nodes((num_leaves + 1) * DIGEST_SIZE_BYTES);
+    std::vector<uint8_t> parents(((num_leaves + 1) / 2 + 1) * DIGEST_SIZE_BYTES);
+    std::memcpy(nodes.data(), leaves, num_leaves * DIGEST_SIZE_BYTES);
+    for (uint64_t num_nodes = num_leaves; num_nodes > 1; num_nodes = (num_nodes + 1) / 2) {
+        if (num_nodes % 2 == 1)     // paired with itself, as in Bitcoin
+            std::memcpy(&nodes[num_nodes * DIGEST_SIZE_BYTES], &nodes[(num_nodes - 1) * DIGEST_SIZE_BYTES], DIGEST_SIZE_BYTES);
+        uint64_t num_pairs = (num_nodes + 1) / 2;
+        // a range of whole lane batches per thread, the last one takes the rest
+        uint64_t level_threads = std::min<uint64_t>(max_threads, std::max<uint64_t>(1, num_pairs / MERKLE_THREAD_PAIRS));
+        uint64_t thread_pairs = ((num_pairs + level_threads - 1) / level_threads + num_lanes - 1) / num_lanes * num_lanes;
+        auto hash_range = [&](uint64_t t) {
+            merkle_parents(nodes.data(), t * thread_pairs, std::min(thread_pairs, num_pairs - std::min(num_pairs, t * thread_pairs)),
+                double_sha256, acceleration, parents.data());
+        };
+        if (level_threads == 1)
+            hash_range(0);
+        else
+            pool->run([&](int thread_num, MineArena&, MineResultSlot&) {
+                if ((uint64_t)thread_num <= level_threads)
+                    hash_range(thread_num - 1);
+            });
+        nodes.swap(parents);
+    }
+    std::memcpy(root, nodes.data(), DIGEST_SIZE_BYTES);
+    return true;
+}
+
+uint32_t sha256_files(const char* const paths[], uint32_t num_paths, uint32_t num_threads, uint8_t digests[], int32_t errors[])
+{
+    return hash_files(paths, num_paths, num_threads, digests, errors);
+}
@@ -3,7 +3,10 @@
 
 #include "Intel/sha256_mb_wrapper.h"
 #include "Intel/sha256_sha_sse41.h"
-#include "Microsoft/cpuid.cpp"
+#include "Intel/sha256_mine.h"
+#include "sha256_dispatch.h"
+#include "mine_topology.h"
+#include "mine_share_ring.h"
 
 const uint64_t DIGEST_NUM_WORDS = 8;    // each WORD is a 32 bits
 const uint64_t DIGEST_WORD_SIZE_BYTES = 4;
@@ -12,12 +15,72 @@ const uint64_t BLOCK_SIZE_BYTES = 64;
 const uint64_t NONCE_SIZE_BYTES = 8; // 64 bit integer
 const uint64_t MAX_NONCE = ULLONG_MAX; // 64 bit integer
 
-// enum class to indicate the preferred acceleration method
-enum class SHA256_Acceleration : uint8_t { AVX512 = 0, SHA = 1, AVX2 = 2, AVX = 3, SSE41 = 4, NO_ACCEL = 5 };
-static bool supported_accelerations[] = { InstructionSet::AVX512F(), InstructionSet::SHA() && InstructionSet::SSE41(), InstructionSet::AVX2(),
-    InstructionSet::AVX(), InstructionSet::SSE41(), true };
-// vector instructions can handle multiple messages at the same time
-static int lane_counts[] = { 16, 1, 8, 4, 4, 1 };
+// mode flags of mine_xcoin_start
+// SHA256D: the block ID is SHA256(SHA256(message, nonce)), as in Bitcoin, and is compared with the target instead
+const uint32_t MINE_FLAG_SHA256D = 1;
+
+// state of an asynchronous mining job, see mine_xcoin_start
+enum class MineJobStatus : int32_t { RUNNING = 0, FOUND = 1, NOT_FOUND = 2 };
+struct MineJob;     // opaque handle
+
+// where the nonce, and the extranonce if any, sit in the message, see mine_xcoin_start
+// the nonce is nonce_bytes (1 to 8) wide at nonce_offset, and the extranonce extranonce_bytes (0 for none, up to 8) wide at
+// extranonce_offset, starting from extranonce_start; the message bytes under both fields are ignored
+// once every nonce has been handed out, the extranonce goes up by one and the blocks from the one it starts in are hashed again
+// the message from the start of the 64-byte block the nonce starts in must fit in 119 bytes, i.e. two blocks with the padding
+// nonces and extranonces are always given as the values of their fields, read in the byte order set here
+struct MineNonceLayout {
+    uint64_t nonce_offset;
+    uint64_t extranonce_offset;
+    uint64_t extranonce_start;
+    uint32_t nonce_bytes;
+    uint32_t extranonce_bytes;
+    uint8_t nonce_big_endian;
+    uint8_t extranonce_big_endian;
+};
+
+// gaps kept by a checkpoint, past those the frontier is moved down to the first one left out
+const uint32_t MINE_CHECKPOINT_MAX_GAPS = 32;
+
+// how far a job got with its last template, see mine_xcoin_checkpoint, and where a later job on the same template picks up
+// the nonces of extranonce that were hashed are the ones of mine_xcoin_coverage, the earlier extranonces are all taken as hashed
+// fingerprint is taken over the message with the nonce zeroed at extranonce, the layout and the mode flags, and has to match
+// the best digest is the lowest of all the nonces hashed since the last replace (block ID, big endian), if has_best
+struct MineCheckpoint {
+    uint8_t fingerprint[DIGEST_SIZE_BYTES];
+    uint64_t extranonce;
+    uint64_t frontier;
+    uint64_t gaps[2 * MINE_CHECKPOINT_MAX_GAPS];
+    uint32_t num_gaps;
+    uint32_t has_best;
+    uint8_t best_id[DIGEST_SIZE_BYTES];
+    uint64_t best_nonce;
+    uint64_t best_extranonce;
+};
+
+// state of a streaming SHA256 between updates, see sha256_stream_init; plain bytes, so a copy hashes on from the same prefix
+struct Sha256Stream {
+    uint32_t state[DIGEST_NUM_WORDS];
+    uint64_t total_len;     // bytes so far, the last total_len % 64 of them are in partial_block
+    uint8_t partial_block[BLOCK_SIZE_BYTES];
+};
+
+// layout of sha256_multihash: stripe i of the buffer (the last one can be short) goes to segment i % MULTIHASH_SEGMENTS,
+// every segment digest is the SHA256 of its stripes in order, and the digest is the SHA256 of the segment digests in order followed
+// by the buffer length, 8 bytes little endian; 256 segments keep 16 lanes busy on 16 cores
+// each segment is one chain of blocks, hashed in order, so one call keeps at most MULTIHASH_SEGMENTS / lanes threads busy, 16 with
+// AVX512, 32 with the 8-lane accelerations; the layout is part of the digest, so the segments cannot grow with the host
+const uint64_t MULTIHASH_STRIPE_BYTES = 4096;
+const uint32_t MULTIHASH_SEGMENTS = 256;
+
+// counters of one worker thread, or of all of them added up, see mine_xcoin_telemetry
+struct MineStats {
+    uint64_t nonces_hashed;
+    uint64_t kernel_calls;
+    uint64_t kernel_cycles;     // time stamp counter (rdtsc) cycles inside the hashing functions, from one call in 64 for those hashing one batch per call
+    uint64_t loop_cycles;       // rdtsc cycles in the loop around them: claims, nonce setup, hit checks, template switches, not parked
+    uint64_t idle_lanes;        // lanes hashed for nothing, past the winner in the winning batch or past the largest nonce
+};
 
 #if defined(_MSC_VER ) && defined(_WIN64)
 #ifdef _EXPORTING
@@ -34,6 +97,107 @@ static int lane_counts[] = { 16, 1, 8, 4, 4, 1 };
 extern "C" {
 	CLASS_DECLSPEC bool mine_xcoin(const uint8_t target[DIGEST_SIZE_BYTES], const uint8_t message_ex_nonce[], uint64_t len_bytes, SHA256_Acceleration preferred_acceleration,
         uint8_t result_id[DIGEST_SIZE_BYTES], uint64_t result_nonce[1], SHA256_Acceleration acceleration_used[1], uint32_t num_threads_used[1], double timeout_seconds);
+
+    // asynchronous version of mine_xcoin, which is start + wait + result + free
+    // only one job hashes at a time: starting a job while another one runs waits for that one to end, replace it instead
+    // every nonce below share_target (can be null), usually easier than target, is kept for mine_xcoin_drain_shares as the job goes on
+    // without a layout (null) the nonce is 8 bytes little endian appended to the message, otherwise the message of len_bytes has
+    // the nonce field in it; returns null if the layout does not fit the message
+    // with a checkpoint (can be null) of an earlier job on the same message, layout and mode flags, the nonces it hashed are skipped,
+    // and its best digest is the winner if below target; returns null if the checkpoint is of another message
+    CLASS_DECLSPEC MineJob* mine_xcoin_start(const uint8_t target[DIGEST_SIZE_BYTES], const uint8_t message_ex_nonce[], uint64_t len_bytes,
+        SHA256_Acceleration preferred_acceleration, double timeout_seconds, uint32_t mode_flags, const uint8_t share_target[DIGEST_SIZE_BYTES],
+        const MineNonceLayout layout[1], const MineCheckpoint resume[1]);
+    CLASS_DECLSPEC MineJobStatus mine_xcoin_poll(MineJob* job);
+    CLASS_DECLSPEC MineJobStatus mine_xcoin_wait(MineJob* job, double wait_seconds);    // negative wait_seconds waits until the job ends
+    CLASS_DECLSPEC void mine_xcoin_cancel(MineJob* job);    // returns at once, the job ends within one kernel call
+    // a new timeout counted from now, e.g. to extend a job that is close to a winner, the same watchdog thread cancels it then
+    // returns false if the job has already timed out or ended
+    CLASS_DECLSPEC bool mine_xcoin_set_deadline(MineJob* job, double timeout_seconds);
+    // new target, message, share target and layout (both can be null) for a running job, the workers restart from their first nonce
+    // after their current kernel call; returns false if the job had already ended, or the layout does not fit the message
+    CLASS_DECLSPEC bool mine_xcoin_replace(MineJob* job, const uint8_t target[DIGEST_SIZE_BYTES], const uint8_t message_ex_nonce[], uint64_t len_bytes,
+        const uint8_t share_target[DIGEST_SIZE_BYTES], const MineNonceLayout layout[1]);
+    // moves up to max_shares of the shares found so far to shares, oldest first, while the job runs or after it has ended, returns how many
+    // the workers keep up to 1024 of them, num_dropped counts the ones found while that many were waiting, since the start
+    CLASS_DECLSPEC uint32_t mine_xcoin_drain_shares(MineJob* job, MineShare shares[], uint32_t max_shares, uint64_t num_dropped[1]);
+    // the workers of threads 1 to num_active (clamped to 1 and the thread count) hash, the others park after their current claim
+    // and the active ones take over what is left of their ranges, so no nonce is lost or hashed twice; returns the count set
+    CLASS_DECLSPEC uint32_t mine_xcoin_set_workers(MineJob* job, uint32_t num_active);
+    // which nonces of the last template (and extranonce) were hashed, once the job has ended (returns false before): all below frontier,
+    // UINT64_MAX if the whole nonce space was handed out, except num_gaps ranges of gaps[2 * i + 1] nonces from gaps[2 * i], at most max_gaps
+    // written; big endian nonces are counted as read little endian
+    CLASS_DECLSPEC bool mine_xcoin_coverage(MineJob* job, uint64_t frontier[1], uint64_t gaps[], uint32_t max_gaps, uint32_t num_gaps[1]);
+    // counters of the workers, while the job runs (each one as of its last timed kernel call) or once it has ended, without stopping them
+    // total adds up all the threads, per_thread gets the first max_threads of them (can be null), returns the number of threads
+    // elapsed_seconds is from the start to now, or to the end of the job, e.g. the hash rate is total.nonces_hashed / elapsed_seconds
+    CLASS_DECLSPEC uint32_t mine_xcoin_telemetry(MineJob* job, MineStats total[1], MineStats per_thread[], uint32_t max_threads, double elapsed_seconds[1]);
+    // the diagnostics are always filled, the ID and nonce only if the job has ended with a winner (for the template of the time)
+    // the worker threads span num_cores_used physical cores on num_nodes_used NUMA nodes, see mine_xcoin_set_threads
+    CLASS_DECLSPEC bool mine_xcoin_result(MineJob* job, uint8_t result_id[DIGEST_SIZE_BYTES], uint64_t result_nonce[1],
+        SHA256_Acceleration acceleration_used[1], uint32_t num_threads_used[1], uint32_t num_cores_used[1], uint32_t num_nodes_used[1]);
+    // the lowest digest so far of the current template (since the last replace), as the block ID, while the job runs or after
+    // it has ended, with its nonce and extranonce; returns false if no nonce has been hashed yet
+    CLASS_DECLSPEC bool mine_xcoin_best(MineJob* job, uint8_t best_id[DIGEST_SIZE_BYTES], uint64_t best_nonce[1], uint64_t best_extranonce[1]);
+    // where a job ended with its last template, for mine_xcoin_start to carry on from, whether it was cancelled, timed out or
+    // found a winner; returns false while the job runs
+    CLASS_DECLSPEC bool mine_xcoin_checkpoint(MineJob* job, MineCheckpoint checkpoint[1]);
+    // the extranonce of the winner, or while there is none the one of the template the job has gone furthest with
+    // returns true once the job has ended with a winner, 0 is given for a job without extranonce
+    CLASS_DECLSPEC bool mine_xcoin_extranonce(MineJob* job, uint64_t extranonce[1]);
+    CLASS_DECLSPEC void mine_xcoin_free(MineJob* job);     // cancels the job if still running, and waits for it to end
+
+    // replaces the worker threads of the following jobs, after the running job ends, by default one unpinned thread per hardware thread
+    // num_threads 0 is one thread per physical core for MinePlacement::PHYSICAL_CORES, and one per logical CPU otherwise
+    // cpus (num_cpus of them, can be null) restricts the threads to those logical CPUs, e.g. to leave cores to other services
+    // the bulk functions (sha256_multihash and those below it) get a set of threads of their own with the same layout, so they never
+    // wait for a job; returns false, with the threads unchanged, if none of the CPUs can be used
+    CLASS_DECLSPEC bool mine_xcoin_set_threads(uint32_t num_threads, const int32_t cpus[], uint32_t num_cpus, MinePlacement placement);
+
+    // times every supported acceleration on all the worker threads, for 1-block and 2-block tails, about seconds_per_run each
+    // the fastest ones are used by SHA256_Acceleration::AUTO from then on, and saved to profile_path unless it is null
+    // returns false if the profile could not be saved
+    CLASS_DECLSPEC bool mine_xcoin_calibrate(const char* profile_path, double seconds_per_run);
+    // loads a profile saved by mine_xcoin_calibrate, returns false if it cannot be read or was made on another kind of host
+    CLASS_DECLSPEC bool mine_xcoin_load_profile(const char* profile_path);
+
+    // whether this CPU has the instructions of an acceleration, whatever SHA256_ACCELERATION forces, see sha256_dispatch.h
+    CLASS_DECLSPEC bool sha256_acceleration_supported(SHA256_Acceleration acceleration);
+
+    // the context manager of Intel/sha256_mb.h, for many independent messages of any length at once, see sha256_ctx_mgr.cpp
+    // it runs on the vector functions with the most lanes the CPU supports, or in plain C without SSE4.1, and with SHA-NI flushes the
+    // last few messages one at a time on it, rather than all the lanes for each
+    // a context (hash_ctx_init first) is submitted with HASH_ENTIRE, or HASH_FIRST, updates and HASH_LAST; submit returns the contexts
+    // as their lanes complete, out of order, or null while lanes are free, and flush returns the rest one by one, then null
+    CLASS_DECLSPEC void sha256_ctx_mgr_init(SHA256_HASH_CTX_MGR* mgr);
+    CLASS_DECLSPEC SHA256_HASH_CTX* sha256_ctx_mgr_submit(SHA256_HASH_CTX_MGR* mgr, SHA256_HASH_CTX* ctx, const void* buffer, uint32_t len, HASH_CTX_FLAG flags);
+    CLASS_DECLSPEC SHA256_HASH_CTX* sha256_ctx_mgr_flush(SHA256_HASH_CTX_MGR* mgr);
+
+    // SHA256 of one message given in pieces of any length, 64-bit lengths, with SHA-NI where the CPU has it and plain C otherwise
+    // the whole blocks of an update are hashed in place, final writes the digest (big endian bytes) and the stream needs an init to start over
+    CLASS_DECLSPEC void sha256_stream_init(Sha256Stream stream[1]);
+    CLASS_DECLSPEC void sha256_stream_update(Sha256Stream stream[1], const uint8_t data[], uint64_t len_bytes);
+    CLASS_DECLSPEC void sha256_stream_final(Sha256Stream stream[1], uint8_t digest[DIGEST_SIZE_BYTES]);
+
+    // tree digest of one large buffer, with the layout of MULTIHASH_SEGMENTS, the same whatever the acceleration and thread count
+    // the segments are hashed on the lanes of the acceleration (AUTO for the widest supported one), by up to num_threads of the
+    // worker threads (0 for all of them, see mine_xcoin_set_threads), a buffer of one round of stripes or less on the calling thread
+    // only; returns the acceleration used
+    CLASS_DECLSPEC SHA256_Acceleration sha256_multihash(const uint8_t data[], uint64_t len_bytes, SHA256_Acceleration preferred_acceleration,
+        uint32_t num_threads, uint8_t digest[DIGEST_SIZE_BYTES]);
+
+    // Merkle root of num_leaves 32-byte nodes, each parent the hash of its two children, an odd last node paired with itself as in Bitcoin
+    // MINE_FLAG_SHA256D in mode_flags hashes with sha256d, the nodes are taken and the root given as the bytes of the hashes (Bitcoin's internal order)
+    // the pairs of a level are hashed on the lanes of the acceleration (AUTO for the widest supported one), a large level on up to
+    // num_threads of the worker threads (0 for all of them, see mine_xcoin_set_threads); returns false for no leaves
+    CLASS_DECLSPEC bool sha256_merkle_root(const uint8_t leaves[], uint64_t num_leaves, uint32_t mode_flags, SHA256_Acceleration preferred_acceleration,
+        uint32_t num_threads, uint8_t root[DIGEST_SIZE_BYTES]);
+
+    // SHA256 of every file of paths into digests (32 bytes each), many files at once, a different one in each lane of the context managers
+    // of up to num_threads of the worker threads (0 for all of them, see mine_xcoin_set_threads); the files are mapped into memory and read
+    // ahead a chunk at a time, see sha256_files.cpp
+    // errors gets 0, or the OS error of a file that could not be read (its digest zeroed); returns how many files were hashed
+    CLASS_DECLSPEC uint32_t sha256_files(const char* const paths[], uint32_t num_paths, uint32_t num_threads, uint8_t digests[], int32_t errors[]);
     void sha256_process_x86(uint32_t state[DIGEST_NUM_WORDS], const uint8_t data[], uint32_t length);  // SHA version by Jeffrey Walton
     void sha256_process(uint32_t state[8], const uint8_t data[], uint32_t length);   // plain C version by Jeffrey Walton
 }
@@ -11,8 +11,15 @@
 #define PCH_H
 
 // add headers that you want to pre-compile here
+#include <algorithm>
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstring>
+#include <fstream>
+#include <functional>
+#include <memory>
+#include <mutex>
 #include <thread>
 #include <vector>
 #include <iostream>
@@ -25,9 +32,11 @@
 
 #if defined(__GNUC__)
 #include <cstdlib>
+#include <x86intrin.h>
 #endif
 #if defined(_MSC_VER ) && defined(_WIN64)
 #include <malloc.h>
+#include <intrin.h>
 #endif
 
 #endif //PCH_H
@@ -0,0 +1,318 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+// the multi-buffer job and context managers declared in Intel/sha256_mb.h, on top of the vector functions of sha256_mb_wrapper.h
+// a job manager keeps up to one job of whole blocks per lane, and once every lane has one (or on a flush) hashes them all for as many
+// blocks as the shortest job has left, which completes; the others stay in their lanes, so the jobs complete out of order
+// a context manager splits messages of any length into such jobs: the whole blocks of each update straight from the caller's buffer,
+// the bytes left over in the partial block buffer of the context, until a later update fills it up or the last one pads it
+// the structs need no particular alignment, the vector functions load the digests and the data unaligned
+// the _ni managers are the same, except that a flush with few lanes in use hashes the shortest job alone with SHA-NI
+
+#include "pch.h"
+
+#include "sha256_dispatch.h"
+#include "Intel/sha256_mb_wrapper.h"
+
+static const uint32_t SHA256_IV[SHA256_DIGEST_NWORDS] = { SHA256_INITIAL_DIGEST };
+
+// the most lanes in use for which a flush of the _ni managers hashes one job with SHA-NI rather than all of them with the vector function
+// SHA-NI hashes one message faster than the x4 SSE function hashes four, and as fast as the x16 AVX-512 one hashes about six
+static const int NI_LANES_SSE = 4;
+static const int NI_LANES_AVX512 = 6;
+
+// the digests are in transposed form, word w of lane j at w * LANES + j, as the vector functions of LANES lanes leave them
+static uint32_t& lane_digest(SHA256_MB_JOB_MGR* state, int num_lanes, int lane, int w)
+{
+    return ((uint32_t*)state->args.digest)[w * num_lanes + lane];
+}
+
+template <int LANES>
+static void job_mgr_init(SHA256_MB_JOB_MGR* state)
+{
+    state->unused_lanes = 0;
+    for (int lane = LANES - 1; lane >= 0; lane--)     // a stack of nibbles, lane 0 on top
+        state->unused_lanes = (state->unused_lanes << 4) | (uint64_t)lane;
+    for (int lane = 0; lane < SHA256_MAX_LANES; lane++) {
+        state->lens[lane] = 0;
+        state->ldata[lane].job_in_lane = nullptr;
+    }
+    state->num_lanes_inuse = 0;
+}
+
+// the lane of the job with the fewest blocks left, there has to be one
+template <int LANES>
+static int shortest_lane(SHA256_MB_JOB_MGR* state)
+{
+    int shortest = -1;
+    for (int lane = 0; lane < LANES; lane++)
+        if (state->ldata[lane].job_in_lane != nullptr && (shortest < 0 || state->lens[lane] < state->lens[shortest]))
+            shortest = lane;
+    return shortest;
+}
+
+// hands back the job of a lane that has no block left, and frees the lane
+template <int LANES>
+static SHA256_JOB* job_mgr_complete(SHA256_MB_JOB_MGR* state, int lane)
+{
+    SHA256_JOB* job = state->ldata[lane].job_in_lane;
+    for (int w = 0; w < SHA256_DIGEST_NWORDS; w++)
+        job->result_digest[w] = lane_digest(state, LANES, lane, w);
+    job->status = STS_COMPLETED;
+    state->ldata[lane].job_in_lane = nullptr;
+    state->unused_lanes = (state->unused_lanes << 4) | (uint64_t)lane;
+    state->num_lanes_inuse--;
+    return job;
+}
+
+// hashes the lanes in use for as many blocks as the shortest job has left, and completes that job
+template <int LANES, sha256_lanes_function HASH>
+static SHA256_JOB* job_mgr_run(SHA256_MB_JOB_MGR* state)
+{
+    int shortest = shortest_lane<LANES>(state);
+    uint32_t num_blocks = state->lens[shortest];
+    if (num_blocks > 0) {
+        for (int lane = 0; lane < LANES; lane++)     // the idle lanes hash along on the data of the shortest job, for nothing
+            if (state->ldata[lane].job_in_lane == nullptr)
+                state->args.data_ptr[lane] = state->args.data_ptr[shortest];
+        HASH(&state->args, num_blocks);
+        for (int lane = 0; lane < LANES; lane++)
+            if (state->ldata[lane].job_in_lane != nullptr)
+                state->lens[lane] -= num_blocks;
+    }
+    return job_mgr_complete<LANES>(state, shortest);
+}
+
+// job->len is in blocks, and job->result_digest the state to start from
+// returns a completed job, not necessarily this one, or null while a lane is still free
+template <int LANES, sha256_lanes_function HASH>
+static SHA256_JOB* job_mgr_submit(SHA256_MB_JOB_MGR* state, SHA256_JOB* job)
+{
+    int lane = (int)(state->unused_lanes & 0xF);
+    state->unused_lanes >>= 4;
+    state->num_lanes_inuse++;
+    state->ldata[lane].job_in_lane = job;
+    state->lens[lane] = (uint32_t)job->len;
+    state->args.data_ptr[lane] = job->buffer;
+    for (int w = 0; w < SHA256_DIGEST_NWORDS; w++)
+        lane_digest(state, LANES, lane, w) = job->result_digest[w];
+    job->status = STS_BEING_PROCESSED;
+    if (state->num_lanes_inuse < LANES)
+        return nullptr;
+    return job_mgr_run<LANES, HASH>(state);
+}
+
+// completes one of the jobs in the lanes without waiting for the free lanes to fill, returns null if there is none
+// with at most NI_LANES lanes in use, the shortest job is hashed on its own with SHA-NI, the vector function would hash every lane
+// for the cost of one; the other jobs stay where they are, untouched
+template <int LANES, sha256_lanes_function HASH, int NI_LANES = 0>
+static SHA256_JOB* job_mgr_flush(SHA256_MB_JOB_MGR* state)
+{
+    if (state->num_lanes_inuse == 0)
+        return nullptr;
+    if (state->num_lanes_inuse > NI_LANES)
+        return job_mgr_run<LANES, HASH>(state);
+    int shortest = shortest_lane<LANES>(state);
+    sha256_ni_x1_wrapper(&state->args, state->lens[shortest], shortest, LANES);
+    state->lens[shortest] = 0;
+    return job_mgr_complete<LANES>(state, shortest);
+}
+
+// pads the partial block of a message of total_len bytes in place, returns the number of blocks to hash, 1 or 2
+static uint32_t pad_last_blocks(uint8_t partial_block[SHA256_BLOCK_SIZE * 2], uint64_t total_len)
+{
+    uint32_t i = (uint32_t)(total_len & (SHA256_BLOCK_SIZE - 1));
+    std::memset(partial_block + i, 0, SHA256_BLOCK_SIZE * 2 - i);
+    partial_block[i] = 0x80;
+    // the bit length takes the last 8 bytes of this block, or of the next one if it does not fit
+    uint32_t num_blocks = i + 1 + SHA256_PADLENGTHFIELD_SIZE > SHA256_BLOCK_SIZE ? 2 : 1;
+    *(uint64_t*)(partial_block + num_blocks * SHA256_BLOCK_SIZE - SHA256_PADLENGTHFIELD_SIZE) = to_be64(total_len * 8);
+    return num_blocks;
+}
+
+// gives a context back its next job, for as long as the job manager returns the job of a context straight away
+template <int LANES, sha256_lanes_function HASH>
+static SHA256_HASH_CTX* ctx_mgr_resubmit(SHA256_HASH_CTX_MGR* mgr, SHA256_HASH_CTX* ctx)
+{
+    while (ctx != nullptr) {
+        if (ctx->status & HASH_CTX_STS_COMPLETE) {
+            ctx->status = HASH_CTX_STS_COMPLETE;    // the padding was the last job
+            return ctx;
+        }
+        // the whole blocks of the update are hashed where they are, the bytes past them wait in the partial block buffer
+        if (ctx->partial_block_buffer_length == 0 && ctx->incoming_buffer_length > 0) {
+            const uint8_t* buffer = (const uint8_t*)ctx->incoming_buffer;
+            uint32_t len = ctx->incoming_buffer_length;
+            uint32_t copy_len = len & (SHA256_BLOCK_SIZE - 1);
+            if (copy_len > 0) {
+                len -= copy_len;
+                std::memcpy(ctx->partial_block_buffer, buffer + len, copy_len);
+                ctx->partial_block_buffer_length = copy_len;
+            }
+            ctx->incoming_buffer_length = 0;
+            if (len > 0) {
+                ctx->job.buffer = (uint8_t*)buffer;
+                ctx->job.len = len >> SHA256_LOG2_BLOCK_SIZE;
+                ctx = (SHA256_HASH_CTX*)job_mgr_submit<LANES, HASH>(&mgr->mgr, &ctx->job);     // the job is at offset 0
+                continue;
+            }
+        }
+        if (ctx->status & HASH_CTX_STS_LAST) {
+            ctx->job.buffer = ctx->partial_block_buffer;
+            ctx->job.len = pad_last_blocks(ctx->partial_block_buffer, ctx->total_length);
+            ctx->status = (HASH_CTX_STS)(HASH_CTX_STS_PROCESSING | HASH_CTX_STS_COMPLETE);
+            ctx = (SHA256_HASH_CTX*)job_mgr_submit<LANES, HASH>(&mgr->mgr, &ctx->job);
+            continue;
+        }
+        ctx->status = HASH_CTX_STS_IDLE;    // ready for the next update
+        return ctx;
+    }
+    return nullptr;
+}
+
+template <int LANES>
+static void ctx_mgr_init(SHA256_HASH_CTX_MGR* mgr)
+{
+    job_mgr_init<LANES>(&mgr->mgr);
+}
+
+// returns a context that is idle again or complete, not necessarily this one, or null while all of them are in the lanes
+// a context given back with an error (see hash_ctx_error) was left as it was
+template <int LANES, sha256_lanes_function HASH>
+static SHA256_HASH_CTX* ctx_mgr_submit(SHA256_HASH_CTX_MGR* mgr, SHA256_HASH_CTX* ctx, const void* buffer, uint32_t len, HASH_CTX_FLAG flags)
+{
+    if (flags & ~HASH_ENTIRE) {
+        ctx->error = HASH_CTX_ERROR_INVALID_FLAGS;
+        return ctx;
+    }
+    if (ctx->status & HASH_CTX_STS_PROCESSING) {
+        ctx->error = HASH_CTX_ERROR_ALREADY_PROCESSING;
+        return ctx;
+    }
+    if ((ctx->status & HASH_CTX_STS_COMPLETE) && !(flags & HASH_FIRST)) {
+        ctx->error = HASH_CTX_ERROR_ALREADY_COMPLETED;
+        return ctx;
+    }
+
+    if (flags & HASH_FIRST) {
+        std::memcpy(ctx->job.result_digest, SHA256_IV, sizeof(SHA256_IV));
+        ctx->total_length = 0;
+        ctx->partial_block_buffer_length = 0;
+    }
+    ctx->error = HASH_CTX_ERROR_NONE;
+    ctx->incoming_buffer = buffer;
+    ctx->incoming_buffer_length = len;
+    ctx->status = (flags & HASH_LAST) ? (HASH_CTX_STS)(HASH_CTX_STS_PROCESSING | HASH_CTX_STS_LAST) : HASH_CTX_STS_PROCESSING;
+    ctx->total_length += len;
+
+    // a partial block left by an earlier update is filled up first, and hashed on its own once full
+    if (ctx->partial_block_buffer_length > 0 || len < SHA256_BLOCK_SIZE) {
+        uint32_t copy_len = std::min(len, (uint32_t)SHA256_BLOCK_SIZE - ctx->partial_block_buffer_length);
+        std::memcpy(ctx->partial_block_buffer + ctx->partial_block_buffer_length, buffer, copy_len);
+        ctx->partial_block_buffer_length += copy_len;
+        ctx->incoming_buffer = (const uint8_t*)buffer + copy_len;
+        ctx->incoming_buffer_length -= copy_len;
+        if (ctx->partial_block_buffer_length == SHA256_BLOCK_SIZE) {
+            ctx->partial_block_buffer_length = 0;
+            ctx->job.buffer = ctx->partial_block_buffer;
+            ctx->job.len = 1;
+            ctx = (SHA256_HASH_CTX*)job_mgr_submit<LANES, HASH>(&mgr->mgr, &ctx->job);
+        }
+    }
+    return ctx_mgr_resubmit<LANES, HASH>(mgr, ctx);
+}
+
+// returns a context that is idle again or complete, or null once none is left in the lanes
+template <int LANES, sha256_lanes_function HASH, int NI_LANES = 0>
+static SHA256_HASH_CTX* ctx_mgr_flush(SHA256_HASH_CTX_MGR* mgr)
+{
+    for (;;) {
+        SHA256_HASH_CTX* ctx = (SHA256_HASH_CTX*)job_mgr_flush<LANES, HASH, NI_LANES>(&mgr->mgr);
+        if (ctx == nullptr)
+            return nullptr;
+        ctx = ctx_mgr_resubmit<LANES, HASH>(mgr, ctx);     // a context with more to hash goes back to a lane
+        if (ctx != nullptr)
+            return ctx;
+    }
+}
+
+extern "C" {
+    void sha256_mb_mgr_init_sse(SHA256_MB_JOB_MGR* state) { job_mgr_init<4>(state); }
+    SHA256_JOB* sha256_mb_mgr_submit_sse(SHA256_MB_JOB_MGR* state, SHA256_JOB* job) { return job_mgr_submit<4, sha256_lanes_x4_sse>(state, job); }
+    SHA256_JOB* sha256_mb_mgr_flush_sse(SHA256_MB_JOB_MGR* state) { return job_mgr_flush<4, sha256_lanes_x4_sse>(state); }
+    SHA256_JOB* sha256_mb_mgr_submit_avx(SHA256_MB_JOB_MGR* state, SHA256_JOB* job) { return job_mgr_submit<4, sha256_lanes_x4_avx>(state, job); }
+    SHA256_JOB* sha256_mb_mgr_flush_avx(SHA256_MB_JOB_MGR* state) { return job_mgr_flush<4, sha256_lanes_x4_avx>(state); }
+    void sha256_mb_mgr_init_avx2(SHA256_MB_JOB_MGR* state) { job_mgr_init<8>(state); }
+    SHA256_JOB* sha256_mb_mgr_submit_avx2(SHA256_MB_JOB_MGR* state, SHA256_JOB* job) { return job_mgr_submit<8, sha256_lanes_x8_avx2>(state, job); }
+    SHA256_JOB* sha256_mb_mgr_flush_avx2(SHA256_MB_JOB_MGR* state) { return job_mgr_flush<8, sha256_lanes_x8_avx2>(state); }
+    void sha256_mb_mgr_init_avx512vl(SHA256_MB_JOB_MGR* state) { job_mgr_init<8>(state); }
+    SHA256_JOB* sha256_mb_mgr_submit_avx512vl(SHA256_MB_JOB_MGR* state, SHA256_JOB* job) { return job_mgr_submit<8, sha256_lanes_x8_avx512vl>(state, job); }
+    SHA256_JOB* sha256_mb_mgr_flush_avx512vl(SHA256_MB_JOB_MGR* state) { return job_mgr_flush<8, sha256_lanes_x8_avx512vl>(state); }
+    void sha256_mb_mgr_init_avx512(SHA256_MB_JOB_MGR* state) { job_mgr_init<16>(state); }
+    SHA256_JOB* sha256_mb_mgr_submit_avx512(SHA256_MB_JOB_MGR* state, SHA256_JOB* job) { return job_mgr_submit<16, sha256_lanes_x16_avx512>(state, job); }
+    SHA256_JOB* sha256_mb_mgr_flush_avx512(SHA256_MB_JOB_MGR* state) { return job_mgr_flush<16, sha256_lanes_x16_avx512>(state); }
+    void sha256_mb_mgr_init_sse_ni(SHA256_MB_JOB_MGR* state) { job_mgr_init<4>(state); }
+    SHA256_JOB* sha256_mb_mgr_submit_sse_ni(SHA256_MB_JOB_MGR* state, SHA256_JOB* job) { return job_mgr_submit<4, sha256_lanes_x4_sse>(state, job); }
+    SHA256_JOB* sha256_mb_mgr_flush_sse_ni(SHA256_MB_JOB_MGR* state) { return job_mgr_flush<4, sha256_lanes_x4_sse, NI_LANES_SSE>(state); }
+    void sha256_mb_mgr_init_avx512_ni(SHA256_MB_JOB_MGR* state) { job_mgr_init<16>(state); }
+    SHA256_JOB* sha256_mb_mgr_submit_avx512_ni(SHA256_MB_JOB_MGR* state, SHA256_JOB* job) { return job_mgr_submit<16, sha256_lanes_x16_avx512>(state, job); }
+    SHA256_JOB* sha256_mb_mgr_flush_avx512_ni(SHA256_MB_JOB_MGR* state) { return job_mgr_flush<16, sha256_lanes_x16_avx512, NI_LANES_AVX512>(state); }
+
+    void sha256_ctx_mgr_init_base(SHA256_HASH_CTX_MGR* mgr) { ctx_mgr_init<1>(mgr); }
+    SHA256_HASH_CTX* sha256_ctx_mgr_submit_base(SHA256_HASH_CTX_MGR* mgr, SHA256_HASH_CTX* ctx, const void* buffer, uint32_t len, HASH_CTX_FLAG flags)
+    {
+        return ctx_mgr_submit<1, sha256_lanes_x1_plain>(mgr, ctx, buffer, len, flags);
+    }
+    SHA256_HASH_CTX* sha256_ctx_mgr_flush_base(SHA256_HASH_CTX_MGR* mgr) { return ctx_mgr_flush<1, sha256_lanes_x1_plain>(mgr); }
+
+    void sha256_ctx_mgr_init_sse(SHA256_HASH_CTX_MGR* mgr) { ctx_mgr_init<4>(mgr); }
+    SHA256_HASH_CTX* sha256_ctx_mgr_submit_sse(SHA256_HASH_CTX_MGR* mgr, SHA256_HASH_CTX* ctx, const void* buffer, uint32_t len, HASH_CTX_FLAG flags)
+    {
+        return ctx_mgr_submit<4, sha256_lanes_x4_sse>(mgr, ctx, buffer, len, flags);
+    }
+    SHA256_HASH_CTX* sha256_ctx_mgr_flush_sse(SHA256_HASH_CTX_MGR* mgr) { return ctx_mgr_flush<4, sha256_lanes_x4_sse>(mgr); }
+
+    void sha256_ctx_mgr_init_sse_ni(SHA256_HASH_CTX_MGR* mgr) { ctx_mgr_init<4>(mgr); }
+    SHA256_HASH_CTX* sha256_ctx_mgr_submit_sse_ni(SHA256_HASH_CTX_MGR* mgr, SHA256_HASH_CTX* ctx, const void* buffer, uint32_t len, HASH_CTX_FLAG flags)
+    {
+        return ctx_mgr_submit<4, sha256_lanes_x4_sse>(mgr, ctx, buffer, len, flags);
+    }
+    SHA256_HASH_CTX* sha256_ctx_mgr_flush_sse_ni(SHA256_HASH_CTX_MGR* mgr) { return ctx_mgr_flush<4, sha256_lanes_x4_sse, NI_LANES_SSE>(mgr); }
+
+    void sha256_ctx_mgr_init_avx(SHA256_HASH_CTX_MGR* mgr) { ctx_mgr_init<4>(mgr); }
+    SHA256_HASH_CTX* sha256_ctx_mgr_submit_avx(SHA256_HASH_CTX_MGR* mgr, SHA256_HASH_CTX* ctx, const void* buffer, uint32_t len, HASH_CTX_FLAG flags)
+    {
+        return ctx_mgr_submit<4, sha256_lanes_x4_avx>(mgr, ctx, buffer, len, flags);
+    }
+    SHA256_HASH_CTX* sha256_ctx_mgr_flush_avx(SHA256_HASH_CTX_MGR* mgr) { return ctx_mgr_flush<4, sha256_lanes_x4_avx>(mgr); }
+
+    void sha256_ctx_mgr_init_avx2(SHA256_HASH_CTX_MGR* mgr) { ctx_mgr_init<8>(mgr); }
+    SHA256_HASH_CTX* sha256_ctx_mgr_submit_avx2(SHA256_HASH_CTX_MGR* mgr, SHA256_HASH_CTX* ctx, const void* buffer, uint32_t len, HASH_CTX_FLAG flags)
+    {
+        return ctx_mgr_submit<8, sha256_lanes_x8_avx2>(mgr, ctx, buffer, len, flags);
+    }
+    SHA256_HASH_CTX* sha256_ctx_mgr_flush_avx2(SHA256_HASH_CTX_MGR* mgr) { return ctx_mgr_flush<8, sha256_lanes_x8_avx2>(mgr); }
+
+    void sha256_ctx_mgr_init_avx512vl(SHA256_HASH_CTX_MGR* mgr) { ctx_mgr_init<8>(mgr); }
+    SHA256_HASH_CTX* sha256_ctx_mgr_submit_avx512vl(SHA256_HASH_CTX_MGR* mgr, SHA256_HASH_CTX* ctx, const void* buffer, uint32_t len,
+        HASH_CTX_FLAG flags)
+    {
+        return ctx_mgr_submit<8, sha256_lanes_x8_avx512vl>(mgr, ctx, buffer, len, flags);
+    }
+    SHA256_HASH_CTX* sha256_ctx_mgr_flush_avx512vl(SHA256_HASH_CTX_MGR* mgr) { return ctx_mgr_flush<8, sha256_lanes_x8_avx512vl>(mgr); }
+
+    void sha256_ctx_mgr_init_avx512(SHA256_HASH_CTX_MGR* mgr) { ctx_mgr_init<16>(mgr); }
+    SHA256_HASH_CTX* sha256_ctx_mgr_submit_avx512(SHA256_HASH_CTX_MGR* mgr, SHA256_HASH_CTX* ctx, const void* buffer, uint32_t len, HASH_CTX_FLAG flags)
+    {
+        return ctx_mgr_submit<16, sha256_lanes_x16_avx512>(mgr, ctx, buffer, len, flags);
+    }
+    SHA256_HASH_CTX* sha256_ctx_mgr_flush_avx512(SHA256_HASH_CTX_MGR* mgr) { return ctx_mgr_flush<16, sha256_lanes_x16_avx512>(mgr); }
+
+    void sha256_ctx_mgr_init_avx512_ni(SHA256_HASH_CTX_MGR* mgr) { ctx_mgr_init<16>(mgr); }
+    SHA256_HASH_CTX* sha256_ctx_mgr_submit_avx512_ni(SHA256_HASH_CTX_MGR* mgr, SHA256_HASH_CTX* ctx, const void* buffer, uint32_t len,
+        HASH_CTX_FLAG flags)
+    {
+        return ctx_mgr_submit<16, sha256_lanes_x16_avx512>(mgr, ctx, buffer, len, flags);
+    }
+    SHA256_HASH_CTX* sha256_ctx_mgr_flush_avx512_ni(SHA256_HASH_CTX_MGR* mgr) { return ctx_mgr_flush<16, sha256_lanes_x16_avx512, NI_LANES_AVX512>(mgr); }
+}
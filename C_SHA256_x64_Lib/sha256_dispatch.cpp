@@ -0,0 +1,131 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+// the dispatch table of sha256_dispatch.h, filled in once when the library is loaded
+// GNU ifunc is not used: its resolvers run while the library is being relocated, before the constructors (and CPU_Rep of cpuid.cpp)
+// and, in a program linked to the library, before the C library has the environment that SHA256_ACCELERATION is read from
+
+#include "pch.h"
+
+#include "sha256_dispatch.h"
+#include "sha256_scalar.h"
+#include "Intel/sha256_sha_sse41.h"
+#include "Microsoft/cpuid.cpp"  // only here, the rest of the library asks sha256_dispatch
+
+static const int BLOCK_SIZE_BYTES = 64;
+
+void sha256_lanes_x16_avx512(SHA256_MB_ARGS_X16* args, uint64_t num_blocks) { sha256_mb_x16_avx512_wrapper(args, num_blocks); }
+void sha256_lanes_x8_avx2(SHA256_MB_ARGS_X16* args, uint64_t num_blocks) { sha256_mb_x8_avx2_wrapper((SHA256_MB_ARGS_X8*)args, num_blocks); }
+void sha256_lanes_x8_avx512vl(SHA256_MB_ARGS_X16* args, uint64_t num_blocks) { sha256_mb_x8_avx512vl_wrapper((SHA256_MB_ARGS_X8*)args, num_blocks); }
+void sha256_lanes_x4_avx(SHA256_MB_ARGS_X16* args, uint64_t num_blocks) { sha256_mb_x4_avx_wrapper((SHA256_MB_ARGS_X4*)args, num_blocks); }
+void sha256_lanes_x4_sse(SHA256_MB_ARGS_X16* args, uint64_t num_blocks) { sha256_mb_x4_sse_wrapper((SHA256_MB_ARGS_X4*)args, num_blocks); }
+void sha256_lanes_x4_sha(SHA256_MB_ARGS_X16* args, uint64_t num_blocks) { sha256_mb_x4_sha_sse41_wrapper((SHA256_MB_ARGS_X4*)args, num_blocks); }
+void sha256_lanes_x2_sha(SHA256_MB_ARGS_X16* args, uint64_t num_blocks) { sha256_mb_x2_sha_sse41_wrapper((SHA256_MB_ARGS_X2*)args, num_blocks); }
+void sha256_lanes_x1_sha(SHA256_MB_ARGS_X16* args, uint64_t num_blocks)
+{
+    sha256_sha_sse41((uint32_t*)args->digest, args->data_ptr[0], num_blocks);
+    args->data_ptr[0] += num_blocks * BLOCK_SIZE_BYTES;
+}
+void sha256_lanes_x1_plain(SHA256_MB_ARGS_X16* args, uint64_t num_blocks)
+{
+    sha256_scalar((uint32_t*)args->digest, args->data_ptr[0], num_blocks);
+    args->data_ptr[0] += num_blocks * BLOCK_SIZE_BYTES;
+}
+
+// in the order of SHA256_Acceleration
+static const sha256_lanes_function lane_functions[] = { sha256_lanes_x16_avx512, sha256_lanes_x1_sha, sha256_lanes_x8_avx2, sha256_lanes_x4_avx,
+    sha256_lanes_x4_sse, sha256_lanes_x1_plain, sha256_lanes_x4_sha, sha256_lanes_x2_sha, sha256_lanes_x8_avx512vl };
+static const sha256_mine_loop_function mine_loop_functions[] = { sha256_mine_x16_avx512_wrapper, nullptr, sha256_mine_x8_avx2_wrapper, nullptr,
+    nullptr, nullptr, nullptr, nullptr, sha256_mine_x8_avx512vl_wrapper };
+static const char* const acceleration_names[] = { "AVX512", "SHA", "AVX2", "AVX", "SSE41", "NO_ACCEL", "SHA_X4", "SHA_X2", "AVX512VL" };
+
+// the functions with the most lanes first, for the bulk hashing, where every lane is busy whatever the CPU
+static const SHA256_Acceleration widest_accelerations[] = { SHA256_Acceleration::AVX512, SHA256_Acceleration::AVX512VL, SHA256_Acceleration::AVX2,
+    SHA256_Acceleration::SHA_X4, SHA256_Acceleration::AVX, SHA256_Acceleration::SSE41, SHA256_Acceleration::NO_ACCEL };
+
+static Sha256Dispatch make_dispatch()
+{
+    Sha256Dispatch dispatch;
+    bool sha = InstructionSet::SHA() && InstructionSet::SSE41();
+    const bool supported[NUM_ACCELERATIONS] = { InstructionSet::AVX512F(), sha, InstructionSet::AVX2(), InstructionSet::AVX(), InstructionSet::SSE41(),
+        true, sha, sha, InstructionSet::AVX512F() && InstructionSet::AVX512VL() };
+    for (int a = 0; a < NUM_ACCELERATIONS; a++) {
+        dispatch.supported[a] = supported[a];
+        dispatch.lanes[a] = lane_functions[a];
+        dispatch.mine_loop[a] = mine_loop_functions[a];
+    }
+
+    dispatch.forced = SHA256_Acceleration::AUTO;
+    const char* forced_name = std::getenv("SHA256_ACCELERATION");
+    for (int a = 0; a < NUM_ACCELERATIONS && forced_name != nullptr; a++)
+        if (std::strcmp(forced_name, acceleration_names[a]) == 0)
+            dispatch.forced = (SHA256_Acceleration)a;
+    auto supported_or_fallback = [&](SHA256_Acceleration a) {
+        while (!supported[(uint8_t)a]) a = fallback_accelerations[(uint8_t)a];
+        return a;
+    };
+
+    dispatch.widest = SHA256_Acceleration::NO_ACCEL;
+    if (dispatch.forced != SHA256_Acceleration::AUTO)
+        dispatch.widest = supported_or_fallback(dispatch.forced);
+    else
+        for (SHA256_Acceleration a : widest_accelerations)
+            if (supported[(uint8_t)a]) {
+                dispatch.widest = a;
+                break;
+            }
+    dispatch.blocks = supported[(int)SHA256_Acceleration::SHA] && dispatch.forced != SHA256_Acceleration::NO_ACCEL ? sha256_sha_sse41 : sha256_scalar;
+
+    // the context managers come in the vector widths, the SHA ones take the SSE manager
+    // with SHA-NI, the AVX-512 and SSE ones are the hybrid _ni managers, which flush the last few jobs on SHA-NI one at a time
+    SHA256_Acceleration ctx_acceleration = dispatch.forced != SHA256_Acceleration::AUTO ? supported_or_fallback(dispatch.forced)
+        : supported[(int)SHA256_Acceleration::AVX512] ? SHA256_Acceleration::AVX512
+        : supported[(int)SHA256_Acceleration::AVX2] ? SHA256_Acceleration::AVX2
+        : supported[(int)SHA256_Acceleration::AVX] ? SHA256_Acceleration::AVX
+        : supported[(int)SHA256_Acceleration::SSE41] ? SHA256_Acceleration::SSE41 : SHA256_Acceleration::NO_ACCEL;
+    switch (ctx_acceleration) {
+        case SHA256_Acceleration::AVX512:
+            if (sha)
+                dispatch.ctx_mgr = { sha256_ctx_mgr_init_avx512_ni, sha256_ctx_mgr_submit_avx512_ni, sha256_ctx_mgr_flush_avx512_ni };
+            else
+                dispatch.ctx_mgr = { sha256_ctx_mgr_init_avx512, sha256_ctx_mgr_submit_avx512, sha256_ctx_mgr_flush_avx512 };
+            break;
+        case SHA256_Acceleration::AVX2:
+            dispatch.ctx_mgr = { sha256_ctx_mgr_init_avx2, sha256_ctx_mgr_submit_avx2, sha256_ctx_mgr_flush_avx2 };
+            break;
+        case SHA256_Acceleration::AVX512VL:
+            dispatch.ctx_mgr = { sha256_ctx_mgr_init_avx512vl, sha256_ctx_mgr_submit_avx512vl, sha256_ctx_mgr_flush_avx512vl };
+            break;
+        case SHA256_Acceleration::AVX:
+            dispatch.ctx_mgr = { sha256_ctx_mgr_init_avx, sha256_ctx_mgr_submit_avx, sha256_ctx_mgr_flush_avx };
+            break;
+        case SHA256_Acceleration::NO_ACCEL:
+            dispatch.ctx_mgr = { sha256_ctx_mgr_init_base, sha256_ctx_mgr_submit_base, sha256_ctx_mgr_flush_base };
+            break;
+        default:    // SSE4.1, and the SHA ones
+            if (sha)
+                dispatch.ctx_mgr = { sha256_ctx_mgr_init_sse_ni, sha256_ctx_mgr_submit_sse_ni, sha256_ctx_mgr_flush_sse_ni };
+            else
+                dispatch.ctx_mgr = { sha256_ctx_mgr_init_sse, sha256_ctx_mgr_submit_sse, sha256_ctx_mgr_flush_sse };
+            break;
+    }
+    return dispatch;
+}
+
+const Sha256Dispatch& sha256_dispatch()
+{
+    static const Sha256Dispatch dispatch = make_dispatch();
+    return dispatch;
+}
+
+// after CPU_Rep, which is defined above in this translation unit, and before any call into the library
+static const Sha256Dispatch& dispatch_at_load = sha256_dispatch();
+
+SHA256_Acceleration supported_acceleration(SHA256_Acceleration preferred_acceleration)
+{
+    if ((uint8_t)preferred_acceleration >= NUM_ACCELERATIONS) preferred_acceleration = SHA256_Acceleration::NO_ACCEL;
+    // this can never loop forever because NO_ACCEL is always supported, and every fallback chain ends there
+    while (!sha256_dispatch().supported[(uint8_t)preferred_acceleration])
+        preferred_acceleration = fallback_accelerations[(uint8_t)preferred_acceleration];
+    return preferred_acceleration;
+}
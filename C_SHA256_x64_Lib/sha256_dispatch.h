@@ -0,0 +1,68 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef _SHA256_DISPATCH_H_
+#define _SHA256_DISPATCH_H_
+
+#include <cstdint>
+
+#include "Intel/sha256_mb_wrapper.h"
+#include "Intel/sha256_mine.h"
+
+// enum class to indicate the preferred acceleration method
+// AUTO picks the fastest one measured on this host for the job's tail, see mine_xcoin_calibrate, or AVX512 if there is no profile,
+// and for the bulk functions (sha256_multihash, sha256_merkle_root) the supported one with the most lanes; either way the one named
+// in the environment variable SHA256_ACCELERATION instead if it is set when the library is loaded, see Sha256Dispatch
+// SHA_X2 interleaves the SHA-NI rounds of 2 messages, to hide the latency of the SHA instructions, SHA_X4 hashes 2 such pairs in turn
+// AVX512VL runs the AVX-512 rotates and ternary logic on the 8 lanes of ymm registers, for CPUs that lower their clock for zmm ones
+enum class SHA256_Acceleration : uint8_t { AVX512 = 0, SHA = 1, AVX2 = 2, AVX = 3, SSE41 = 4, NO_ACCEL = 5, SHA_X4 = 6, SHA_X2 = 7, AVX512VL = 8,
+    AUTO = 0xFF };
+// the next one to try when an acceleration is not supported by the CPU, the last one of every chain is NO_ACCEL
+static const SHA256_Acceleration fallback_accelerations[] = { SHA256_Acceleration::SHA, SHA256_Acceleration::AVX2, SHA256_Acceleration::AVX,
+    SHA256_Acceleration::SSE41, SHA256_Acceleration::NO_ACCEL, SHA256_Acceleration::NO_ACCEL, SHA256_Acceleration::SHA_X2, SHA256_Acceleration::SHA,
+    SHA256_Acceleration::AVX2 };
+// vector instructions can handle multiple messages at the same time
+static const int lane_counts[] = { 16, 1, 8, 4, 4, 1, 4, 2, 8 };
+const int NUM_ACCELERATIONS = sizeof(lane_counts) / sizeof(lane_counts[0]);
+
+// compresses whole blocks into state, the caller pads the last one
+typedef void (*sha256_blocks_function)(uint32_t state[8], const uint8_t data[], uint64_t num_blocks);
+// num_blocks of every lane of args, from the transposed digests in it, and moves the data pointers past them
+typedef void (*sha256_lanes_function)(SHA256_MB_ARGS_X16* args, uint64_t num_blocks);
+// the lane functions of the table, one per kernel, also the template arguments of the managers of sha256_ctx_mgr.cpp
+void sha256_lanes_x16_avx512(SHA256_MB_ARGS_X16* args, uint64_t num_blocks);
+void sha256_lanes_x8_avx2(SHA256_MB_ARGS_X16* args, uint64_t num_blocks);
+void sha256_lanes_x8_avx512vl(SHA256_MB_ARGS_X16* args, uint64_t num_blocks);
+void sha256_lanes_x4_avx(SHA256_MB_ARGS_X16* args, uint64_t num_blocks);
+void sha256_lanes_x4_sse(SHA256_MB_ARGS_X16* args, uint64_t num_blocks);
+void sha256_lanes_x4_sha(SHA256_MB_ARGS_X16* args, uint64_t num_blocks);
+void sha256_lanes_x2_sha(SHA256_MB_ARGS_X16* args, uint64_t num_blocks);
+void sha256_lanes_x1_sha(SHA256_MB_ARGS_X16* args, uint64_t num_blocks);
+void sha256_lanes_x1_plain(SHA256_MB_ARGS_X16* args, uint64_t num_blocks);
+// the mining kernels that build the nonces themselves and loop over many batches, see Intel/sha256_mine.h
+typedef uint32_t (*sha256_mine_loop_function)(const SHA256_MINE_PRECOMP* precomp, SHA256_MINE_RANGE* range, uint64_t num_blocks);
+
+// the hashing functions for this CPU, picked once when the library is loaded, in the only translation unit that checks the CPU
+// (sha256_dispatch.cpp), so that the hot loops call them through a pointer, without branching on the acceleration
+// SHA256_ACCELERATION (AVX512, SHA, AVX2, AVX, SSE41, NO_ACCEL, SHA_X4, SHA_X2 or AVX512VL) forces the acceleration of AUTO, falling back if
+// the CPU does not support it, e.g. to run the AVX2 kernels on an AVX-512 host; NO_ACCEL also keeps the SHA instructions out of
+// the streaming API, and the context managers take the width of the forced one (SSE for the SHA ones, plain C for NO_ACCEL)
+struct Sha256Dispatch {
+    bool supported[NUM_ACCELERATIONS];      // by the CPU, whatever is forced
+    SHA256_Acceleration forced;             // AUTO if SHA256_ACCELERATION is not set, or not one of the names above
+    SHA256_Acceleration widest;             // AUTO of the bulk functions
+    sha256_blocks_function blocks;          // one message at a time, SHA-NI where the CPU has it, plain C otherwise
+    sha256_lanes_function lanes[NUM_ACCELERATIONS];     // lane_counts messages of the same length, lane 0 only for SHA and NO_ACCEL
+    sha256_mine_loop_function mine_loop[NUM_ACCELERATIONS];     // null for the accelerations without looping mining kernel
+    struct {
+        void (*init)(SHA256_HASH_CTX_MGR* mgr);
+        SHA256_HASH_CTX* (*submit)(SHA256_HASH_CTX_MGR* mgr, SHA256_HASH_CTX* ctx, const void* buffer, uint32_t len, HASH_CTX_FLAG flags);
+        SHA256_HASH_CTX* (*flush)(SHA256_HASH_CTX_MGR* mgr);
+    } ctx_mgr;                              // the context manager with the most lanes, the _ni one with SHA-NI, see sha256_ctx_mgr.cpp
+};
+const Sha256Dispatch& sha256_dispatch();
+
+// preferred_acceleration if the CPU supports it, or else the first one of its fallback chain that it does, NO_ACCEL for AUTO
+SHA256_Acceleration supported_acceleration(SHA256_Acceleration preferred_acceleration);
+
+#endif // _SHA256_DISPATCH_H_
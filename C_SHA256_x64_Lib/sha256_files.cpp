@@ -0,0 +1,206 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+// many files hashed at once: every thread has a context manager of its own, see sha256_ctx_mgr.cpp, with a different file in each
+// of its contexts, which are fed the mapped files a chunk at a time; the lanes only wait on the page cache, as the next chunk of every
+// file is read ahead while the current ones are hashed
+
+#include "pch.h"
+
+#include "sha256_files.h"
+#include "mine_pool.h"
+#include "Intel/sha256_mb_wrapper.h"
+
+#if defined(_MSC_VER ) && defined(_WIN64)
+#include "framework.h"
+#endif
+
+#if defined(__GNUC__)
+#include <cerrno>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+const uint8_t MappedFile::no_bytes = 0;
+
+#if defined(_MSC_VER ) && defined(_WIN64)
+int MappedFile::open(const char* path)
+{
+    close();
+    HANDLE file = CreateFileA(path, GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (file == INVALID_HANDLE_VALUE)
+        return (int)GetLastError();
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size)) {
+        int error = (int)GetLastError();
+        CloseHandle(file);
+        return error;
+    }
+    if (size.QuadPart > 0) {
+        // the mapping keeps the file open
+        HANDLE file_mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        void* view = file_mapping == nullptr ? nullptr : MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0);
+        if (view == nullptr) {
+            int error = (int)GetLastError();
+            if (file_mapping != nullptr) CloseHandle(file_mapping);
+            CloseHandle(file);
+            return error;
+        }
+        mapping = file_mapping;
+        bytes = (const uint8_t*)view;
+        num_bytes = (uint64_t)size.QuadPart;
+    }
+    CloseHandle(file);
+    return 0;
+}
+
+void MappedFile::close()
+{
+    if (mapping != nullptr) {
+        UnmapViewOfFile(bytes);
+        CloseHandle(mapping);
+    }
+    mapping = nullptr;
+    bytes = &no_bytes;
+    num_bytes = 0;
+}
+
+void MappedFile::read_ahead(uint64_t offset, uint64_t len) const
+{
+    if (offset >= num_bytes) return;
+    WIN32_MEMORY_RANGE_ENTRY range = { (void*)(bytes + offset), (SIZE_T)std::min(len, num_bytes - offset) };
+    PrefetchVirtualMemory(GetCurrentProcess(), 1, &range, 0);
+}
+#endif
+
+#if defined(__GNUC__)
+int MappedFile::open(const char* path)
+{
+    close();
+    int fd = ::open(path, O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+        return errno;
+    struct stat status;
+    int error = fstat(fd, &status) != 0 ? errno : S_ISDIR(status.st_mode) ? EISDIR : !S_ISREG(status.st_mode) ? EINVAL : 0;
+    if (error != 0) {
+        ::close(fd);
+        return error;
+    }
+    if (status.st_size > 0) {
+        // the mapping keeps the file open
+        void* view = mmap(nullptr, (size_t)status.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (view == MAP_FAILED) {
+            error = errno;
+            ::close(fd);
+            return error;
+        }
+        madvise(view, (size_t)status.st_size, MADV_SEQUENTIAL);     // more read-ahead, and the pages behind are dropped first
+        bytes = (const uint8_t*)view;
+        num_bytes = (uint64_t)status.st_size;
+    }
+    ::close(fd);
+    return 0;
+}
+
+void MappedFile::close()
+{
+    if (num_bytes > 0)
+        munmap((void*)bytes, num_bytes);
+    bytes = &no_bytes;
+    num_bytes = 0;
+}
+
+void MappedFile::read_ahead(uint64_t offset, uint64_t len) const
+{
+    if (offset >= num_bytes) return;
+    uint64_t page_offset = offset & ~(uint64_t)(sysconf(_SC_PAGESIZE) - 1);    // madvise takes a page aligned address
+    madvise((void*)(bytes + page_offset), (size_t)(std::min(len, num_bytes - offset) + offset - page_offset), MADV_WILLNEED);
+}
+#endif
+
+// one context of a thread's manager, with the file it is hashing
+struct FileLane {
+    SHA256_HASH_CTX ctx;
+    MappedFile file;
+    uint32_t path_index = 0;
+    uint64_t offset = 0;    // of the next chunk
+};
+
+// hashes files from next_path on until there are none left, up to max_lanes of them at once, each one in a context of its own
+static void hash_files_worker(const char* const paths[], uint32_t num_paths, std::atomic<uint32_t>& next_path, uint32_t max_lanes,
+    uint8_t digests[], int32_t errors[])
+{
+    std::unique_ptr<SHA256_HASH_CTX_MGR> mgr(new SHA256_HASH_CTX_MGR);
+    std::unique_ptr<FileLane[]> lanes(new FileLane[SHA256_MAX_LANES]);
+    sha256_ctx_mgr_init(mgr.get());
+
+    // the lane gets the next file that can be opened, false once there is none left
+    auto start_next_file = [&](FileLane& lane) {
+        for (uint32_t i = next_path.fetch_add(1); i < num_paths; i = next_path.fetch_add(1)) {
+            errors[i] = lane.file.open(paths[i]);
+            if (errors[i] == 0) {
+                hash_ctx_init(&lane.ctx);
+                hash_ctx_user_data(&lane.ctx) = &lane;
+                lane.path_index = i;
+                lane.offset = 0;
+                return true;
+            }
+            std::memset(digests + i * SHA256_DIGEST_NWORDS * 4, 0, SHA256_DIGEST_NWORDS * 4);
+        }
+        return false;
+    };
+    auto submit_chunk = [&](FileLane& lane) {
+        uint64_t len = std::min(FILES_CHUNK_BYTES, lane.file.size() - lane.offset);
+        bool first = lane.offset == 0, last = lane.offset + len == lane.file.size();
+        HASH_CTX_FLAG flags = first && last ? HASH_ENTIRE : first ? HASH_FIRST : last ? HASH_LAST : HASH_UPDATE;
+        const uint8_t* chunk = lane.file.data() + lane.offset;
+        lane.offset += len;
+        lane.file.read_ahead(lane.offset, FILES_CHUNK_BYTES);
+        return sha256_ctx_mgr_submit(mgr.get(), &lane.ctx, chunk, (uint32_t)len, flags);
+    };
+    // a context given back by the manager is idle, it goes on with the next chunk of its file, or once that is hashed, with the next file
+    auto feed = [&](SHA256_HASH_CTX* ctx) {
+        while (ctx != nullptr) {
+            FileLane& lane = *(FileLane*)hash_ctx_user_data(ctx);
+            if (hash_ctx_complete(ctx)) {
+                uint8_t* digest = digests + lane.path_index * SHA256_DIGEST_NWORDS * 4;
+                for (int w = 0; w < SHA256_DIGEST_NWORDS; w++)
+                    ((uint32_t*)digest)[w] = byteswap32(hash_ctx_digest(ctx)[w]);
+                lane.file.close();
+                if (!start_next_file(lane))
+                    return;
+            }
+            ctx = submit_chunk(lane);
+        }
+    };
+
+    for (uint32_t j = 0; j < max_lanes && start_next_file(lanes[j]); j++)
+        feed(submit_chunk(lanes[j]));
+    for (SHA256_HASH_CTX* ctx = sha256_ctx_mgr_flush(mgr.get()); ctx != nullptr; ctx = sha256_ctx_mgr_flush(mgr.get()))
+        feed(ctx);
+}
+
+uint32_t hash_files(const char* const paths[], uint32_t num_paths, uint32_t num_threads, uint8_t digests[], int32_t errors[])
+{
+    std::atomic<uint32_t> next_path{ 0 };
+    // the files are shared out evenly to start with, so that a few large ones do not end up in the lanes of one thread
+    auto lanes_per_thread = [&](uint32_t active_threads) {
+        return std::min((uint32_t)SHA256_MAX_LANES, (num_paths + active_threads - 1) / active_threads);
+    };
+    if (num_threads == 1 || num_paths <= 1)
+        hash_files_worker(paths, num_paths, next_path, lanes_per_thread(1), digests, errors);
+    else {
+        // on the workers of the bulk pool, see mine_xcoin_set_threads
+        std::lock_guard<std::mutex> pool_lock(bulk_pool_mutex());
+        MinePool& pool = bulk_pool();
+        uint32_t active_threads = std::min(num_threads == 0 ? pool.size() : std::min(num_threads, pool.size()), num_paths);
+        uint32_t max_lanes = lanes_per_thread(active_threads);
+        pool.run([&](int thread_num, MineArena&, MineResultSlot&) {
+            if ((uint32_t)thread_num <= active_threads)
+                hash_files_worker(paths, num_paths, next_path, max_lanes, digests, errors);
+        });
+    }
+    return (uint32_t)std::count(errors, errors + num_paths, 0);
+}
@@ -0,0 +1,38 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef _SHA256_FILES_H_
+#define _SHA256_FILES_H_
+
+#include <cstdint>
+
+// bytes of a file submitted to the context manager at a time, the next ones are read ahead while these are hashed
+const uint64_t FILES_CHUNK_BYTES = 1ULL << 20;
+
+// a file mapped read-only into memory, for as long as the object lives or until close
+class MappedFile {
+public:
+    MappedFile() = default;
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+    ~MappedFile() { close(); }
+
+    // maps the whole file, to be read front to back, returns 0 or the OS error (errno, or GetLastError on Windows)
+    int open(const char* path);
+    void close();
+    const uint8_t* data() const { return bytes; }   // never null, even for an empty file
+    uint64_t size() const { return num_bytes; }
+    // asks the OS to start reading len bytes from offset in, without waiting for them
+    void read_ahead(uint64_t offset, uint64_t len) const;
+
+private:
+    const uint8_t* bytes = &no_bytes;
+    uint64_t num_bytes = 0;
+    void* mapping = nullptr;    // Windows only, the handle of the file mapping
+    static const uint8_t no_bytes;
+};
+
+// the SHA256 of every file, see sha256_files in mine_xcoin.h
+uint32_t hash_files(const char* const paths[], uint32_t num_paths, uint32_t num_threads, uint8_t digests[], int32_t errors[]);
+
+#endif // _SHA256_FILES_H_
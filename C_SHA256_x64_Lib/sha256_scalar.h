@@ -0,0 +1,102 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+#ifndef _SHA256_SCALAR_H_
+#define _SHA256_SCALAR_H_
+
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#include "Intel/endian_helper.h"
+
+// the portable SHA256 compression, for CPUs without SHA-NI or SSE4.1, or VMs that hide them, see NO_ACCEL in sha256_dispatch.h
+// the 64 rounds are unrolled at compile time, a fold over an index sequence, so that every index below is a constant: the eight
+// working variables never move, round I names them rotated instead, and the 16 words of the message schedule are a ring the compiler
+// keeps in registers as far as there are any; each word is loaded whole and byte swapped
+// header only, so that mine_bench can time it next to sha256_process without the library exporting it
+namespace sha256_scalar_detail {
+
+    constexpr uint32_t K256[64] = {
+        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3, 0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13, 0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208, 0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2 };
+
+    inline uint32_t rotr(uint32_t x, int n) { return (x >> n) | (x << (32 - n)); }
+
+    inline uint32_t load_be32(const uint8_t* p)
+    {
+        uint32_t word;
+        std::memcpy(&word, p, sizeof(word));    // a single unaligned load
+        return to_be32(word);
+    }
+
+    // round I, a to h being v[(8 - I % 8 + 0..7) % 8], so that the new a goes where h was, and the new e is d updated in place
+    // the message word of the round is loaded for the first 16, then computed in place in the ring from the words 16 rounds back
+    template <int I>
+    inline void sha256_round(uint32_t v[8], uint32_t w[16], const uint8_t block[])
+    {
+        constexpr int r = (8 - I % 8) % 8;
+        const uint32_t a = v[r], b = v[(r + 1) % 8], c = v[(r + 2) % 8];
+        const uint32_t e = v[(r + 4) % 8], f = v[(r + 5) % 8], g = v[(r + 6) % 8];
+        uint32_t& d = v[(r + 3) % 8];
+        uint32_t& h = v[(r + 7) % 8];
+        if constexpr (I < 16)
+            w[I] = load_be32(block + 4 * I);
+        else {
+            const uint32_t w2 = w[(I - 2) % 16], w15 = w[(I - 15) % 16];
+            w[I % 16] += (rotr(w2, 17) ^ rotr(w2, 19) ^ (w2 >> 10)) + w[(I - 7) % 16] + (rotr(w15, 7) ^ rotr(w15, 18) ^ (w15 >> 3));
+        }
+        const uint32_t t1 = (h + K256[I] + w[I % 16]) + (g ^ (e & (f ^ g))) + (rotr(e, 6) ^ rotr(e, 11) ^ rotr(e, 25));   // e last, it is the latest
+        const uint32_t t2 = (rotr(a, 2) ^ rotr(a, 13) ^ rotr(a, 22)) + ((a & b) | (c & (a | b)));
+        d += t1;
+        h = t1 + t2;
+    }
+
+    template <int... I>
+    inline void sha256_rounds(uint32_t v[8], uint32_t w[16], const uint8_t block[], std::integer_sequence<int, I...>)
+    {
+        (sha256_round<I>(v, w, block), ...);
+    }
+
+    inline void sha256_compress(uint32_t state[8], const uint8_t block[])
+    {
+        uint32_t v[8] = { state[0], state[1], state[2], state[3], state[4], state[5], state[6], state[7] };
+        uint32_t w[16];
+        sha256_rounds(v, w, block, std::make_integer_sequence<int, 64>());
+        for (int i = 0; i < 8; i++)     // 64 rounds bring the names back to where they started
+            state[i] += v[i];
+    }
+}
+
+// NUM_BLOCKS blocks known at compile time, as for the 1-block and 2-block tails of mining, from state; the caller pads the last one
+template <uint64_t NUM_BLOCKS>
+inline void sha256_scalar_blocks(uint32_t state[8], const uint8_t data[])
+{
+    for (uint64_t b = 0; b < NUM_BLOCKS; b++)
+        sha256_scalar_detail::sha256_compress(state, data + 64 * b);
+}
+
+// any number of blocks, the 1-block and 2-block ones on their own specialisations
+inline void sha256_scalar(uint32_t state[8], const uint8_t data[], uint64_t num_blocks)
+{
+    switch (num_blocks) {
+        case 1:
+            sha256_scalar_blocks<1>(state, data);
+            break;
+        case 2:
+            sha256_scalar_blocks<2>(state, data);
+            break;
+        default:
+            for (; num_blocks > 0; num_blocks--, data += 64)
+                sha256_scalar_blocks<1>(state, data);
+            break;
+    }
+}
+
+#endif // _SHA256_SCALAR_H_
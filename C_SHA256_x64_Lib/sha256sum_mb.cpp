@@ -0,0 +1,56 @@
+// SPDX-FileCopyrightText: © 2021 Yake Ho Foong
+// SPDX-License-Identifier: BSD-3-Clause
+
+// SHA256 of many files at once, printed as sha256sum does, built by 'make'
+// usage: sha256sum_mb [-t num_threads] [-v] file...
+// -t 0 (the default) is all the worker threads of the library, -v adds the bytes hashed and the throughput on stderr
+// the exit code is 1 if a file could not be read, as for sha256sum
+
+#include "pch.h"
+
+#include "mine_xcoin.h"
+
+#include <sys/stat.h>
+
+int main(int argc, char* argv[])
+{
+    uint32_t num_threads = 0;
+    bool verbose = false;
+    std::vector<const char*> paths;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "-t") == 0 && i + 1 < argc)
+            num_threads = (uint32_t)std::atoi(argv[++i]);
+        else if (std::strcmp(argv[i], "-v") == 0)
+            verbose = true;
+        else
+            paths.push_back(argv[i]);
+    }
+    if (paths.empty()) {
+        std::cerr << "usage: sha256sum_mb [-t num_threads] [-v] file...\n";
+        return 2;
+    }
+
+    std::vector<uint8_t> digests(paths.size() * DIGEST_SIZE_BYTES);
+    std::vector<int32_t> errors(paths.size());
+    auto start = std::chrono::steady_clock::now();
+    uint32_t num_hashed = sha256_files(paths.data(), (uint32_t)paths.size(), num_threads, digests.data(), errors.data());
+    double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    uint64_t total_bytes = 0;
+    for (size_t i = 0; i < paths.size(); i++) {
+        if (errors[i] != 0) {
+            std::cerr << "sha256sum_mb: " << paths[i] << ": " << std::strerror(errors[i]) << '\n';
+            continue;
+        }
+        std::cout << std::hex << std::setfill('0');
+        for (uint64_t b = 0; b < DIGEST_SIZE_BYTES; b++)
+            std::cout << std::setw(2) << (int)digests[i * DIGEST_SIZE_BYTES + b];
+        std::cout << std::dec << "  " << paths[i] << '\n';
+        struct stat status;
+        if (verbose && stat(paths[i], &status) == 0)
+            total_bytes += (uint64_t)status.st_size;
+    }
+    if (verbose)
+        std::cerr << num_hashed << " files, " << total_bytes << " bytes in " << seconds << " s, " << total_bytes / seconds / 1e6 << " MB/s\n";
+    return num_hashed == paths.size() ? 0 : 1;
+}
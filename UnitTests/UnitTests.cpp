@@ -5,6 +5,7 @@
 #include "CppUnitTest.h"
 
 #include "..\C_SHA256_x64_Lib\mine_xcoin.h"
+#include "..\C_SHA256_x64_Lib\sha256_scalar.h"
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
@@ -36,6 +37,10 @@ namespace UnitTests
             bool result = mine_xcoin(target, message_ex_nonce, sizeof(message_ex_nonce), accel,
                     result_id, result_nonce, acceleration_used, num_threads_used, 10.0);   // timeout of 10 seconds
 
+            check_result(result, result_id, result_nonce);
+        }
+        void check_result(bool result, const uint8_t result_id[DIGEST_SIZE_BYTES], const uint64_t result_nonce[1], bool double_sha256 = false)
+        {
             // check function return status
             Assert::IsTrue(
                 // Actual value:
@@ -68,6 +73,11 @@ namespace UnitTests
             *((uint64_t*)(message + sizeof(message_ex_nonce))) = result_nonce[0];
             uint8_t expected_digest[32];
             WinCalcSHA256(message, sizeof(message), expected_digest);
+            if (double_sha256) {
+                uint8_t first_digest[32];
+                std::memcpy(first_digest, expected_digest, sizeof(first_digest));
+                WinCalcSHA256(first_digest, sizeof(first_digest), expected_digest);
+            }
             std::vector<uint8_t> expected_id(std::begin(expected_digest), std::end(expected_digest));
             std::vector<uint8_t> actual_id(std::begin(result_id), std::end(result_id));
             Assert::IsTrue(
@@ -103,5 +113,480 @@ namespace UnitTests
         {
             test_sha256(SHA256_Acceleration::NO_ACCEL);
         }
+        TEST_METHOD(TestMethodSHA_X4)
+        {
+            test_sha256(SHA256_Acceleration::SHA_X4);
+        }
+        TEST_METHOD(TestMethodSHA_X2)
+        {
+            test_sha256(SHA256_Acceleration::SHA_X2);
+        }
+        TEST_METHOD(TestMethodAVX512VL)
+        {
+            test_sha256(SHA256_Acceleration::AVX512VL);
+        }
+        TEST_METHOD(TestMethodAUTO)
+        {
+            // a short calibration is enough to pick a working kernel, the timings themselves are not checked
+            Assert::IsTrue(mine_xcoin_calibrate("UnitTests_profile.txt", 0.05), L"SHA256 AUTO test failed, profile not saved", LINE_INFO());
+            Assert::IsTrue(mine_xcoin_load_profile("UnitTests_profile.txt"), L"SHA256 AUTO test failed, profile not loaded", LINE_INFO());
+            test_sha256(SHA256_Acceleration::AUTO);
+        }
+        TEST_METHOD(TestMethodAsyncReplace)
+        {
+            // start on a target no nonce can meet, then swap in the test job while it runs
+            static const uint8_t impossible_target[DIGEST_SIZE_BYTES] = { 0x0 };
+            MineJob* job = mine_xcoin_start(impossible_target, message_ex_nonce, sizeof(message_ex_nonce), SHA256_Acceleration::AVX512, 10.0, 0, nullptr, nullptr, nullptr);
+            Assert::IsTrue(mine_xcoin_poll(job) == MineJobStatus::RUNNING, L"SHA256 async test failed, job ended early", LINE_INFO());
+            Assert::IsTrue(mine_xcoin_replace(job, target, message_ex_nonce, sizeof(message_ex_nonce), nullptr, nullptr),
+                L"SHA256 async test failed, job could not be replaced", LINE_INFO());
+            mine_xcoin_wait(job, -1.0);
+
+            uint8_t result_id[DIGEST_SIZE_BYTES];
+            uint64_t result_nonce[1];
+            SHA256_Acceleration acceleration_used[1];   // diagnostics not used
+            uint32_t num_threads_used[1], num_cores_used[1], num_nodes_used[1];   // diagnostics not used
+            bool result = mine_xcoin_result(job, result_id, result_nonce, acceleration_used, num_threads_used, num_cores_used, num_nodes_used);
+            mine_xcoin_free(job);
+
+            check_result(result, result_id, result_nonce);
+        }
+        TEST_METHOD(TestMethodShares)
+        {
+            // a share target 256 times easier than the block target, every share must hash below it, and the winner be one of them
+            static const uint8_t share_target[DIGEST_SIZE_BYTES] = { 0x0, 0x10 };
+            for (int a = 0; a < NUM_ACCELERATIONS; a++) {
+                MineJob* job = mine_xcoin_start(target, message_ex_nonce, sizeof(message_ex_nonce), SHA256_Acceleration(a), 10.0, 0, share_target, nullptr, nullptr);
+                mine_xcoin_wait(job, -1.0);
+
+                uint8_t result_id[DIGEST_SIZE_BYTES];
+                uint64_t result_nonce[1];
+                SHA256_Acceleration acceleration_used[1];   // diagnostics not used
+                uint32_t num_threads_used[1], num_cores_used[1], num_nodes_used[1];   // diagnostics not used
+                bool result = mine_xcoin_result(job, result_id, result_nonce, acceleration_used, num_threads_used, num_cores_used, num_nodes_used);
+                check_result(result, result_id, result_nonce);
+
+                static MineShare shares[1024];
+                uint64_t num_dropped[1];
+                uint32_t num_shares = mine_xcoin_drain_shares(job, shares, 1024, num_dropped);
+                mine_xcoin_free(job);
+                bool winner_shared = false;
+                for (uint32_t s = 0; s < num_shares; s++) {
+                    Assert::IsTrue(std::memcmp(shares[s].id, share_target, DIGEST_SIZE_BYTES) < 0, L"SHA256 shares test failed, share above the share target", LINE_INFO());
+                    uint8_t message[sizeof(message_ex_nonce) + 8];
+                    std::memcpy(message, message_ex_nonce, sizeof(message_ex_nonce));
+                    *((uint64_t*)(message + sizeof(message_ex_nonce))) = shares[s].nonce;
+                    uint8_t expected_digest[32];
+                    WinCalcSHA256(message, sizeof(message), expected_digest);
+                    Assert::IsTrue(std::memcmp(shares[s].id, expected_digest, DIGEST_SIZE_BYTES) == 0, L"SHA256 shares test failed, wrong share ID", LINE_INFO());
+                    winner_shared = winner_shared || shares[s].nonce == result_nonce[0];
+                }
+                Assert::IsTrue(winner_shared || num_dropped[0] > 0, L"SHA256 shares test failed, winner not shared", LINE_INFO());
+            }
+        }
+        TEST_METHOD(TestMethodNonceLayout)
+        {
+            // an 80-byte header with a nonce too narrow for the target, so the 4-byte extranonce at offset 4 has to roll a few times
+            // the 2-byte nonce is big endian, the 1-byte one rolls the extranonce every 256 nonces, the first extranonce (7) has no winner
+            uint8_t header[80];
+            for (int i = 0; i < 80; i++) header[i] = (uint8_t)i;
+            for (uint32_t nonce_bytes = 1; nonce_bytes <= 2; nonce_bytes++) {
+                MineNonceLayout layout = { 76, 4, 7, nonce_bytes, 4, (uint8_t)(nonce_bytes == 2), 0 };
+                for (int a = 0; a < NUM_ACCELERATIONS; a++) {
+                    MineJob* job = mine_xcoin_start(target, header, sizeof(header), SHA256_Acceleration(a), 10.0, 0, nullptr, &layout, nullptr);
+                    mine_xcoin_wait(job, -1.0);
+
+                    uint8_t result_id[DIGEST_SIZE_BYTES];
+                    uint64_t result_nonce[1], extranonce[1];
+                    SHA256_Acceleration acceleration_used[1];   // diagnostics not used
+                    uint32_t num_threads_used[1], num_cores_used[1], num_nodes_used[1];   // diagnostics not used
+                    bool result = mine_xcoin_result(job, result_id, result_nonce, acceleration_used, num_threads_used, num_cores_used, num_nodes_used);
+                    bool result_extranonce = mine_xcoin_extranonce(job, extranonce);
+                    mine_xcoin_free(job);
+                    Assert::IsTrue(result && result_extranonce, L"SHA256 nonce layout test failed, function returned status false", LINE_INFO());
+                    Assert::IsTrue(extranonce[0] > 7 && result_nonce[0] < (1ULL << (8 * nonce_bytes)), L"SHA256 nonce layout test failed, extranonce not rolled", LINE_INFO());
+                    Assert::IsTrue(std::memcmp(result_id, target, DIGEST_SIZE_BYTES) < 0, L"SHA256 nonce layout test failed, ID is greater than target", LINE_INFO());
+
+                    uint8_t message[sizeof(header)];
+                    std::memcpy(message, header, sizeof(header));
+                    *((uint32_t*)(message + 4)) = (uint32_t)extranonce[0];  // little endian
+                    if (nonce_bytes == 2) {
+                        message[76] = (uint8_t)(result_nonce[0] >> 8);
+                        message[77] = (uint8_t)result_nonce[0];
+                    }
+                    else
+                        message[76] = (uint8_t)result_nonce[0];
+                    uint8_t expected_digest[32];
+                    WinCalcSHA256(message, sizeof(message), expected_digest);
+                    Assert::IsTrue(std::memcmp(result_id, expected_digest, DIGEST_SIZE_BYTES) == 0, L"SHA256 nonce layout test failed, wrong ID", LINE_INFO());
+                }
+            }
+        }
+        TEST_METHOD(TestMethodCheckpoint)
+        {
+            // a job timed out, then carried on from its checkpoint with another acceleration, then with a target just above the best
+            // digest so far, which is the winner straight away
+            static const uint8_t impossible_target[DIGEST_SIZE_BYTES] = { 0x0 };
+            MineCheckpoint checkpoints[2];
+            uint8_t best_id[2][DIGEST_SIZE_BYTES];
+            uint64_t best_nonce[2], best_extranonce[1];
+            for (int run = 0; run < 2; run++) {
+                MineJob* job = mine_xcoin_start(impossible_target, message_ex_nonce, sizeof(message_ex_nonce),
+                    run == 0 ? SHA256_Acceleration::AVX512 : SHA256_Acceleration::SHA_X4, 0.2, 0, nullptr, nullptr, run == 0 ? nullptr : &checkpoints[0]);
+                Assert::IsTrue(job != nullptr, L"SHA256 checkpoint test failed, checkpoint not taken", LINE_INFO());
+                Assert::IsTrue(mine_xcoin_wait(job, -1.0) == MineJobStatus::NOT_FOUND, L"SHA256 checkpoint test failed, job not timed out", LINE_INFO());
+                Assert::IsTrue(mine_xcoin_checkpoint(job, &checkpoints[run]), L"SHA256 checkpoint test failed, no checkpoint", LINE_INFO());
+                Assert::IsTrue(mine_xcoin_best(job, best_id[run], &best_nonce[run], best_extranonce), L"SHA256 checkpoint test failed, no best digest", LINE_INFO());
+                mine_xcoin_free(job);
+
+                uint8_t message[sizeof(message_ex_nonce) + 8];
+                std::memcpy(message, message_ex_nonce, sizeof(message_ex_nonce));
+                *((uint64_t*)(message + sizeof(message_ex_nonce))) = best_nonce[run];
+                uint8_t expected_digest[32];
+                WinCalcSHA256(message, sizeof(message), expected_digest);
+                Assert::IsTrue(std::memcmp(best_id[run], expected_digest, DIGEST_SIZE_BYTES) == 0, L"SHA256 checkpoint test failed, wrong best digest", LINE_INFO());
+            }
+            Assert::IsTrue(std::memcmp(best_id[1], best_id[0], DIGEST_SIZE_BYTES) <= 0, L"SHA256 checkpoint test failed, best digest lost", LINE_INFO());
+            auto nonces_hashed = [](const MineCheckpoint& checkpoint) {
+                uint64_t hashed = checkpoint.frontier;
+                for (uint32_t g = 0; g < checkpoint.num_gaps; g++) hashed -= checkpoint.gaps[2 * g + 1];
+                return hashed;
+            };
+            Assert::IsTrue(nonces_hashed(checkpoints[1]) > nonces_hashed(checkpoints[0]), L"SHA256 checkpoint test failed, no progress", LINE_INFO());
+
+            uint8_t above_best[DIGEST_SIZE_BYTES];
+            std::memcpy(above_best, best_id[1], DIGEST_SIZE_BYTES);
+            for (int i = DIGEST_SIZE_BYTES - 1; i >= 0 && ++above_best[i] == 0; i--);
+            MineJob* job = mine_xcoin_start(above_best, message_ex_nonce, sizeof(message_ex_nonce), SHA256_Acceleration::AVX2, 10.0, 0, nullptr, nullptr, &checkpoints[1]);
+            uint8_t result_id[DIGEST_SIZE_BYTES];
+            uint64_t result_nonce[1];
+            SHA256_Acceleration acceleration_used[1];   // diagnostics not used
+            uint32_t num_threads_used[1], num_cores_used[1], num_nodes_used[1];   // diagnostics not used
+            mine_xcoin_wait(job, -1.0);
+            bool result = mine_xcoin_result(job, result_id, result_nonce, acceleration_used, num_threads_used, num_cores_used, num_nodes_used);
+            mine_xcoin_free(job);
+            Assert::IsTrue(result && result_nonce[0] == best_nonce[1], L"SHA256 checkpoint test failed, best digest not the winner", LINE_INFO());
+
+            MineCheckpoint other = checkpoints[1];
+            other.fingerprint[0] ^= 1;
+            Assert::IsTrue(mine_xcoin_start(target, message_ex_nonce, sizeof(message_ex_nonce), SHA256_Acceleration::AVX2, 10.0, 0, nullptr, nullptr, &other) == nullptr,
+                L"SHA256 checkpoint test failed, checkpoint of another message taken", LINE_INFO());
+        }
+        TEST_METHOD(TestMethodDeadline)
+        {
+            // a job that would run for a minute, cut short through its deadline, which cannot be moved once passed
+            static const uint8_t impossible_target[DIGEST_SIZE_BYTES] = { 0x0 };
+            MineJob* job = mine_xcoin_start(impossible_target, message_ex_nonce, sizeof(message_ex_nonce), SHA256_Acceleration::AVX512, 60.0, 0, nullptr, nullptr, nullptr);
+            Assert::IsTrue(mine_xcoin_set_deadline(job, 0.1), L"SHA256 deadline test failed, deadline not set", LINE_INFO());
+            Assert::IsTrue(mine_xcoin_wait(job, 5.0) == MineJobStatus::NOT_FOUND, L"SHA256 deadline test failed, job not timed out", LINE_INFO());
+            Assert::IsTrue(!mine_xcoin_set_deadline(job, 60.0), L"SHA256 deadline test failed, ended job extended", LINE_INFO());
+            mine_xcoin_free(job);
+        }
+        TEST_METHOD(TestMethodSHA256D)
+        {
+            // the mining kernels hash twice in registers, the others with a second pass, so check every acceleration
+            for (int a = 0; a < NUM_ACCELERATIONS; a++) {
+                MineJob* job = mine_xcoin_start(target, message_ex_nonce, sizeof(message_ex_nonce), SHA256_Acceleration(a), 10.0, MINE_FLAG_SHA256D, nullptr, nullptr, nullptr);
+                mine_xcoin_wait(job, -1.0);
+
+                uint8_t result_id[DIGEST_SIZE_BYTES];
+                uint64_t result_nonce[1];
+                SHA256_Acceleration acceleration_used[1];   // diagnostics not used
+                uint32_t num_threads_used[1], num_cores_used[1], num_nodes_used[1];   // diagnostics not used
+                bool result = mine_xcoin_result(job, result_id, result_nonce, acceleration_used, num_threads_used, num_cores_used, num_nodes_used);
+                mine_xcoin_free(job);
+
+                check_result(result, result_id, result_nonce, true);
+            }
+        }
+        TEST_METHOD(TestMethodWorkers)
+        {
+            // park all the workers but one half way, the coverage must still add up with no gap bigger than what was handed out
+            static const uint8_t impossible_target[DIGEST_SIZE_BYTES] = { 0x0 };
+            MineJob* job = mine_xcoin_start(impossible_target, message_ex_nonce, sizeof(message_ex_nonce), SHA256_Acceleration::AVX2, 0.5, 0, nullptr, nullptr, nullptr);
+            uint64_t frontier[1];
+            uint64_t gaps[2 * 64];
+            uint32_t num_gaps[1];
+            Assert::IsTrue(!mine_xcoin_coverage(job, frontier, gaps, 64, num_gaps), L"SHA256 workers test failed, coverage while running", LINE_INFO());
+            Sleep(250);
+            Assert::IsTrue(mine_xcoin_set_workers(job, 1) == 1, L"SHA256 workers test failed, workers not set", LINE_INFO());
+            mine_xcoin_wait(job, -1.0);
+
+            Assert::IsTrue(mine_xcoin_coverage(job, frontier, gaps, 64, num_gaps), L"SHA256 workers test failed, no coverage", LINE_INFO());
+            uint64_t not_hashed = 0;
+            for (uint32_t g = 0; g < num_gaps[0] && g < 64; g++) {
+                Assert::IsTrue(gaps[2 * g] + gaps[2 * g + 1] <= frontier[0], L"SHA256 workers test failed, gap past the frontier", LINE_INFO());
+                not_hashed += gaps[2 * g + 1];
+            }
+            Assert::IsTrue(frontier[0] > not_hashed, L"SHA256 workers test failed, nothing hashed", LINE_INFO());
+            mine_xcoin_free(job);
+        }
+        TEST_METHOD(TestMethodTelemetry)
+        {
+            // read while running and once ended, the threads must add up to the total
+            static const uint8_t impossible_target[DIGEST_SIZE_BYTES] = { 0x0 };
+            MineJob* job = mine_xcoin_start(impossible_target, message_ex_nonce, sizeof(message_ex_nonce), SHA256_Acceleration::AVX512, 0.3, 0, nullptr, nullptr, nullptr);
+            MineStats total[1];
+            MineStats per_thread[256];
+            double elapsed_seconds[1];
+            Sleep(100);
+            mine_xcoin_telemetry(job, total, per_thread, 256, elapsed_seconds);
+            Assert::IsTrue(elapsed_seconds[0] > 0.0, L"SHA256 telemetry test failed, no time elapsed", LINE_INFO());
+            mine_xcoin_wait(job, -1.0);
+
+            uint32_t num_threads = mine_xcoin_telemetry(job, total, per_thread, 256, elapsed_seconds);
+            uint64_t nonces_hashed = 0, kernel_calls = 0;
+            for (uint32_t t = 0; t < num_threads && t < 256; t++) {
+                nonces_hashed += per_thread[t].nonces_hashed;
+                kernel_calls += per_thread[t].kernel_calls;
+            }
+            Assert::IsTrue(total[0].nonces_hashed > 0 && total[0].kernel_calls > 0 && total[0].kernel_cycles > 0,
+                L"SHA256 telemetry test failed, nothing counted", LINE_INFO());
+            Assert::IsTrue(num_threads > 256 || (nonces_hashed == total[0].nonces_hashed && kernel_calls == total[0].kernel_calls),
+                L"SHA256 telemetry test failed, threads do not add up", LINE_INFO());
+            mine_xcoin_free(job);
+        }
+        TEST_METHOD(TestMethodThreads)
+        {
+            // one thread per physical core, pinned, then back to the default unpinned threads for the other tests
+            Assert::IsTrue(mine_xcoin_set_threads(0, nullptr, 0, MinePlacement::PHYSICAL_CORES), L"SHA256 threads test failed, no thread placed", LINE_INFO());
+            MineJob* job = mine_xcoin_start(target, message_ex_nonce, sizeof(message_ex_nonce), SHA256_Acceleration::AVX512, 10.0, 0, nullptr, nullptr, nullptr);
+            mine_xcoin_wait(job, -1.0);
+
+            uint8_t result_id[DIGEST_SIZE_BYTES];
+            uint64_t result_nonce[1];
+            SHA256_Acceleration acceleration_used[1];   // diagnostics not used
+            uint32_t num_threads_used[1], num_cores_used[1], num_nodes_used[1];
+            bool result = mine_xcoin_result(job, result_id, result_nonce, acceleration_used, num_threads_used, num_cores_used, num_nodes_used);
+            mine_xcoin_free(job);
+            Assert::IsTrue(num_cores_used[0] == num_threads_used[0] && num_nodes_used[0] >= 1,
+                L"SHA256 threads test failed, threads not one per physical core", LINE_INFO());
+            check_result(result, result_id, result_nonce);
+
+            static const int32_t unusable_cpus[] = { -1 };
+            Assert::IsTrue(!mine_xcoin_set_threads(0, unusable_cpus, 1, MinePlacement::OS),
+                L"SHA256 threads test failed, an unusable CPU set was accepted", LINE_INFO());
+            Assert::IsTrue(mine_xcoin_set_threads(0, nullptr, 0, MinePlacement::OS),
+                L"SHA256 threads test failed, default threads not restored", LINE_INFO());
+        }
+        TEST_METHOD(TestMethodDispatch)
+        {
+            // every acceleration runs as asked when the CPU has it, or falls back to one it has, NO_ACCEL being always there
+            Assert::IsTrue(sha256_acceleration_supported(SHA256_Acceleration::NO_ACCEL), L"Dispatch test failed, no plain C", LINE_INFO());
+            Assert::IsTrue(!sha256_acceleration_supported(SHA256_Acceleration::AUTO), L"Dispatch test failed, AUTO supported", LINE_INFO());
+            const uint8_t data[100] = { 0x0 };
+            for (int a = 0; a <= NUM_ACCELERATIONS; a++) {
+                SHA256_Acceleration preferred_acceleration = a == NUM_ACCELERATIONS ? SHA256_Acceleration::AUTO : (SHA256_Acceleration)a;
+                uint8_t digest[DIGEST_SIZE_BYTES];
+                SHA256_Acceleration used_acceleration = sha256_multihash(data, sizeof(data), preferred_acceleration, 1, digest);
+                Assert::IsTrue(sha256_acceleration_supported(used_acceleration), L"Dispatch test failed, unsupported acceleration", LINE_INFO());
+                Assert::IsTrue(!sha256_acceleration_supported(preferred_acceleration) || used_acceleration == preferred_acceleration,
+                    L"Dispatch test failed, needless fallback", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(TestMethodCtxMgr)
+        {
+            // every prefix of the test message at once, i.e. partial blocks padded into one or two blocks, then one message in updates
+            const int num_messages = sizeof(message_ex_nonce) + 1;
+            SHA256_HASH_CTX_MGR mgr;
+            SHA256_HASH_CTX ctxs[num_messages];
+            sha256_ctx_mgr_init(&mgr);
+            int num_completed = 0;
+            auto check_ctx = [&](SHA256_HASH_CTX* ctx) {
+                if (ctx == nullptr) return;
+                Assert::IsTrue(hash_ctx_complete(ctx) && hash_ctx_error(ctx) == HASH_CTX_ERROR_NONE, L"SHA256 CTX manager test failed, not complete", LINE_INFO());
+                uint8_t expected_digest[DIGEST_SIZE_BYTES];
+                WinCalcSHA256(message_ex_nonce, ctx->total_length, expected_digest);
+                for (int w = 0; w < DIGEST_NUM_WORDS; w++)
+                    Assert::IsTrue(byteswap32(hash_ctx_digest(ctx)[w]) == ((uint32_t*)expected_digest)[w], L"SHA256 CTX manager test failed, wrong digest", LINE_INFO());
+                num_completed++;
+            };
+            for (int i = 0; i < num_messages; i++) {
+                hash_ctx_init(&ctxs[i]);
+                check_ctx(sha256_ctx_mgr_submit(&mgr, &ctxs[i], message_ex_nonce, i, HASH_ENTIRE));
+            }
+            for (SHA256_HASH_CTX* ctx = sha256_ctx_mgr_flush(&mgr); ctx != nullptr; ctx = sha256_ctx_mgr_flush(&mgr))
+                check_ctx(ctx);
+            Assert::IsTrue(num_completed == num_messages, L"SHA256 CTX manager test failed, messages lost", LINE_INFO());
+
+            // a context is given back idle after each update, once its lane is hashed
+            static const uint32_t update_lens[] = { 1, 70, 63, sizeof(message_ex_nonce) - 134 };
+            SHA256_HASH_CTX* ctx = &ctxs[0];
+            hash_ctx_init(ctx);
+            uint32_t offset = 0;
+            for (int u = 0; u < 4; u++) {
+                HASH_CTX_FLAG flags = u == 0 ? HASH_FIRST : u == 3 ? HASH_LAST : HASH_UPDATE;
+                SHA256_HASH_CTX* returned = sha256_ctx_mgr_submit(&mgr, ctx, message_ex_nonce + offset, update_lens[u], flags);
+                while (returned == nullptr)
+                    returned = sha256_ctx_mgr_flush(&mgr);
+                Assert::IsTrue(returned == ctx, L"SHA256 CTX manager test failed, another context returned", LINE_INFO());
+                offset += update_lens[u];
+            }
+            check_ctx(ctx);
+            Assert::IsTrue(sha256_ctx_mgr_submit(&mgr, ctx, message_ex_nonce, 1, HASH_UPDATE) == ctx && hash_ctx_error(ctx) == HASH_CTX_ERROR_ALREADY_COMPLETED,
+                L"SHA256 CTX manager test failed, completed context updated", LINE_INFO());
+        }
+        TEST_METHOD(TestMethodCtxMgrNi)
+        {
+            // messages of several lengths, so that with SHA-NI the flushes of the hybrid manager start on the vector function,
+            // with most lanes in use, and end on SHA-NI one job at a time
+            const int num_messages = 12;
+            SHA256_HASH_CTX_MGR mgr;
+            SHA256_HASH_CTX ctxs[num_messages];
+            sha256_ctx_mgr_init(&mgr);
+            int num_completed = 0;
+            for (int i = 0; i < num_messages; i++) {
+                hash_ctx_init(&ctxs[i]);
+                num_completed += sha256_ctx_mgr_submit(&mgr, &ctxs[i], message_ex_nonce, (uint32_t)(sizeof(message_ex_nonce) - 11 * i), HASH_ENTIRE) != nullptr;
+            }
+            while (sha256_ctx_mgr_flush(&mgr) != nullptr)
+                num_completed++;
+            Assert::IsTrue(num_completed == num_messages, L"SHA256 CTX manager NI test failed, messages lost", LINE_INFO());
+            for (int i = 0; i < num_messages; i++) {
+                uint8_t expected_digest[DIGEST_SIZE_BYTES];
+                WinCalcSHA256(message_ex_nonce, ctxs[i].total_length, expected_digest);
+                for (int w = 0; w < DIGEST_NUM_WORDS; w++)
+                    Assert::IsTrue(byteswap32(hash_ctx_digest(&ctxs[i])[w]) == ((uint32_t*)expected_digest)[w], L"SHA256 CTX manager NI test failed, wrong digest", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(TestMethodScalar)
+        {
+            // padded prefixes of the test message of 1 and 2 blocks, as the mining tails, then of 3 blocks, on the scalar kernel
+            const uint64_t lens[] = { 55, 119, sizeof(message_ex_nonce) };
+            for (uint64_t len : lens) {
+                uint8_t padded[3 * 64] = { 0x0 };
+                std::memcpy(padded, message_ex_nonce, len);
+                padded[len] = 0x80;
+                uint64_t num_blocks = (len + 8) / 64 + 1;
+                for (int b = 0; b < 8; b++)
+                    padded[num_blocks * 64 - 1 - b] = (uint8_t)((len * 8) >> (8 * b));
+                uint32_t state[DIGEST_NUM_WORDS] = { 0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a, 0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19 };
+                sha256_scalar(state, padded, num_blocks);
+                uint8_t expected_digest[DIGEST_SIZE_BYTES];
+                WinCalcSHA256(message_ex_nonce, len, expected_digest);
+                for (int w = 0; w < DIGEST_NUM_WORDS; w++)
+                    Assert::IsTrue(byteswap32(state[w]) == ((uint32_t*)expected_digest)[w], L"SHA256 scalar test failed, wrong digest", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(TestMethodStream)
+        {
+            // every prefix of the test message, in updates of 1 to 70 bytes that start and end anywhere in a block
+            for (uint64_t len = 0; len <= sizeof(message_ex_nonce); len++) {
+                Sha256Stream stream;
+                sha256_stream_init(&stream);
+                for (uint64_t offset = 0, update_len = 0; offset < len; offset += update_len) {
+                    update_len = std::min(len - offset, 1 + (offset * 7 + len) % 70);
+                    sha256_stream_update(&stream, message_ex_nonce + offset, update_len);
+                }
+                uint8_t digest[DIGEST_SIZE_BYTES], expected_digest[DIGEST_SIZE_BYTES];
+                sha256_stream_final(&stream, digest);
+                WinCalcSHA256(message_ex_nonce, len, expected_digest);
+                Assert::IsTrue(std::memcmp(digest, expected_digest, DIGEST_SIZE_BYTES) == 0, L"SHA256 stream test failed, wrong digest", LINE_INFO());
+            }
+        }
+
+        TEST_METHOD(TestMethodMultihash)
+        {
+            // two full rounds of stripes and a short one, which leaves the last segments a stripe shorter than the others
+            std::vector<uint8_t> data(2 * MULTIHASH_STRIPE_BYTES * MULTIHASH_SEGMENTS + 5000);
+            for (size_t i = 0; i < data.size(); i++)
+                data[i] = (uint8_t)(i * 131 + (i >> 12));
+            // the documented layout, segment by segment
+            uint64_t num_stripes = (data.size() + MULTIHASH_STRIPE_BYTES - 1) / MULTIHASH_STRIPE_BYTES;
+            std::vector<uint8_t> root_message(MULTIHASH_SEGMENTS * DIGEST_SIZE_BYTES + 8);
+            for (uint32_t s = 0; s < MULTIHASH_SEGMENTS; s++) {
+                std::vector<uint8_t> segment;
+                for (uint64_t i = s; i < num_stripes; i += MULTIHASH_SEGMENTS)
+                    segment.insert(segment.end(), data.begin() + i * MULTIHASH_STRIPE_BYTES,
+                        data.begin() + std::min<uint64_t>((i + 1) * MULTIHASH_STRIPE_BYTES, data.size()));
+                WinCalcSHA256(segment.data(), segment.size(), root_message.data() + s * DIGEST_SIZE_BYTES);
+            }
+            uint64_t len_bytes = data.size();
+            std::memcpy(root_message.data() + MULTIHASH_SEGMENTS * DIGEST_SIZE_BYTES, &len_bytes, 8);
+            uint8_t expected_digest[DIGEST_SIZE_BYTES];
+            WinCalcSHA256(root_message.data(), root_message.size(), expected_digest);
+
+            // the same digest on every acceleration, with one thread and with a few
+            for (int a = 0; a <= NUM_ACCELERATIONS; a++) {
+                SHA256_Acceleration preferred_acceleration = a == NUM_ACCELERATIONS ? SHA256_Acceleration::AUTO : (SHA256_Acceleration)a;
+                for (uint32_t num_threads = 1; num_threads <= 4; num_threads += 3) {
+                    uint8_t digest[DIGEST_SIZE_BYTES];
+                    sha256_multihash(data.data(), data.size(), preferred_acceleration, num_threads, digest);
+                    Assert::IsTrue(std::memcmp(digest, expected_digest, DIGEST_SIZE_BYTES) == 0, L"SHA256 multi-hash test failed, wrong digest", LINE_INFO());
+                }
+            }
+        }
+
+        TEST_METHOD(TestMethodMerkleRoot)
+        {
+            // odd levels, partly filled lane batches, and a first level split between two threads
+            for (uint64_t num_leaves : { 1, 2, 3, 17, 4099 }) {
+                std::vector<uint8_t> leaves(num_leaves * DIGEST_SIZE_BYTES);
+                for (size_t i = 0; i < leaves.size(); i++)
+                    leaves[i] = (uint8_t)(i * 29 + num_leaves);
+                for (uint32_t mode_flags = 0; mode_flags <= MINE_FLAG_SHA256D; mode_flags++) {
+                    // level by level, the last node of an odd level paired with itself
+                    std::vector<uint8_t> nodes = leaves;
+                    while (nodes.size() > DIGEST_SIZE_BYTES) {
+                        if (nodes.size() % (2 * DIGEST_SIZE_BYTES) != 0)
+                            nodes.insert(nodes.end(), nodes.end() - DIGEST_SIZE_BYTES, nodes.end());
+                        std::vector<uint8_t> parents(nodes.size() / 2);
+                        for (size_t p = 0; p < parents.size(); p += DIGEST_SIZE_BYTES) {
+                            WinCalcSHA256(&nodes[2 * p], 2 * DIGEST_SIZE_BYTES, &parents[p]);
+                            if (mode_flags & MINE_FLAG_SHA256D) {
+                                uint8_t first_digest[DIGEST_SIZE_BYTES];
+                                std::memcpy(first_digest, &parents[p], DIGEST_SIZE_BYTES);
+                                WinCalcSHA256(first_digest, DIGEST_SIZE_BYTES, &parents[p]);
+                            }
+                        }
+                        nodes.swap(parents);
+                    }
+
+                    for (int a = 0; a <= NUM_ACCELERATIONS; a++) {
+                        SHA256_Acceleration preferred_acceleration = a == NUM_ACCELERATIONS ? SHA256_Acceleration::AUTO : (SHA256_Acceleration)a;
+                        uint8_t root[DIGEST_SIZE_BYTES];
+                        Assert::IsTrue(sha256_merkle_root(leaves.data(), num_leaves, mode_flags, preferred_acceleration, 2, root), L"Merkle root test failed, no root", LINE_INFO());
+                        Assert::IsTrue(std::memcmp(root, nodes.data(), DIGEST_SIZE_BYTES) == 0, L"Merkle root test failed, wrong root", LINE_INFO());
+                    }
+                }
+            }
+            uint8_t root[DIGEST_SIZE_BYTES];
+            Assert::IsTrue(!sha256_merkle_root(nullptr, 0, 0, SHA256_Acceleration::AUTO, 1, root), L"Merkle root test failed, root of no leaves", LINE_INFO());
+        }
+
+        TEST_METHOD(TestMethodFiles)
+        {
+            // more files than lanes, empty, short, and over a chunk, so that the contexts are refilled and take several updates
+            const uint64_t chunk = 1 << 20;     // FILES_CHUNK_BYTES of sha256_files.h
+            const uint64_t file_lens[] = { 0, 1, 55, 64, 1000, chunk - 1, chunk + 3, 2 * chunk + 100 };
+            const int num_files = 40;
+            std::vector<std::string> names;
+            std::vector<const char*> paths;
+            std::vector<uint8_t> expected_digests(num_files * DIGEST_SIZE_BYTES);
+            for (int f = 0; f < num_files; f++) {
+                std::vector<uint8_t> contents(file_lens[f % 8] + f);
+                for (size_t i = 0; i < contents.size(); i++)
+                    contents[i] = (uint8_t)(i * 13 + f);
+                names.push_back("sha256_files_test_" + std::to_string(f) + ".bin");
+                std::ofstream(names.back(), std::ios::binary).write((const char*)contents.data(), contents.size());
+                WinCalcSHA256(contents.data(), contents.size(), &expected_digests[f * DIGEST_SIZE_BYTES]);
+            }
+            names.push_back("sha256_files_test_missing.bin");
+            for (const std::string& name : names)
+                paths.push_back(name.c_str());
+
+            for (uint32_t num_threads = 1; num_threads <= 3; num_threads += 2) {
+                std::vector<uint8_t> digests(paths.size() * DIGEST_SIZE_BYTES);
+                std::vector<int32_t> errors(paths.size());
+                uint32_t num_hashed = sha256_files(paths.data(), (uint32_t)paths.size(), num_threads, digests.data(), errors.data());
+                Assert::IsTrue(num_hashed == num_files && errors[num_files] != 0, L"SHA256 files test failed, wrong error", LINE_INFO());
+                Assert::IsTrue(std::memcmp(digests.data(), expected_digests.data(), expected_digests.size()) == 0, L"SHA256 files test failed, wrong digest", LINE_INFO());
+            }
+            for (int f = 0; f < num_files; f++)
+                std::remove(paths[f]);
+        }
     };
 }
@@ -7,7 +7,7 @@ import sys
 import platform
 import ctypes
 import ctypes.util
-from typing import Tuple, Union
+from typing import List, Optional, Tuple, Union
 from enum import Enum
 import time
 
@@ -21,6 +21,116 @@ class PreferredAccelerationInC(Enum):
     AVX = 3
     SSE = 4
     NO_ACCEL = 5
+    SHA_X4 = 6  # SHA with 4 interleaved messages
+    SHA_X2 = 7  # SHA with 2 interleaved messages
+    AVX512VL = 8  # AVX 512 instructions on 256-bit registers
+    AUTO = 0xFF  # fastest on this host, see `calibrate_c`
+
+
+class PlacementInC(Enum):
+    """Where the C library pins its worker threads, see `set_threads_c`."""
+
+    OS = 0  # not pinned
+    PHYSICAL_CORES = 1  # one thread per physical core first
+    FILL_SMT = 2  # the SMT siblings of a core before the next core
+    SPREAD_NUMA = 3  # the NUMA nodes take turns
+
+
+class MineStatsC(ctypes.Structure):
+    """Counters of one worker thread or of all, see `MiningJobC.telemetry`."""
+
+    _fields_ = [('nonces_hashed', ctypes.c_uint64),
+                ('kernel_calls', ctypes.c_uint64),
+                ('kernel_cycles', ctypes.c_uint64),  # rdtsc, in the kernels
+                ('loop_cycles', ctypes.c_uint64),  # rdtsc, around them
+                ('idle_lanes', ctypes.c_uint64)]  # lanes hashed for nothing
+
+
+class MineShareC(ctypes.Structure):
+    """One nonce below the share target, see `MiningJobC.drain_shares`."""
+
+    _fields_ = [('nonce', ctypes.c_uint64),
+                ('extranonce', ctypes.c_uint64),  # 0 without extranonce
+                ('epoch', ctypes.c_uint32),  # 0, then +1 for each replace
+                ('id', ctypes.c_ubyte * 32)]
+
+
+class MineNonceLayoutC(ctypes.Structure):
+    """Where the nonce and the extranonce sit, see `MiningJobC`.
+
+    The nonce is `nonce_bytes` (1 to 8) wide at `nonce_offset` of the
+    whole message, the extranonce `extranonce_bytes` (0 for none, up to
+    8) wide at `extranonce_offset`, counting up from `extranonce_start`
+    once all the nonces are hashed. Both are given as field values.
+    """
+
+    _fields_ = [('nonce_offset', ctypes.c_uint64),
+                ('extranonce_offset', ctypes.c_uint64),
+                ('extranonce_start', ctypes.c_uint64),
+                ('nonce_bytes', ctypes.c_uint32),
+                ('extranonce_bytes', ctypes.c_uint32),
+                ('nonce_big_endian', ctypes.c_uint8),
+                ('extranonce_big_endian', ctypes.c_uint8)]
+
+
+# gaps kept by a checkpoint, see mine_xcoin.h
+MINE_CHECKPOINT_MAX_GAPS = 32
+
+
+class MineCheckpointC(ctypes.Structure):
+    """Where a job ended, to carry on from, see `MiningJobC.checkpoint`.
+
+    Plain bytes, `bytes(checkpoint)` saves it and
+    `MineCheckpointC.from_buffer_copy` reads it back.
+    """
+
+    _fields_ = [('fingerprint', ctypes.c_ubyte * 32),
+                ('extranonce', ctypes.c_uint64),
+                ('frontier', ctypes.c_uint64),
+                ('gaps', ctypes.c_uint64 * (2 * MINE_CHECKPOINT_MAX_GAPS)),
+                ('num_gaps', ctypes.c_uint32),
+                ('has_best', ctypes.c_uint32),
+                ('best_id', ctypes.c_ubyte * 32),
+                ('best_nonce', ctypes.c_uint64),
+                ('best_extranonce', ctypes.c_uint64)]
+
+
+class Sha256StreamC(ctypes.Structure):
+    """State of a streaming SHA256 between updates, see `Sha256C`."""
+
+    _fields_ = [('state', ctypes.c_uint32 * 8),
+                ('total_len', ctypes.c_uint64),
+                ('partial_block', ctypes.c_ubyte * 64)]
+
+
+class Sha256HashCtxC(ctypes.Structure):
+    """SHA256_HASH_CTX of Intel/sha256_mb.h, see `sha256_many_c`.
+
+    64-byte aligned in C, so only ever placed at such an address.
+    """
+
+    _fields_ = [('job_buffer', ctypes.c_void_p),
+                ('job_len', ctypes.c_uint64),  # in blocks
+                ('_job_align', ctypes.c_ubyte * 48),
+                ('digest', ctypes.c_uint32 * 8),  # state words, native order
+                ('job_status', ctypes.c_int32),
+                ('job_user_data', ctypes.c_void_p),
+                ('_ctx_align', ctypes.c_ubyte * 16),
+                ('status', ctypes.c_int32),
+                ('error', ctypes.c_int32),
+                ('total_length', ctypes.c_uint64),
+                ('incoming_buffer', ctypes.c_void_p),
+                ('incoming_buffer_length', ctypes.c_uint32),
+                ('partial_block_buffer', ctypes.c_ubyte * 128),
+                ('partial_block_buffer_length', ctypes.c_uint32),
+                ('user_data', ctypes.c_void_p),
+                ('_tail_align', ctypes.c_ubyte * 24)]
+
+
+# bytes of SHA256_HASH_CTX_MGR, kept opaque, and the flags and status used
+SHA256_HASH_CTX_MGR_SIZE = 848
+HASH_ENTIRE = 3
+HASH_CTX_STS_COMPLETE = 4
 
 
 # current applicaiton folder
@@ -90,6 +200,505 @@ mine_xcoin.argtypes = [
     ctypes.POINTER(ctypes.c_ubyte), ctypes.POINTER(ctypes.c_uint32)]
 mine_xcoin.restype = ctypes.c_bool
 
+# asynchronous job API, see mine_xcoin.h
+mylib.mine_xcoin_start.argtypes = [
+    ctypes.POINTER(ctypes.c_ubyte), ctypes.POINTER(ctypes.c_ubyte),
+    ctypes.c_uint64, ctypes.c_ubyte, ctypes.c_double, ctypes.c_uint32,
+    ctypes.POINTER(ctypes.c_ubyte), ctypes.POINTER(MineNonceLayoutC),
+    ctypes.POINTER(MineCheckpointC)]
+mylib.mine_xcoin_start.restype = ctypes.c_void_p
+mylib.mine_xcoin_poll.argtypes = [ctypes.c_void_p]
+mylib.mine_xcoin_poll.restype = ctypes.c_int32
+mylib.mine_xcoin_wait.argtypes = [ctypes.c_void_p, ctypes.c_double]
+mylib.mine_xcoin_wait.restype = ctypes.c_int32
+mylib.mine_xcoin_cancel.argtypes = [ctypes.c_void_p]
+mylib.mine_xcoin_cancel.restype = None
+mylib.mine_xcoin_set_deadline.argtypes = [ctypes.c_void_p, ctypes.c_double]
+mylib.mine_xcoin_set_deadline.restype = ctypes.c_bool
+mylib.mine_xcoin_replace.argtypes = [
+    ctypes.c_void_p, ctypes.POINTER(ctypes.c_ubyte),
+    ctypes.POINTER(ctypes.c_ubyte), ctypes.c_uint64,
+    ctypes.POINTER(ctypes.c_ubyte), ctypes.POINTER(MineNonceLayoutC)]
+mylib.mine_xcoin_replace.restype = ctypes.c_bool
+mylib.mine_xcoin_drain_shares.argtypes = [
+    ctypes.c_void_p, ctypes.POINTER(MineShareC), ctypes.c_uint32,
+    ctypes.POINTER(ctypes.c_uint64)]
+mylib.mine_xcoin_drain_shares.restype = ctypes.c_uint32
+mylib.mine_xcoin_set_workers.argtypes = [ctypes.c_void_p, ctypes.c_uint32]
+mylib.mine_xcoin_set_workers.restype = ctypes.c_uint32
+mylib.mine_xcoin_coverage.argtypes = [
+    ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint64),
+    ctypes.POINTER(ctypes.c_uint64), ctypes.c_uint32,
+    ctypes.POINTER(ctypes.c_uint32)]
+mylib.mine_xcoin_coverage.restype = ctypes.c_bool
+mylib.mine_xcoin_telemetry.argtypes = [
+    ctypes.c_void_p, ctypes.POINTER(MineStatsC), ctypes.POINTER(MineStatsC),
+    ctypes.c_uint32, ctypes.POINTER(ctypes.c_double)]
+mylib.mine_xcoin_telemetry.restype = ctypes.c_uint32
+mylib.mine_xcoin_result.argtypes = [
+    ctypes.c_void_p, ctypes.POINTER(ctypes.c_ubyte),
+    ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_ubyte),
+    ctypes.POINTER(ctypes.c_uint32), ctypes.POINTER(ctypes.c_uint32),
+    ctypes.POINTER(ctypes.c_uint32)]
+mylib.mine_xcoin_result.restype = ctypes.c_bool
+mylib.mine_xcoin_best.argtypes = [
+    ctypes.c_void_p, ctypes.POINTER(ctypes.c_ubyte),
+    ctypes.POINTER(ctypes.c_uint64), ctypes.POINTER(ctypes.c_uint64)]
+mylib.mine_xcoin_best.restype = ctypes.c_bool
+mylib.mine_xcoin_checkpoint.argtypes = [
+    ctypes.c_void_p, ctypes.POINTER(MineCheckpointC)]
+mylib.mine_xcoin_checkpoint.restype = ctypes.c_bool
+mylib.mine_xcoin_extranonce.argtypes = [
+    ctypes.c_void_p, ctypes.POINTER(ctypes.c_uint64)]
+mylib.mine_xcoin_extranonce.restype = ctypes.c_bool
+mylib.mine_xcoin_free.argtypes = [ctypes.c_void_p]
+mylib.mine_xcoin_free.restype = None
+
+# worker threads of the following jobs
+mylib.mine_xcoin_set_threads.argtypes = [
+    ctypes.c_uint32, ctypes.POINTER(ctypes.c_int32), ctypes.c_uint32,
+    ctypes.c_ubyte]
+mylib.mine_xcoin_set_threads.restype = ctypes.c_bool
+
+# kernel profile for PreferredAccelerationInC.AUTO
+mylib.mine_xcoin_calibrate.argtypes = [ctypes.c_char_p, ctypes.c_double]
+mylib.mine_xcoin_calibrate.restype = ctypes.c_bool
+mylib.mine_xcoin_load_profile.argtypes = [ctypes.c_char_p]
+mylib.mine_xcoin_load_profile.restype = ctypes.c_bool
+mylib.sha256_acceleration_supported.argtypes = [ctypes.c_ubyte]
+mylib.sha256_acceleration_supported.restype = ctypes.c_bool
+
+# streaming SHA256
+mylib.sha256_stream_init.argtypes = [ctypes.POINTER(Sha256StreamC)]
+mylib.sha256_stream_init.restype = None
+mylib.sha256_stream_update.argtypes = [
+    ctypes.POINTER(Sha256StreamC), ctypes.c_char_p, ctypes.c_uint64]
+mylib.sha256_stream_update.restype = None
+mylib.sha256_stream_final.argtypes = [
+    ctypes.POINTER(Sha256StreamC), ctypes.c_ubyte * 32]
+mylib.sha256_stream_final.restype = None
+
+# tree digest of one large buffer
+mylib.sha256_multihash.argtypes = [
+    ctypes.c_char_p, ctypes.c_uint64, ctypes.c_ubyte, ctypes.c_uint32,
+    ctypes.c_ubyte * 32]
+mylib.sha256_multihash.restype = ctypes.c_ubyte
+
+# Merkle root of 32-byte leaves
+mylib.sha256_merkle_root.argtypes = [
+    ctypes.c_char_p, ctypes.c_uint64, ctypes.c_uint32, ctypes.c_ubyte,
+    ctypes.c_uint32, ctypes.c_ubyte * 32]
+mylib.sha256_merkle_root.restype = ctypes.c_bool
+
+# many files at once
+mylib.sha256_files.argtypes = [
+    ctypes.POINTER(ctypes.c_char_p), ctypes.c_uint32, ctypes.c_uint32,
+    ctypes.POINTER(ctypes.c_ubyte), ctypes.POINTER(ctypes.c_int32)]
+mylib.sha256_files.restype = ctypes.c_uint32
+
+# multi-buffer context manager of Intel/sha256_mb.h
+mylib.sha256_ctx_mgr_init.argtypes = [ctypes.c_void_p]
+mylib.sha256_ctx_mgr_init.restype = None
+mylib.sha256_ctx_mgr_submit.argtypes = [
+    ctypes.c_void_p, ctypes.POINTER(Sha256HashCtxC), ctypes.c_char_p,
+    ctypes.c_uint32, ctypes.c_int]
+mylib.sha256_ctx_mgr_submit.restype = ctypes.POINTER(Sha256HashCtxC)
+mylib.sha256_ctx_mgr_flush.argtypes = [ctypes.c_void_p]
+mylib.sha256_ctx_mgr_flush.restype = ctypes.POINTER(Sha256HashCtxC)
+
+
+def calibrate_c(profile_path: Union[str, None],
+                seconds_per_run: float = 0.5) -> bool:
+    """Time every supported acceleration on this host, used by AUTO.
+
+    Saves the profile to `profile_path` unless it is None, and returns
+    False if it could not be saved. Takes about 2 * 8 * `seconds_per_run`.
+    """
+    path = None if profile_path is None else os.fsencode(profile_path)
+    return bool(mylib.mine_xcoin_calibrate(
+        path, (ctypes.c_double)(seconds_per_run)))
+
+
+def load_profile_c(profile_path: str) -> bool:
+    """Load a profile saved by `calibrate_c`, False if missing or stale."""
+    return bool(mylib.mine_xcoin_load_profile(os.fsencode(profile_path)))
+
+
+def acceleration_supported_c(accel: PreferredAccelerationInC) -> bool:
+    """Whether this CPU has the instructions of `accel`.
+
+    The environment variable SHA256_ACCELERATION, read when the library
+    is loaded, forces what AUTO picks, e.g. SHA256_ACCELERATION=AVX2,
+    and falls back as usual if this returns False for it.
+    """
+    return bool(mylib.sha256_acceleration_supported(
+        (ctypes.c_ubyte)(accel.value)))
+
+
+def set_threads_c(num_threads: int = 0,
+                  cpus: Union[List[int], None] = None,
+                  placement: PlacementInC = PlacementInC.OS) -> bool:
+    """Replace the worker threads used by the following jobs.
+
+    `num_threads` 0 is one thread per physical core for PHYSICAL_CORES,
+    and one per logical CPU otherwise. `cpus` restricts the threads to
+    those logical CPUs. Returns False, threads unchanged, if none is usable.
+    """
+    cpu_list = [] if cpus is None else list(cpus)
+    cpu_arr = (ctypes.c_int32 * max(1, len(cpu_list)))(*cpu_list)
+    return bool(mylib.mine_xcoin_set_threads(
+        (ctypes.c_uint32)(num_threads), cpu_arr,
+        (ctypes.c_uint32)(len(cpu_list)),
+        (ctypes.c_ubyte)(placement.value)))
+
+
+class Sha256C:
+    """SHA256 of a message given in pieces, as `hashlib.sha256`.
+
+    Hashed by the C library, with SHA-NI where the CPU has it.
+    """
+
+    def __init__(self, data: bytes = b''):
+        self._stream = Sha256StreamC()
+        mylib.sha256_stream_init(ctypes.byref(self._stream))
+        if data:
+            self.update(data)
+
+    def update(self, data: bytes) -> None:
+        """Hash on with `data`, of any length."""
+        data = bytes(data)
+        mylib.sha256_stream_update(ctypes.byref(self._stream), data, len(data))
+
+    def copy(self) -> 'Sha256C':
+        """A copy that hashes on from the data so far."""
+        other = Sha256C.__new__(Sha256C)
+        other._stream = Sha256StreamC.from_buffer_copy(self._stream)
+        return other
+
+    def digest(self) -> bytes:
+        """The digest of the data so far, more updates can follow."""
+        digest_arr = (ctypes.c_ubyte * 32)(0)
+        stream = Sha256StreamC.from_buffer_copy(self._stream)
+        mylib.sha256_stream_final(ctypes.byref(stream), digest_arr)
+        return bytes(digest_arr)
+
+
+def multihash_c(data: bytes,
+                preferred_accel: PreferredAccelerationInC =
+                PreferredAccelerationInC.AUTO,
+                num_threads: int = 0) -> bytes:
+    """Tree digest of one large buffer, hashed across lanes and cores.
+
+    Not the SHA256 of `data`: 4 KiB stripe i goes to segment i % 256,
+    each segment is hashed with SHA256, and the digest is the SHA256 of
+    the 256 segment digests followed by len(data), 8 bytes little endian.
+    It does not depend on the acceleration nor on `num_threads`, 0 being
+    all the worker threads of `set_threads_c`. A call keeps at most
+    256 / lanes threads busy, as each segment is hashed in order.
+    """
+    data = bytes(data)
+    digest_arr = (ctypes.c_ubyte * 32)(0)
+    mylib.sha256_multihash(data, len(data),
+                           (ctypes.c_ubyte)(preferred_accel.value),
+                           (ctypes.c_uint32)(num_threads), digest_arr)
+    return bytes(digest_arr)
+
+
+def merkle_root_c(leaves: List[bytes], double_sha256: bool = True,
+                  preferred_accel: PreferredAccelerationInC =
+                  PreferredAccelerationInC.AUTO,
+                  num_threads: int = 0) -> bytes:
+    """Merkle root of 32-byte leaves, an odd last node paired with itself.
+
+    With `double_sha256` the nodes are hashed with sha256d, as in Bitcoin,
+    where the leaves are the transaction IDs in internal byte order (the
+    reverse of the hex shown by block explorers), and so is the root.
+    """
+    if not leaves or any(len(leaf) != 32 for leaf in leaves):
+        raise ValueError('one or more leaves of 32 bytes are needed')
+    root_arr = (ctypes.c_ubyte * 32)(0)
+    mylib.sha256_merkle_root(
+        b''.join(leaves), len(leaves),
+        MINE_FLAG_SHA256D if double_sha256 else 0,
+        (ctypes.c_ubyte)(preferred_accel.value),
+        (ctypes.c_uint32)(num_threads), root_arr)
+    return bytes(root_arr)
+
+
+def sha256_files_c(paths: List[str],
+                   num_threads: int = 0) -> List[Optional[bytes]]:
+    """SHA256 digests of many files, hashed at once, one file per lane.
+
+    The files are mapped into memory and read ahead while hashed, by
+    up to `num_threads` of the worker threads, 0 being all of them (see
+    set_threads_c). The digest of a file that cannot be read is None.
+    """
+    num_paths = len(paths)
+    path_arr = (ctypes.c_char_p * max(1, num_paths))(
+        *[os.fsencode(p) for p in paths])
+    digest_arr = (ctypes.c_ubyte * (32 * max(1, num_paths)))()
+    error_arr = (ctypes.c_int32 * max(1, num_paths))()
+    mylib.sha256_files(path_arr, num_paths, (ctypes.c_uint32)(num_threads),
+                       digest_arr, error_arr)
+    return [None if error_arr[i] != 0
+            else bytes(digest_arr[32 * i:32 * (i + 1)])
+            for i in range(num_paths)]
+
+
+def sha256_many_c(messages: List[bytes]) -> List[bytes]:
+    """SHA256 digests of many independent messages of any length.
+
+    The messages go through the lanes of the multi-buffer context manager
+    on the widest vector functions of the CPU, and complete out of order;
+    the digests are given back in the order of `messages`.
+    """
+    if any(len(m) >= 2**32 for m in messages):
+        raise ValueError('messages are limited to 4 GiB each')
+    size = ctypes.sizeof(Sha256HashCtxC)
+    raw = ctypes.create_string_buffer(len(messages) * size + 64)
+    ctxs = (Sha256HashCtxC * len(messages)).from_buffer(
+        raw, -ctypes.addressof(raw) % 64)
+    mgr = ctypes.create_string_buffer(SHA256_HASH_CTX_MGR_SIZE)
+    mylib.sha256_ctx_mgr_init(mgr)
+
+    digests: List[bytes] = [b''] * len(messages)
+
+    def collect(ctx) -> None:
+        if ctx:
+            i = (ctypes.addressof(ctx.contents) - ctypes.addressof(ctxs)) \
+                // size
+            digests[i] = b''.join(
+                w.to_bytes(4, 'big') for w in ctxs[i].digest)
+
+    for i, message in enumerate(messages):
+        ctxs[i].status = HASH_CTX_STS_COMPLETE  # hash_ctx_init
+        ctxs[i].error = 0
+        collect(mylib.sha256_ctx_mgr_submit(
+            mgr, ctypes.byref(ctxs[i]), message, len(message), HASH_ENTIRE))
+    while True:
+        ctx = mylib.sha256_ctx_mgr_flush(mgr)
+        if not ctx:
+            return digests
+        collect(ctx)
+
+
+# mode flags of mine_xcoin_start, see mine_xcoin.h
+MINE_FLAG_SHA256D = 1
+
+
+class MineJobStatusInC(Enum):
+    """State of an asynchronous mining job."""
+
+    RUNNING = 0
+    FOUND = 1
+    NOT_FOUND = 2
+
+
+def _target_array(difficulty: int):
+    """Convert a difficulty into the big endian target the C functions take."""
+    target = min(2 ** 256 // difficulty, 2**256 - 1)
+    return (ctypes.c_ubyte * 32)(*target.to_bytes
+                                 (32, byteorder='big', signed=False))
+
+
+class MiningJobC:
+    """Asynchronous mining job, hashing on the C library worker threads.
+
+    Only one job hashes at a time, so swap the work of a running job with
+    `replace` rather than starting another one.
+
+    Parameters
+    ----------
+    partial_bytes : bytes
+        The bytes where append nonce and apply SHA-256 becomes block ID.
+    difficulty : int
+        The difficulty.
+    preferred_accel : PreferredAccelerationInC
+        The preferred acceleration, see enum class `PreferredAccelerationInC`.
+    timeout : float
+        Seconds from now to give up mining if still no success.
+    double_sha256 : bool
+        The block ID is SHA-256 applied twice (sha256d), as in Bitcoin.
+    share_difficulty : int
+        Keep every nonce meeting this easier difficulty, 0 for none, see
+        `drain_shares`.
+    layout : MineNonceLayoutC
+        Where the nonce and the extranonce are in `partial_bytes`, then the
+        whole message, or None to append an 8-byte little endian nonce.
+    resume : MineCheckpointC
+        The checkpoint of an earlier job on the same message, layout and
+        sha256d setting, whose hashed nonces are skipped, or None.
+    """
+
+    def __init__(self, *, partial_bytes: bytes, difficulty: int,
+                 preferred_accel: PreferredAccelerationInC, timeout: float,
+                 double_sha256: bool = False, share_difficulty: int = 0,
+                 layout: Optional[MineNonceLayoutC] = None,
+                 resume: Optional[MineCheckpointC] = None):
+        """Start the job, returns without waiting."""
+        msg = (ctypes.c_ubyte * len(partial_bytes))(*partial_bytes)
+        self._job = mylib.mine_xcoin_start(
+            _target_array(difficulty), msg,
+            (ctypes.c_uint64)(len(partial_bytes)),
+            (ctypes.c_ubyte)(preferred_accel.value),
+            (ctypes.c_double)(timeout),
+            (ctypes.c_uint32)(MINE_FLAG_SHA256D if double_sha256 else 0),
+            _target_array(share_difficulty) if share_difficulty else None,
+            layout, resume)
+        if self._job is None:
+            raise ValueError('the nonce layout does not fit the message, '
+                             'or the checkpoint is of another one')
+
+    def poll(self) -> MineJobStatusInC:
+        """Return the state of the job without waiting."""
+        return MineJobStatusInC(mylib.mine_xcoin_poll(self._job))
+
+    def wait(self, timeout: float = -1.0) -> MineJobStatusInC:
+        """Wait up to `timeout` seconds, forever if negative, for the end."""
+        return MineJobStatusInC(mylib.mine_xcoin_wait(
+            self._job, (ctypes.c_double)(timeout)))
+
+    def cancel(self) -> None:
+        """Ask the workers to stop, returns without waiting."""
+        mylib.mine_xcoin_cancel(self._job)
+
+    def set_deadline(self, timeout: float) -> bool:
+        """Time out `timeout` seconds from now, False if already ended."""
+        return bool(mylib.mine_xcoin_set_deadline(
+            self._job, (ctypes.c_double)(timeout)))
+
+    def replace(self, *, partial_bytes: bytes, difficulty: int,
+                share_difficulty: int = 0,
+                layout: Optional[MineNonceLayoutC] = None) -> bool:
+        """Swap in new work, returns False if the job had already ended.
+
+        Or if the layout does not fit the message.
+        """
+        msg = (ctypes.c_ubyte * len(partial_bytes))(*partial_bytes)
+        return bool(mylib.mine_xcoin_replace(
+            self._job, _target_array(difficulty), msg,
+            (ctypes.c_uint64)(len(partial_bytes)),
+            _target_array(share_difficulty) if share_difficulty else None,
+            layout))
+
+    def drain_shares(self, max_shares: int = 1024) \
+            -> Tuple[List[Tuple[int, int, bytes, int]], int]:
+        """Take the shares found so far, without waiting.
+
+        Returns (epoch, nonce, block ID, extranonce) for each, oldest
+        first, and the number of shares dropped since the start for want
+        of draining.
+        """
+        shares = (MineShareC * max_shares)()
+        dropped = (ctypes.c_uint64 * 1)(0)
+        count = mylib.mine_xcoin_drain_shares(self._job, shares, max_shares,
+                                              dropped)
+        return ([(int(s.epoch), int(s.nonce), bytes(s.id),
+                  int(s.extranonce)) for s in shares[:count]],
+                int(dropped[0]))
+
+    def set_workers(self, num_active: int) -> int:
+        """Hash on the first `num_active` threads only, returns the count."""
+        return int(mylib.mine_xcoin_set_workers(
+            self._job, (ctypes.c_uint32)(num_active)))
+
+    def coverage(self) -> Union[Tuple[int, List[Tuple[int, int]]],
+                                Tuple[None, None]]:
+        """Return the nonces hashed, once the job has ended, else None.
+
+        All nonces below the frontier, 2**64 - 1 if all were handed
+        out, except the (first nonce, count) gaps.
+        """
+        frontier = (ctypes.c_uint64 * 1)(0)
+        num_gaps = (ctypes.c_uint32 * 1)(0)
+        empty = (ctypes.c_uint64 * 2)(0)
+        if not mylib.mine_xcoin_coverage(self._job, frontier, empty, 0,
+                                         num_gaps):
+            return (None, None)
+        gaps = (ctypes.c_uint64 * max(2, 2 * num_gaps[0]))(0)
+        mylib.mine_xcoin_coverage(self._job, frontier, gaps, num_gaps[0],
+                                  num_gaps)
+        return (int(frontier[0]), [(int(gaps[2 * i]), int(gaps[2 * i + 1]))
+                                   for i in range(num_gaps[0])])
+
+    def telemetry(self) -> Tuple[float, MineStatsC, List[MineStatsC]]:
+        """Return the seconds elapsed, the total and the per thread counters.
+
+        Can be called while the job runs, the hash rate is
+        `total.nonces_hashed / elapsed`.
+        """
+        total = MineStatsC()
+        elapsed = (ctypes.c_double * 1)(0.0)
+        num_threads = mylib.mine_xcoin_telemetry(self._job, total, None, 0,
+                                                 elapsed)
+        per_thread = (MineStatsC * num_threads)()
+        mylib.mine_xcoin_telemetry(self._job, total, per_thread, num_threads,
+                                   elapsed)
+        return (float(elapsed[0]), total, list(per_thread))
+
+    def result(self) -> Union[Tuple[bytes, int], Tuple[None, None]]:
+        """Return block ID and nonce if the job found one, else None."""
+        results_arr = (ctypes.c_ubyte * 32)(0)
+        nonce_arr = (ctypes.c_uint64 * 1)(0)
+        if mylib.mine_xcoin_result(self._job, results_arr, nonce_arr,
+                                   *self._diagnostics_arrays()):
+            return (ctypes.string_at(results_arr, 32), int(nonce_arr[0]))
+        return (None, None)
+
+    def best(self) -> Union[Tuple[bytes, int, int], Tuple[None, None, None]]:
+        """Return the lowest block ID so far, its nonce and extranonce.
+
+        Of the work since the last `replace`, None before the first hash.
+        """
+        best_arr = (ctypes.c_ubyte * 32)(0)
+        nonce_arr = (ctypes.c_uint64 * 1)(0)
+        extranonce_arr = (ctypes.c_uint64 * 1)(0)
+        if mylib.mine_xcoin_best(self._job, best_arr, nonce_arr,
+                                 extranonce_arr):
+            return (ctypes.string_at(best_arr, 32), int(nonce_arr[0]),
+                    int(extranonce_arr[0]))
+        return (None, None, None)
+
+    def checkpoint(self) -> Optional[MineCheckpointC]:
+        """Return where the job ended, for `resume`, None while running."""
+        checkpoint = MineCheckpointC()
+        if mylib.mine_xcoin_checkpoint(self._job, checkpoint):
+            return checkpoint
+        return None
+
+    def extranonce(self) -> int:
+        """Return the extranonce of the winner, or else the current one."""
+        extranonce_arr = (ctypes.c_uint64 * 1)(0)
+        mylib.mine_xcoin_extranonce(self._job, extranonce_arr)
+        return int(extranonce_arr[0])
+
+    def topology(self) -> Tuple[int, int, int]:
+        """Return the threads, physical cores and NUMA nodes of the job."""
+        arrays = self._diagnostics_arrays()
+        mylib.mine_xcoin_result(self._job, (ctypes.c_ubyte * 32)(0),
+                                (ctypes.c_uint64 * 1)(0), *arrays)
+        return (int(arrays[1][0]), int(arrays[2][0]), int(arrays[3][0]))
+
+    @staticmethod
+    def _diagnostics_arrays():
+        """Acceleration, threads, cores and nodes out arrays."""
+        return ((ctypes.c_ubyte * 1)(0), (ctypes.c_uint32 * 1)(0),
+                (ctypes.c_uint32 * 1)(0), (ctypes.c_uint32 * 1)(0))
+
+    def close(self) -> None:
+        """Cancel the job if still running and release it."""
+        if self._job is not None:
+            mylib.mine_xcoin_free(self._job)
+            self._job = None
+
+    def __enter__(self):
+        """Use as a context manager, closed on exit."""
+        return self
+
+    def __exit__(self, *exc):
+        """Close the job."""
+        self.close()
+
 
 def search_block_id_c(
     *,
@@ -124,12 +733,8 @@ def search_block_id_c(
                          and time used in seconds
     (None, None, None): if search failed
     """
-    target = min(2 ** 256 // difficulty, 2**256 - 1)
-
     # inputs
-    target_arr = \
-        (ctypes.c_ubyte * 32)(*target.to_bytes
-                              (32, byteorder='big', signed=False))
+    target_arr = _target_array(difficulty)
     msg = (ctypes.c_ubyte * len(partial_bytes))(*partial_bytes)
     # results
     results_arr = (ctypes.c_ubyte * 32)(0)
@@ -162,7 +767,9 @@ def search_block_id_c(
 
         print(f"\n\nNumber of threads used: {int(num_threads_used[0])}\n")
         accel_method = ['AVX 512', 'SHA', 'AVX2', 'AVX', 'SSE 4.1',
-                        'No x64 instruction set extension used']
+                        'No x64 instruction set extension used',
+                        'SHA x4 interleaved', 'SHA x2 interleaved',
+                        'AVX 512 on 256-bit registers']
         print(f"Acceleration used: {accel_method[int(accel_used[0])]}\n")
 
         return (results, nonce, seconds_used)